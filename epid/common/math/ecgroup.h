@@ -93,6 +93,71 @@ EpidStatus NewEcGroup(FiniteField const* ff, FfElement const* a,
 */
 void DeleteEcGroup(EcGroup** g);
 
+/// Sets the endomorphism of an elliptic curve group that splits powers.
+/*!
+
+ On a curve y^2 = x^3 + b over a prime field the map (x, y) -> (beta*x, y)
+ raises every point of prime order to the power lambda. Once it is set,
+ exponentiations in the group split each power into two halves of half
+ the size that share their doublings.
+
+ \param[in,out] g
+ The elliptic curve group. Must be of prime order.
+ \param[in] beta
+ A cube root of unity in the finite field of the curve.
+ \param[in] lambda
+ The matching cube root of unity modulo the order of the group.
+
+ \returns ::EpidStatus
+
+ \retval ::kEpidBadArgErr
+ beta and lambda do not describe an endomorphism of the group
+
+ \attention The endomorphism must be set before the group is shared by
+ several threads.
+
+ \see NewEcGroup
+*/
+EpidStatus EcSetEndomorphism(EcGroup* g, FfElement const* beta,
+                             BigNumStr const* lambda);
+
+/// Sets the Frobenius endomorphism of the twist of a BN curve.
+/*!
+
+ On the sextic twist over Fq^2 of a BN curve of parameter t the map
+ (x, y) -> (conj(x)*frob_x, conj(y)*frob_y) raises every point of the
+ prime order to the power 6*t^2. Once it is set, exponentiations in the
+ group split each power into four quarters of a quarter of the size that
+ share their doublings, and membership checks test for the prime order
+ subgroup with a power of t instead of a power of the order.
+
+ \param[in,out] g
+ The elliptic curve group. Must be the twist over Fq^2 of a BN curve,
+ with the subgroup of the prime order and the matching cofactor.
+ \param[in] frob_x
+ The element of Fq^2 that the conjugate of x is multiplied by.
+ \param[in] frob_y
+ The element of Fq^2 that the conjugate of y is multiplied by.
+ \param[in] t
+ The absolute value of the parameter of the BN curve.
+ \param[in] neg
+ The sign of the parameter of the BN curve, true if negative.
+
+ \returns ::EpidStatus
+
+ \retval ::kEpidBadArgErr
+ the arguments do not describe the Frobenius endomorphism of the group
+
+ \attention The endomorphism must be set before the group is shared by
+ several threads. Exponentiations are only correct for points in the
+ subgroup of the prime order.
+
+ \see NewEcGroup
+*/
+EpidStatus EcSetFrobenius(EcGroup* g, FfElement const* frob_x,
+                          FfElement const* frob_y, BigNumStr const* t,
+                          bool neg);
+
 /// Point on elliptic curve over finite field.
 typedef struct EcPoint EcPoint;
 
@@ -129,6 +194,49 @@ EpidStatus NewEcPoint(EcGroup const* g, EcPoint** p);
 */
 void DeleteEcPoint(EcPoint** p);
 
+/// Gets the size of memory needed to place an EcPoint.
+/*!
+ \param[in] g
+ Elliptic curve group.
+ \param[out] size
+ The number of bytes InitEcPoint needs.
+
+ \returns ::EpidStatus
+
+ \see InitEcPoint
+*/
+EpidStatus EcPointGetSize(EcGroup const* g, size_t* size);
+
+/// Creates a new EcPoint in caller provided memory.
+/*!
+ Same as NewEcPoint, but places the point in mem instead of allocating
+ it, so that temporaries can live in a stack buffer or share a single
+ allocation. The point holds no other resources.
+
+ Do not call DeleteEcPoint() on the point. It is valid as long as mem
+ is.
+
+ \param[in] g
+ Elliptic curve group.
+ \param[in] mem
+ The memory to place the point in. Needs no particular alignment.
+ \param[in] mem_size
+ The size of mem in bytes. Must be at least the size given by
+ EcPointGetSize().
+ \param[out] p
+ Newly constructed point on the elliptic curve group g.
+
+ \returns ::EpidStatus
+
+ \attention It is the responsibility of the caller to ensure that g exists
+ for the entire lifetime of the new EcPoint.
+
+ \see EcPointGetSize
+ \see NewEcPoint
+*/
+EpidStatus InitEcPoint(EcGroup const* g, void* mem, size_t mem_size,
+                       EcPoint** p);
+
 /// Deserializes an EcPoint from a string.
 /*!
  \param[in] g
@@ -165,6 +273,31 @@ EpidStatus ReadEcPoint(EcGroup* g, ConstOctStr p_str, size_t strlen,
 EpidStatus WriteEcPoint(EcGroup* g, EcPoint const* p, OctStr p_str,
                         size_t strlen);
 
+/// Serializes several EcPoints to strings.
+/*!
+ Produces the same output as calling WriteEcPoint on each point, but
+ converts all points to affine coordinates with a single field
+ inversion.
+
+ \param[in] g
+ The elliptic curve group.
+ \param[in] p
+ The array of EcPoints to be serialized.
+ \param[in] m
+ The number of points.
+ \param[out] p_str
+ The array of m target strings.
+ \param[in] strlen
+ the size of each target string in bytes.
+
+ \returns ::EpidStatus
+
+ \see NewEcPoint
+ \see WriteEcPoint
+*/
+EpidStatus WriteEcPoints(EcGroup* g, EcPoint const** p, size_t m,
+                         OctStr const* p_str, size_t strlen);
+
 /// Multiplies two elements in an elliptic curve group.
 /*!
  This multiplication operation is also known as element addition for
@@ -207,6 +340,30 @@ EpidStatus EcMul(EcGroup* g, EcPoint const* a, EcPoint const* b, EcPoint* r);
 */
 EpidStatus EcExp(EcGroup* g, EcPoint const* a, BigNumStr const* b, EcPoint* r);
 
+/// Raises a point in an elliptic curve group to a power in a prime field.
+/*!
+ Same as EcExp, but takes the power as an element of the prime field
+ whose order is the order of the group, so that it does not have to be
+ serialized first. Like EcExp, it is side channel mitigated.
+
+ \param[in] g
+ The elliptic curve group.
+ \param[in] a
+ The base.
+ \param[in] fp
+ The prime field of the power.
+ \param[in] b
+ The power.
+ \param[out] r
+ The result of raising a to the power b.
+
+ \returns ::EpidStatus
+
+ \see EcExp
+*/
+EpidStatus EcExpFp(EcGroup* g, EcPoint const* a, FiniteField* fp,
+                   FfElement const* b, EcPoint* r);
+
 /// Software side-channel mitigated implementation of EcExp.
 /*!
  This exponentiation operation is also known as element multiplication
@@ -240,9 +397,18 @@ EpidStatus EcSscmExp(EcGroup* g, EcPoint const* a, BigNumStr const* b,
 /// Multi-exponentiates elements in elliptic curve group.
 /*!
  Takes a group elements a[0], ... , a[m-1] in G and positive
- integers b[0], ..., b[m-1], where m is a small positive integer.
+ integers b[0], ..., b[m-1], where m is a positive integer.
  Outputs r (in G) = EcExp(a[0],b[0]) * ... * EcExp(a[m-1],b[m-1]).
 
+ All terms share one series of point doublings. A few terms are
+ combined with interleaved signed windows, many terms with the bucket
+ method.
+
+ \attention
+ The operations depend on the powers, so this function is not side
+ channel mitigated and must only be used with public powers. Use
+ EcSscmMultiExp for secret powers.
+
  \param[in] g
  The elliptic curve group.
  \param[in] a
@@ -267,9 +433,13 @@ EpidStatus EcMultiExp(EcGroup* g, EcPoint const** a, BigNumStr const** b,
 /// Multi-exponentiates elements in elliptic curve group.
 /*!
 Takes a group elements a[0], ... , a[m-1] in G and positive
-integers b[0], ..., b[m-1], where m is a small positive integer.
+integers b[0], ..., b[m-1], where m is a positive integer.
 Outputs r (in G) = EcExp(a[0],b[0]) * ... * EcExp(a[m-1],b[m-1]).
 
+\attention
+Like EcMultiExp, this function is not side channel mitigated and must
+only be used with public powers.
+
 \param[in] g
 The elliptic curve group.
 \param[in] a
@@ -291,6 +461,37 @@ the results.
 EpidStatus EcMultiExpBn(EcGroup* g, EcPoint const** a, BigNum const** b,
                         size_t m, EcPoint* r);
 
+/// Multi-exponentiates elements in elliptic curve group by prime field powers.
+/*!
+ Same as EcMultiExp, but takes the powers as elements of the prime field
+ whose order is the order of the group, so that they do not have to be
+ serialized first.
+
+ \attention
+ Like EcMultiExp, this function is not side channel mitigated and must
+ only be used with public powers.
+
+ \param[in] g
+ The elliptic curve group.
+ \param[in] a
+ The bases.
+ \param[in] fp
+ The prime field of the powers.
+ \param[in] b
+ The powers.
+ \param[in] m
+ Number of entries in a and b.
+ \param[out] r
+ The result of raising each a to the corresponding power b and multiplying
+ the results.
+
+ \returns ::EpidStatus
+
+ \see EcMultiExp
+*/
+EpidStatus EcMultiExpFp(EcGroup* g, EcPoint const** a, FiniteField* fp,
+                        FfElement const** b, size_t m, EcPoint* r);
+
 /// Software side-channel mitigated implementation of EcMultiExp.
 /*!
  Takes a group elements a[0], ... , a[m-1] in G and positive
@@ -298,9 +499,9 @@ EpidStatus EcMultiExpBn(EcGroup* g, EcPoint const** a, BigNum const** b,
  Outputs r (in G) = EcExp(a[0],b[0]) * ... * EcExp(a[m-1],b[m-1]).
 
  \attention
- The reference implementation of EcSscmMultiExp calls EcMultiExp
- directly because the implementation of EcMultiExp is already side channel
- mitigated. Implementers providing their own versions of this function are
+ The reference implementation of EcSscmMultiExp raises each base to its
+ power separately with the side channel mitigated EcExp operation.
+ Implementers providing their own versions of this function are
  responsible for ensuring that EcSscmMultiExp is side channel mitigated per
  section 8 of the Intel(R) EPID 2.0 spec.
 
@@ -325,6 +526,77 @@ EpidStatus EcMultiExpBn(EcGroup* g, EcPoint const** a, BigNum const** b,
 EpidStatus EcSscmMultiExp(EcGroup* g, EcPoint const** a, BigNumStr const** b,
                           size_t m, EcPoint* r);
 
+/// Precomputed multiples of an elliptic curve point.
+typedef struct EcPointTable EcPointTable;
+
+/// Creates a table of precomputed multiples of an elliptic curve point.
+/*!
+ Allocates memory and fills a table that allows the point to be
+ raised to any power using only point additions. Building a table
+ costs a few exponentiations, so tables pay off for points that are
+ raised to many different powers.
+
+ Use DeleteEcPointTable() to free memory.
+
+ \param[in] g
+ The elliptic curve group.
+ \param[in] a
+ The point.
+ \param[out] t
+ The newly constructed table.
+
+ \returns ::EpidStatus
+
+ \attention It is the responsibility of the caller to ensure that g exists
+ for the entire lifetime of the new EcPointTable.
+
+ \see DeleteEcPointTable
+ \see EcMultiExpTable
+*/
+EpidStatus NewEcPointTable(EcGroup* g, EcPoint const* a, EcPointTable** t);
+
+/// Deletes a table of precomputed multiples of an elliptic curve point.
+/*!
+ Frees memory pointed to by table. Nulls the pointer.
+
+ \param[in] t
+ The table. Can be NULL.
+
+ \see NewEcPointTable
+*/
+void DeleteEcPointTable(EcPointTable** t);
+
+/// Multi-exponentiates elements given by their precomputed tables.
+/*!
+ Takes tables of group elements a[0], ... , a[m-1] in G and positive
+ integers b[0], ..., b[m-1], where m is a small positive integer.
+ Outputs r (in G) = EcExp(a[0],b[0]) * ... * EcExp(a[m-1],b[m-1]).
+
+ \attention
+ The table lookups depend on the powers, so this function is not side
+ channel mitigated and must only be used with public powers.
+
+ \param[in] g
+ The elliptic curve group.
+ \param[in] a
+ The tables of the bases.
+ \param[in] b
+ The powers. Power must be less than the order of the elliptic curve
+ group.
+ \param[in] m
+ Number of entries in a and b.
+ \param[out] r
+ The result of raising each a to the corresponding power b and multiplying
+ the results.
+
+ \returns ::EpidStatus
+
+ \see NewEcGroup
+ \see NewEcPointTable
+*/
+EpidStatus EcMultiExpTable(EcGroup* g, EcPointTable const** a,
+                           BigNumStr const** b, size_t m, EcPoint* r);
+
 /// Generates a random element from an elliptic curve group.
 /*!
  This function is only available for G1 and GT.
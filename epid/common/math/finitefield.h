@@ -168,6 +168,49 @@ EpidStatus NewFfElement(FiniteField const* ff, FfElement** new_ff_elem);
 */
 void DeleteFfElement(FfElement** ff_elem);
 
+/// Gets the size of memory needed to place an FfElement.
+/*!
+ \param[in] ff
+ The finite field.
+ \param[out] size
+ The number of bytes InitFfElement needs.
+
+ \returns ::EpidStatus
+
+ \see InitFfElement
+*/
+EpidStatus FfElementGetSize(FiniteField const* ff, size_t* size);
+
+/// Creates a new finite field element in caller provided memory.
+/*!
+ Same as NewFfElement, but places the element in mem instead of
+ allocating it, so that temporaries can live in a stack buffer or share
+ a single allocation. The element holds no other resources.
+
+ Do not call DeleteFfElement() on the element. It is valid as long as
+ mem is.
+
+ \param[in] ff
+ The finite field.
+ \param[in] mem
+ The memory to place the element in. Needs no particular alignment.
+ \param[in] mem_size
+ The size of mem in bytes. Must be at least the size given by
+ FfElementGetSize().
+ \param[out] ff_elem
+ The newly constructed finite field element.
+
+ \returns ::EpidStatus
+
+ \attention It is the responsibility of the caller to ensure that ff
+ exists for the entire lifetime of the new FfElement.
+
+ \see FfElementGetSize
+ \see NewFfElement
+*/
+EpidStatus InitFfElement(FiniteField const* ff, void* mem, size_t mem_size,
+                         FfElement** ff_elem);
+
 /// Deserializes a FfElement from a string.
 /*!
  \param[in] ff
@@ -426,6 +469,100 @@ EpidStatus FfMultiExpBn(FiniteField* ff, FfElement const** a, BigNum const** b,
 EpidStatus FfSscmMultiExp(FiniteField* ff, FfElement const** a,
                           BigNumStr const** b, size_t m, FfElement* r);
 
+/// Comb table of an element of GT.
+typedef struct FfCombTable FfCombTable;
+
+/// Creates an empty comb table of an element of GT.
+/*!
+ Allocates memory for a comb table. Use InitFfCombTable() to fill the
+ table before it is used.
+
+ Comb tables are only available for the GT field of the Intel(R) EPID
+ 2.0 parameters. Exponentiation with a comb table needs a fifth of the
+ squarings of FfMultiExp(), the squarings are shared by all tables of an
+ FfMultiExpComb() call, and they use the cheaper squaring of the
+ cyclotomic subgroup of GT.
+
+ Use DeleteFfCombTable() to free memory.
+
+ \param[in] ff
+ The GT field.
+ \param[out] t
+ The newly constructed table.
+
+ \returns ::EpidStatus
+
+ \attention It is the responsibility of the caller to ensure that ff exists
+ for the entire lifetime of the new FfCombTable.
+
+ \see DeleteFfCombTable
+ \see InitFfCombTable
+*/
+EpidStatus NewFfCombTable(FiniteField* ff, FfCombTable** t);
+
+/// Deletes a comb table of an element of GT.
+/*!
+ Frees memory pointed to by table. Nulls the pointer.
+
+ \param[in] t
+ The table. Can be NULL.
+
+ \see NewFfCombTable
+*/
+void DeleteFfCombTable(FfCombTable** t);
+
+/// Fills a comb table for an element of GT.
+/*!
+ Costs less than one exponentiation.
+
+ \param[in] ff
+ The GT field.
+ \param[in] a
+ The element. Must be in the cyclotomic subgroup of GT, as pairing
+ results and their products and powers are.
+ \param[in,out] t
+ The table.
+
+ \returns ::EpidStatus
+
+ \attention
+ a is not checked to be in the cyclotomic subgroup. A table of any other
+ element gives wrong results.
+
+ \see NewFfCombTable
+ \see FfMultiExpComb
+*/
+EpidStatus InitFfCombTable(FiniteField* ff, FfElement const* a,
+                           FfCombTable* t);
+
+/// Multi-exponentiates elements of GT given by their comb tables.
+/*!
+ Calculates FfExp(a[0],b[0]) * ... * FfExp(a[m-1],b[m-1]) given the comb
+ tables of a[0], ..., a[m-1].
+
+ \attention
+ The table lookups depend on the powers, so this function is not side
+ channel mitigated and must only be used with public powers.
+
+ \param[in] ff
+ The GT field.
+ \param[in] a
+ The tables of the bases.
+ \param[in] b
+ The powers.
+ \param[in] m
+ Number of entries in a and b.
+ \param[out] r
+ The result of raising each a to the corresponding power b and multiplying
+ the results.
+
+ \returns ::EpidStatus
+
+ \see NewFfCombTable
+*/
+EpidStatus FfMultiExpComb(FiniteField* ff, FfCombTable const** a,
+                          BigNumStr const** b, size_t m, FfElement* r);
+
 /// Checks if two finite field elements are equal.
 /*!
  \param[in] ff
@@ -466,6 +603,96 @@ EpidStatus FfIsEqual(FiniteField* ff, FfElement const* a, FfElement const* b,
 EpidStatus FfHash(FiniteField* ff, ConstOctStr msg, size_t msg_len,
                   HashAlg hash_alg, FfElement* r);
 
+/// State of an incremental hash to an element in a finite field.
+typedef struct FfHashState FfHashState;
+
+/// Starts an incremental hash to an element in a finite field.
+/*!
+ Allocates memory and initializes the state of a hash that is computed
+ over several calls to FfHashUpdate() and finished with FfHashFinal().
+
+ The result is the same as FfHash() over the concatenation of all
+ updates.
+
+ Use DeleteFfHashState() to free memory.
+
+ \param[in] hash_alg
+ The hash algorithm.
+ \param[out] state
+ Newly constructed hash state.
+
+ \returns ::EpidStatus
+
+ \see DeleteFfHashState
+ \see FfHashUpdate
+ \see FfHashFinal
+ */
+EpidStatus NewFfHashState(HashAlg hash_alg, FfHashState** state);
+
+/// Frees a previously allocated FfHashState.
+/*!
+ Frees memory pointed to by hash state. Nulls the pointer.
+
+ \param[in] state
+ The hash state. Can be NULL.
+
+ \see NewFfHashState
+ */
+void DeleteFfHashState(FfHashState** state);
+
+/// Copies the state of an incremental hash.
+/*!
+ Sets dst to the point that src has reached, so that a common prefix
+ hashed once into src can be finished with different suffixes.
+
+ \param[in] src
+ The hash state to copy.
+ \param[out] dst
+ The hash state to overwrite. Must use the same hash algorithm as src.
+
+ \returns ::EpidStatus
+
+ \see NewFfHashState
+ \see FfHashUpdate
+ */
+EpidStatus FfHashStateCopy(FfHashState const* src, FfHashState* dst);
+
+/// Adds part of a message to an incremental hash.
+/*!
+ \param[in,out] state
+ The hash state.
+ \param[in] msg
+ The next part of the message. Can be NULL if msg_len is 0.
+ \param[in] msg_len
+ The size of msg in bytes.
+
+ \returns ::EpidStatus
+
+ \see NewFfHashState
+ \see FfHashFinal
+ */
+EpidStatus FfHashUpdate(FfHashState* state, ConstOctStr msg, size_t msg_len);
+
+/// Finishes an incremental hash to an element in a finite field.
+/*!
+ Reduces the digest of the message added with FfHashUpdate() to an
+ element in the field and restarts the state for a new message.
+
+ \param[in] ff
+ The finite field.
+ \param[in,out] state
+ The hash state.
+ \param[out] r
+ The hashed value.
+
+ \returns ::EpidStatus
+
+ \see NewFfHashState
+ \see FfHashUpdate
+ \see FfHash
+ */
+EpidStatus FfHashFinal(FiniteField* ff, FfHashState* state, FfElement* r);
+
 /// Generate random finite field element.
 /*!
  \param[in] ff
@@ -82,6 +82,26 @@ EpidStatus NewPairingState(EcGroup const* ga, EcGroup const* gb,
 */
 void DeletePairingState(PairingState** ps);
 
+/// Sets the Frobenius endomorphism of the second group of a pairing.
+/*!
+ Sets the endomorphism of gb used to create ps from the constants of
+ the pairing state with EcSetFrobenius(). Exponentiations in gb then
+ split their powers in four quarters and membership checks in gb, such
+ as those of Pairing() and ReadEcPoint(), also test for the subgroup of
+ the prime order.
+
+ \param[in] ps
+ The pairing state.
+
+ \returns ::EpidStatus
+
+ \attention gb must not be shared by several threads while the
+ endomorphism is set.
+
+ \see EcSetFrobenius
+*/
+EpidStatus PairingSetG2Frobenius(PairingState* ps);
+
 /// Computes an Optimal Ate Pairing for two parameters.
 /*!
  \param[in] ps
@@ -98,6 +118,115 @@ void DeletePairingState(PairingState** ps);
 EpidStatus Pairing(PairingState* ps, EcPoint const* a, EcPoint const* b,
                    FfElement* d);
 
+/// Computes an Optimal Ate Pairing for two known group elements.
+/*!
+ Same as Pairing(), but does not check that a and b are in the groups of
+ ps. Use it for values that are already known to be valid, such as points
+ read with ReadEcPoint() or computed from such points.
+
+ \param[in] ps
+ The pairing state.
+ \param[in] a
+ The first value to pair. Must be in ga used to create ps.
+ \param[in] b
+ The second value to pair. Must be in gb used to create ps
+ \param[out] d
+ The result of the pairing. Will be in ff used to create the pairing state.
+
+ \returns ::EpidStatus
+
+ \see Pairing
+*/
+EpidStatus PairingTrusted(PairingState* ps, EcPoint const* a,
+                          EcPoint const* b, FfElement* d);
+
+/// Miller loop line coefficients of a fixed second pairing parameter
+typedef struct PreparedG2 PreparedG2;
+
+/// Precomputes the Miller loop lines of a second pairing parameter.
+/*!
+ Runs the doubling and addition steps of the Miller loop for b once and
+ keeps the resulting line coefficients, so that pairings with b can be
+ computed by PairingProduct() without any arithmetic in gb.
+
+ Use DeletePreparedG2() to free memory.
+
+ \param[in] ps
+ The pairing state.
+ \param[in] b
+ The second value to pair. Must be in gb used to create ps.
+ \param[out] pb
+ Newly constructed prepared value.
+
+ \returns ::EpidStatus
+
+ \attention The prepared value can only be used with pairing states
+ created with the same parameters as ps.
+
+ \see DeletePreparedG2
+ \see PairingProduct
+*/
+EpidStatus NewPreparedG2(PairingState* ps, EcPoint const* b,
+                         PreparedG2** pb);
+
+/// Frees a previously allocated PreparedG2.
+/*!
+ Frees memory pointed to by the prepared value. Nulls the pointer.
+
+ \param[in] pb
+ The prepared value. Can be NULL.
+
+ \see NewPreparedG2
+*/
+void DeletePreparedG2(PreparedG2** pb);
+
+/// Computes the product of Optimal Ate Pairings.
+/*!
+ Computes d = pairing(a[0], b[0]) * ... * pairing(a[m-1], b[m-1]) with a
+ single Miller loop shared by all pairs and a single final exponentiation.
+
+ \param[in] ps
+ The pairing state.
+ \param[in] a
+ The first values to pair. Must be in ga used to create ps.
+ \param[in] b
+ The second values to pair, prepared with NewPreparedG2().
+ \param[in] m
+ Number of pairs.
+ \param[out] d
+ The result. Will be in ff used to create the pairing state.
+
+ \returns ::EpidStatus
+
+ \see NewPreparedG2
+*/
+EpidStatus PairingProduct(PairingState* ps, EcPoint const** a,
+                          PreparedG2 const** b, size_t m, FfElement* d);
+
+/// Computes the product of Optimal Ate Pairings of known group elements.
+/*!
+ Same as PairingProduct(), but does not check that a[i] are in the group
+ of ps.
+
+ \param[in] ps
+ The pairing state.
+ \param[in] a
+ The first values to pair. Must be in ga used to create ps.
+ \param[in] b
+ The second values to pair, prepared with NewPreparedG2().
+ \param[in] m
+ Number of pairs.
+ \param[out] d
+ The result. Will be in ff used to create the pairing state.
+
+ \returns ::EpidStatus
+
+ \see PairingProduct
+*/
+EpidStatus PairingProductTrusted(PairingState* ps, EcPoint const** a,
+                                 PreparedG2 const** b, size_t m,
+                                 FfElement* d);
+
 /*!
   @}
 */
@@ -29,10 +29,14 @@
 struct EcGroup {
   /// Internal implementation of elliptic curve group
   IppsGFpECState* ipp_ec;
-  /// Scratch buffer for operations over elliptic curve group
-  OctStr scratch_buffer;
+  /// Size of scratch buffer for operations over elliptic curve group
+  int scratch_buffer_size;
   /// Information about finite field of elliptic curve group
   struct FiniteField* ff;
+  /// Endomorphism that splits powers, NULL if not set
+  Ipp8u* glv;
+  /// Frobenius endomorphism of a twist, NULL if not set
+  Ipp8u* gls;
 };
 
 /// Elpitic Curve Point
@@ -42,4 +46,12 @@ struct EcPoint {
   /// length of the finite field element of elliptic curve group
   int element_len;
 };
+
+/// Precomputed multiples of an elliptic curve point
+struct EcPointTable {
+  /// Internal implementation of the table
+  Ipp8u* ipp_table;
+  /// length of the finite field element of elliptic curve group
+  int element_len;
+};
 #endif  // EPID_COMMON_MATH_SRC_ECGROUP_INTERNAL_H_
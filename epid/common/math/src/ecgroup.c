@@ -20,6 +20,7 @@
  */
 
 #include "epid/common/math/ecgroup.h"
+#include <stdint.h>
 #include <string.h>
 #include "epid/common/1.1/types.h"
 #include "epid/common/math/hash.h"
@@ -55,7 +56,6 @@ EpidStatus NewEcGroup(FiniteField const* ff, FfElement const* a,
                       BigNum const* cofactor, EcGroup** g) {
   EpidStatus result = kEpidNoErr;
   IppsGFpECState* state = NULL;
-  OctStr scratch_buffer = NULL;
   EcGroup* grp = NULL;
   do {
     IppStatus ipp_status;
@@ -130,7 +130,7 @@ EpidStatus NewEcGroup(FiniteField const* ff, FfElement const* a,
       break;
     }
 
-    // allocate scratch buffer
+    // calculate scratch buffer size
     ipp_status = ippsGFpECScratchBufferSize(1, state, &scratch_size);
     // check return codes
     if (ippStsNoErr != ipp_status) {
@@ -139,27 +139,23 @@ EpidStatus NewEcGroup(FiniteField const* ff, FfElement const* a,
       result = kEpidMathErr;
       break;
     }
-
-    // allocate scratch buffer
-    scratch_buffer = (OctStr)SAFE_ALLOC(scratch_size);
-    if (!scratch_buffer) {
-      result = kEpidMemAllocErr;
-      break;
-    }
     // Warning: once assigned ground field must never be modified. this was not
     // made const
     // to allow the FiniteField structure to be used in context when we want to
     // modify the parameters.
     grp->ff = (FiniteField*)ff;
     grp->ipp_ec = state;
-    grp->scratch_buffer = scratch_buffer;
+    // scratch buffer is allocated by each operation so that the group can
+    // be used from several threads at a time
+    grp->scratch_buffer_size = scratch_size;
+    grp->glv = NULL;
+    grp->gls = NULL;
     *g = grp;
   } while (0);
 
   if (kEpidNoErr != result) {
     // we had a problem during init, free any allocated memory
     SAFE_FREE(state);
-    SAFE_FREE(scratch_buffer);
     SAFE_FREE(grp);
   }
   return result;
@@ -173,83 +169,111 @@ void DeleteEcGroup(EcGroup** g) {
     SAFE_FREE((*g)->ipp_ec);
     (*g)->ipp_ec = NULL;
   }
-  if ((*g)->scratch_buffer) {
-    SAFE_FREE((*g)->scratch_buffer);
-    (*g)->scratch_buffer = NULL;
-  }
+  SAFE_FREE((*g)->glv);
+  SAFE_FREE((*g)->gls);
   SAFE_FREE(*g);
   *g = NULL;
 }
 
+/// Places a new point at the start of mem, which is pointer aligned
+static EpidStatus PlaceEcPoint(EcGroup const* g, void* mem, EcPoint** p) {
+  IppStatus sts = ippStsNoErr;
+  EcPoint* ecpoint = (EcPoint*)mem;
+  IppsGFpECPoint* ec_pt_context =
+      (IppsGFpECPoint*)((Ipp8u*)mem + MATH_ALIGN_UP(sizeof(EcPoint)));
+  // Initialize
+  sts = ippsGFpECPointInit(NULL, NULL, ec_pt_context, g->ipp_ec);
+  if (ippStsContextMatchErr == sts) {
+    return kEpidBadArgErr;
+  } else if (ippStsNoErr != sts) {
+    return kEpidMathErr;
+  }
+  ecpoint->element_len = g->ff->element_len;
+  ecpoint->ipp_ec_pt = ec_pt_context;
+  *p = ecpoint;
+  return kEpidNoErr;
+}
+
+/// Gets the size of a point and its ipp context in one block
+static EpidStatus GetEcPointBlockSize(EcGroup const* g, size_t* size) {
+  int sizeInBytes = 0;
+  // get size
+  IppStatus sts = ippsGFpECPointGetSize(g->ipp_ec, &sizeInBytes);
+  if (ippStsContextMatchErr == sts) {
+    return kEpidBadArgErr;
+  } else if (ippStsNoErr != sts) {
+    return kEpidMathErr;
+  }
+  *size = MATH_ALIGN_UP(sizeof(EcPoint)) + (size_t)sizeInBytes;
+  return kEpidNoErr;
+}
+
 EpidStatus NewEcPoint(EcGroup const* g, EcPoint** p) {
   EpidStatus result = kEpidErr;
-  IppsGFpECPoint* ec_pt_context = NULL;
-  EcPoint* ecpoint = NULL;
-  do {
-    IppStatus sts = ippStsNoErr;
-    int sizeInBytes = 0;
-    // validate inputs
-    if (!g || !p) {
-      result = kEpidBadArgErr;
-      break;
-    } else if (!g->ipp_ec) {
-      result = kEpidBadArgErr;
-      break;
-    }
-    // get size
-    sts = ippsGFpECPointGetSize(g->ipp_ec, &sizeInBytes);
-    if (ippStsContextMatchErr == sts) {
-      result = kEpidBadArgErr;
-      break;
-    } else if (ippStsNoErr != sts) {
-      result = kEpidMathErr;
-      break;
-    }
-    // allocate memory
-    ec_pt_context = (IppsGFpECPoint*)SAFE_ALLOC(sizeInBytes);
-    if (!ec_pt_context) {
-      result = kEpidMemAllocErr;
-      break;
-    }
-    // Initialize
-    sts = ippsGFpECPointInit(NULL, NULL, ec_pt_context, g->ipp_ec);
-    if (ippStsContextMatchErr == sts) {
-      result = kEpidBadArgErr;
-      break;
-    } else if (ippStsNoErr != sts) {
-      result = kEpidMathErr;
-      break;
-    }
-    ecpoint = SAFE_ALLOC(sizeof(EcPoint));
-    if (!ecpoint) {
-      result = kEpidMemAllocErr;
-      break;
-    }
-    if (!g->ff) {
-      result = kEpidBadArgErr;
-      break;
-    }
-    ecpoint->element_len = g->ff->element_len;
-    ecpoint->ipp_ec_pt = ec_pt_context;
-    *p = ecpoint;
-    result = kEpidNoErr;
-  } while (0);
+  void* mem = NULL;
+  size_t size = 0;
+  // validate inputs
+  if (!g || !p) {
+    return kEpidBadArgErr;
+  } else if (!g->ipp_ec || !g->ff) {
+    return kEpidBadArgErr;
+  }
+  result = GetEcPointBlockSize(g, &size);
   if (kEpidNoErr != result) {
-    SAFE_FREE(ec_pt_context);
-    SAFE_FREE(ecpoint);
+    return result;
+  }
+  // the point and its ipp context share one allocation
+  mem = SAFE_ALLOC(size);
+  if (!mem) {
+    return kEpidMemAllocErr;
+  }
+  result = PlaceEcPoint(g, mem, p);
+  if (kEpidNoErr != result) {
+    SAFE_FREE(mem);
   }
   return result;
 }
 
 void DeleteEcPoint(EcPoint** p) {
   if (p) {
-    if (*p) {
-      SAFE_FREE((*p)->ipp_ec_pt);
-    }
     SAFE_FREE(*p);
   }
 }
 
+EpidStatus EcPointGetSize(EcGroup const* g, size_t* size) {
+  EpidStatus result = kEpidErr;
+  size_t block_size = 0;
+  if (!g || !size) {
+    return kEpidBadArgErr;
+  } else if (!g->ipp_ec || !g->ff) {
+    return kEpidBadArgErr;
+  }
+  result = GetEcPointBlockSize(g, &block_size);
+  if (kEpidNoErr != result) {
+    return result;
+  }
+  // room to align an arbitrary buffer
+  *size = block_size + sizeof(void*) - 1;
+  return kEpidNoErr;
+}
+
+EpidStatus InitEcPoint(EcGroup const* g, void* mem, size_t mem_size,
+                       EcPoint** p) {
+  EpidStatus result = kEpidErr;
+  size_t size = 0;
+  if (!mem || !p) {
+    return kEpidBadArgErr;
+  }
+  result = EcPointGetSize(g, &size);
+  if (kEpidNoErr != result) {
+    return result;
+  }
+  if (mem_size < size) {
+    return kEpidBadArgErr;
+  }
+  return PlaceEcPoint(g, (void*)MATH_ALIGN_UP((uintptr_t)mem), p);
+}
+
 /// Check and initialize element if it is in elliptic curve group.
 /*!
   This is internal function.
@@ -359,8 +383,14 @@ EpidStatus eccontains(EcGroup* g, ConstOctStr p_str, size_t strlen, EcPoint* p,
       break;
     }
 
-    // verify the point is actually on the curve
-    sts = ippsGFpECTstPoint(p->ipp_ec_pt, &ec_result, g->ipp_ec);
+    // verify the point is actually on the curve, and in the subgroup if
+    // the group has the Frobenius endomorphism of a twist
+    if (g->gls) {
+      sts = ippsGFpECTstPointInSubgroupGLS(p->ipp_ec_pt, &ec_result, g->gls,
+                                           g->ipp_ec);
+    } else {
+      sts = ippsGFpECTstPoint(p->ipp_ec_pt, &ec_result, g->ipp_ec);
+    }
     // check return codes
     if (ippStsNoErr != sts) {
       if (ippStsContextMatchErr == sts)
@@ -495,115 +525,744 @@ EpidStatus WriteEcPoint(EcGroup* g, EcPoint const* p, OctStr p_str,
   return result;
 }
 
-EpidStatus EcMul(EcGroup* g, EcPoint const* a, EcPoint const* b, EcPoint* r) {
-  IppStatus sts = ippStsNoErr;
-  if (!g || !a || !b || !r) {
-    return kEpidBadArgErr;
-  } else if (!g->ff || !g->ipp_ec || !a->ipp_ec_pt || !b->ipp_ec_pt ||
-             !r->ipp_ec_pt) {
+EpidStatus WriteEcPoints(EcGroup* g, EcPoint const** p, size_t m,
+                         OctStr const* p_str, size_t strlen) {
+  EpidStatus result = kEpidErr;
+  FiniteField* fp = NULL;
+  IppsGFpECPoint const** ipp_pts = NULL;
+  IppsGFpElement** ipp_x = NULL;
+  IppsGFpElement** ipp_y = NULL;
+  FfElement** fp_x = NULL;
+  FfElement** fp_y = NULL;
+  int ipp_half_strlen = (int)strlen / 2;
+  size_t i = 0;
+
+  if (!g || !p || !p_str) {
+    return kEpidBadArgErr;
+  }
+  if (!g->ff || !g->ipp_ec) {
+    return kEpidBadArgErr;
+  }
+  if (m <= 0 || INT_MAX < m) {
+    return kEpidBadArgErr;
+  }
+  if (INT_MAX < strlen || strlen <= 0 || strlen & 0x1) {
+    return kEpidBadArgErr;
+  }
+  for (i = 0; i < m; i++) {
+    if (!p[i] || !p[i]->ipp_ec_pt || !p_str[i]) {
+      return kEpidBadArgErr;
+    }
+  }
+
+  do {
+    IppStatus sts = ippStsNoErr;
+    fp = g->ff;
+
+    ipp_pts = SAFE_ALLOC(m * sizeof(*ipp_pts));
+    ipp_x = SAFE_ALLOC(m * sizeof(*ipp_x));
+    ipp_y = SAFE_ALLOC(m * sizeof(*ipp_y));
+    fp_x = SAFE_ALLOC(m * sizeof(*fp_x));
+    fp_y = SAFE_ALLOC(m * sizeof(*fp_y));
+    if (!ipp_pts || !ipp_x || !ipp_y || !fp_x || !fp_y) {
+      result = kEpidMemAllocErr;
+      break;
+    }
+    for (i = 0; i < m; i++) {
+      result = NewFfElement(fp, &fp_x[i]);
+      if (kEpidNoErr != result) break;
+      result = NewFfElement(fp, &fp_y[i]);
+      if (kEpidNoErr != result) break;
+      ipp_pts[i] = p[i]->ipp_ec_pt;
+      ipp_x[i] = fp_x[i]->ipp_ff_elem;
+      ipp_y[i] = fp_y[i]->ipp_ff_elem;
+    }
+    if (kEpidNoErr != result) break;
+
+    // get affine coordinates of all points with one inversion
+    sts = ippsGFpECGetPoints(ipp_pts, ipp_x, ipp_y, (int)m, g->ipp_ec);
+    if (ippStsNoErr != sts) {
+      if (ippStsContextMatchErr == sts || ippStsOutOfRangeErr == sts) {
+        result = kEpidBadArgErr;
+      } else {
+        result = kEpidMathErr;
+      }
+      break;
+    }
+
+    // points at infinity come back as (0, 0) and serialize to zeros
+    for (i = 0; i < m; i++) {
+      IppOctStr byte_str = (IppOctStr)p_str[i];
+      sts = ippsGFpGetElementOctString(ipp_x[i], byte_str, ipp_half_strlen,
+                                       fp->ipp_ff);
+      if (ippStsNoErr != sts) break;
+      sts = ippsGFpGetElementOctString(ipp_y[i], byte_str + ipp_half_strlen,
+                                       ipp_half_strlen, fp->ipp_ff);
+      if (ippStsNoErr != sts) break;
+    }
+    if (ippStsNoErr != sts) {
+      if (ippStsContextMatchErr == sts)
+        result = kEpidBadArgErr;
+      else
+        result = kEpidMathErr;
+      break;
+    }
+    result = kEpidNoErr;
+  } while (0);
+
+  if (fp_x) {
+    for (i = 0; i < m; i++) {
+      DeleteFfElement(&fp_x[i]);
+    }
+  }
+  if (fp_y) {
+    for (i = 0; i < m; i++) {
+      DeleteFfElement(&fp_y[i]);
+    }
+  }
+  SAFE_FREE(fp_y);
+  SAFE_FREE(fp_x);
+  SAFE_FREE(ipp_y);
+  SAFE_FREE(ipp_x);
+  SAFE_FREE(ipp_pts);
+
+  return result;
+}
+
+EpidStatus EcMul(EcGroup* g, EcPoint const* a, EcPoint const* b, EcPoint* r) {
+  IppStatus sts = ippStsNoErr;
+  if (!g || !a || !b || !r) {
+    return kEpidBadArgErr;
+  } else if (!g->ff || !g->ipp_ec || !a->ipp_ec_pt || !b->ipp_ec_pt ||
+             !r->ipp_ec_pt) {
+    return kEpidBadArgErr;
+  }
+  if (g->ff->element_len != a->element_len ||
+      g->ff->element_len != b->element_len ||
+      g->ff->element_len != r->element_len) {
+    return kEpidBadArgErr;
+  }
+  // Multiplies elliptic curve points
+  sts = ippsGFpECAddPoint(a->ipp_ec_pt, b->ipp_ec_pt, r->ipp_ec_pt, g->ipp_ec);
+  // Check return codes
+  if (ippStsNoErr != sts) {
+    if (ippStsContextMatchErr == sts)
+      return kEpidBadArgErr;
+    else
+      return kEpidMathErr;
+  }
+  return kEpidNoErr;
+}
+
+/// Ipp32u words of the largest power
+#define EXP_WORDS ((int)(sizeof(BigNumStr) / sizeof(Ipp32u)))
+
+/// Bytes reserved for the ipp context of a power
+#define EXP_CTX_SIZE (256)
+
+/// Initializes a power context in EXP_CTX_SIZE bytes of mem
+static EpidStatus InitExp(Ipp8u* mem, IppsBigNumState** exp) {
+  int ctx_size = 0;
+  IppStatus sts = ippsBigNumGetSize(EXP_WORDS, &ctx_size);
+  if (ippStsNoErr != sts || ctx_size > EXP_CTX_SIZE) {
+    return kEpidMathErr;
+  }
+  sts = ippsBigNumInit(EXP_WORDS, (IppsBigNumState*)mem);
+  if (ippStsNoErr != sts) {
+    return kEpidMathErr;
+  }
+  *exp = (IppsBigNumState*)mem;
+  return kEpidNoErr;
+}
+
+/// Sets a power context from a serialized power
+static EpidStatus SetExpStr(BigNumStr const* b, IppsBigNumState* exp) {
+  BigNum bn;
+  bn.ipp_bn = exp;
+  return ReadBigNum(b, sizeof(*b), &bn);
+}
+
+/// Sets a power context from an element of a prime field
+static EpidStatus SetExpFp(FiniteField* fp, FfElement const* b,
+                           IppsBigNumState* exp) {
+  EpidStatus result = kEpidErr;
+  Ipp32u data[EXP_WORDS];
+  IppStatus sts = ippStsNoErr;
+  if (!b || !b->ipp_ff_elem || b->element_len != fp->element_len) {
+    return kEpidBadArgErr;
+  }
+  do {
+    sts = ippsGFpGetElement(b->ipp_ff_elem, data, EXP_WORDS, fp->ipp_ff);
+    if (ippStsNoErr != sts) {
+      if (ippStsContextMatchErr == sts || ippStsOutOfRangeErr == sts ||
+          ippStsSizeErr == sts)
+        result = kEpidBadArgErr;
+      else
+        result = kEpidMathErr;
+      break;
+    }
+    sts = ippsSet_BN(IppsBigNumPOS, EXP_WORDS, data, exp);
+    if (ippStsNoErr != sts) {
+      result = kEpidMathErr;
+      break;
+    }
+    result = kEpidNoErr;
+  } while (0);
+  EpidZeroMemory(data, sizeof(data));
+  return result;
+}
+
+/// Checks that a finite field is a prime field for powers
+static EpidStatus CheckExpField(FiniteField const* fp) {
+  if (!fp || !fp->ipp_ff) {
+    return kEpidBadArgErr;
+  }
+  if (1 != fp->basic_degree || 1 != fp->ground_degree ||
+      fp->element_len > EXP_WORDS) {
+    return kEpidBadArgErr;
+  }
+  return kEpidNoErr;
+}
+
+/// Checks the group, base and result of an exponentiation
+static EpidStatus CheckExpArgs(EcGroup* g, EcPoint const* a, EcPoint* r) {
+  if (!g || !a || !r) {
+    return kEpidBadArgErr;
+  } else if (!g->ff || !g->ipp_ec || !a->ipp_ec_pt || !r->ipp_ec_pt) {
+    return kEpidBadArgErr;
+  }
+  if (g->ff->element_len != a->element_len ||
+      g->ff->element_len != r->element_len) {
+    return kEpidBadArgErr;
+  }
+  return kEpidNoErr;
+}
+
+EpidStatus EcSetEndomorphism(EcGroup* g, FfElement const* beta,
+                             BigNumStr const* lambda) {
+  EpidStatus result = kEpidErr;
+  Ipp8u exp_ctx[EXP_CTX_SIZE];
+  IppsBigNumState* exp = NULL;
+  Ipp8u* glv = NULL;
+  if (!g || !beta || !lambda) {
+    return kEpidBadArgErr;
+  }
+  if (!g->ff || !g->ipp_ec || !beta->ipp_ff_elem) {
+    return kEpidBadArgErr;
+  }
+  if (g->ff->element_len != beta->element_len) {
+    return kEpidBadArgErr;
+  }
+  do {
+    IppStatus sts = ippStsNoErr;
+    int glv_size = 0;
+    int scratch_size = 0;
+    result = InitExp(exp_ctx, &exp);
+    if (kEpidNoErr != result) break;
+    result = SetExpStr(lambda, exp);
+    if (kEpidNoErr != result) break;
+
+    sts = ippsGFpECGLVGetSize(g->ipp_ec, &glv_size);
+    if (ippStsNoErr != sts) {
+      result = kEpidMathErr;
+      break;
+    }
+    glv = (Ipp8u*)SAFE_ALLOC(glv_size);
+    if (!glv) {
+      result = kEpidMemAllocErr;
+      break;
+    }
+    sts = ippsGFpECGLVInit(beta->ipp_ff_elem, exp, glv, g->ipp_ec);
+    if (ippStsNoErr != sts) {
+      if (ippStsContextMatchErr == sts || ippStsBadArgErr == sts ||
+          ippStsOutOfRangeErr == sts)
+        result = kEpidBadArgErr;
+      else
+        result = kEpidMathErr;
+      break;
+    }
+    // the halves of a power are multiplied with a table each
+    sts = ippsGFpECScratchBufferSize(2, g->ipp_ec, &scratch_size);
+    if (ippStsNoErr != sts) {
+      result = kEpidMathErr;
+      break;
+    }
+    if (scratch_size > g->scratch_buffer_size) {
+      g->scratch_buffer_size = scratch_size;
+    }
+    SAFE_FREE(g->glv);
+    g->glv = glv;
+    glv = NULL;
+    result = kEpidNoErr;
+  } while (0);
+  SAFE_FREE(glv);
+  return result;
+}
+
+EpidStatus EcSetFrobenius(EcGroup* g, FfElement const* frob_x,
+                          FfElement const* frob_y, BigNumStr const* t,
+                          bool neg) {
+  EpidStatus result = kEpidErr;
+  Ipp8u exp_ctx[EXP_CTX_SIZE];
+  IppsBigNumState* exp = NULL;
+  Ipp8u* gls = NULL;
+  if (!g || !frob_x || !frob_y || !t) {
+    return kEpidBadArgErr;
+  }
+  if (!g->ff || !g->ipp_ec || !frob_x->ipp_ff_elem || !frob_y->ipp_ff_elem) {
+    return kEpidBadArgErr;
+  }
+  if (g->ff->element_len != frob_x->element_len ||
+      g->ff->element_len != frob_y->element_len) {
+    return kEpidBadArgErr;
+  }
+  do {
+    IppStatus sts = ippStsNoErr;
+    int gls_size = 0;
+    int scratch_size = 0;
+    result = InitExp(exp_ctx, &exp);
+    if (kEpidNoErr != result) break;
+    result = SetExpStr(t, exp);
+    if (kEpidNoErr != result) break;
+    if (neg) {
+      IppsBigNumSGN sgn = IppsBigNumPOS;
+      Ipp32u data[EXP_WORDS];
+      int len = 0;
+      sts = ippsGet_BN(&sgn, &len, data, exp);
+      if (ippStsNoErr != sts) {
+        result = kEpidMathErr;
+        break;
+      }
+      sts = ippsSet_BN(IppsBigNumNEG, len, data, exp);
+      if (ippStsNoErr != sts) {
+        result = kEpidMathErr;
+        break;
+      }
+    }
+
+    sts = ippsGFpECGLSGetSize(g->ipp_ec, &gls_size);
+    if (ippStsNoErr != sts) {
+      result = kEpidMathErr;
+      break;
+    }
+    gls = (Ipp8u*)SAFE_ALLOC(gls_size);
+    if (!gls) {
+      result = kEpidMemAllocErr;
+      break;
+    }
+    sts = ippsGFpECGLSInit(frob_x->ipp_ff_elem, frob_y->ipp_ff_elem, exp, gls,
+                           g->ipp_ec);
+    if (ippStsNoErr != sts) {
+      if (ippStsContextMatchErr == sts || ippStsBadArgErr == sts ||
+          ippStsOutOfRangeErr == sts)
+        result = kEpidBadArgErr;
+      else
+        result = kEpidMathErr;
+      break;
+    }
+    // the quarters of a power are multiplied with a table each
+    sts = ippsGFpECScratchBufferSize(4, g->ipp_ec, &scratch_size);
+    if (ippStsNoErr != sts) {
+      result = kEpidMathErr;
+      break;
+    }
+    if (scratch_size > g->scratch_buffer_size) {
+      g->scratch_buffer_size = scratch_size;
+    }
+    SAFE_FREE(g->gls);
+    g->gls = gls;
+    gls = NULL;
+    result = kEpidNoErr;
+  } while (0);
+  SAFE_FREE(gls);
+  return result;
+}
+
+/// Multiplies an ipp point, splitting the power if the group has an
+/// endomorphism
+static IppStatus EcMulPointIpp(EcGroup* g, IppsGFpECPoint const* a,
+                               IppsBigNumState const* b, IppsGFpECPoint* r,
+                               Ipp8u* scratch_buffer) {
+  if (g->gls) {
+    return ippsGFpECMulPointGLS(a, b, g->gls, r, g->ipp_ec, scratch_buffer);
+  }
+  if (g->glv) {
+    return ippsGFpECMulPointGLV(a, b, g->glv, r, g->ipp_ec, scratch_buffer);
+  }
+  return ippsGFpECMulPoint(a, b, r, g->ipp_ec, scratch_buffer);
+}
+
+/// Raises a point to a power held in an ipp context
+static EpidStatus EcExpIpp(EcGroup* g, EcPoint const* a,
+                           IppsBigNumState const* b, EcPoint* r) {
+  EpidStatus result = kEpidErr;
+  OctStr scratch_buffer = NULL;
+  do {
+    IppStatus sts = ippStsNoErr;
+    // Allocate scratch buffer for ipp call
+    scratch_buffer = (OctStr)SAFE_ALLOC(g->scratch_buffer_size);
+    if (!scratch_buffer) {
+      result = kEpidMemAllocErr;
+      break;
+    }
+    sts = EcMulPointIpp(g, a->ipp_ec_pt, b, r->ipp_ec_pt, scratch_buffer);
+    if (ippStsNoErr != sts) {
+      if (ippStsContextMatchErr == sts || ippStsRangeErr == sts ||
+          ippStsOutOfRangeErr == sts)
+        result = kEpidBadArgErr;
+      else
+        result = kEpidMathErr;
+      break;
+    }
+    result = kEpidNoErr;
+  } while (0);
+  SAFE_FREE(scratch_buffer);
+  return result;
+}
+
+EpidStatus EcExp(EcGroup* g, EcPoint const* a, BigNumStr const* b, EcPoint* r) {
+  EpidStatus result = kEpidErr;
+  Ipp8u exp_ctx[EXP_CTX_SIZE];
+  IppsBigNumState* exp = NULL;
+
+  result = CheckExpArgs(g, a, r);
+  if (kEpidNoErr != result) {
+    return result;
+  }
+  if (!b) {
+    return kEpidBadArgErr;
+  }
+  do {
+    // the power is converted on the stack rather than in a new BigNum
+    result = InitExp(exp_ctx, &exp);
+    if (kEpidNoErr != result) break;
+    result = SetExpStr(b, exp);
+    if (kEpidNoErr != result) break;
+    result = EcExpIpp(g, a, exp, r);
+  } while (0);
+  EpidZeroMemory(exp_ctx, sizeof(exp_ctx));
+  return result;
+}
+
+EpidStatus EcExpFp(EcGroup* g, EcPoint const* a, FiniteField* fp,
+                   FfElement const* b, EcPoint* r) {
+  EpidStatus result = kEpidErr;
+  Ipp8u exp_ctx[EXP_CTX_SIZE];
+  IppsBigNumState* exp = NULL;
+
+  result = CheckExpArgs(g, a, r);
+  if (kEpidNoErr != result) {
+    return result;
+  }
+  result = CheckExpField(fp);
+  if (kEpidNoErr != result) {
+    return result;
+  }
+  if (!b) {
+    return kEpidBadArgErr;
+  }
+  do {
+    result = InitExp(exp_ctx, &exp);
+    if (kEpidNoErr != result) break;
+    result = SetExpFp(fp, b, exp);
+    if (kEpidNoErr != result) break;
+    result = EcExpIpp(g, a, exp, r);
+  } while (0);
+  EpidZeroMemory(exp_ctx, sizeof(exp_ctx));
+  return result;
+}
+
+EpidStatus EcSscmExp(EcGroup* g, EcPoint const* a, BigNumStr const* b,
+                     EcPoint* r) {
+  // call EcExp directly because its implementation is side channel
+  // mitigated already
+  return EcExp(g, a, b, r);
+}
+
+/// Largest number of terms of one ippsGFpECMultiMulPoint call
+#define MULTI_EXP_MAX_TERMS ((size_t)1 << 16)
+
+/// Multi-exponentiates with doublings shared by all terms
+/*!
+ Not side channel mitigated: the operations depend on the powers.
+ */
+static EpidStatus EcMultiExpVarTime(EcGroup* g, EcPoint const** a,
+                                    IppsBigNumState const** ipp_b, size_t m,
+                                    EcPoint* r) {
+  EpidStatus result = kEpidErr;
+  IppsGFpECPoint const** ipp_a = NULL;
+  EcPoint* ecp_t = NULL;
+  OctStr scratch_buffer = NULL;
+  size_t i = 0;
+  size_t done = 0;
+  do {
+    IppStatus sts = ippStsNoErr;
+    int scratch_size = 0;
+    int count = (int)((m < MULTI_EXP_MAX_TERMS) ? m : MULTI_EXP_MAX_TERMS);
+
+    ipp_a = SAFE_ALLOC(m * sizeof(*ipp_a));
+    if (!ipp_a) {
+      result = kEpidMemAllocErr;
+      break;
+    }
+    for (i = 0; i < m; i++) {
+      ipp_a[i] = a[i]->ipp_ec_pt;
+    }
+    if (m > MULTI_EXP_MAX_TERMS) {
+      // partial products of each batch of terms
+      result = NewEcPoint(g, &ecp_t);
+      if (kEpidNoErr != result) break;
+    }
+    // the first batch is the largest
+    if (g->glv) {
+      sts = ippsGFpECMultiMulPointGLVGetSize(count, g->glv, g->ipp_ec,
+                                             &scratch_size);
+    } else {
+      sts = ippsGFpECMultiMulPointGetSize(count, g->ipp_ec, &scratch_size);
+    }
+    if (ippStsNoErr != sts) {
+      result = kEpidMathErr;
+      break;
+    }
+    scratch_buffer = (OctStr)SAFE_ALLOC(scratch_size);
+    if (!scratch_buffer) {
+      result = kEpidMemAllocErr;
+      break;
+    }
+
+    result = kEpidNoErr;
+    for (done = 0; done < m; done += count) {
+      count = (int)((m - done < MULTI_EXP_MAX_TERMS) ? m - done
+                                                     : MULTI_EXP_MAX_TERMS);
+      if (g->glv) {
+        sts = ippsGFpECMultiMulPointGLV(
+            ipp_a + done, ipp_b + done, count, g->glv,
+            done ? ecp_t->ipp_ec_pt : r->ipp_ec_pt, g->ipp_ec, scratch_buffer);
+      } else {
+        sts = ippsGFpECMultiMulPoint(ipp_a + done, ipp_b + done, count,
+                                     done ? ecp_t->ipp_ec_pt : r->ipp_ec_pt,
+                                     g->ipp_ec, scratch_buffer);
+      }
+      if (ippStsNoErr != sts) {
+        if (ippStsContextMatchErr == sts || ippStsBadArgErr == sts ||
+            ippStsOutOfRangeErr == sts)
+          result = kEpidBadArgErr;
+        else
+          result = kEpidMathErr;
+        break;
+      }
+      if (done) {
+        sts = ippsGFpECAddPoint(ecp_t->ipp_ec_pt, r->ipp_ec_pt, r->ipp_ec_pt,
+                                g->ipp_ec);
+        if (ippStsNoErr != sts) {
+          result = kEpidMathErr;
+          break;
+        }
+      }
+    }
+  } while (0);
+  SAFE_FREE(scratch_buffer);
+  SAFE_FREE(ipp_a);
+  DeleteEcPoint(&ecp_t);
+  return result;
+}
+
+/// Terms of a multi-exponentiation whose powers are held on the stack
+#define MULTI_EXP_STACK_TERMS (4)
+
+/// Power contexts of a multi-exponentiation
+typedef struct MultiExpPowers {
+  /// contexts of the powers of few terms
+  Ipp8u stack_ctx[MULTI_EXP_STACK_TERMS * EXP_CTX_SIZE];
+  /// powers of few terms
+  IppsBigNumState* stack_exp[MULTI_EXP_STACK_TERMS];
+  /// block holding contexts and powers of many terms
+  void* heap;
+  /// contexts in use
+  Ipp8u* ctx;
+  /// powers in use
+  IppsBigNumState** exp;
+  /// number of powers
+  size_t m;
+} MultiExpPowers;
+
+/// Initializes power contexts for m terms
+static EpidStatus InitMultiExpPowers(size_t m, MultiExpPowers* powers) {
+  EpidStatus result = kEpidNoErr;
+  size_t i = 0;
+  powers->heap = NULL;
+  powers->ctx = powers->stack_ctx;
+  powers->exp = powers->stack_exp;
+  powers->m = 0;
+  if (m > MULTI_EXP_STACK_TERMS) {
+    if (m > SIZE_MAX / (EXP_CTX_SIZE + sizeof(*powers->exp))) {
+      return kEpidBadArgErr;
+    }
+    powers->heap = SAFE_ALLOC(m * (EXP_CTX_SIZE + sizeof(*powers->exp)));
+    if (!powers->heap) {
+      return kEpidMemAllocErr;
+    }
+    powers->exp = (IppsBigNumState**)powers->heap;
+    powers->ctx = (Ipp8u*)(powers->exp + m);
+  }
+  powers->m = m;
+  for (i = 0; i < m && kEpidNoErr == result; i++) {
+    result = InitExp(powers->ctx + i * EXP_CTX_SIZE, &powers->exp[i]);
+  }
+  return result;
+}
+
+/// Clears and frees power contexts
+static void ClearMultiExpPowers(MultiExpPowers* powers) {
+  EpidZeroMemory(powers->ctx, powers->m * EXP_CTX_SIZE);
+  SAFE_FREE(powers->heap);
+}
+
+/// Checks the group, bases and result of a multi-exponentiation
+static EpidStatus CheckMultiExpArgs(EcGroup* g, EcPoint const** a, size_t m,
+                                    EcPoint* r) {
+  size_t i = 0;
+  if (!g || !a || !r) {
     return kEpidBadArgErr;
   }
-  if (g->ff->element_len != a->element_len ||
-      g->ff->element_len != b->element_len ||
-      g->ff->element_len != r->element_len) {
+  if (!g->ff || !g->ipp_ec || !r->ipp_ec_pt || m <= 0) {
     return kEpidBadArgErr;
   }
-  // Multiplies elliptic curve points
-  sts = ippsGFpECAddPoint(a->ipp_ec_pt, b->ipp_ec_pt, r->ipp_ec_pt, g->ipp_ec);
-  // Check return codes
-  if (ippStsNoErr != sts) {
-    if (ippStsContextMatchErr == sts)
+  // Verify that ec points are not NULL
+  for (i = 0; i < m; i++) {
+    if (!a[i]) {
       return kEpidBadArgErr;
-    else
-      return kEpidMathErr;
+    }
+    if (!a[i]->ipp_ec_pt) {
+      return kEpidBadArgErr;
+    }
+    if (g->ff->element_len != a[i]->element_len) {
+      return kEpidBadArgErr;
+    }
+  }
+  if (g->ff->element_len != r->element_len) {
+    return kEpidBadArgErr;
   }
   return kEpidNoErr;
 }
 
-EpidStatus EcExp(EcGroup* g, EcPoint const* a, BigNumStr const* b, EcPoint* r) {
+EpidStatus EcMultiExp(EcGroup* g, EcPoint const** a, BigNumStr const** b,
+                      size_t m, EcPoint* r) {
   EpidStatus result = kEpidErr;
-  BigNum* b_bn = NULL;
-  do {
-    IppStatus sts = ippStsNoErr;
+  MultiExpPowers powers;
+  size_t i = 0;
 
-    // Check required parameters
-    if (!g || !a || !b || !r) {
-      result = kEpidBadArgErr;
-      break;
-    } else if (!g->ff || !g->ipp_ec || !a->ipp_ec_pt || !r->ipp_ec_pt) {
-      result = kEpidBadArgErr;
-      break;
-    }
-    if (g->ff->element_len != a->element_len ||
-        g->ff->element_len != r->element_len) {
-      result = kEpidBadArgErr;
-      break;
+  result = CheckMultiExpArgs(g, a, m, r);
+  if (kEpidNoErr != result) {
+    return result;
+  }
+  if (!b) {
+    return kEpidBadArgErr;
+  }
+  for (i = 0; i < m; i++) {
+    if (!b[i]) {
+      return kEpidBadArgErr;
     }
+  }
 
-    // Create and initialize big number element for ipp call
-    result = NewBigNum(sizeof(((BigNumStr*)0)->data.data), &b_bn);
-    if (kEpidNoErr != result) break;
-    result = ReadBigNum(b, sizeof(*b), b_bn);
-    if (kEpidNoErr != result) break;
-    sts = ippsGFpECMulPoint(a->ipp_ec_pt, b_bn->ipp_bn, r->ipp_ec_pt, g->ipp_ec,
-                            g->scratch_buffer);
-    if (ippStsNoErr != sts) {
-      if (ippStsContextMatchErr == sts || ippStsRangeErr == sts ||
-          ippStsOutOfRangeErr == sts)
-        result = kEpidBadArgErr;
-      else
-        result = kEpidMathErr;
-      break;
-    }
-    result = kEpidNoErr;
-  } while (0);
-  DeleteBigNum(&b_bn);
-  return result;
-}
+  result = InitMultiExpPowers(m, &powers);
+  for (i = 0; i < m && kEpidNoErr == result; i++) {
+    result = SetExpStr(b[i], powers.exp[i]);
+  }
+  if (kEpidNoErr == result) {
+    result = EcMultiExpVarTime(g, a, (IppsBigNumState const**)powers.exp, m, r);
+  }
+  ClearMultiExpPowers(&powers);
 
-EpidStatus EcSscmExp(EcGroup* g, EcPoint const* a, BigNumStr const* b,
-                     EcPoint* r) {
-  // call EcExp directly because its implementation is side channel
-  // mitigated already
-  return EcExp(g, a, b, r);
+  return result;
 }
 
-EpidStatus EcMultiExp(EcGroup* g, EcPoint const** a, BigNumStr const** b,
-                      size_t m, EcPoint* r) {
+EpidStatus EcMultiExpFp(EcGroup* g, EcPoint const** a, FiniteField* fp,
+                        FfElement const** b, size_t m, EcPoint* r) {
   EpidStatus result = kEpidErr;
-  BigNum* b_bn = NULL;
-  EcPoint* ecp_t = NULL;
+  MultiExpPowers powers;
   size_t i = 0;
-  size_t ii = 0;
 
-  if (!g || !a || !b || !r) {
-    return kEpidBadArgErr;
+  result = CheckMultiExpArgs(g, a, m, r);
+  if (kEpidNoErr != result) {
+    return result;
+  }
+  result = CheckExpField(fp);
+  if (kEpidNoErr != result) {
+    return result;
   }
-  if (!g->ff || !g->ipp_ec || m <= 0) {
+  if (!b) {
     return kEpidBadArgErr;
   }
-
-  // Verify that ec points are not NULL
   for (i = 0; i < m; i++) {
-    if (!a[i]) {
-      return kEpidBadArgErr;
-    }
-    if (!a[i]->ipp_ec_pt) {
+    if (!b[i]) {
       return kEpidBadArgErr;
     }
-    if (g->ff->element_len != a[i]->element_len) {
+  }
+
+  // the powers are read straight from the field elements
+  result = InitMultiExpPowers(m, &powers);
+  for (i = 0; i < m && kEpidNoErr == result; i++) {
+    result = SetExpFp(fp, b[i], powers.exp[i]);
+  }
+  if (kEpidNoErr == result) {
+    result = EcMultiExpVarTime(g, a, (IppsBigNumState const**)powers.exp, m, r);
+  }
+  ClearMultiExpPowers(&powers);
+
+  return result;
+}
+
+EpidStatus EcMultiExpBn(EcGroup* g, EcPoint const** a, BigNum const** b,
+                        size_t m, EcPoint* r) {
+  EpidStatus result = kEpidErr;
+  IppsBigNumState const** ipp_b = NULL;
+  size_t i = 0;
+
+  result = CheckMultiExpArgs(g, a, m, r);
+  if (kEpidNoErr != result) {
+    return result;
+  }
+  if (!b) {
+    return kEpidBadArgErr;
+  }
+  for (i = 0; i < m; i++) {
+    if (!b[i] || !b[i]->ipp_bn) {
       return kEpidBadArgErr;
     }
-    for (ii = 0; ii < i; ii++) {
-      if (a[i]->element_len != a[ii]->element_len) {
-        return kEpidBadArgErr;
-      }
-    }
   }
+  ipp_b = SAFE_ALLOC(m * sizeof(*ipp_b));
+  if (!ipp_b) {
+    return kEpidMemAllocErr;
+  }
+  for (i = 0; i < m; i++) {
+    ipp_b[i] = b[i]->ipp_bn;
+  }
+  result = EcMultiExpVarTime(g, a, ipp_b, m, r);
+  SAFE_FREE(ipp_b);
+  return result;
+}
 
-  if (g->ff->element_len != r->element_len) {
+EpidStatus EcSscmMultiExp(EcGroup* g, EcPoint const** a, BigNumStr const** b,
+                          size_t m, EcPoint* r) {
+  EpidStatus result = kEpidErr;
+  BigNum* b_bn = NULL;
+  EcPoint* ecp_t = NULL;
+  OctStr scratch_buffer = NULL;
+  size_t i = 0;
+
+  result = CheckMultiExpArgs(g, a, m, r);
+  if (kEpidNoErr != result) {
+    return result;
+  }
+  if (!b) {
     return kEpidBadArgErr;
   }
+  for (i = 0; i < m; i++) {
+    if (!b[i]) {
+      return kEpidBadArgErr;
+    }
+  }
 
   do {
     IppStatus sts = ippStsNoErr;
@@ -614,13 +1273,21 @@ EpidStatus EcMultiExp(EcGroup* g, EcPoint const** a, BigNumStr const** b,
     // Create temporal EcPoint element
     result = NewEcPoint(g, &ecp_t);
     if (kEpidNoErr != result) break;
+    // Allocate scratch buffer for ipp call
+    scratch_buffer = (OctStr)SAFE_ALLOC(g->scratch_buffer_size);
+    if (!scratch_buffer) {
+      result = kEpidMemAllocErr;
+      break;
+    }
 
+    // ippsGFpECMulPoint, ippsGFpECMulPointGLV and ippsGFpECMulPointGLS
+    // are side channel mitigated, so each power is applied separately
     for (i = 0; i < m; i++) {
       // Initialize big number element for ipp call
       result = ReadBigNum(b[i], sizeof(BigNumStr), b_bn);
       if (kEpidNoErr != result) break;
-      sts = ippsGFpECMulPoint(a[i]->ipp_ec_pt, b_bn->ipp_bn, ecp_t->ipp_ec_pt,
-                              g->ipp_ec, g->scratch_buffer);
+      sts = EcMulPointIpp(g, a[i]->ipp_ec_pt, b_bn->ipp_bn, ecp_t->ipp_ec_pt,
+                          scratch_buffer);
       if (ippStsNoErr != sts) {
         if (ippStsContextMatchErr == sts || ippStsRangeErr == sts ||
             ippStsOutOfRangeErr == sts)
@@ -648,79 +1315,131 @@ EpidStatus EcMultiExp(EcGroup* g, EcPoint const** a, BigNumStr const** b,
 
     result = kEpidNoErr;
   } while (0);
+  SAFE_FREE(scratch_buffer);
   DeleteBigNum(&b_bn);
   DeleteEcPoint(&ecp_t);
 
   return result;
 }
 
-EpidStatus EcMultiExpBn(EcGroup* g, EcPoint const** a, BigNum const** b,
-                        size_t m, EcPoint* r) {
+EpidStatus NewEcPointTable(EcGroup* g, EcPoint const* a, EcPointTable** t) {
+  EpidStatus result = kEpidErr;
+  EcPointTable* table = NULL;
+  do {
+    IppStatus sts = ippStsNoErr;
+    int sizeInBytes = 0;
+    // validate inputs
+    if (!g || !a || !t) {
+      result = kEpidBadArgErr;
+      break;
+    } else if (!g->ff || !g->ipp_ec || !a->ipp_ec_pt) {
+      result = kEpidBadArgErr;
+      break;
+    }
+    if (g->ff->element_len != a->element_len) {
+      result = kEpidBadArgErr;
+      break;
+    }
+    // get size
+    sts = ippsGFpECPointTableGetSize(g->ipp_ec, &sizeInBytes);
+    if (ippStsContextMatchErr == sts) {
+      result = kEpidBadArgErr;
+      break;
+    } else if (ippStsNoErr != sts) {
+      result = kEpidMathErr;
+      break;
+    }
+    // allocate memory
+    table = SAFE_ALLOC(sizeof(EcPointTable));
+    if (!table) {
+      result = kEpidMemAllocErr;
+      break;
+    }
+    table->ipp_table = (Ipp8u*)SAFE_ALLOC(sizeInBytes);
+    if (!table->ipp_table) {
+      result = kEpidMemAllocErr;
+      break;
+    }
+    // fill the table
+    sts = ippsGFpECPointTableInit(a->ipp_ec_pt, table->ipp_table, g->ipp_ec);
+    if (ippStsContextMatchErr == sts || ippStsOutOfRangeErr == sts) {
+      result = kEpidBadArgErr;
+      break;
+    } else if (ippStsNoErr != sts) {
+      result = kEpidMathErr;
+      break;
+    }
+    table->element_len = a->element_len;
+    *t = table;
+    result = kEpidNoErr;
+  } while (0);
+
+  if (kEpidNoErr != result) {
+    DeleteEcPointTable(&table);
+  }
+  return result;
+}
+
+void DeleteEcPointTable(EcPointTable** t) {
+  if (t) {
+    if (*t) {
+      SAFE_FREE((*t)->ipp_table);
+    }
+    SAFE_FREE(*t);
+  }
+}
+
+EpidStatus EcMultiExpTable(EcGroup* g, EcPointTable const** a,
+                           BigNumStr const** b, size_t m, EcPoint* r) {
   EpidStatus result = kEpidErr;
+  BigNum* b_bn = NULL;
   EcPoint* ecp_t = NULL;
   size_t i = 0;
-  size_t ii = 0;
 
   if (!g || !a || !b || !r) {
     return kEpidBadArgErr;
   }
-  if (!g->ff || !g->ipp_ec || m <= 0) {
+  if (!g->ff || !g->ipp_ec || !r->ipp_ec_pt || m <= 0) {
     return kEpidBadArgErr;
   }
-
-  // Verify that ec points are not NULL
   for (i = 0; i < m; i++) {
-    if (!a[i]) {
-      return kEpidBadArgErr;
-    }
-    if (!a[i]->ipp_ec_pt) {
-      return kEpidBadArgErr;
-    }
-    if (!b[i]) {
-      return kEpidBadArgErr;
-    }
-    if (!b[i]->ipp_bn) {
+    if (!a[i] || !b[i]) {
       return kEpidBadArgErr;
     }
-
-    if (g->ff->element_len != a[i]->element_len) {
+    if (!a[i]->ipp_table || g->ff->element_len != a[i]->element_len) {
       return kEpidBadArgErr;
     }
-    for (ii = 0; ii < i; ii++) {
-      if (a[i]->element_len != a[ii]->element_len) {
-        return kEpidBadArgErr;
-      }
-    }
   }
-
   if (g->ff->element_len != r->element_len) {
     return kEpidBadArgErr;
   }
 
   do {
     IppStatus sts = ippStsNoErr;
+
+    // Create big number element for ipp call
+    result = NewBigNum(sizeof(((BigNumStr*)0)->data.data), &b_bn);
+    if (kEpidNoErr != result) break;
     // Create temporal EcPoint element
     result = NewEcPoint(g, &ecp_t);
     if (kEpidNoErr != result) break;
 
     for (i = 0; i < m; i++) {
-      sts = ippsGFpECMulPoint(a[i]->ipp_ec_pt, b[i]->ipp_bn, ecp_t->ipp_ec_pt,
-                              g->ipp_ec, g->scratch_buffer);
+      // Initialize big number element for ipp call
+      result = ReadBigNum(b[i], sizeof(BigNumStr), b_bn);
+      if (kEpidNoErr != result) break;
+      sts = ippsGFpECMulPointTable(a[i]->ipp_table, b_bn->ipp_bn,
+                                   (i == 0) ? r->ipp_ec_pt : ecp_t->ipp_ec_pt,
+                                   g->ipp_ec);
       if (ippStsNoErr != sts) {
-        if (ippStsContextMatchErr == sts || ippStsRangeErr == sts ||
+        if (ippStsContextMatchErr == sts || ippStsBadArgErr == sts ||
             ippStsOutOfRangeErr == sts)
           result = kEpidBadArgErr;
         else
           result = kEpidMathErr;
         break;
       }
-      if (i == 0) {
-        sts = ippsGFpECCpyPoint(ecp_t->ipp_ec_pt, r->ipp_ec_pt, g->ipp_ec);
-        if (ippStsNoErr != sts) {
-          result = kEpidMathErr;
-          break;
-        }
-      } else {
+      if (i > 0) {
         sts = ippsGFpECAddPoint(ecp_t->ipp_ec_pt, r->ipp_ec_pt, r->ipp_ec_pt,
                                 g->ipp_ec);
         if (ippStsNoErr != sts) {
@@ -733,25 +1452,20 @@ EpidStatus EcMultiExpBn(EcGroup* g, EcPoint const** a, BigNum const** b,
 
     result = kEpidNoErr;
   } while (0);
+  DeleteBigNum(&b_bn);
   DeleteEcPoint(&ecp_t);
 
   return result;
 }
 
-EpidStatus EcSscmMultiExp(EcGroup* g, EcPoint const** a, BigNumStr const** b,
-                          size_t m, EcPoint* r) {
-  // call EcMultiExp directly because its implementation is side channel
-  // mitigated already
-  return EcMultiExp(g, a, b, m, r);
-}
-
 EpidStatus EcGetRandom(EcGroup* g, BitSupplier rnd_func, void* rnd_func_param,
                        EcPoint* r) {
   IppStatus sts = ippStsNoErr;
+  OctStr scratch_buffer = NULL;
   if (!g || !rnd_func || !r) {
     return kEpidBadArgErr;
   }
-  if (!g->ff || !g->ipp_ec || !g->scratch_buffer) {
+  if (!g->ff || !g->ipp_ec) {
     return kEpidBadArgErr;
   }
 
@@ -759,9 +1473,14 @@ EpidStatus EcGetRandom(EcGroup* g, BitSupplier rnd_func, void* rnd_func_param,
     return kEpidBadArgErr;
   }
 
+  scratch_buffer = (OctStr)SAFE_ALLOC(g->scratch_buffer_size);
+  if (!scratch_buffer) {
+    return kEpidMemAllocErr;
+  }
   sts =
       ippsGFpECSetPointRandom(r->ipp_ec_pt, g->ipp_ec, (IppBitSupplier)rnd_func,
-                              rnd_func_param, g->scratch_buffer);
+                              rnd_func_param, scratch_buffer);
+  SAFE_FREE(scratch_buffer);
   if (ippStsNoErr != sts) {
     if (ippStsContextMatchErr == sts) {
       return kEpidBadArgErr;
@@ -917,6 +1636,8 @@ EpidStatus Epid11EcHash(EcGroup* g, ConstOctStr msg, size_t msg_len,
 
   FiniteField* ff = NULL;
 
+  OctStr scratch_buffer = NULL;
+
   // check parameters
   if ((!msg && msg_len > 0) || !r || !g) {
     return kEpidBadArgErr;
@@ -1049,13 +1770,19 @@ EpidStatus Epid11EcHash(EcGroup* g, ConstOctStr msg, size_t msg_len,
                             g->ipp_ec);
     BREAK_ON_IPP_ERROR(sts, result);
     // R = E(&ff).exp(R,h)
+    scratch_buffer = (OctStr)SAFE_ALLOC(g->scratch_buffer_size);
+    if (!scratch_buffer) {
+      result = kEpidMemAllocErr;
+      break;
+    }
     sts = ippsGFpECMulPoint(r->ipp_ec_pt, h_bn->ipp_bn, r->ipp_ec_pt, g->ipp_ec,
-                            g->scratch_buffer);
+                            scratch_buffer);
     BREAK_ON_IPP_ERROR(sts, result);
 
     result = kEpidNoErr;
   } while (0);
 
+  SAFE_FREE(scratch_buffer);
   SAFE_FREE(hash_buf);
   DeleteFfElement(&a);
   DeleteFfElement(&b);
@@ -1075,6 +1802,7 @@ EpidStatus EcHash(EcGroup* g, ConstOctStr msg, size_t msg_len, HashAlg hash_alg,
   IppHashAlgId hash_id;
   int ipp_msg_len = 0;
   Ipp32u ipp_i = 0;
+  OctStr scratch_buffer = NULL;
   if (!g || (!msg && msg_len > 0) || !r) {
     return kEpidBadArgErr;
   } else if (!g->ff || !g->ipp_ec || !r->ipp_ec_pt) {
@@ -1103,11 +1831,16 @@ EpidStatus EcHash(EcGroup* g, ConstOctStr msg, size_t msg_len, HashAlg hash_alg,
     return kEpidBadArgErr;
   }
 
+  scratch_buffer = (OctStr)SAFE_ALLOC(g->scratch_buffer_size);
+  if (!scratch_buffer) {
+    return kEpidMemAllocErr;
+  }
   do {
     sts = ippsGFpECSetPointHash(ipp_i, msg, ipp_msg_len, r->ipp_ec_pt,
-                                g->ipp_ec, hash_id, g->scratch_buffer);
+                                g->ipp_ec, hash_id, scratch_buffer);
   } while (ippStsQuadraticNonResidueErr == sts &&
            ipp_i++ < EPID_ECHASH_WATCHDOG);
+  SAFE_FREE(scratch_buffer);
 
   if (iterations) {
     *iterations = (uint32_t)ipp_i;
@@ -1204,6 +1937,7 @@ EpidStatus EcIsEqual(EcGroup* g, EcPoint const* a, EcPoint const* b,
 EpidStatus EcIsIdentity(EcGroup* g, EcPoint const* p, bool* is_identity) {
   IppStatus sts;
   IppECResult result;
+  OctStr scratch_buffer = NULL;
 
   if (!g || !p || !is_identity) {
     return kEpidBadArgErr;
@@ -1223,8 +1957,13 @@ EpidStatus EcIsIdentity(EcGroup* g, EcPoint const* p, bool* is_identity) {
       return kEpidMathErr;
     }
   }
+  scratch_buffer = (OctStr)SAFE_ALLOC(g->scratch_buffer_size);
+  if (!scratch_buffer) {
+    return kEpidMemAllocErr;
+  }
   sts = ippsGFpECTstPointInSubgroup(p->ipp_ec_pt, &result, g->ipp_ec,
-                                    g->scratch_buffer);
+                                    scratch_buffer);
+  SAFE_FREE(scratch_buffer);
   if (ippStsNoErr != sts) {
     if (ippStsContextMatchErr == sts) {
       return kEpidBadArgErr;
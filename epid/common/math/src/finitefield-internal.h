@@ -47,6 +47,10 @@ struct FiniteField {
   BigNum* modulus_0;
 };
 
+/// Rounds size up so that objects placed after it are pointer aligned
+#define MATH_ALIGN_UP(size) \
+  (((size) + sizeof(void*) - 1) & ~(sizeof(void*) - 1))
+
 /// Finite Field Element
 struct FfElement {
   /// Internal implementation of finite field element
@@ -57,6 +61,22 @@ struct FfElement {
   int degree;
 };
 
+/// Comb table of an element of GT
+struct FfCombTable {
+  /// Internal implementation of the table
+  Ipp8u* ipp_table;
+  /// Size of element in BNU units
+  int element_len;
+};
+
+/// State of an incremental hash to a finite field element
+struct FfHashState {
+  /// Internal implementation of the hash
+  IppsHashState* ipp_hash_state;
+  /// Hash algorithm
+  HashAlg hash_alg;
+};
+
 EpidStatus SetFfElementOctString(ConstOctStr ff_elem_str, int strlen,
                                  struct FfElement* ff_elem,
                                  struct FiniteField* ff);
@@ -407,72 +407,104 @@ void DeleteFiniteField(FiniteField** ff) {
   }
 }
 
-EpidStatus NewFfElement(FiniteField const* ff, FfElement** new_ff_elem) {
-  EpidStatus result = kEpidErr;
-  IppsGFpElement* ipp_ff_elem = NULL;
-  FfElement* ff_elem = NULL;
-  do {
-    IppStatus sts = ippStsNoErr;
-    unsigned int ctxsize = 0;
-    Ipp32u zero = 0;
-    // check parameters
-    if (!ff || !new_ff_elem) {
-      result = kEpidBadArgErr;
-      break;
-    } else if (!ff->ipp_ff) {
-      result = kEpidBadArgErr;
-      break;
-    }
-    // Determine the memory requirement for finite field element context
-    sts = ippsGFpElementGetSize(ff->ipp_ff, (int*)&ctxsize);
-    if (ippStsNoErr != sts) {
-      result = kEpidMathErr;
-      break;
-    }
-    // Allocate space for ipp bignum context
-    ipp_ff_elem = (IppsGFpElement*)SAFE_ALLOC(ctxsize);
-    if (!ipp_ff_elem) {
-      result = kEpidMemAllocErr;
-      break;
-    }
-    // Initialize ipp bignum context
-    // initialize state
-    sts = ippsGFpElementInit(&zero, 1, ipp_ff_elem, ff->ipp_ff);
-    if (ippStsNoErr != sts) {
-      result = kEpidMathErr;
-      break;
-    }
-
-    ff_elem = (FfElement*)SAFE_ALLOC(sizeof(FfElement));
-    if (!ff_elem) {
-      result = kEpidMemAllocErr;
-      break;
-    }
-
-    ff_elem->ipp_ff_elem = ipp_ff_elem;
-    ff_elem->element_len = ff->element_len;
-    ff_elem->degree = ff->ground_degree;
+/// Places a new element at the start of mem, which is pointer aligned
+static EpidStatus PlaceFfElement(FiniteField const* ff, void* mem,
+                                 FfElement** ff_elem) {
+  IppStatus sts = ippStsNoErr;
+  Ipp32u zero = 0;
+  FfElement* elem = (FfElement*)mem;
+  IppsGFpElement* ipp_ff_elem =
+      (IppsGFpElement*)((Ipp8u*)mem + MATH_ALIGN_UP(sizeof(FfElement)));
+  // initialize state
+  sts = ippsGFpElementInit(&zero, 1, ipp_ff_elem, ff->ipp_ff);
+  if (ippStsNoErr != sts) {
+    return kEpidMathErr;
+  }
+  elem->ipp_ff_elem = ipp_ff_elem;
+  elem->element_len = ff->element_len;
+  elem->degree = ff->ground_degree;
+  *ff_elem = elem;
+  return kEpidNoErr;
+}
 
-    *new_ff_elem = ff_elem;
-    result = kEpidNoErr;
-  } while (0);
+/// Gets the size of an element and its ipp context in one block
+static EpidStatus GetFfElementBlockSize(FiniteField const* ff, size_t* size) {
+  int ctxsize = 0;
+  // Determine the memory requirement for finite field element context
+  IppStatus sts = ippsGFpElementGetSize(ff->ipp_ff, &ctxsize);
+  if (ippStsNoErr != sts) {
+    return kEpidMathErr;
+  }
+  *size = MATH_ALIGN_UP(sizeof(FfElement)) + (size_t)ctxsize;
+  return kEpidNoErr;
+}
 
+EpidStatus NewFfElement(FiniteField const* ff, FfElement** new_ff_elem) {
+  EpidStatus result = kEpidErr;
+  void* mem = NULL;
+  size_t size = 0;
+  // check parameters
+  if (!ff || !new_ff_elem) {
+    return kEpidBadArgErr;
+  } else if (!ff->ipp_ff) {
+    return kEpidBadArgErr;
+  }
+  result = GetFfElementBlockSize(ff, &size);
   if (kEpidNoErr != result) {
-    SAFE_FREE(ipp_ff_elem);
-    SAFE_FREE(ff_elem);
+    return result;
+  }
+  // the element and its ipp context share one allocation
+  mem = SAFE_ALLOC(size);
+  if (!mem) {
+    return kEpidMemAllocErr;
+  }
+  result = PlaceFfElement(ff, mem, new_ff_elem);
+  if (kEpidNoErr != result) {
+    SAFE_FREE(mem);
   }
   return result;
 }
 
 void DeleteFfElement(FfElement** ff_elem) {
   if (ff_elem) {
-    if (*ff_elem) {
-      SAFE_FREE((*ff_elem)->ipp_ff_elem);
-    }
     SAFE_FREE(*ff_elem);
   }
 }
 
+EpidStatus FfElementGetSize(FiniteField const* ff, size_t* size) {
+  EpidStatus result = kEpidErr;
+  size_t block_size = 0;
+  if (!ff || !size) {
+    return kEpidBadArgErr;
+  } else if (!ff->ipp_ff) {
+    return kEpidBadArgErr;
+  }
+  result = GetFfElementBlockSize(ff, &block_size);
+  if (kEpidNoErr != result) {
+    return result;
+  }
+  // room to align an arbitrary buffer
+  *size = block_size + sizeof(void*) - 1;
+  return kEpidNoErr;
+}
+
+EpidStatus InitFfElement(FiniteField const* ff, void* mem, size_t mem_size,
+                         FfElement** ff_elem) {
+  EpidStatus result = kEpidErr;
+  size_t size = 0;
+  if (!mem || !ff_elem) {
+    return kEpidBadArgErr;
+  }
+  result = FfElementGetSize(ff, &size);
+  if (kEpidNoErr != result) {
+    return result;
+  }
+  if (mem_size < size) {
+    return kEpidBadArgErr;
+  }
+  return PlaceFfElement(ff, (void*)MATH_ALIGN_UP((uintptr_t)mem), ff_elem);
+}
+
 EpidStatus IsValidFfElemOctString(ConstOctStr ff_elem_str, int strlen,
                                   FiniteField const* ff) {
   int i;
@@ -1182,6 +1214,156 @@ EpidStatus FfSscmMultiExp(FiniteField* ff, FfElement const** p,
   return FfMultiExp(ff, p, b, m, r);
 }
 
+/// Bit size of the powers of FfMultiExpComb
+#define COMB_TABLE_POWER_BITS ((int)(8 * sizeof(((BigNumStr*)0)->data.data)))
+
+EpidStatus NewFfCombTable(FiniteField* ff, FfCombTable** t) {
+  EpidStatus result = kEpidErr;
+  FfCombTable* table = NULL;
+  do {
+    IppStatus sts = ippStsNoErr;
+    int sizeInBytes = 0;
+    // validate inputs
+    if (!ff || !t) {
+      result = kEpidBadArgErr;
+      break;
+    } else if (!ff->ipp_ff) {
+      result = kEpidBadArgErr;
+      break;
+    }
+    // get size, fails unless ff is GT
+    sts = ippsGFpxCyclotomicCombTableGetSize(ff->ipp_ff, &sizeInBytes);
+    if (ippStsContextMatchErr == sts || ippStsBadArgErr == sts) {
+      result = kEpidBadArgErr;
+      break;
+    } else if (ippStsNoErr != sts) {
+      result = kEpidMathErr;
+      break;
+    }
+    // allocate memory
+    table = SAFE_ALLOC(sizeof(FfCombTable));
+    if (!table) {
+      result = kEpidMemAllocErr;
+      break;
+    }
+    table->ipp_table = (Ipp8u*)SAFE_ALLOC(sizeInBytes);
+    if (!table->ipp_table) {
+      result = kEpidMemAllocErr;
+      break;
+    }
+    table->element_len = ff->element_len;
+    *t = table;
+    result = kEpidNoErr;
+  } while (0);
+
+  if (kEpidNoErr != result) {
+    DeleteFfCombTable(&table);
+  }
+  return result;
+}
+
+void DeleteFfCombTable(FfCombTable** t) {
+  if (t) {
+    if (*t) {
+      SAFE_FREE((*t)->ipp_table);
+    }
+    SAFE_FREE(*t);
+  }
+}
+
+EpidStatus InitFfCombTable(FiniteField* ff, FfElement const* a,
+                           FfCombTable* t) {
+  IppStatus sts = ippStsNoErr;
+  if (!ff || !a || !t) {
+    return kEpidBadArgErr;
+  }
+  if (!ff->ipp_ff || !a->ipp_ff_elem || !t->ipp_table) {
+    return kEpidBadArgErr;
+  }
+  if (ff->element_len != a->element_len || ff->element_len != t->element_len) {
+    return kEpidBadArgErr;
+  }
+  sts = ippsGFpxCyclotomicCombTableInit(a->ipp_ff_elem, COMB_TABLE_POWER_BITS,
+                                        t->ipp_table, ff->ipp_ff);
+  if (ippStsContextMatchErr == sts || ippStsOutOfRangeErr == sts ||
+      ippStsBadArgErr == sts) {
+    return kEpidBadArgErr;
+  } else if (ippStsNoErr != sts) {
+    return kEpidMathErr;
+  }
+  return kEpidNoErr;
+}
+
+EpidStatus FfMultiExpComb(FiniteField* ff, FfCombTable const** a,
+                          BigNumStr const** b, size_t m, FfElement* r) {
+  EpidStatus result = kEpidErr;
+  Ipp8u const** ipp_a = NULL;
+  IppsBigNumState const** ipp_b = NULL;
+  BigNum** b_bn = NULL;
+  size_t i = 0;
+
+  if (!ff || !a || !b || !r) {
+    return kEpidBadArgErr;
+  }
+  if (!ff->ipp_ff || !r->ipp_ff_elem || m <= 0 || m > INT_MAX) {
+    return kEpidBadArgErr;
+  }
+  for (i = 0; i < m; i++) {
+    if (!a[i] || !b[i]) {
+      return kEpidBadArgErr;
+    }
+    if (!a[i]->ipp_table || ff->element_len != a[i]->element_len) {
+      return kEpidBadArgErr;
+    }
+  }
+  if (ff->element_len != r->element_len) {
+    return kEpidBadArgErr;
+  }
+
+  do {
+    IppStatus sts = ippStsNoErr;
+    ipp_a = SAFE_ALLOC(m * sizeof(*ipp_a));
+    ipp_b = SAFE_ALLOC(m * sizeof(*ipp_b));
+    b_bn = SAFE_ALLOC(m * sizeof(*b_bn));
+    if (!ipp_a || !ipp_b || !b_bn) {
+      result = kEpidMemAllocErr;
+      break;
+    }
+    for (i = 0; i < m; i++) {
+      // Create and initialize big number elements for ipp call
+      result = NewBigNum(sizeof(((BigNumStr*)0)->data.data), &b_bn[i]);
+      if (kEpidNoErr != result) break;
+      result = ReadBigNum(b[i], sizeof(BigNumStr), b_bn[i]);
+      if (kEpidNoErr != result) break;
+      ipp_a[i] = a[i]->ipp_table;
+      ipp_b[i] = b_bn[i]->ipp_bn;
+    }
+    if (kEpidNoErr != result) break;
+
+    sts = ippsGFpxCyclotomicMultiExpComb(ipp_a, ipp_b, (int)m, r->ipp_ff_elem,
+                                         ff->ipp_ff);
+    if (ippStsNoErr != sts) {
+      if (ippStsContextMatchErr == sts || ippStsBadArgErr == sts ||
+          ippStsOutOfRangeErr == sts)
+        result = kEpidBadArgErr;
+      else
+        result = kEpidMathErr;
+      break;
+    }
+    result = kEpidNoErr;
+  } while (0);
+  if (b_bn) {
+    for (i = 0; i < m; i++) {
+      DeleteBigNum(&b_bn[i]);
+    }
+  }
+  SAFE_FREE(b_bn);
+  SAFE_FREE(ipp_b);
+  SAFE_FREE(ipp_a);
+
+  return result;
+}
+
 EpidStatus FfIsEqual(FiniteField* ff, FfElement const* a, FfElement const* b,
                      bool* is_equal) {
   IppStatus sts;
@@ -1263,6 +1445,154 @@ EpidStatus FfHash(FiniteField* ff, ConstOctStr msg, size_t msg_len,
   return result;
 }
 
+/// Maps a hash algorithm to the matching IPP hash algorithm id
+static EpidStatus GetIppHashAlgId(HashAlg hash_alg, IppHashAlgId* hash_id) {
+  if (kSha256 == hash_alg) {
+    *hash_id = ippHashAlg_SHA256;
+  } else if (kSha384 == hash_alg) {
+    *hash_id = ippHashAlg_SHA384;
+  } else if (kSha512 == hash_alg) {
+    *hash_id = ippHashAlg_SHA512;
+  } else if (kSha512_256 == hash_alg) {
+    *hash_id = ippHashAlg_SHA512_256;
+  } else {
+    return kEpidHashAlgorithmNotSupported;
+  }
+  return kEpidNoErr;
+}
+
+EpidStatus NewFfHashState(HashAlg hash_alg, FfHashState** state) {
+  EpidStatus result = kEpidErr;
+  FfHashState* hash_state = NULL;
+  IppsHashState* ipp_hash_state = NULL;
+  do {
+    IppStatus sts = ippStsNoErr;
+    IppHashAlgId hash_id;
+    int state_size = 0;
+    if (!state) {
+      result = kEpidBadArgErr;
+      break;
+    }
+    result = GetIppHashAlgId(hash_alg, &hash_id);
+    if (kEpidNoErr != result) {
+      break;
+    }
+    sts = ippsHashGetSize(&state_size);
+    if (ippStsNoErr != sts) {
+      result = kEpidMathErr;
+      break;
+    }
+    ipp_hash_state = (IppsHashState*)SAFE_ALLOC(state_size);
+    if (!ipp_hash_state) {
+      result = kEpidMemAllocErr;
+      break;
+    }
+    sts = ippsHashInit(ipp_hash_state, hash_id);
+    if (ippStsNoErr != sts) {
+      result = kEpidMathErr;
+      break;
+    }
+    hash_state = (FfHashState*)SAFE_ALLOC(sizeof(FfHashState));
+    if (!hash_state) {
+      result = kEpidMemAllocErr;
+      break;
+    }
+    hash_state->ipp_hash_state = ipp_hash_state;
+    hash_state->hash_alg = hash_alg;
+    *state = hash_state;
+    result = kEpidNoErr;
+  } while (0);
+  if (kEpidNoErr != result) {
+    SAFE_FREE(ipp_hash_state);
+  }
+  return result;
+}
+
+void DeleteFfHashState(FfHashState** state) {
+  if (state) {
+    if (*state) {
+      SAFE_FREE((*state)->ipp_hash_state);
+    }
+    SAFE_FREE(*state);
+  }
+}
+
+EpidStatus FfHashStateCopy(FfHashState const* src, FfHashState* dst) {
+  IppStatus sts = ippStsNoErr;
+  if (!src || !dst || !src->ipp_hash_state || !dst->ipp_hash_state) {
+    return kEpidBadArgErr;
+  }
+  if (src->hash_alg != dst->hash_alg) {
+    return kEpidBadArgErr;
+  }
+  sts = ippsHashDuplicate(src->ipp_hash_state, dst->ipp_hash_state);
+  if (ippStsNoErr != sts) {
+    return kEpidMathErr;
+  }
+  return kEpidNoErr;
+}
+
+EpidStatus FfHashUpdate(FfHashState* state, ConstOctStr msg, size_t msg_len) {
+  uint8_t const* next = (uint8_t const*)msg;
+  if (!state || !state->ipp_hash_state || (!msg && 0 != msg_len)) {
+    return kEpidBadArgErr;
+  }
+  // ipp takes the length as "int", so longer messages are added in parts
+  while (msg_len > 0) {
+    int part_len = (int)MIN(msg_len, INT_MAX);
+    IppStatus sts = ippsHashUpdate(next, part_len, state->ipp_hash_state);
+    if (ippStsNoErr != sts) {
+      return kEpidMathErr;
+    }
+    next += part_len;
+    msg_len -= (size_t)part_len;
+  }
+  return kEpidNoErr;
+}
+
+EpidStatus FfHashFinal(FiniteField* ff, FfHashState* state, FfElement* r) {
+  EpidStatus result = kEpidErr;
+  BigNum* hash_bn = NULL;
+  Ipp8u digest[64] = {0};
+  do {
+    IppStatus sts = ippStsNoErr;
+    size_t digest_size = 0;
+    if (!ff || !state || !r) {
+      result = kEpidBadArgErr;
+      break;
+    }
+    if (!ff->ipp_ff || !state->ipp_hash_state || !r->ipp_ff_elem) {
+      result = kEpidBadArgErr;
+      break;
+    }
+    if (kSha256 == state->hash_alg || kSha512_256 == state->hash_alg) {
+      digest_size = 32;
+    } else if (kSha384 == state->hash_alg) {
+      digest_size = 48;
+    } else {
+      digest_size = 64;
+    }
+    sts = ippsHashFinal(digest, state->ipp_hash_state);
+    if (ippStsNoErr != sts) {
+      result = kEpidMathErr;
+      break;
+    }
+    // Fp.hash(m) is the digest of m reduced modulo the field prime
+    result = NewBigNum(digest_size, &hash_bn);
+    if (kEpidNoErr != result) {
+      break;
+    }
+    result = ReadBigNum(digest, digest_size, hash_bn);
+    if (kEpidNoErr != result) {
+      break;
+    }
+    result = InitFfElementFromBn(ff, hash_bn, r);
+  } while (0);
+  EpidZeroMemory(digest, sizeof(digest));
+  DeleteBigNum(&hash_bn);
+  return result;
+}
+
 /// Number of tries for RNG
 #define RNG_WATCHDOG (10)
 EpidStatus FfGetRandom(FiniteField* ff, BigNumStr const* low_bound,
@@ -22,6 +22,9 @@
 #ifndef EPID_COMMON_MATH_SRC_PAIRING_INTERNAL_H_
 #define EPID_COMMON_MATH_SRC_PAIRING_INTERNAL_H_
 
+#include <limits.h>
+#include "epid/common/types.h"
+
 /// Pairing State
 struct PairingState {
   EcGroup* ga;      ///< elliptic curve group G1
@@ -34,6 +37,17 @@ struct PairingState {
   FiniteField* Fq;     ///< Fq
   FiniteField* Fq2;    ///< Fq2
   FiniteField* Fq6;    ///< Fq6
+  /// ternary representation of the Miller loop length s = 6t + 2, or
+  /// s = 6t - 2 if neg, least significant digit first
+  int s_ternary[sizeof(BigNumStr) * CHAR_BIT];
+  int s_ternary_len;  ///< number of digits in s_ternary
+  size_t num_lines;   ///< number of lines in the Miller loop
+};
+
+/// Miller loop line coefficients of a G2 point
+struct PreparedG2 {
+  size_t num_lines;    ///< number of lines in the Miller loop
+  FfElement** coeffs;  ///< 3 elements in Fq2 per line
 };
 
 #endif  // EPID_COMMON_MATH_SRC_PAIRING_INTERNAL_H_
@@ -79,6 +79,13 @@ typedef struct Fq12ElemDat {
 #pragma pack()
 
 // Forward Declarations
+static EpidStatus DoPairing(PairingState* ps, EcPoint const* a,
+                            EcPoint const* b, FfElement* d, bool check_input);
+
+static EpidStatus DoPairingProduct(PairingState* ps, EcPoint const** a,
+                                   PreparedG2 const** b, size_t m,
+                                   FfElement* d, bool check_input);
+
 static EpidStatus FinalExp(PairingState* ps, FfElement* d, FfElement const* h);
 
 static EpidStatus PiOp(PairingState* ps, FfElement* x_out, FfElement* y_out,
@@ -100,6 +107,9 @@ static EpidStatus Tangent(FiniteField* gt, FfElement* f, FfElement* x_out,
                           FfElement const* x, FfElement const* y,
                           FfElement const* z, FfElement const* z2);
 
+static EpidStatus LoopTernary(PairingState* ps, int* s, int* n,
+                              int max_elements);
+
 static EpidStatus Ternary(int* s, int* n, int max_elements, BigNum const* x);
 
 static int Bit(Ipp32u const* num, Ipp32u bit_index);
@@ -114,6 +124,9 @@ static EpidStatus Fq6MulGFpE2(FfElement* e, FfElement* a, FfElement* b0,
 static EpidStatus MulSpecial(FfElement* e, FfElement const* a,
                              FfElement const* b, PairingState* ps);
 
+static EpidStatus MulSparse(FfElement* e, FfElement const* a, FfElement* b0,
+                            FfElement* b1, FfElement* b3, PairingState* ps);
+
 static EpidStatus SquareCyclotomic(PairingState* ps, FfElement* e_out,
                                    FfElement const* a_in);
 
@@ -269,6 +282,18 @@ EpidStatus NewPairingState(EcGroup const* ga, EcGroup const* gb,
     // 6. Save g[0][0], ..., g[0][4], g[1][0], ..., g[1][4], g[2][0], ...,
     // g[2][4]
     //    for the pairing operations.
+    // 7. Save the ternary representation of the Miller loop length s
+    //    and the number of lines it takes for the pairing operations.
+    result = LoopTernary(pairing_state_ctx, pairing_state_ctx->s_ternary,
+                         &pairing_state_ctx->s_ternary_len,
+                         sizeof(pairing_state_ctx->s_ternary) /
+                             sizeof(pairing_state_ctx->s_ternary[0]));
+    BREAK_ON_EPID_ERROR(result);
+    pairing_state_ctx->num_lines = 2;
+    for (i = 0; i < pairing_state_ctx->s_ternary_len; i++) {
+      pairing_state_ctx->num_lines +=
+          (0 != pairing_state_ctx->s_ternary[i]) ? 2 : 1;
+    }
     *ps = pairing_state_ctx;
     result = kEpidNoErr;
   } while (0);
@@ -318,8 +343,41 @@ void DeletePairingState(PairingState** ps) {
   }
 }
 
+EpidStatus PairingSetG2Frobenius(PairingState* ps) {
+  EpidStatus result = kEpidErr;
+  BigNumStr t_str = {0};
+  if (!ps) {
+    return kEpidBadArgErr;
+  }
+  if (!ps->gb || !ps->t) {
+    return kEpidBadArgErr;
+  }
+  // psi(x, y) = (conj(x) * g[0][1], conj(y) * g[0][2]) as in PiOp with e = 1
+  result = WriteBigNum(ps->t, sizeof(t_str), &t_str);
+  if (kEpidNoErr != result) {
+    return result;
+  }
+  return EcSetFrobenius(ps->gb, ps->g[0][1], ps->g[0][2], &t_str, ps->neg);
+}
+
 EpidStatus Pairing(PairingState* ps, EcPoint const* a, EcPoint const* b,
                    FfElement* d) {
+  return DoPairing(ps, a, b, d, true);
+}
+
+EpidStatus PairingTrusted(PairingState* ps, EcPoint const* a,
+                          EcPoint const* b, FfElement* d) {
+  return DoPairing(ps, a, b, d, false);
+}
+
+/*
+d = pairing(a, b)
+Input: a (an element in G1), b (an element in G2), check_input (check that
+a and b are in the groups of ps)
+Output: d (an element in GT)
+*/
+static EpidStatus DoPairing(PairingState* ps, EcPoint const* a,
+                            EcPoint const* b, FfElement* d, bool check_input) {
   EpidStatus result = kEpidErr;
   FfElement* ax = NULL;
   FfElement* ay = NULL;
@@ -332,22 +390,15 @@ EpidStatus Pairing(PairingState* ps, EcPoint const* a, EcPoint const* b,
   FfElement* bx_ = NULL;
   FfElement* by_ = NULL;
   FfElement* f = NULL;
-  BigNum* s = NULL;
-  BigNum* two = NULL;
-  BigNum* six = NULL;
   FfElement* neg_qy = NULL;
 
   do {
     IppStatus sts = ippStsNoErr;
-    Ipp32u two_dat[] = {2};
-    Ipp32u six_dat[] = {6};
     Ipp32u one_dat[] = {1};
     G1ElemStr first_val_str = {0};
     G2ElemStr second_val_str = {0};
     bool in_group = true;
-    int s_ternary[sizeof(BigNumStr) * CHAR_BIT] = {0};
     int i = 0;
-    int n = 0;
     // check parameters
     if (!ps || !d || !a || !b) {
       result = kEpidBadArgErr;
@@ -393,56 +444,39 @@ EpidStatus Pairing(PairingState* ps, EcPoint const* a, EcPoint const* b,
 
     // 1. If neg = 0, compute integer s = 6t + 2, otherwise, compute
     // s = 6t - 2
-    result = NewBigNum(sizeof(BigNumStr), &s);
-    BREAK_ON_EPID_ERROR(result);
-    result = NewBigNum(sizeof(BigNumStr), &two);
-    BREAK_ON_EPID_ERROR(result);
-    sts = ippsSet_BN(IppsBigNumPOS, sizeof(two_dat) / sizeof(Ipp32u), two_dat,
-                     two->ipp_bn);
-    BREAK_ON_IPP_ERROR(sts, result);
-    result = NewBigNum(sizeof(BigNumStr), &six);
-    BREAK_ON_EPID_ERROR(result);
-    sts = ippsSet_BN(IppsBigNumPOS, sizeof(six_dat) / sizeof(Ipp32u), six_dat,
-                     six->ipp_bn);
-    BREAK_ON_IPP_ERROR(sts, result);
-    sts = ippsMul_BN(six->ipp_bn, ps->t->ipp_bn, s->ipp_bn);
-    BREAK_ON_IPP_ERROR(sts, result);
-    if (ps->neg) {
-      sts = ippsSub_BN(s->ipp_bn, two->ipp_bn, s->ipp_bn);
-      BREAK_ON_IPP_ERROR(sts, result);
-    } else {
-      sts = ippsAdd_BN(s->ipp_bn, two->ipp_bn, s->ipp_bn);
-      BREAK_ON_IPP_ERROR(sts, result);
-    }
     // 2. Let sn...s1s0 be the ternary representation of s, that is s =
     // s0 + 2*s1 + ... + 2^n*sn, where si is in {-1, 0, 1}.
-    result =
-        Ternary(s_ternary, &n, sizeof(s_ternary) / sizeof(s_ternary[0]), s);
-    BREAK_ON_EPID_ERROR(result);
+    //    s is fixed by ps, so its representation is computed by
+    //    NewPairingState.
     // 3. Set (ax, ay) = E(Fq).outputPoint(a)
     // check if a is in ga that was used to create ps
-    result = WriteEcPoint(ps->ga, a, &first_val_str, sizeof(first_val_str));
-    BREAK_ON_EPID_ERROR(result);
-    result =
-        EcInGroup(ps->ga, &first_val_str, sizeof(first_val_str), &in_group);
-    BREAK_ON_EPID_ERROR(result);
-    if (false == in_group) {
-      result = kEpidBadArgErr;
-      break;
+    if (check_input) {
+      result = WriteEcPoint(ps->ga, a, &first_val_str, sizeof(first_val_str));
+      BREAK_ON_EPID_ERROR(result);
+      result =
+          EcInGroup(ps->ga, &first_val_str, sizeof(first_val_str), &in_group);
+      BREAK_ON_EPID_ERROR(result);
+      if (false == in_group) {
+        result = kEpidBadArgErr;
+        break;
+      }
     }
     sts = ippsGFpECGetPoint(a->ipp_ec_pt, ax->ipp_ff_elem, ay->ipp_ff_elem,
                             ps->ga->ipp_ec);
     BREAK_ON_IPP_ERROR(sts, result);
     // 4. Set (bx, by) = E(Fq2).outputPoint(b).
     // check if b is in gb that was used to create ps
-    result = WriteEcPoint(ps->gb, b, &second_val_str, sizeof(second_val_str));
-    BREAK_ON_EPID_ERROR(result);
-    result =
-        EcInGroup(ps->gb, &second_val_str, sizeof(second_val_str), &in_group);
-    BREAK_ON_EPID_ERROR(result);
-    if (false == in_group) {
-      result = kEpidBadArgErr;
-      break;
+    if (check_input) {
+      result =
+          WriteEcPoint(ps->gb, b, &second_val_str, sizeof(second_val_str));
+      BREAK_ON_EPID_ERROR(result);
+      result = EcInGroup(ps->gb, &second_val_str, sizeof(second_val_str),
+                         &in_group);
+      BREAK_ON_EPID_ERROR(result);
+      if (false == in_group) {
+        result = kEpidBadArgErr;
+        break;
+      }
     }
     sts = ippsGFpECGetPoint(b->ipp_ec_pt, bx->ipp_ff_elem, by->ipp_ff_elem,
                             ps->gb->ipp_ec);
@@ -463,7 +497,7 @@ EpidStatus Pairing(PairingState* ps, EcPoint const* a, EcPoint const* b,
                             d->ipp_ff_elem, ps->ff->ipp_ff);
     BREAK_ON_IPP_ERROR(sts, result);
     // 7. For i = n-1, ..., 0, do the following:
-    for (i = n - 1; i >= 0; i--) {
+    for (i = ps->s_ternary_len - 1; i >= 0; i--) {
       // a. Set (f, x, y, z, z2) = tangent(ax, ay, x, y, z, z2),
       result = Tangent(ps->ff, f, x, y, z, z2, ax, ay, x, y, z, z2);
       BREAK_ON_EPID_ERROR(result);
@@ -475,7 +509,7 @@ EpidStatus Pairing(PairingState* ps, EcPoint const* a, EcPoint const* b,
       result = MulSpecial(d, d, f, ps);
       BREAK_ON_EPID_ERROR(result);
       // d. If s[i] = -1 then
-      if (-1 == s_ternary[i]) {
+      if (-1 == ps->s_ternary[i]) {
         // i. Set (f, x, y, z, z2) = line(ax, ay, x, y, z, z2, bx,
         // -by),
         BREAK_ON_EPID_ERROR(result);
@@ -488,7 +522,7 @@ EpidStatus Pairing(PairingState* ps, EcPoint const* a, EcPoint const* b,
         BREAK_ON_EPID_ERROR(result);
       }
       // e. If s[i] = 1 then
-      if (1 == s_ternary[i]) {
+      if (1 == ps->s_ternary[i]) {
         // i. Set (f, x, y, z, z2) = line(ax, ay, x, y, z, z2, bx,
         // by),
         result = Line(ps->ff, f, x, y, z, z2, ax, ay, x, y, z, z2, bx, by);
@@ -549,9 +583,394 @@ EpidStatus Pairing(PairingState* ps, EcPoint const* a, EcPoint const* b,
   DeleteFfElement(&f);
   DeleteFfElement(&neg_qy);
 
-  DeleteBigNum(&s);
-  DeleteBigNum(&two);
-  DeleteBigNum(&six);
+  return result;
+}
+
+/*
+(c[0], c[1], c[2]) = lineCoeffs(f)
+Input: f (an element in GT) where f = ((c[0], 0, 0), (c[1], c[2], 0))
+Output: c[0], c[1], c[2] (newly allocated elements in Fq2)
+*/
+static EpidStatus LineCoeffs(PairingState* ps, FfElement const* f,
+                             FfElement** c) {
+  EpidStatus result = kEpidErr;
+  Fq12ElemDat f_dat = {0};
+  do {
+    IppStatus sts = ippStsNoErr;
+    Fq2ElemDat* c_dat[3];
+    size_t i = 0;
+    c_dat[0] = &f_dat.x[0].x[0];
+    c_dat[1] = &f_dat.x[1].x[0];
+    c_dat[2] = &f_dat.x[1].x[1];
+    sts = ippsGFpGetElement(f->ipp_ff_elem, (BNU)&f_dat,
+                            sizeof(f_dat) / sizeof(Ipp32u), ps->ff->ipp_ff);
+    BREAK_ON_IPP_ERROR(sts, result);
+    result = kEpidNoErr;
+    for (i = 0; i < 3; i++) {
+      result = NewFfElement(ps->Fq2, &c[i]);
+      BREAK_ON_EPID_ERROR(result);
+      sts = ippsGFpSetElement((Ipp32u*)c_dat[i],
+                              sizeof(Fq2ElemDat) / sizeof(Ipp32u),
+                              c[i]->ipp_ff_elem, ps->Fq2->ipp_ff);
+      BREAK_ON_IPP_ERROR(sts, result);
+    }
+  } while (0);
+  EpidZeroMemory(&f_dat, sizeof(f_dat));
+  return result;
+}
+
+EpidStatus NewPreparedG2(PairingState* ps, EcPoint const* b,
+                         PreparedG2** pb) {
+  EpidStatus result = kEpidErr;
+  PreparedG2* prepared = NULL;
+  FfElement* one = NULL;
+  FfElement* bx = NULL;
+  FfElement* by = NULL;
+  FfElement* x = NULL;
+  FfElement* y = NULL;
+  FfElement* z = NULL;
+  FfElement* z2 = NULL;
+  FfElement* bx_ = NULL;
+  FfElement* by_ = NULL;
+  FfElement* neg_qy = NULL;
+  FfElement* f = NULL;
+
+  do {
+    IppStatus sts = ippStsNoErr;
+    Ipp32u one_dat[] = {1};
+    G2ElemStr b_str = {0};
+    bool in_group = true;
+    int i = 0;
+    size_t k = 0;
+    if (!ps || !b || !pb) {
+      result = kEpidBadArgErr;
+      break;
+    }
+    if (!b->ipp_ec_pt || !ps->ff || !ps->ff->ipp_ff || !ps->Fq ||
+        !ps->Fq->ipp_ff || !ps->Fq2 || !ps->Fq2->ipp_ff || !ps->gb ||
+        !ps->gb->ipp_ec) {
+      result = kEpidBadArgErr;
+      break;
+    }
+    // check if b is in gb that was used to create ps
+    result = WriteEcPoint(ps->gb, b, &b_str, sizeof(b_str));
+    BREAK_ON_EPID_ERROR(result);
+    result = EcInGroup(ps->gb, &b_str, sizeof(b_str), &in_group);
+    BREAK_ON_EPID_ERROR(result);
+    if (false == in_group) {
+      result = kEpidBadArgErr;
+      break;
+    }
+
+    prepared = SAFE_ALLOC(sizeof(PreparedG2));
+    if (!prepared) {
+      result = kEpidMemAllocErr;
+      break;
+    }
+    prepared->coeffs = SAFE_ALLOC(3 * ps->num_lines * sizeof(FfElement*));
+    if (!prepared->coeffs) {
+      result = kEpidMemAllocErr;
+      break;
+    }
+    prepared->num_lines = ps->num_lines;
+
+    result = NewFfElement(ps->Fq, &one);
+    BREAK_ON_EPID_ERROR(result);
+    result = NewFfElement(ps->Fq2, &bx);
+    BREAK_ON_EPID_ERROR(result);
+    result = NewFfElement(ps->Fq2, &by);
+    BREAK_ON_EPID_ERROR(result);
+    result = NewFfElement(ps->Fq2, &x);
+    BREAK_ON_EPID_ERROR(result);
+    result = NewFfElement(ps->Fq2, &y);
+    BREAK_ON_EPID_ERROR(result);
+    result = NewFfElement(ps->Fq2, &z);
+    BREAK_ON_EPID_ERROR(result);
+    result = NewFfElement(ps->Fq2, &z2);
+    BREAK_ON_EPID_ERROR(result);
+    result = NewFfElement(ps->Fq2, &bx_);
+    BREAK_ON_EPID_ERROR(result);
+    result = NewFfElement(ps->Fq2, &by_);
+    BREAK_ON_EPID_ERROR(result);
+    result = NewFfElement(ps->Fq2, &neg_qy);
+    BREAK_ON_EPID_ERROR(result);
+    result = NewFfElement(ps->ff, &f);
+    BREAK_ON_EPID_ERROR(result);
+
+    // Line and tangent values are ((c0 * Py, 0, 0), (c1 * Px, c2, 0))
+    // where c0, c1 and c2 only depend on b, so running the Miller loop of
+    // Pairing with Px = Py = 1 yields the coefficients.
+    sts = ippsGFpSetElement(one_dat, sizeof(one_dat) / sizeof(Ipp32u),
+                            one->ipp_ff_elem, ps->Fq->ipp_ff);
+    BREAK_ON_IPP_ERROR(sts, result);
+    sts = ippsGFpECGetPoint(b->ipp_ec_pt, bx->ipp_ff_elem, by->ipp_ff_elem,
+                            ps->gb->ipp_ec);
+    BREAK_ON_IPP_ERROR(sts, result);
+    sts = ippsGFpNeg(by->ipp_ff_elem, neg_qy->ipp_ff_elem, ps->Fq2->ipp_ff);
+    BREAK_ON_IPP_ERROR(sts, result);
+    sts = ippsGFpCpyElement(bx->ipp_ff_elem, x->ipp_ff_elem, ps->Fq2->ipp_ff);
+    BREAK_ON_IPP_ERROR(sts, result);
+    sts = ippsGFpCpyElement(by->ipp_ff_elem, y->ipp_ff_elem, ps->Fq2->ipp_ff);
+    BREAK_ON_IPP_ERROR(sts, result);
+    sts = ippsGFpSetElement(one_dat, sizeof(one_dat) / sizeof(Ipp32u),
+                            z->ipp_ff_elem, ps->Fq2->ipp_ff);
+    BREAK_ON_IPP_ERROR(sts, result);
+    sts = ippsGFpSetElement(one_dat, sizeof(one_dat) / sizeof(Ipp32u),
+                            z2->ipp_ff_elem, ps->Fq2->ipp_ff);
+    BREAK_ON_IPP_ERROR(sts, result);
+    for (i = ps->s_ternary_len - 1; i >= 0; i--) {
+      result = Tangent(ps->ff, f, x, y, z, z2, one, one, x, y, z, z2);
+      BREAK_ON_EPID_ERROR(result);
+      result = LineCoeffs(ps, f, &prepared->coeffs[3 * k++]);
+      BREAK_ON_EPID_ERROR(result);
+      if (0 != ps->s_ternary[i]) {
+        result = Line(ps->ff, f, x, y, z, z2, one, one, x, y, z, z2, bx,
+                      (-1 == ps->s_ternary[i]) ? neg_qy : by);
+        BREAK_ON_EPID_ERROR(result);
+        result = LineCoeffs(ps, f, &prepared->coeffs[3 * k++]);
+        BREAK_ON_EPID_ERROR(result);
+      }
+    }
+    BREAK_ON_EPID_ERROR(result);
+    if (ps->neg) {
+      sts = ippsGFpNeg(y->ipp_ff_elem, y->ipp_ff_elem, ps->Fq2->ipp_ff);
+      BREAK_ON_IPP_ERROR(sts, result);
+    }
+    result = PiOp(ps, bx_, by_, bx, by, 1);
+    BREAK_ON_EPID_ERROR(result);
+    result = Line(ps->ff, f, x, y, z, z2, one, one, x, y, z, z2, bx_, by_);
+    BREAK_ON_EPID_ERROR(result);
+    result = LineCoeffs(ps, f, &prepared->coeffs[3 * k++]);
+    BREAK_ON_EPID_ERROR(result);
+    result = PiOp(ps, bx_, by_, bx, by, 2);
+    BREAK_ON_EPID_ERROR(result);
+    sts = ippsGFpNeg(by_->ipp_ff_elem, by_->ipp_ff_elem, ps->Fq2->ipp_ff);
+    BREAK_ON_IPP_ERROR(sts, result);
+    result = Line(ps->ff, f, x, y, z, z2, one, one, x, y, z, z2, bx_, by_);
+    BREAK_ON_EPID_ERROR(result);
+    result = LineCoeffs(ps, f, &prepared->coeffs[3 * k++]);
+    BREAK_ON_EPID_ERROR(result);
+
+    *pb = prepared;
+    prepared = NULL;
+    result = kEpidNoErr;
+  } while (0);
+
+  DeletePreparedG2(&prepared);
+  DeleteFfElement(&one);
+  DeleteFfElement(&bx);
+  DeleteFfElement(&by);
+  DeleteFfElement(&x);
+  DeleteFfElement(&y);
+  DeleteFfElement(&z);
+  DeleteFfElement(&z2);
+  DeleteFfElement(&bx_);
+  DeleteFfElement(&by_);
+  DeleteFfElement(&neg_qy);
+  DeleteFfElement(&f);
+
+  return result;
+}
+
+void DeletePreparedG2(PreparedG2** pb) {
+  size_t i = 0;
+  if (!pb || !*pb) {
+    return;
+  }
+  if ((*pb)->coeffs) {
+    for (i = 0; i < 3 * (*pb)->num_lines; i++) {
+      DeleteFfElement(&(*pb)->coeffs[i]);
+    }
+    SAFE_FREE((*pb)->coeffs);
+  }
+  SAFE_FREE(*pb);
+}
+
+/*
+d = Fq12.mulPreparedLine(d, c, Px, Py)
+Input: d (an element in GT), c[0], c[1], c[2] (prepared line coefficients in
+Fq2), Px, Py (elements in Fq)
+Output: d (an element in GT) where d = d * ((c[0] * Py, 0, 0),
+(c[1] * Px, c[2], 0))
+*/
+static EpidStatus MulPreparedLine(PairingState* ps, FfElement* d,
+                                  FfElement* const* c, FfElement const* px,
+                                  FfElement const* py, FfElement* l0,
+                                  FfElement* l1) {
+  IppStatus sts = ippStsNoErr;
+  sts = ippsGFpMul_PE(c[0]->ipp_ff_elem, py->ipp_ff_elem, l0->ipp_ff_elem,
+                      ps->Fq2->ipp_ff);
+  RETURN_ON_IPP_ERROR(sts);
+  sts = ippsGFpMul_PE(c[1]->ipp_ff_elem, px->ipp_ff_elem, l1->ipp_ff_elem,
+                      ps->Fq2->ipp_ff);
+  RETURN_ON_IPP_ERROR(sts);
+  return MulSparse(d, d, l0, l1, c[2], ps);
+}
+
+EpidStatus PairingProduct(PairingState* ps, EcPoint const** a,
+                          PreparedG2 const** b, size_t m, FfElement* d) {
+  return DoPairingProduct(ps, a, b, m, d, true);
+}
+
+EpidStatus PairingProductTrusted(PairingState* ps, EcPoint const** a,
+                                 PreparedG2 const** b, size_t m,
+                                 FfElement* d) {
+  return DoPairingProduct(ps, a, b, m, d, false);
+}
+
+/*
+d = pairing(a[0], b[0]) * ... * pairing(a[m-1], b[m-1])
+Input: a[0], ..., a[m-1] (elements in G1), b[0], ..., b[m-1] (prepared
+elements in G2), check_input (check that a[i] are in the group of ps)
+Output: d (an element in GT)
+*/
+static EpidStatus DoPairingProduct(PairingState* ps, EcPoint const** a,
+                                   PreparedG2 const** b, size_t m,
+                                   FfElement* d, bool check_input) {
+  EpidStatus result = kEpidErr;
+  FfElement** ax = NULL;
+  FfElement** ay = NULL;
+  FfElement* l0 = NULL;
+  FfElement* l1 = NULL;
+  size_t j = 0;
+
+  do {
+    IppStatus sts = ippStsNoErr;
+    Ipp32u one_dat[] = {1};
+    int i = 0;
+    size_t k = 0;
+    // check parameters
+    if (!ps || !a || !b || !d || 0 == m) {
+      result = kEpidBadArgErr;
+      break;
+    }
+    if (!d->ipp_ff_elem || !ps->ff || !ps->ff->ipp_ff || !ps->Fq ||
+        !ps->Fq->ipp_ff || !ps->Fq2 || !ps->Fq2->ipp_ff || !ps->ga ||
+        !ps->ga->ipp_ec) {
+      result = kEpidBadArgErr;
+      break;
+    }
+    result = kEpidNoErr;
+    for (j = 0; j < m; j++) {
+      if (!a[j] || !a[j]->ipp_ec_pt || !b[j] || !b[j]->coeffs ||
+          ps->num_lines != b[j]->num_lines) {
+        result = kEpidBadArgErr;
+        break;
+      }
+    }
+    BREAK_ON_EPID_ERROR(result);
+
+    ax = SAFE_ALLOC(m * sizeof(FfElement*));
+    ay = SAFE_ALLOC(m * sizeof(FfElement*));
+    if (!ax || !ay) {
+      result = kEpidMemAllocErr;
+      break;
+    }
+    result = NewFfElement(ps->Fq2, &l0);
+    BREAK_ON_EPID_ERROR(result);
+    result = NewFfElement(ps->Fq2, &l1);
+    BREAK_ON_EPID_ERROR(result);
+
+    // Set (ax, ay) = E(Fq).outputPoint(a) for each a that is not the
+    // identity, pairings of the identity are 1 and are left out.
+    for (j = 0; j < m; j++) {
+      G1ElemStr a_str = {0};
+      bool in_group = true;
+      bool is_identity = false;
+      result = EcIsIdentity(ps->ga, a[j], &is_identity);
+      BREAK_ON_EPID_ERROR(result);
+      if (is_identity) {
+        continue;
+      }
+      // check if a is in ga that was used to create ps
+      if (check_input) {
+        result = WriteEcPoint(ps->ga, a[j], &a_str, sizeof(a_str));
+        BREAK_ON_EPID_ERROR(result);
+        result = EcInGroup(ps->ga, &a_str, sizeof(a_str), &in_group);
+        BREAK_ON_EPID_ERROR(result);
+        if (false == in_group) {
+          result = kEpidBadArgErr;
+          break;
+        }
+      }
+      result = NewFfElement(ps->Fq, &ax[j]);
+      BREAK_ON_EPID_ERROR(result);
+      result = NewFfElement(ps->Fq, &ay[j]);
+      BREAK_ON_EPID_ERROR(result);
+      sts = ippsGFpECGetPoint(a[j]->ipp_ec_pt, ax[j]->ipp_ff_elem,
+                              ay[j]->ipp_ff_elem, ps->ga->ipp_ec);
+      BREAK_ON_IPP_ERROR(sts, result);
+    }
+    BREAK_ON_EPID_ERROR(result);
+
+    // Run the Miller loop of Pairing once for all pairs, taking the
+    // lines from the prepared coefficients.
+    sts = ippsGFpSetElement(one_dat, sizeof(one_dat) / sizeof(Ipp32u),
+                            d->ipp_ff_elem, ps->ff->ipp_ff);
+    BREAK_ON_IPP_ERROR(sts, result);
+    for (i = ps->s_ternary_len - 1; i >= 0; i--) {
+      sts = ippsGFpMul(d->ipp_ff_elem, d->ipp_ff_elem, d->ipp_ff_elem,
+                       ps->ff->ipp_ff);
+      BREAK_ON_IPP_ERROR(sts, result);
+      for (j = 0; j < m; j++) {
+        if (!ax[j]) {
+          continue;
+        }
+        result = MulPreparedLine(ps, d, &b[j]->coeffs[3 * k], ax[j], ay[j],
+                                 l0, l1);
+        BREAK_ON_EPID_ERROR(result);
+      }
+      BREAK_ON_EPID_ERROR(result);
+      k++;
+      if (0 != ps->s_ternary[i]) {
+        for (j = 0; j < m; j++) {
+          if (!ax[j]) {
+            continue;
+          }
+          result = MulPreparedLine(ps, d, &b[j]->coeffs[3 * k], ax[j],
+                                   ay[j], l0, l1);
+          BREAK_ON_EPID_ERROR(result);
+        }
+        BREAK_ON_EPID_ERROR(result);
+        k++;
+      }
+    }
+    BREAK_ON_EPID_ERROR(result);
+    if (ps->neg) {
+      sts = ippsGFpConj(d->ipp_ff_elem, d->ipp_ff_elem, ps->ff->ipp_ff);
+      BREAK_ON_IPP_ERROR(sts, result);
+    }
+    for (; k < ps->num_lines; k++) {
+      for (j = 0; j < m; j++) {
+        if (!ax[j]) {
+          continue;
+        }
+        result = MulPreparedLine(ps, d, &b[j]->coeffs[3 * k], ax[j], ay[j],
+                                 l0, l1);
+        BREAK_ON_EPID_ERROR(result);
+      }
+      BREAK_ON_EPID_ERROR(result);
+    }
+    BREAK_ON_EPID_ERROR(result);
+    result = FinalExp(ps, d, d);
+    BREAK_ON_EPID_ERROR(result);
+    result = kEpidNoErr;
+  } while (0);
+
+  if (ax) {
+    for (j = 0; j < m; j++) {
+      DeleteFfElement(&ax[j]);
+    }
+    SAFE_FREE(ax);
+  }
+  if (ay) {
+    for (j = 0; j < m; j++) {
+      DeleteFfElement(&ay[j]);
+    }
+    SAFE_FREE(ay);
+  }
+  DeleteFfElement(&l0);
+  DeleteFfElement(&l1);
 
   return result;
 }
@@ -1430,6 +1849,56 @@ static EpidStatus Tangent(FiniteField* gt, FfElement* f, FfElement* x_out,
   return result;
 }
 
+/*
+(sn...s1s0) = loopTernary()
+Output: sn...s1s0 (ternary representation of the Miller loop length s,
+where s = 6t + 2 if neg = 0, otherwise s = 6t - 2)
+*/
+static EpidStatus LoopTernary(PairingState* ps, int* s, int* n,
+                              int max_elements) {
+  EpidStatus result = kEpidErr;
+  BigNum* x = NULL;
+  BigNum* two = NULL;
+  BigNum* six = NULL;
+  do {
+    IppStatus sts = ippStsNoErr;
+    Ipp32u two_dat[] = {2};
+    Ipp32u six_dat[] = {6};
+    if (!ps || !s || !n || !ps->t || !ps->t->ipp_bn) {
+      result = kEpidBadArgErr;
+      break;
+    }
+    result = NewBigNum(sizeof(BigNumStr), &x);
+    BREAK_ON_EPID_ERROR(result);
+    result = NewBigNum(sizeof(BigNumStr), &two);
+    BREAK_ON_EPID_ERROR(result);
+    sts = ippsSet_BN(IppsBigNumPOS, sizeof(two_dat) / sizeof(Ipp32u), two_dat,
+                     two->ipp_bn);
+    BREAK_ON_IPP_ERROR(sts, result);
+    result = NewBigNum(sizeof(BigNumStr), &six);
+    BREAK_ON_EPID_ERROR(result);
+    sts = ippsSet_BN(IppsBigNumPOS, sizeof(six_dat) / sizeof(Ipp32u), six_dat,
+                     six->ipp_bn);
+    BREAK_ON_IPP_ERROR(sts, result);
+    sts = ippsMul_BN(six->ipp_bn, ps->t->ipp_bn, x->ipp_bn);
+    BREAK_ON_IPP_ERROR(sts, result);
+    if (ps->neg) {
+      sts = ippsSub_BN(x->ipp_bn, two->ipp_bn, x->ipp_bn);
+      BREAK_ON_IPP_ERROR(sts, result);
+    } else {
+      sts = ippsAdd_BN(x->ipp_bn, two->ipp_bn, x->ipp_bn);
+      BREAK_ON_IPP_ERROR(sts, result);
+    }
+    result = Ternary(s, n, max_elements, x);
+    BREAK_ON_EPID_ERROR(result);
+    result = kEpidNoErr;
+  } while (0);
+  DeleteBigNum(&x);
+  DeleteBigNum(&two);
+  DeleteBigNum(&six);
+  return result;
+}
+
 /*
 (sn...s1s0) = ternary(s)
 Input: s (big integer)
@@ -1891,25 +2360,87 @@ Output: e (an element in Fq12) where e = a * b
 static EpidStatus MulSpecial(FfElement* e, FfElement const* a,
                              FfElement const* b, PairingState* ps) {
   EpidStatus retvalue = kEpidNotImpl;
+  FfElement* b0 = NULL;
+  FfElement* b1 = NULL;
+  FfElement* b3 = NULL;
+  Fq12ElemDat b_dat = {0};
+  do {
+    IppStatus sts = ippStsNoErr;
+
+    // check parameters
+    if (!e || !a || !b || !ps) {
+      retvalue = kEpidBadArgErr;
+      BREAK_ON_EPID_ERROR(retvalue);
+    }
+    if (!ps->Fq2 || !b->ipp_ff_elem || !ps->Fq2->ipp_ff || !ps->ff ||
+        !ps->ff->ipp_ff) {
+      retvalue = kEpidBadArgErr;
+      BREAK_ON_EPID_ERROR(retvalue);
+    }
+
+    // 1.  Let b = ((b[0], b[2], b[4]), (b[1], b[3], b[5])) where
+    //     b[0], ..., b[5] are elements in ps->Fq2 and b[2] = b[4] = b[5]
+    //     = 0.
+    retvalue = NewFfElement(ps->Fq2, &b0);
+    BREAK_ON_EPID_ERROR(retvalue);
+    retvalue = NewFfElement(ps->Fq2, &b1);
+    BREAK_ON_EPID_ERROR(retvalue);
+    retvalue = NewFfElement(ps->Fq2, &b3);
+    BREAK_ON_EPID_ERROR(retvalue);
+
+    sts = ippsGFpGetElement(b->ipp_ff_elem, (BNU)&b_dat,
+                            sizeof(b_dat) / sizeof(Ipp32u), ps->ff->ipp_ff);
+    BREAK_ON_IPP_ERROR(sts, retvalue);
+    sts = ippsGFpSetElement((Ipp32u*)&b_dat.x[0].x[0],
+                            sizeof(b_dat.x[0].x[0]) / sizeof(Ipp32u),
+                            b0->ipp_ff_elem, ps->Fq2->ipp_ff);
+    BREAK_ON_IPP_ERROR(sts, retvalue);
+    sts = ippsGFpSetElement((Ipp32u*)&b_dat.x[1].x[0],
+                            sizeof(b_dat.x[1].x[0]) / sizeof(Ipp32u),
+                            b1->ipp_ff_elem, ps->Fq2->ipp_ff);
+    BREAK_ON_IPP_ERROR(sts, retvalue);
+    sts = ippsGFpSetElement((Ipp32u*)&b_dat.x[1].x[1],
+                            sizeof(b_dat.x[1].x[1]) / sizeof(Ipp32u),
+                            b3->ipp_ff_elem, ps->Fq2->ipp_ff);
+    BREAK_ON_IPP_ERROR(sts, retvalue);
+
+    // 2.  e = Fq12.MulSparse(a, b[0], b[1], b[3]).
+    retvalue = MulSparse(e, a, b0, b1, b3, ps);
+    BREAK_ON_EPID_ERROR(retvalue);
+    retvalue = kEpidNoErr;
+  } while (0);
+  EpidZeroMemory(&b_dat, sizeof(b_dat));
+  DeleteFfElement(&b0);
+  DeleteFfElement(&b1);
+  DeleteFfElement(&b3);
+
+  return (retvalue);
+}
+
+/*
+e = Fq12.MulSparse(a, b[0], b[1], b[3])
+Input: a (an element in Fq12), b[0], b[1], b[3] (elements in Fq2)
+Output: e (an element in Fq12) where e = a * b and
+b = ((b[0], 0, 0), (b[1], b[3], 0))
+*/
+static EpidStatus MulSparse(FfElement* e, FfElement const* a, FfElement* b0,
+                            FfElement* b1, FfElement* b3, PairingState* ps) {
+  EpidStatus retvalue = kEpidNotImpl;
   FfElement* t0 = NULL;
   FfElement* t1 = NULL;
   FfElement* t2 = NULL;
   FfElement* a0 = NULL;
   FfElement* a1 = NULL;
-  FfElement* b0 = NULL;
-  FfElement* b1 = NULL;
-  FfElement* b3 = NULL;
   FfElement* e0 = NULL;
   FfElement* e1 = NULL;
   FfElement* b0plusb1 = NULL;
   Fq12ElemDat a_dat = {0};
-  Fq12ElemDat b_dat = {0};
   Fq12ElemDat e_dat = {0};
   do {
     IppStatus sts = ippStsNoErr;
 
     // check parameters
-    if (!e || !a || !b || !ps) {
+    if (!e || !a || !b0 || !b1 || !b3 || !ps) {
       retvalue = kEpidBadArgErr;
       BREAK_ON_EPID_ERROR(retvalue);
     }
@@ -1917,8 +2448,9 @@ static EpidStatus MulSpecial(FfElement* e, FfElement const* a,
       retvalue = kEpidBadArgErr;
       BREAK_ON_EPID_ERROR(retvalue);
     }
-    if (!e->ipp_ff_elem || !a->ipp_ff_elem || !b->ipp_ff_elem ||
-        !ps->Fq2->ipp_ff || !ps->Fq6->ipp_ff || !ps->ff || !ps->ff->ipp_ff) {
+    if (!e->ipp_ff_elem || !a->ipp_ff_elem || !b0->ipp_ff_elem ||
+        !b1->ipp_ff_elem || !b3->ipp_ff_elem || !ps->Fq2->ipp_ff ||
+        !ps->Fq6->ipp_ff || !ps->ff || !ps->ff->ipp_ff) {
       retvalue = kEpidBadArgErr;
       BREAK_ON_EPID_ERROR(retvalue);
     }
@@ -1955,32 +2487,7 @@ static EpidStatus MulSpecial(FfElement* e, FfElement const* a,
                             a1->ipp_ff_elem, ps->Fq6->ipp_ff);
     BREAK_ON_IPP_ERROR(sts, retvalue);
 
-    // 2.  Let b = ((b[0], b[2], b[4]), (b[1], b[3], b[5])) where
-    //     b[0], ..., b[5] are elements in ps->Fq2 and b[2] = b[4] = b[5]
-    //     = 0.
-    retvalue = NewFfElement(ps->Fq2, &b0);
-    BREAK_ON_EPID_ERROR(retvalue);
-    retvalue = NewFfElement(ps->Fq2, &b1);
-    BREAK_ON_EPID_ERROR(retvalue);
-    retvalue = NewFfElement(ps->Fq2, &b3);
-    BREAK_ON_EPID_ERROR(retvalue);
-
-    sts = ippsGFpGetElement(b->ipp_ff_elem, (BNU)&b_dat,
-                            sizeof(b_dat) / sizeof(Ipp32u), ps->ff->ipp_ff);
-    BREAK_ON_IPP_ERROR(sts, retvalue);
-    sts = ippsGFpSetElement((Ipp32u*)&b_dat.x[0].x[0],
-                            sizeof(a_dat.x[0].x[0]) / sizeof(Ipp32u),
-                            b0->ipp_ff_elem, ps->Fq2->ipp_ff);
-    BREAK_ON_IPP_ERROR(sts, retvalue);
-    sts = ippsGFpSetElement((Ipp32u*)&b_dat.x[1].x[0],
-                            sizeof(a_dat.x[1].x[0]) / sizeof(Ipp32u),
-                            b1->ipp_ff_elem, ps->Fq2->ipp_ff);
-    BREAK_ON_IPP_ERROR(sts, retvalue);
-    sts = ippsGFpSetElement((Ipp32u*)&b_dat.x[1].x[1],
-                            sizeof(a_dat.x[1].x[1]) / sizeof(Ipp32u),
-                            b3->ipp_ff_elem, ps->Fq2->ipp_ff);
-    BREAK_ON_IPP_ERROR(sts, retvalue);
-
+    // 2.  Let b = ((b[0], 0, 0), (b[1], b[3], 0)).
     // 3.  t0 = ps->Fq6.mul(a[0], b[0]).
 
     sts = ippsGFpMul_PE(a0->ipp_ff_elem, b0->ipp_ff_elem, t0->ipp_ff_elem,
@@ -2029,16 +2536,12 @@ static EpidStatus MulSpecial(FfElement* e, FfElement const* a,
     retvalue = kEpidNoErr;
   } while (0);
   EpidZeroMemory(&a_dat, sizeof(a_dat));
-  EpidZeroMemory(&b_dat, sizeof(b_dat));
   EpidZeroMemory(&e_dat, sizeof(e_dat));
   DeleteFfElement(&t0);
   DeleteFfElement(&t1);
   DeleteFfElement(&t2);
   DeleteFfElement(&a0);
   DeleteFfElement(&a1);
-  DeleteFfElement(&b0);
-  DeleteFfElement(&b1);
-  DeleteFfElement(&b3);
   DeleteFfElement(&e0);
   DeleteFfElement(&e1);
   DeleteFfElement(&b0plusb1);
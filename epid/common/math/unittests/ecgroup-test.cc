@@ -151,6 +151,11 @@ class EcGroupTest : public ::testing::Test {
   static const BigNumStr h1;
   static const BigNumStr p;
   static const BigNumStr q;
+  static const FqElemStr glv_beta;
+  static const BigNumStr glv_lambda;
+  static const Fq2ElemStr gls_frob_x;
+  static const Fq2ElemStr gls_frob_y;
+  static const BigNumStr gls_t;
 
   static const G1ElemStr efq_a_str;
   static const G1ElemStr efq_b_str;
@@ -174,6 +179,7 @@ class EcGroupTest : public ::testing::Test {
   static const G2ElemStr efq2_multiexp_abxy_str;
   static const G2ElemStr efq2_inv_a_str;
   static const G2ElemStr efq2_identity_str;
+  static const G2ElemStr efq2_out_of_subgroup_str;
 
   // Intel(R) EPID 1.1 hash of message "aad"
   static const Epid11G3ElemStr kAadHash;
@@ -233,6 +239,24 @@ class EcGroupTest : public ::testing::Test {
     epid11_G3_r = EcPointObj(&epid11_G3);
   }
 
+  /// Creates G1 with the endomorphism that splits powers
+  EcGroupObj NewEfqWithEndomorphism() {
+    EcGroupObj g(&fq, fq_a, fq_b, g1_x, g1_y, bn_p, bn_h);
+    FfElementObj beta(&fq, glv_beta);
+    THROW_ON_EPIDERR(EcSetEndomorphism(g, beta, &glv_lambda));
+    return g;
+  }
+
+  /// Creates G2 with the Frobenius endomorphism
+  EcGroupObj NewEfq2WithFrobenius() {
+    EcGroupObj g(&efq2_par->fq2, efq2_par->a, efq2_par->b, efq2_par->x,
+                 efq2_par->y, efq2_par->order, efq2_par->cofactor);
+    FfElementObj frob_x(&efq2_par->fq2, gls_frob_x);
+    FfElementObj frob_y(&efq2_par->fq2, gls_frob_y);
+    THROW_ON_EPIDERR(EcSetFrobenius(g, frob_x, frob_y, &gls_t, true));
+    return g;
+  }
+
   FiniteFieldObj fq;
   FfElementObj fq_a;
   FfElementObj fq_b;
@@ -308,6 +332,37 @@ const BigNumStr EcGroupTest::q = {
     {{0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF0, 0xCD, 0x46, 0xE5, 0xF2,
       0x5E, 0xEE, 0x71, 0xA4, 0x9F, 0x0C, 0xDC, 0x65, 0xFB, 0x12, 0x98,
       0x0A, 0x82, 0xD3, 0x29, 0x2D, 0xDB, 0xAE, 0xD3, 0x30, 0x13}}};
+// beta = -(18t^3 + 18t^2 + 9t + 2) mod q
+const FqElemStr EcGroupTest::glv_beta = {
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x39, 0x88, 0xE1,
+      0x40, 0x92, 0x10, 0x18, 0x65, 0x9B, 0xCD, 0xD7, 0x9D, 0xF1, 0x93,
+      0x2D, 0x1E, 0xDB, 0x1C, 0x0A, 0x24, 0xA3, 0xA1, 0xB8, 0x07}}};
+// lambda = -(36t^3 + 18t^2 + 6t + 2) mod p
+const BigNumStr EcGroupTest::glv_lambda = {
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x73, 0x11, 0xC2,
+      0x81, 0x24, 0x20, 0x30, 0xCE, 0x37, 0x9B, 0xAF, 0x3B, 0xE3, 0x21,
+      0xC3, 0x70, 0x67, 0x08, 0x1E, 0x93, 0x98, 0x53, 0x30, 0x16}}};
+// frob_x = xi^((q-1)/3), xi = 2 + u
+const Fq2ElemStr EcGroupTest::gls_frob_x = {
+    {{{{0x79, 0x7D, 0x9F, 0xB2, 0x18, 0x36, 0x15, 0xAB, 0xA4, 0x59, 0x03,
+        0x0A, 0x5A, 0xA5, 0xA3, 0x21, 0x73, 0xF7, 0x65, 0xF9, 0xBA, 0x68,
+        0x4F, 0x80, 0xD0, 0x08, 0x48, 0xC6, 0x32, 0xB2, 0xF5, 0xB3}}},
+     {{{0x7C, 0x7B, 0x75, 0xD9, 0x8A, 0xA0, 0x2F, 0xD3, 0xC5, 0x32, 0x09,
+        0x7B, 0x4D, 0xFF, 0x74, 0x80, 0x9B, 0x86, 0xA8, 0x47, 0x52, 0x2D,
+        0x62, 0x6B, 0x2B, 0xC5, 0x97, 0xA2, 0x5A, 0x32, 0xA7, 0xFF}}}}};
+// frob_y = xi^((q-1)/2)
+const Fq2ElemStr EcGroupTest::gls_frob_y = {
+    {{{{0x8D, 0xC4, 0xB4, 0xCB, 0xFF, 0x74, 0x73, 0x92, 0xD0, 0xD5, 0x7A,
+        0x94, 0x41, 0x88, 0x6C, 0x60, 0x2C, 0x4F, 0xD1, 0x59, 0x7F, 0x31,
+        0xE6, 0x6B, 0xD3, 0xF1, 0x5D, 0x94, 0xDB, 0xB6, 0x3B, 0x09}}},
+     {{{0x1B, 0x89, 0x69, 0x97, 0xFE, 0xEB, 0xF6, 0x58, 0x5A, 0xC5, 0x02,
+        0xC9, 0x94, 0x9F, 0x34, 0x21, 0x4B, 0xC3, 0x3C, 0xB7, 0xEB, 0xCB,
+        0xC2, 0x54, 0xD4, 0xB9, 0x8D, 0x4E, 0x08, 0x99, 0x45, 0xFF}}}}};
+// |t| of the BN curve, t is negative
+const BigNumStr EcGroupTest::gls_t = {
+    {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x68, 0x82, 0xF5, 0xC0, 0x30, 0xB0, 0xA8, 0x01}}};
 
 const G1ElemStr EcGroupTest::efq_a_str = {
     {{{0x12, 0xA6, 0x5B, 0xD6, 0x91, 0x8D, 0x50, 0xA7, 0x66, 0xEB, 0x7D,
@@ -542,6 +597,26 @@ const G2ElemStr EcGroupTest::efq2_identity_str = {
     },
 };
 
+// on the curve, but not of the order p
+const G2ElemStr EcGroupTest::efq2_out_of_subgroup_str = {
+    {
+        {0xAE, 0x97, 0xBA, 0x94, 0xD0, 0xED, 0xA8, 0x2F, 0x8F, 0x6D, 0x05,
+         0x58, 0x4E, 0xF8, 0xAA, 0x38, 0x92, 0x27, 0x66, 0x58, 0x1E, 0x27,
+         0xA1, 0xC0, 0x8A, 0x6A, 0x63, 0xEC, 0x24, 0xED, 0xE6, 0xA4},
+        {0x18, 0xF1, 0x35, 0xD2, 0x5F, 0x55, 0x72, 0x03, 0x30, 0x18, 0x50,
+         0xC5, 0xA3, 0x8F, 0xD5, 0x47, 0x92, 0x3A, 0x73, 0x69, 0x94, 0xE3,
+         0xBF, 0x91, 0x1A, 0x61, 0xDB, 0xE2, 0x2E, 0x44, 0x15, 0x8B},
+    },
+    {
+        {0x43, 0x7C, 0x82, 0x9A, 0x06, 0x6E, 0xC5, 0x3F, 0x90, 0x7E, 0x5C,
+         0xFC, 0xCD, 0x36, 0x2C, 0xF3, 0xAF, 0x48, 0xC0, 0x64, 0xDF, 0x9A,
+         0x97, 0xAF, 0x44, 0xD7, 0x86, 0x00, 0xC6, 0x40, 0x6B, 0x62},
+        {0x18, 0xE2, 0xF1, 0x93, 0xE6, 0xCF, 0xBA, 0x02, 0x4C, 0x4F, 0x6D,
+         0x4F, 0xA1, 0x72, 0x6E, 0xAA, 0x2D, 0xD8, 0xE7, 0x79, 0x88, 0x6E,
+         0xF0, 0xC0, 0x0C, 0x0B, 0x7F, 0x04, 0x25, 0x5F, 0xCB, 0x12},
+    },
+};
+
 // msg=aad, size=3
 // algorithm code path: sqrt result <= modulus/2, high bit is 0
 const G1ElemStr EcGroupTest::kAadHash = {
@@ -687,6 +762,116 @@ TEST_F(EcGroupTest, DeleteWorksGivenNullPointer) {
   EXPECT_NO_THROW(DeleteEcGroup(&g));
 }
 ///////////////////////////////////////////////////////////////////////
+// EcSetEndomorphism
+TEST_F(EcGroupTest, SetEndomorphismFailsGivenNullPointer) {
+  FfElementObj beta(&this->fq, this->glv_beta);
+  EXPECT_EQ(kEpidBadArgErr,
+            EcSetEndomorphism(nullptr, beta, &this->glv_lambda));
+  EXPECT_EQ(kEpidBadArgErr,
+            EcSetEndomorphism(this->efq, nullptr, &this->glv_lambda));
+  EXPECT_EQ(kEpidBadArgErr, EcSetEndomorphism(this->efq, beta, nullptr));
+}
+TEST_F(EcGroupTest, SetEndomorphismFailsGivenArgumentsMismatch) {
+  FfElementObj beta(&this->fq, this->glv_beta);
+  FfElementObj fq2_elem(&this->efq2_par->fq2);
+  EXPECT_EQ(kEpidBadArgErr,
+            EcSetEndomorphism(this->efq2, beta, &this->glv_lambda));
+  EXPECT_EQ(kEpidBadArgErr,
+            EcSetEndomorphism(this->efq, fq2_elem, &this->glv_lambda));
+}
+TEST_F(EcGroupTest, SetEndomorphismFailsGivenWrongLambda) {
+  FfElementObj beta(&this->fq, this->glv_beta);
+  // the other cube root of unity, -lambda - 1, does not match beta
+  const BigNumStr other_lambda = {
+      {{0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF0, 0xCA, 0xD3, 0xD4, 0x2F,
+        0xDD, 0xCA, 0x51, 0x73, 0xCF, 0xD5, 0x40, 0xB6, 0xBF, 0x2F, 0x77,
+        0xCE, 0xAA, 0x8F, 0x25, 0x34, 0xD9, 0x38, 0xB8, 0x1F, 0xF6}}};
+  EXPECT_EQ(kEpidBadArgErr, EcSetEndomorphism(this->efq, beta, &other_lambda));
+  EXPECT_EQ(kEpidBadArgErr, EcSetEndomorphism(this->efq, beta, &this->x_str));
+  EXPECT_EQ(kEpidBadArgErr, EcSetEndomorphism(this->efq, beta, &this->p));
+}
+TEST_F(EcGroupTest, SetEndomorphismFailsGivenWrongBeta) {
+  FfElementObj b(&this->fq, this->b1);
+  EXPECT_EQ(kEpidBadArgErr,
+            EcSetEndomorphism(this->efq, b, &this->glv_lambda));
+}
+TEST_F(EcGroupTest, SetEndomorphismFailsGivenCofactorIsNotOne) {
+  FfElementObj beta(&this->fq, this->glv_beta);
+  BigNumStr h3 = this->h1;
+  h3.data.data[sizeof(h3.data.data) - 1] = 3;
+  BigNumObj bn_h3(h3);
+  EcGroupObj g(&this->fq, this->fq_a, this->fq_b, this->g1_x, this->g1_y,
+               this->bn_p, bn_h3);
+  EXPECT_EQ(kEpidBadArgErr, EcSetEndomorphism(g, beta, &this->glv_lambda));
+}
+TEST_F(EcGroupTest, SetEndomorphismSucceedsForG1) {
+  FfElementObj beta(&this->fq, this->glv_beta);
+  EcGroupObj g(&this->fq, this->fq_a, this->fq_b, this->g1_x, this->g1_y,
+               this->bn_p, this->bn_h);
+  EXPECT_EQ(kEpidNoErr, EcSetEndomorphism(g, beta, &this->glv_lambda));
+  // setting it again replaces it
+  EXPECT_EQ(kEpidNoErr, EcSetEndomorphism(g, beta, &this->glv_lambda));
+}
+///////////////////////////////////////////////////////////////////////
+// EcSetFrobenius
+TEST_F(EcGroupTest, SetFrobeniusFailsGivenNullPointer) {
+  FfElementObj frob_x(&this->efq2_par->fq2, this->gls_frob_x);
+  FfElementObj frob_y(&this->efq2_par->fq2, this->gls_frob_y);
+  EXPECT_EQ(kEpidBadArgErr,
+            EcSetFrobenius(nullptr, frob_x, frob_y, &this->gls_t, true));
+  EXPECT_EQ(kEpidBadArgErr,
+            EcSetFrobenius(this->efq2, nullptr, frob_y, &this->gls_t, true));
+  EXPECT_EQ(kEpidBadArgErr,
+            EcSetFrobenius(this->efq2, frob_x, nullptr, &this->gls_t, true));
+  EXPECT_EQ(kEpidBadArgErr,
+            EcSetFrobenius(this->efq2, frob_x, frob_y, nullptr, true));
+}
+TEST_F(EcGroupTest, SetFrobeniusFailsGivenArgumentsMismatch) {
+  FfElementObj frob_x(&this->efq2_par->fq2, this->gls_frob_x);
+  FfElementObj frob_y(&this->efq2_par->fq2, this->gls_frob_y);
+  FfElementObj fq_elem(&this->fq);
+  EXPECT_EQ(kEpidBadArgErr,
+            EcSetFrobenius(this->efq, frob_x, frob_y, &this->gls_t, true));
+  EXPECT_EQ(kEpidBadArgErr,
+            EcSetFrobenius(this->efq2, fq_elem, frob_y, &this->gls_t, true));
+  EXPECT_EQ(kEpidBadArgErr,
+            EcSetFrobenius(this->efq2, frob_x, fq_elem, &this->gls_t, true));
+}
+TEST_F(EcGroupTest, SetFrobeniusFailsGivenWrongT) {
+  FfElementObj frob_x(&this->efq2_par->fq2, this->gls_frob_x);
+  FfElementObj frob_y(&this->efq2_par->fq2, this->gls_frob_y);
+  const BigNumStr zero = {0};
+  EXPECT_EQ(kEpidBadArgErr,
+            EcSetFrobenius(this->efq2, frob_x, frob_y, &this->gls_t, false));
+  EXPECT_EQ(kEpidBadArgErr,
+            EcSetFrobenius(this->efq2, frob_x, frob_y, &this->x_str, true));
+  EXPECT_EQ(kEpidBadArgErr,
+            EcSetFrobenius(this->efq2, frob_x, frob_y, &zero, true));
+}
+TEST_F(EcGroupTest, SetFrobeniusFailsGivenWrongConstants) {
+  FfElementObj frob_x(&this->efq2_par->fq2, this->gls_frob_x);
+  FfElementObj frob_y(&this->efq2_par->fq2, this->gls_frob_y);
+  EXPECT_EQ(kEpidBadArgErr,
+            EcSetFrobenius(this->efq2, frob_y, frob_x, &this->gls_t, true));
+  EXPECT_EQ(kEpidBadArgErr,
+            EcSetFrobenius(this->efq2, frob_x, frob_x, &this->gls_t, true));
+}
+TEST_F(EcGroupTest, SetFrobeniusFailsGivenG1) {
+  FfElementObj beta(&this->fq, this->glv_beta);
+  EXPECT_EQ(kEpidBadArgErr,
+            EcSetFrobenius(this->efq, beta, beta, &this->gls_t, true));
+}
+TEST_F(EcGroupTest, SetFrobeniusSucceedsForG2) {
+  FfElementObj frob_x(&this->efq2_par->fq2, this->gls_frob_x);
+  FfElementObj frob_y(&this->efq2_par->fq2, this->gls_frob_y);
+  EcGroupObj g(&this->efq2_par->fq2, this->efq2_par->a, this->efq2_par->b,
+               this->efq2_par->x, this->efq2_par->y, this->efq2_par->order,
+               this->efq2_par->cofactor);
+  EXPECT_EQ(kEpidNoErr, EcSetFrobenius(g, frob_x, frob_y, &this->gls_t, true));
+  // setting it again replaces it
+  EXPECT_EQ(kEpidNoErr, EcSetFrobenius(g, frob_x, frob_y, &this->gls_t, true));
+}
+///////////////////////////////////////////////////////////////////////
 // NewEcPoint
 TEST_F(EcGroupTest, NewEcPointSucceedsGivenEcGroupBasedOnFq) {
   EcPoint* point = nullptr;
@@ -736,6 +921,53 @@ TEST_F(EcGroupTest, DeleteEcPointWorksGivenNullPointer) {
   EXPECT_EQ(nullptr, point);
 }
 ///////////////////////////////////////////////////////////////////////
+// EcPointGetSize / InitEcPoint
+TEST_F(EcGroupTest, EcPointGetSizeFailsGivenNullPointer) {
+  size_t size = 0;
+  EXPECT_EQ(kEpidBadArgErr, EcPointGetSize(nullptr, &size));
+  EXPECT_EQ(kEpidBadArgErr, EcPointGetSize(this->efq, nullptr));
+}
+TEST_F(EcGroupTest, InitEcPointFailsGivenNullPointer) {
+  size_t size = 0;
+  THROW_ON_EPIDERR(EcPointGetSize(this->efq, &size));
+  std::vector<uint8_t> mem(size);
+  EcPoint* point = nullptr;
+  EXPECT_EQ(kEpidBadArgErr, InitEcPoint(nullptr, mem.data(), size, &point));
+  EXPECT_EQ(kEpidBadArgErr, InitEcPoint(this->efq, nullptr, size, &point));
+  EXPECT_EQ(kEpidBadArgErr, InitEcPoint(this->efq, mem.data(), size, nullptr));
+}
+TEST_F(EcGroupTest, InitEcPointFailsGivenTooSmallBuffer) {
+  size_t size = 0;
+  THROW_ON_EPIDERR(EcPointGetSize(this->efq, &size));
+  std::vector<uint8_t> mem(size);
+  EcPoint* point = nullptr;
+  EXPECT_EQ(kEpidBadArgErr,
+            InitEcPoint(this->efq, mem.data(), size - 1, &point));
+}
+TEST_F(EcGroupTest, InitEcPointCreatesIdentity) {
+  size_t size = 0;
+  THROW_ON_EPIDERR(EcPointGetSize(this->efq, &size));
+  std::vector<uint8_t> mem(size, 0xff);
+  EcPoint* point = nullptr;
+  G1ElemStr g1_elem_str = {{{{0}}}, {{{0}}}};
+  EXPECT_EQ(kEpidNoErr, InitEcPoint(this->efq, mem.data(), size, &point));
+  THROW_ON_EPIDERR(
+      WriteEcPoint(this->efq, point, &g1_elem_str, sizeof(g1_elem_str)));
+  EXPECT_EQ(this->efq_identity_str, g1_elem_str);
+}
+TEST_F(EcGroupTest, InitEcPointWorksGivenUnalignedBuffer) {
+  size_t size = 0;
+  THROW_ON_EPIDERR(EcPointGetSize(this->efq2, &size));
+  std::vector<uint8_t> mem(size + 1);
+  EcPoint* point = nullptr;
+  G2ElemStr g2_elem_str = {{{{0}}}, {{{0}}}};
+  EXPECT_EQ(kEpidNoErr, InitEcPoint(this->efq2, mem.data() + 1, size, &point));
+  THROW_ON_EPIDERR(EcMul(this->efq2, this->efq2_a, this->efq2_b, point));
+  THROW_ON_EPIDERR(
+      WriteEcPoint(this->efq2, point, &g2_elem_str, sizeof(g2_elem_str)));
+  EXPECT_EQ(this->efq2_mul_ab_str, g2_elem_str);
+}
+///////////////////////////////////////////////////////////////////////
 // ReadEcPoint
 TEST_F(EcGroupTest, ReadFailsGivenNullPointer) {
   EXPECT_EQ(kEpidBadArgErr, ReadEcPoint(nullptr, &(this->efq_a_str),
@@ -801,6 +1033,15 @@ TEST_F(EcGroupTest, ReadFailsGivenPointDoesNotBelongToEcGroup) {
   EXPECT_EQ(kEpidBadArgErr, ReadEcPoint(this->efq2, &bad_g2_point,
                                         sizeof(bad_g2_point), this->efq2_a));
 }
+TEST_F(EcGroupTest, ReadFailsGivenG2PointOutOfSubgroupWithFrobenius) {
+  EcGroupObj g = this->NewEfq2WithFrobenius();
+  EcPointObj r(&g);
+  EXPECT_EQ(kEpidNoErr, ReadEcPoint(g, &this->efq2_a_str,
+                                    sizeof(this->efq2_a_str), r));
+  EXPECT_EQ(kEpidBadArgErr,
+            ReadEcPoint(g, &this->efq2_out_of_subgroup_str,
+                        sizeof(this->efq2_out_of_subgroup_str), r));
+}
 ///////////////////////////////////////////////////////////////////////
 // WriteEcPoint
 TEST_F(EcGroupTest, WriteFailsGivenNullPointer) {
@@ -846,6 +1087,77 @@ TEST_F(EcGroupTest, WriteEcPointWritesG2PointCorrectly) {
   EXPECT_EQ(this->efq2_a_str, g2_elem_str);
 }
 ///////////////////////////////////////////////////////////////////////
+// WriteEcPoints
+TEST_F(EcGroupTest, WriteEcPointsFailsGivenNullPointer) {
+  G1ElemStr g1_elem_str = {{{{0}}}, {{{0}}}};
+  EcPoint const* points[] = {this->efq_a};
+  EcPoint const* null_points[] = {nullptr};
+  OctStr strs[] = {&g1_elem_str};
+  OctStr null_strs[] = {nullptr};
+  EXPECT_EQ(kEpidBadArgErr,
+            WriteEcPoints(nullptr, points, 1, strs, sizeof(g1_elem_str)));
+  EXPECT_EQ(kEpidBadArgErr,
+            WriteEcPoints(this->efq, nullptr, 1, strs, sizeof(g1_elem_str)));
+  EXPECT_EQ(kEpidBadArgErr,
+            WriteEcPoints(this->efq, points, 1, nullptr, sizeof(g1_elem_str)));
+  EXPECT_EQ(kEpidBadArgErr, WriteEcPoints(this->efq, null_points, 1, strs,
+                                          sizeof(g1_elem_str)));
+  EXPECT_EQ(kEpidBadArgErr, WriteEcPoints(this->efq, points, 1, null_strs,
+                                          sizeof(g1_elem_str)));
+}
+TEST_F(EcGroupTest, WriteEcPointsFailsGivenInvalidSize) {
+  G1ElemStr g1_elem_str = {{{{0}}}, {{{0}}}};
+  EcPoint const* points[] = {this->efq_a};
+  OctStr strs[] = {&g1_elem_str};
+  EXPECT_EQ(kEpidBadArgErr,
+            WriteEcPoints(this->efq, points, 0, strs, sizeof(g1_elem_str)));
+  EXPECT_EQ(kEpidBadArgErr, WriteEcPoints(this->efq, points, 1, strs, 0));
+  EXPECT_EQ(kEpidBadArgErr, WriteEcPoints(this->efq, points, 1, strs,
+                                          sizeof(g1_elem_str) - 1));
+  EXPECT_EQ(kEpidBadArgErr, WriteEcPoints(this->efq, points, 1, strs,
+                                          std::numeric_limits<size_t>::max()));
+}
+TEST_F(EcGroupTest, WriteEcPointsWritesG1PointsCorrectly) {
+  EcPointObj efq_s(&this->efq);
+  G1ElemStr strs[5];
+  THROW_ON_EPIDERR(EcMul(this->efq, this->efq_a, this->efq_b, this->efq_r));
+  THROW_ON_EPIDERR(EcExp(this->efq, this->efq_a, &this->x_str, efq_s));
+  EcPoint const* points[] = {this->efq_r, this->efq_identity, this->efq_a,
+                             efq_s, this->efq_r};
+  OctStr strs_ptr[] = {&strs[0], &strs[1], &strs[2], &strs[3], &strs[4]};
+  EXPECT_EQ(kEpidNoErr,
+            WriteEcPoints(this->efq, points, 5, strs_ptr, sizeof(strs[0])));
+  EXPECT_EQ(this->efq_mul_ab_str, strs[0]);
+  EXPECT_EQ(this->efq_identity_str, strs[1]);
+  EXPECT_EQ(this->efq_a_str, strs[2]);
+  EXPECT_EQ(this->efq_exp_ax_str, strs[3]);
+  EXPECT_EQ(this->efq_mul_ab_str, strs[4]);
+}
+TEST_F(EcGroupTest, WriteEcPointsWritesG1IdentityPointsCorrectly) {
+  G1ElemStr strs[2];
+  EcPoint const* points[] = {this->efq_identity, this->efq_identity};
+  OctStr strs_ptr[] = {&strs[0], &strs[1]};
+  EXPECT_EQ(kEpidNoErr,
+            WriteEcPoints(this->efq, points, 2, strs_ptr, sizeof(strs[0])));
+  EXPECT_EQ(this->efq_identity_str, strs[0]);
+  EXPECT_EQ(this->efq_identity_str, strs[1]);
+}
+TEST_F(EcGroupTest, WriteEcPointsWritesG2PointsCorrectly) {
+  EcPointObj efq2_s(&this->efq2);
+  G2ElemStr strs[4];
+  THROW_ON_EPIDERR(EcMul(this->efq2, this->efq2_a, this->efq2_b, this->efq2_r));
+  THROW_ON_EPIDERR(EcExp(this->efq2, this->efq2_a, &this->x_str, efq2_s));
+  EcPoint const* points[] = {this->efq2_a, this->efq2_r,
+                             this->efq2_identity, efq2_s};
+  OctStr strs_ptr[] = {&strs[0], &strs[1], &strs[2], &strs[3]};
+  EXPECT_EQ(kEpidNoErr,
+            WriteEcPoints(this->efq2, points, 4, strs_ptr, sizeof(strs[0])));
+  EXPECT_EQ(this->efq2_a_str, strs[0]);
+  EXPECT_EQ(this->efq2_mul_ab_str, strs[1]);
+  EXPECT_EQ(this->efq2_identity_str, strs[2]);
+  EXPECT_EQ(this->efq2_exp_ax_str, strs[3]);
+}
+///////////////////////////////////////////////////////////////////////
 // EcMul
 TEST_F(EcGroupTest, MulFailsGivenArgumentsMismatch) {
   EXPECT_EQ(kEpidBadArgErr,
@@ -969,6 +1281,60 @@ TEST_F(EcGroupTest, ExpResultIsCorrectForG2) {
   EXPECT_EQ(this->efq2_exp_ax_str, efq2_r_str);
 }
 ///////////////////////////////////////////////////////////////////////
+// EcExpFp
+TEST_F(EcGroupTest, ExpFpFailsGivenArgumentsMismatch) {
+  FiniteFieldObj fp(this->p);
+  FfElementObj x(&fp, &this->x_str, sizeof(this->x_str));
+  EXPECT_EQ(kEpidBadArgErr,
+            EcExpFp(this->efq2, this->efq_a, fp, x, this->efq_r));
+  EXPECT_EQ(kEpidBadArgErr,
+            EcExpFp(this->efq, this->efq2_a, fp, x, this->efq_r));
+  EXPECT_EQ(kEpidBadArgErr,
+            EcExpFp(this->efq, this->efq_a, fp, x, this->efq2_r));
+  EXPECT_EQ(kEpidBadArgErr, EcExpFp(this->efq, this->efq_a, this->efq2_par->fq2,
+                                    x, this->efq_r));
+}
+TEST_F(EcGroupTest, ExpFpFailsGivenNullPointer) {
+  FiniteFieldObj fp(this->p);
+  FfElementObj x(&fp, &this->x_str, sizeof(this->x_str));
+  EXPECT_EQ(kEpidBadArgErr, EcExpFp(nullptr, this->efq_a, fp, x, this->efq_r));
+  EXPECT_EQ(kEpidBadArgErr, EcExpFp(this->efq, nullptr, fp, x, this->efq_r));
+  EXPECT_EQ(kEpidBadArgErr,
+            EcExpFp(this->efq, this->efq_a, nullptr, x, this->efq_r));
+  EXPECT_EQ(kEpidBadArgErr,
+            EcExpFp(this->efq, this->efq_a, fp, nullptr, this->efq_r));
+  EXPECT_EQ(kEpidBadArgErr, EcExpFp(this->efq, this->efq_a, fp, x, nullptr));
+}
+TEST_F(EcGroupTest, ExpFpSucceedsGivenZeroExponent) {
+  G1ElemStr efq_r_str;
+  FiniteFieldObj fp(this->p);
+  FfElementObj zero(&fp);
+  EXPECT_EQ(kEpidNoErr,
+            EcExpFp(this->efq, this->efq_a, fp, zero, this->efq_r));
+  THROW_ON_EPIDERR(
+      WriteEcPoint(this->efq, this->efq_r, &efq_r_str, sizeof(efq_r_str)));
+  EXPECT_EQ(this->efq_identity_str, efq_r_str);
+}
+TEST_F(EcGroupTest, ExpFpResultIsCorrect) {
+  G1ElemStr efq_r_str;
+  FiniteFieldObj fp(this->p);
+  FfElementObj x(&fp, &this->x_str, sizeof(this->x_str));
+  EXPECT_EQ(kEpidNoErr, EcExpFp(this->efq, this->efq_a, fp, x, this->efq_r));
+  THROW_ON_EPIDERR(
+      WriteEcPoint(this->efq, this->efq_r, &efq_r_str, sizeof(efq_r_str)));
+  EXPECT_EQ(this->efq_exp_ax_str, efq_r_str);
+}
+TEST_F(EcGroupTest, ExpFpResultIsCorrectForG2) {
+  G2ElemStr efq2_r_str;
+  FiniteFieldObj fp(this->p);
+  FfElementObj x(&fp, &this->x_str, sizeof(this->x_str));
+  EXPECT_EQ(kEpidNoErr,
+            EcExpFp(this->efq2, this->efq2_a, fp, x, this->efq2_r));
+  THROW_ON_EPIDERR(
+      WriteEcPoint(this->efq2, this->efq2_r, &efq2_r_str, sizeof(efq2_r_str)));
+  EXPECT_EQ(this->efq2_exp_ax_str, efq2_r_str);
+}
+///////////////////////////////////////////////////////////////////////
 // EcSscmExp
 TEST_F(EcGroupTest, SscmExpFailsGivenArgumentsMismatch) {
   BigNumStr zero_bn_str = {0};
@@ -1016,6 +1382,77 @@ TEST_F(EcGroupTest, SscmExpSucceedsGivenG2ZeroExponent) {
       WriteEcPoint(this->efq2, this->efq2_r, &efq2_r_str, sizeof(efq2_r_str)));
   EXPECT_EQ(this->efq2_identity_str, efq2_r_str);
 }
+TEST_F(EcGroupTest, ExpWithEndomorphismMatchesExp) {
+  EcGroupObj g = this->NewEfqWithEndomorphism();
+  EcPointObj a(&g, this->efq_a_str);
+  EcPointObj r(&g);
+  BigNumStr p_minus_1 = this->p;
+  p_minus_1.data.data[sizeof(p_minus_1.data.data) - 1] -= 1;
+  BigNumStr one = {0};
+  one.data.data[sizeof(one.data.data) - 1] = 1;
+  const BigNumStr zero = {0};
+  std::vector<BigNumStr> powers = {this->x_str, this->y_str,  zero,
+                                   one,         p_minus_1,    this->p,
+                                   this->glv_lambda};
+  for (auto const& b : powers) {
+    G1ElemStr expected_str;
+    G1ElemStr r_str;
+    THROW_ON_EPIDERR(EcExp(this->efq, this->efq_a, &b, this->efq_r));
+    THROW_ON_EPIDERR(WriteEcPoint(this->efq, this->efq_r, &expected_str,
+                                  sizeof(expected_str)));
+    EXPECT_EQ(kEpidNoErr, EcExp(g, a, &b, r));
+    THROW_ON_EPIDERR(WriteEcPoint(g, r, &r_str, sizeof(r_str)));
+    EXPECT_EQ(expected_str, r_str);
+    EXPECT_EQ(kEpidNoErr, EcSscmExp(g, a, &b, r));
+    THROW_ON_EPIDERR(WriteEcPoint(g, r, &r_str, sizeof(r_str)));
+    EXPECT_EQ(expected_str, r_str);
+  }
+}
+TEST_F(EcGroupTest, ExpWithEndomorphismFailsLikeExpGivenPowerAboveOrder) {
+  EcGroupObj g = this->NewEfqWithEndomorphism();
+  EcPointObj a(&g, this->efq_a_str);
+  EcPointObj r(&g);
+  BigNumStr p_plus_1 = this->p;
+  p_plus_1.data.data[sizeof(p_plus_1.data.data) - 1] += 1;
+  EpidStatus expected = EcExp(this->efq, this->efq_a, &p_plus_1, this->efq_r);
+  EXPECT_NE(kEpidNoErr, expected);
+  EXPECT_EQ(expected, EcExp(g, a, &p_plus_1, r));
+}
+TEST_F(EcGroupTest, ExpWithFrobeniusMatchesExp) {
+  EcGroupObj g = this->NewEfq2WithFrobenius();
+  EcPointObj a(&g, this->efq2_a_str);
+  EcPointObj r(&g);
+  BigNumStr p_minus_1 = this->p;
+  p_minus_1.data.data[sizeof(p_minus_1.data.data) - 1] -= 1;
+  BigNumStr one = {0};
+  one.data.data[sizeof(one.data.data) - 1] = 1;
+  const BigNumStr zero = {0};
+  std::vector<BigNumStr> powers = {this->x_str, this->y_str, zero, one,
+                                   p_minus_1,   this->p,     this->q,
+                                   this->gls_t};
+  for (auto const& b : powers) {
+    G2ElemStr expected_str;
+    G2ElemStr r_str;
+    THROW_ON_EPIDERR(EcExp(this->efq2, this->efq2_a, &b, this->efq2_r));
+    THROW_ON_EPIDERR(WriteEcPoint(this->efq2, this->efq2_r, &expected_str,
+                                  sizeof(expected_str)));
+    EXPECT_EQ(kEpidNoErr, EcExp(g, a, &b, r));
+    THROW_ON_EPIDERR(WriteEcPoint(g, r, &r_str, sizeof(r_str)));
+    EXPECT_EQ(expected_str, r_str);
+    EXPECT_EQ(kEpidNoErr, EcSscmExp(g, a, &b, r));
+    THROW_ON_EPIDERR(WriteEcPoint(g, r, &r_str, sizeof(r_str)));
+    EXPECT_EQ(expected_str, r_str);
+  }
+}
+TEST_F(EcGroupTest, ExpWithFrobeniusResultIsCorrect) {
+  EcGroupObj g = this->NewEfq2WithFrobenius();
+  EcPointObj a(&g, this->efq2_a_str);
+  EcPointObj r(&g);
+  G2ElemStr r_str;
+  EXPECT_EQ(kEpidNoErr, EcExp(g, a, &this->x_str, r));
+  THROW_ON_EPIDERR(WriteEcPoint(g, r, &r_str, sizeof(r_str)));
+  EXPECT_EQ(this->efq2_exp_ax_str, r_str);
+}
 TEST_F(EcGroupTest, SscmExpResultIsCorrectForG2) {
   G2ElemStr efq2_r_str;
   EXPECT_EQ(kEpidNoErr,
@@ -1197,6 +1634,331 @@ TEST_F(EcGroupTest, MultiExpWorksTwiceGivenSameOutputBuf) {
   THROW_ON_EPIDERR(WriteEcPoint(this->efq2, temp, &temp_str, sizeof(temp_str)));
   EXPECT_EQ(temp_str, efq2_r_str);
 }
+/// Powers of a long multi-exponentiation: x, y and 0 with varying low bytes
+std::vector<BigNumStr> MultiExpPowers(BigNumStr const& x, BigNumStr const& y,
+                                      size_t m) {
+  std::vector<BigNumStr> powers(m);
+  for (size_t i = 0; i < m; i++) {
+    if (i % 3 == 0) {
+      powers[i] = x;
+    } else if (i % 3 == 1) {
+      powers[i] = y;
+    } else {
+      memset(&powers[i], 0, sizeof(powers[i]));
+    }
+    powers[i].data.data[sizeof(powers[i].data.data) - 1] ^= (uint8_t)i;
+  }
+  return powers;
+}
+TEST_F(EcGroupTest, MultiExpMatchesSscmMultiExpGivenManyG2Terms) {
+  size_t m = 40;
+  std::vector<BigNumStr> powers = MultiExpPowers(this->x_str, this->y_str, m);
+  std::vector<EcPoint const*> pts(m);
+  std::vector<BigNumStr const*> b(m);
+  for (size_t i = 0; i < m; i++) {
+    pts[i] = (i % 2) ? this->efq2_b : this->efq2_a;
+    b[i] = &powers[i];
+  }
+  EcPointObj expected(&this->efq2);
+  G2ElemStr expected_str;
+  G2ElemStr efq2_r_str;
+  THROW_ON_EPIDERR(
+      EcSscmMultiExp(this->efq2, pts.data(), b.data(), m, expected));
+  EXPECT_EQ(kEpidNoErr,
+            EcMultiExp(this->efq2, pts.data(), b.data(), m, this->efq2_r));
+  THROW_ON_EPIDERR(WriteEcPoint(this->efq2, expected, &expected_str,
+                                sizeof(expected_str)));
+  THROW_ON_EPIDERR(
+      WriteEcPoint(this->efq2, this->efq2_r, &efq2_r_str, sizeof(efq2_r_str)));
+  EXPECT_EQ(expected_str, efq2_r_str);
+}
+TEST_F(EcGroupTest, MultiExpMatchesSscmMultiExpGivenEnoughTermsForBuckets) {
+  // enough terms for the bucket method to be cheaper than interleaving
+  size_t m = 1500;
+  std::vector<BigNumStr> powers = MultiExpPowers(this->x_str, this->y_str, m);
+  std::vector<EcPoint const*> pts(m);
+  std::vector<BigNumStr const*> b(m);
+  for (size_t i = 0; i < m; i++) {
+    pts[i] = (i % 2) ? this->efq_b : this->efq_a;
+    b[i] = &powers[i];
+  }
+  EcPointObj expected(&this->efq);
+  G1ElemStr expected_str;
+  G1ElemStr efq_r_str;
+  THROW_ON_EPIDERR(
+      EcSscmMultiExp(this->efq, pts.data(), b.data(), m, expected));
+  EXPECT_EQ(kEpidNoErr,
+            EcMultiExp(this->efq, pts.data(), b.data(), m, this->efq_r));
+  THROW_ON_EPIDERR(WriteEcPoint(this->efq, expected, &expected_str,
+                                sizeof(expected_str)));
+  THROW_ON_EPIDERR(
+      WriteEcPoint(this->efq, this->efq_r, &efq_r_str, sizeof(efq_r_str)));
+  EXPECT_EQ(expected_str, efq_r_str);
+}
+///////////////////////////////////////////////////////////////////////
+// EcMultiExpFp
+TEST_F(EcGroupTest, MultiExpFpFailsGivenArgumentsMismatch) {
+  FiniteFieldObj fp(this->p);
+  FfElementObj x(&fp, &this->x_str, sizeof(this->x_str));
+  FfElementObj y(&fp, &this->y_str, sizeof(this->y_str));
+  EcPoint const* pts[] = {this->efq_a, this->efq_b};
+  EcPoint const* pts2[] = {this->efq2_a, this->efq2_b};
+  FfElement const* b[] = {x, y};
+  size_t m = 2;
+  EXPECT_EQ(kEpidBadArgErr,
+            EcMultiExpFp(this->efq2, pts, fp, b, m, this->efq2_r));
+  EXPECT_EQ(kEpidBadArgErr,
+            EcMultiExpFp(this->efq, pts2, fp, b, m, this->efq_r));
+  EXPECT_EQ(kEpidBadArgErr,
+            EcMultiExpFp(this->efq, pts, fp, b, m, this->efq2_r));
+  EXPECT_EQ(kEpidBadArgErr, EcMultiExpFp(this->efq, pts, this->efq2_par->fq2,
+                                         b, m, this->efq_r));
+}
+TEST_F(EcGroupTest, MultiExpFpFailsGivenNullPointer) {
+  FiniteFieldObj fp(this->p);
+  FfElementObj x(&fp, &this->x_str, sizeof(this->x_str));
+  EcPoint const* pts[] = {this->efq_a, this->efq_b};
+  EcPoint const* pts_null[] = {this->efq_a, nullptr};
+  FfElement const* b[] = {x, x};
+  FfElement const* b_null[] = {x, nullptr};
+  size_t m = 2;
+  EXPECT_EQ(kEpidBadArgErr, EcMultiExpFp(nullptr, pts, fp, b, m, this->efq_r));
+  EXPECT_EQ(kEpidBadArgErr,
+            EcMultiExpFp(this->efq, nullptr, fp, b, m, this->efq_r));
+  EXPECT_EQ(kEpidBadArgErr,
+            EcMultiExpFp(this->efq, pts_null, fp, b, m, this->efq_r));
+  EXPECT_EQ(kEpidBadArgErr,
+            EcMultiExpFp(this->efq, pts, nullptr, b, m, this->efq_r));
+  EXPECT_EQ(kEpidBadArgErr,
+            EcMultiExpFp(this->efq, pts, fp, nullptr, m, this->efq_r));
+  EXPECT_EQ(kEpidBadArgErr,
+            EcMultiExpFp(this->efq, pts, fp, b_null, m, this->efq_r));
+  EXPECT_EQ(kEpidBadArgErr, EcMultiExpFp(this->efq, pts, fp, b, m, nullptr));
+}
+TEST_F(EcGroupTest, MultiExpFpWorksGivenTwoExponents) {
+  G1ElemStr efq_r_str;
+  FiniteFieldObj fp(this->p);
+  FfElementObj x(&fp, &this->x_str, sizeof(this->x_str));
+  FfElementObj y(&fp, &this->y_str, sizeof(this->y_str));
+  EcPoint const* pts[] = {this->efq_a, this->efq_b};
+  FfElement const* b[] = {x, y};
+  size_t m = 2;
+  EXPECT_EQ(kEpidNoErr, EcMultiExpFp(this->efq, pts, fp, b, m, this->efq_r));
+  THROW_ON_EPIDERR(
+      WriteEcPoint(this->efq, this->efq_r, &efq_r_str, sizeof(efq_r_str)));
+  EXPECT_EQ(this->efq_multiexp_abxy_str, efq_r_str);
+}
+TEST_F(EcGroupTest, MultiExpWithEndomorphismResultIsCorrect) {
+  EcGroupObj g = this->NewEfqWithEndomorphism();
+  EcPointObj a(&g, this->efq_a_str);
+  EcPointObj b(&g, this->efq_b_str);
+  EcPointObj r(&g);
+  EcPoint const* pts[] = {a, b};
+  BigNumStr const* powers[] = {&this->x_str, &this->y_str};
+  G1ElemStr r_str;
+  EXPECT_EQ(kEpidNoErr, EcMultiExp(g, pts, powers, 2, r));
+  THROW_ON_EPIDERR(WriteEcPoint(g, r, &r_str, sizeof(r_str)));
+  EXPECT_EQ(this->efq_multiexp_abxy_str, r_str);
+  EXPECT_EQ(kEpidNoErr, EcSscmMultiExp(g, pts, powers, 2, r));
+  THROW_ON_EPIDERR(WriteEcPoint(g, r, &r_str, sizeof(r_str)));
+  EXPECT_EQ(this->efq_multiexp_abxy_str, r_str);
+}
+TEST_F(EcGroupTest, MultiExpWithEndomorphismMatchesMultiExpGivenManyTerms) {
+  EcGroupObj g = this->NewEfqWithEndomorphism();
+  EcPointObj a(&g, this->efq_a_str);
+  EcPointObj b(&g, this->efq_b_str);
+  EcPointObj r(&g);
+  // interleaved and bucket method
+  for (size_t m : {size_t(40), size_t(1500)}) {
+    std::vector<BigNumStr> powers =
+        MultiExpPowers(this->x_str, this->y_str, m);
+    std::vector<EcPoint const*> efq_pts(m);
+    std::vector<EcPoint const*> pts(m);
+    std::vector<BigNumStr const*> b_str(m);
+    for (size_t i = 0; i < m; i++) {
+      efq_pts[i] = (i % 2) ? this->efq_b : this->efq_a;
+      pts[i] = (i % 2) ? b : a;
+      b_str[i] = &powers[i];
+    }
+    G1ElemStr expected_str;
+    G1ElemStr r_str;
+    THROW_ON_EPIDERR(
+        EcMultiExp(this->efq, efq_pts.data(), b_str.data(), m, this->efq_r));
+    THROW_ON_EPIDERR(WriteEcPoint(this->efq, this->efq_r, &expected_str,
+                                  sizeof(expected_str)));
+    EXPECT_EQ(kEpidNoErr, EcMultiExp(g, pts.data(), b_str.data(), m, r));
+    THROW_ON_EPIDERR(WriteEcPoint(g, r, &r_str, sizeof(r_str)));
+    EXPECT_EQ(expected_str, r_str);
+  }
+}
+TEST_F(EcGroupTest, MultiExpFpMatchesMultiExpGivenManyTerms) {
+  // more terms than fit in the stack power contexts
+  size_t m = 9;
+  FiniteFieldObj fp(this->p);
+  std::vector<BigNumStr> powers = MultiExpPowers(this->x_str, this->y_str, m);
+  std::vector<FfElementObj> elems;
+  std::vector<EcPoint const*> pts(m);
+  std::vector<BigNumStr const*> b_str(m);
+  std::vector<FfElement const*> b(m);
+  for (size_t i = 0; i < m; i++) {
+    elems.push_back(FfElementObj(&fp, &powers[i], sizeof(powers[i])));
+  }
+  for (size_t i = 0; i < m; i++) {
+    pts[i] = (i % 2) ? this->efq_b : this->efq_a;
+    b_str[i] = &powers[i];
+    b[i] = elems[i];
+  }
+  EcPointObj expected(&this->efq);
+  G1ElemStr expected_str;
+  G1ElemStr efq_r_str;
+  THROW_ON_EPIDERR(
+      EcMultiExp(this->efq, pts.data(), b_str.data(), m, expected));
+  EXPECT_EQ(kEpidNoErr,
+            EcMultiExpFp(this->efq, pts.data(), fp, b.data(), m, this->efq_r));
+  THROW_ON_EPIDERR(WriteEcPoint(this->efq, expected, &expected_str,
+                                sizeof(expected_str)));
+  THROW_ON_EPIDERR(
+      WriteEcPoint(this->efq, this->efq_r, &efq_r_str, sizeof(efq_r_str)));
+  EXPECT_EQ(expected_str, efq_r_str);
+}
+///////////////////////////////////////////////////////////////////////
+// NewEcPointTable / DeleteEcPointTable
+TEST_F(EcGroupTest, NewEcPointTableFailsGivenNullPointer) {
+  EcPointTable* table = nullptr;
+  EXPECT_EQ(kEpidBadArgErr, NewEcPointTable(nullptr, this->efq_a, &table));
+  EXPECT_EQ(kEpidBadArgErr, NewEcPointTable(this->efq, nullptr, &table));
+  EXPECT_EQ(kEpidBadArgErr, NewEcPointTable(this->efq, this->efq_a, nullptr));
+}
+TEST_F(EcGroupTest, NewEcPointTableFailsGivenArgumentsMismatch) {
+  EcPointTable* table = nullptr;
+  EXPECT_EQ(kEpidBadArgErr, NewEcPointTable(this->efq2, this->efq_a, &table));
+  EXPECT_EQ(kEpidBadArgErr, NewEcPointTable(this->efq, this->efq2_a, &table));
+}
+TEST_F(EcGroupTest, DeleteEcPointTableNullsPointer) {
+  EcPointTable* table = nullptr;
+  THROW_ON_EPIDERR(NewEcPointTable(this->efq, this->efq_a, &table));
+  EXPECT_NO_THROW(DeleteEcPointTable(&table));
+  EXPECT_EQ(nullptr, table);
+}
+TEST_F(EcGroupTest, DeleteEcPointTableWorksGivenNullPointer) {
+  EXPECT_NO_THROW(DeleteEcPointTable(nullptr));
+  EcPointTable* table = nullptr;
+  EXPECT_NO_THROW(DeleteEcPointTable(&table));
+  EXPECT_EQ(nullptr, table);
+}
+///////////////////////////////////////////////////////////////////////
+// EcMultiExpTable
+TEST_F(EcGroupTest, MultiExpTableFailsGivenNullPointer) {
+  EcPointTable* table_a = nullptr;
+  THROW_ON_EPIDERR(NewEcPointTable(this->efq, this->efq_a, &table_a));
+  EcPointTable const* tables[] = {table_a};
+  EcPointTable const* tables_withnull[] = {nullptr};
+  BigNumStr const* b[] = {&this->x_str};
+  BigNumStr const* b_withnull[] = {nullptr};
+  size_t m = 1;
+
+  EXPECT_EQ(kEpidBadArgErr,
+            EcMultiExpTable(nullptr, tables, b, m, this->efq_r));
+  EXPECT_EQ(kEpidBadArgErr,
+            EcMultiExpTable(this->efq, nullptr, b, m, this->efq_r));
+  EXPECT_EQ(kEpidBadArgErr,
+            EcMultiExpTable(this->efq, tables, nullptr, m, this->efq_r));
+  EXPECT_EQ(kEpidBadArgErr, EcMultiExpTable(this->efq, tables, b, m, nullptr));
+  EXPECT_EQ(kEpidBadArgErr,
+            EcMultiExpTable(this->efq, tables_withnull, b, m, this->efq_r));
+  EXPECT_EQ(kEpidBadArgErr,
+            EcMultiExpTable(this->efq, tables, b_withnull, m, this->efq_r));
+  DeleteEcPointTable(&table_a);
+}
+TEST_F(EcGroupTest, MultiExpTableFailsGivenArgumentsMismatch) {
+  EcPointTable* table_a = nullptr;
+  THROW_ON_EPIDERR(NewEcPointTable(this->efq, this->efq_a, &table_a));
+  EcPointTable const* tables[] = {table_a};
+  BigNumStr const* b[] = {&this->x_str};
+  size_t m = 1;
+
+  EXPECT_EQ(kEpidBadArgErr,
+            EcMultiExpTable(this->efq2, tables, b, m, this->efq2_r));
+  EXPECT_EQ(kEpidBadArgErr,
+            EcMultiExpTable(this->efq, tables, b, m, this->efq2_r));
+  DeleteEcPointTable(&table_a);
+}
+TEST_F(EcGroupTest, MultiExpTableWorksGivenZeroExponent) {
+  G1ElemStr efq_r_str;
+  BigNumStr zero_bn_str = {0};
+  EcPointTable* table_a = nullptr;
+  THROW_ON_EPIDERR(NewEcPointTable(this->efq, this->efq_a, &table_a));
+  EcPointTable const* tables[] = {table_a};
+  BigNumStr const* b[] = {&zero_bn_str};
+  size_t m = 1;
+  EXPECT_EQ(kEpidNoErr, EcMultiExpTable(this->efq, tables, b, m, this->efq_r));
+  DeleteEcPointTable(&table_a);
+  THROW_ON_EPIDERR(
+      WriteEcPoint(this->efq, this->efq_r, &efq_r_str, sizeof(efq_r_str)));
+  EXPECT_EQ(this->efq_identity_str, efq_r_str);
+}
+TEST_F(EcGroupTest, MultiExpTableWorksGivenOneExponent) {
+  G1ElemStr efq_r_str;
+  EcPointTable* table_a = nullptr;
+  THROW_ON_EPIDERR(NewEcPointTable(this->efq, this->efq_a, &table_a));
+  EcPointTable const* tables[] = {table_a};
+  BigNumStr const* b[] = {&this->x_str};
+  size_t m = 1;
+  EXPECT_EQ(kEpidNoErr, EcMultiExpTable(this->efq, tables, b, m, this->efq_r));
+  DeleteEcPointTable(&table_a);
+  THROW_ON_EPIDERR(
+      WriteEcPoint(this->efq, this->efq_r, &efq_r_str, sizeof(efq_r_str)));
+  EXPECT_EQ(this->efq_exp_ax_str, efq_r_str);
+}
+TEST_F(EcGroupTest, MultiExpTableWorksGivenTwoExponents) {
+  G1ElemStr efq_r_str;
+  EcPointTable* table_a = nullptr;
+  EcPointTable* table_b = nullptr;
+  THROW_ON_EPIDERR(NewEcPointTable(this->efq, this->efq_a, &table_a));
+  THROW_ON_EPIDERR(NewEcPointTable(this->efq, this->efq_b, &table_b));
+  EcPointTable const* tables[] = {table_a, table_b};
+  BigNumStr const* b[] = {&this->x_str, &this->y_str};
+  size_t m = 2;
+  EXPECT_EQ(kEpidNoErr, EcMultiExpTable(this->efq, tables, b, m, this->efq_r));
+  DeleteEcPointTable(&table_b);
+  DeleteEcPointTable(&table_a);
+  THROW_ON_EPIDERR(
+      WriteEcPoint(this->efq, this->efq_r, &efq_r_str, sizeof(efq_r_str)));
+  EXPECT_EQ(this->efq_multiexp_abxy_str, efq_r_str);
+}
+TEST_F(EcGroupTest, MultiExpTableWorksGivenTwoG2Exponents) {
+  G2ElemStr efq2_r_str;
+  EcPointTable* table_a = nullptr;
+  EcPointTable* table_b = nullptr;
+  THROW_ON_EPIDERR(NewEcPointTable(this->efq2, this->efq2_a, &table_a));
+  THROW_ON_EPIDERR(NewEcPointTable(this->efq2, this->efq2_b, &table_b));
+  EcPointTable const* tables[] = {table_a, table_b};
+  BigNumStr const* b[] = {&this->x_str, &this->y_str};
+  size_t m = 2;
+  EXPECT_EQ(kEpidNoErr,
+            EcMultiExpTable(this->efq2, tables, b, m, this->efq2_r));
+  DeleteEcPointTable(&table_b);
+  DeleteEcPointTable(&table_a);
+  THROW_ON_EPIDERR(
+      WriteEcPoint(this->efq2, this->efq2_r, &efq2_r_str, sizeof(efq2_r_str)));
+  EXPECT_EQ(this->efq2_multiexp_abxy_str, efq2_r_str);
+}
+TEST_F(EcGroupTest, MultiExpTableWorksTwiceWithSameTable) {
+  G1ElemStr efq_r_str;
+  EcPointTable* table_a = nullptr;
+  THROW_ON_EPIDERR(NewEcPointTable(this->efq, this->efq_a, &table_a));
+  EcPointTable const* tables[] = {table_a};
+  BigNumStr const* b_x[] = {&this->x_str};
+  BigNumStr const* b_y[] = {&this->y_str};
+  EXPECT_EQ(kEpidNoErr,
+            EcMultiExpTable(this->efq, tables, b_y, 1, this->efq_r));
+  EXPECT_EQ(kEpidNoErr,
+            EcMultiExpTable(this->efq, tables, b_x, 1, this->efq_r));
+  DeleteEcPointTable(&table_a);
+  THROW_ON_EPIDERR(
+      WriteEcPoint(this->efq, this->efq_r, &efq_r_str, sizeof(efq_r_str)));
+  EXPECT_EQ(this->efq_exp_ax_str, efq_r_str);
+}
 ///////////////////////////////////////////////////////////////////////
 // EcMultiExpBn
 TEST_F(EcGroupTest, MultiExpBnFailsGivenArgumentsMismatch) {
@@ -1731,6 +2493,25 @@ TEST_F(EcGroupTest, InGroupFailsGivenContextMismatch) {
                                       sizeof(this->efq2_a_str), &in_group));
   EXPECT_FALSE(in_group);
 }
+TEST_F(EcGroupTest, InGroupDetectsG2ElementOutOfSubgroupWithFrobenius) {
+  EcGroupObj g = this->NewEfq2WithFrobenius();
+  bool in_group = false;
+  // without the endomorphism only the curve equation is checked
+  EXPECT_EQ(kEpidNoErr,
+            EcInGroup(this->efq2, &this->efq2_out_of_subgroup_str,
+                      sizeof(this->efq2_out_of_subgroup_str), &in_group));
+  EXPECT_TRUE(in_group);
+  EXPECT_EQ(kEpidNoErr, EcInGroup(g, &this->efq2_out_of_subgroup_str,
+                                  sizeof(this->efq2_out_of_subgroup_str),
+                                  &in_group));
+  EXPECT_FALSE(in_group);
+  std::vector<G2ElemStr> points = {this->efq2_a_str, this->efq2_b_str,
+                                   this->efq2_identity_str};
+  for (auto const& p_str : points) {
+    EXPECT_EQ(kEpidNoErr, EcInGroup(g, &p_str, sizeof(p_str), &in_group));
+    EXPECT_TRUE(in_group);
+  }
+}
 ///////////////////////////////////////////////////////////////////////
 // EcHash
 TEST_F(EcGroupTest, HashFailsGivenArgumentsMismatch) {
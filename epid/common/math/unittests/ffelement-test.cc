@@ -22,6 +22,7 @@
 #include <algorithm>
 #include <cstring>
 #include <limits>
+#include <vector>
 
 #include "epid/common-testhelper/epid_gtest-testhelper.h"
 #include "gtest/gtest.h"
@@ -1455,6 +1456,62 @@ TEST_F(FfElementTest, DeleteWorksGivenNullPointer) {
   EXPECT_NO_THROW(DeleteFfElement(&ff_elem));
 }
 
+////////////////////////////////////////////////
+// FfElementGetSize / InitFfElement
+
+TEST_F(FfElementTest, FfElementGetSizeFailsGivenNullPointer) {
+  size_t size = 0;
+  EXPECT_EQ(kEpidBadArgErr, FfElementGetSize(nullptr, &size));
+  EXPECT_EQ(kEpidBadArgErr, FfElementGetSize(this->fq, nullptr));
+}
+
+TEST_F(FfElementTest, InitFfElementFailsGivenNullPointer) {
+  size_t size = 0;
+  THROW_ON_EPIDERR(FfElementGetSize(this->fq, &size));
+  std::vector<uint8_t> mem(size);
+  FfElement* ff_elem = nullptr;
+  EXPECT_EQ(kEpidBadArgErr, InitFfElement(nullptr, mem.data(), size, &ff_elem));
+  EXPECT_EQ(kEpidBadArgErr, InitFfElement(this->fq, nullptr, size, &ff_elem));
+  EXPECT_EQ(kEpidBadArgErr, InitFfElement(this->fq, mem.data(), size, nullptr));
+}
+
+TEST_F(FfElementTest, InitFfElementFailsGivenTooSmallBuffer) {
+  size_t size = 0;
+  THROW_ON_EPIDERR(FfElementGetSize(this->fq, &size));
+  std::vector<uint8_t> mem(size);
+  FfElement* ff_elem = nullptr;
+  EXPECT_EQ(kEpidBadArgErr,
+            InitFfElement(this->fq, mem.data(), size - 1, &ff_elem));
+}
+
+TEST_F(FfElementTest, InitFfElementCreatesZeroElement) {
+  size_t size = 0;
+  THROW_ON_EPIDERR(FfElementGetSize(this->fq, &size));
+  std::vector<uint8_t> mem(size, 0xff);
+  FfElement* ff_elem = nullptr;
+  FqElemStr ff_elem_str;
+  FqElemStr fq_zero_str = {0};
+  EXPECT_EQ(kEpidNoErr, InitFfElement(this->fq, mem.data(), size, &ff_elem));
+  THROW_ON_EPIDERR(
+      WriteFfElement(this->fq, ff_elem, &ff_elem_str, sizeof(ff_elem_str)));
+  EXPECT_EQ(fq_zero_str, ff_elem_str);
+}
+
+TEST_F(FfElementTest, InitFfElementWorksGivenUnalignedBuffer) {
+  size_t size = 0;
+  THROW_ON_EPIDERR(FfElementGetSize(this->fq12, &size));
+  std::vector<uint8_t> mem(size + 1);
+  FfElement* ff_elem = nullptr;
+  Fq12ElemStr ff_elem_str;
+  EXPECT_EQ(kEpidNoErr,
+            InitFfElement(this->fq12, mem.data() + 1, size, &ff_elem));
+  THROW_ON_EPIDERR(ReadFfElement(this->fq12, &this->fq12_g_str,
+                                 sizeof(this->fq12_g_str), ff_elem));
+  THROW_ON_EPIDERR(
+      WriteFfElement(this->fq12, ff_elem, &ff_elem_str, sizeof(ff_elem_str)));
+  EXPECT_EQ(this->fq12_g_str, ff_elem_str);
+}
+
 ////////////////////////////////////////////////
 // ReadFfElement
 
@@ -2199,6 +2256,126 @@ TEST_F(FfElementTest, FfHashWorksGivenSHA512256HashAlg) {
   EXPECT_EQ(this->fq_abc_sha512256_str, fq_r_str)
       << "FfHash: Hash element does not match to reference value";
 }
+
+////////////////////////////////////////////////
+// NewFfHashState / FfHashUpdate / FfHashFinal
+
+TEST_F(FfElementTest, NewFfHashStateFailsGivenNullPointer) {
+  EXPECT_EQ(kEpidBadArgErr, NewFfHashState(kSha256, nullptr));
+}
+
+TEST_F(FfElementTest, NewFfHashStateFailsGivenUnsupportedHashAlg) {
+  FfHashState* state = nullptr;
+  EXPECT_EQ(kEpidHashAlgorithmNotSupported, NewFfHashState(kSha3_256, &state));
+  EXPECT_EQ(nullptr, state);
+}
+
+TEST_F(FfElementTest, DeleteFfHashStateNullsPointer) {
+  FfHashState* state = nullptr;
+  THROW_ON_EPIDERR(NewFfHashState(kSha256, &state));
+  DeleteFfHashState(&state);
+  EXPECT_EQ(nullptr, state);
+  EXPECT_NO_THROW(DeleteFfHashState(&state));
+  EXPECT_NO_THROW(DeleteFfHashState(nullptr));
+}
+
+TEST_F(FfElementTest, FfHashUpdateFailsGivenNullPointer) {
+  FfHashState* state = nullptr;
+  THROW_ON_EPIDERR(NewFfHashState(kSha256, &state));
+  EXPECT_EQ(kEpidBadArgErr, FfHashUpdate(nullptr, sha_msg, sizeof(sha_msg)));
+  EXPECT_EQ(kEpidBadArgErr, FfHashUpdate(state, nullptr, sizeof(sha_msg)));
+  EXPECT_EQ(kEpidNoErr, FfHashUpdate(state, nullptr, 0));
+  DeleteFfHashState(&state);
+}
+
+TEST_F(FfElementTest, FfHashFinalFailsGivenNullPointer) {
+  FfHashState* state = nullptr;
+  THROW_ON_EPIDERR(NewFfHashState(kSha256, &state));
+  EXPECT_EQ(kEpidBadArgErr, FfHashFinal(nullptr, state, this->fq_result));
+  EXPECT_EQ(kEpidBadArgErr, FfHashFinal(this->fq, nullptr, this->fq_result));
+  EXPECT_EQ(kEpidBadArgErr, FfHashFinal(this->fq, state, nullptr));
+  DeleteFfHashState(&state);
+}
+
+TEST_F(FfElementTest, FfHashFinalMatchesFfHashForAllHashAlgs) {
+  HashAlg const hash_algs[] = {kSha256, kSha384, kSha512, kSha512_256};
+  FqElemStr const* expected[] = {
+      &this->fq_abc_sha256_str, &this->fq_abc_sha384_str,
+      &this->fq_abc_sha512_str, &this->fq_abc_sha512256_str};
+  for (size_t i = 0; i < sizeof(hash_algs) / sizeof(hash_algs[0]); i++) {
+    FfHashState* state = nullptr;
+    FqElemStr fq_r_str;
+    THROW_ON_EPIDERR(NewFfHashState(hash_algs[i], &state));
+    // "abc" added as "a" and "bc"
+    EXPECT_EQ(kEpidNoErr, FfHashUpdate(state, sha_msg, 1));
+    EXPECT_EQ(kEpidNoErr, FfHashUpdate(state, sha_msg + 1, 0));
+    EXPECT_EQ(kEpidNoErr, FfHashUpdate(state, sha_msg + 1, 2));
+    EXPECT_EQ(kEpidNoErr, FfHashFinal(this->fq, state, this->fq_result));
+    DeleteFfHashState(&state);
+    THROW_ON_EPIDERR(WriteFfElement(this->fq, this->fq_result, &fq_r_str,
+                                    sizeof(fq_r_str)));
+    EXPECT_EQ(*expected[i], fq_r_str) << "hash_alg: " << hash_algs[i];
+  }
+}
+
+TEST_F(FfElementTest, FfHashFinalRestartsState) {
+  FfHashState* state = nullptr;
+  FqElemStr fq_r_str;
+  THROW_ON_EPIDERR(NewFfHashState(kSha256, &state));
+  THROW_ON_EPIDERR(FfHashUpdate(state, sha_msg, sizeof(sha_msg)));
+  THROW_ON_EPIDERR(FfHashFinal(this->fq, state, this->fq_result));
+  THROW_ON_EPIDERR(FfHashUpdate(state, sha_msg, sizeof(sha_msg)));
+  EXPECT_EQ(kEpidNoErr, FfHashFinal(this->fq, state, this->fq_result));
+  DeleteFfHashState(&state);
+  THROW_ON_EPIDERR(
+      WriteFfElement(this->fq, this->fq_result, &fq_r_str, sizeof(fq_r_str)));
+  EXPECT_EQ(this->fq_abc_sha256_str, fq_r_str);
+}
+
+TEST_F(FfElementTest, FfHashStateCopyFailsGivenNullPointer) {
+  FfHashState* state = nullptr;
+  THROW_ON_EPIDERR(NewFfHashState(kSha256, &state));
+  EXPECT_EQ(kEpidBadArgErr, FfHashStateCopy(nullptr, state));
+  EXPECT_EQ(kEpidBadArgErr, FfHashStateCopy(state, nullptr));
+  DeleteFfHashState(&state);
+}
+
+TEST_F(FfElementTest, FfHashStateCopyFailsGivenDifferentHashAlgs) {
+  FfHashState* src = nullptr;
+  FfHashState* dst = nullptr;
+  THROW_ON_EPIDERR(NewFfHashState(kSha256, &src));
+  THROW_ON_EPIDERR(NewFfHashState(kSha512, &dst));
+  EXPECT_EQ(kEpidBadArgErr, FfHashStateCopy(src, dst));
+  DeleteFfHashState(&dst);
+  DeleteFfHashState(&src);
+}
+
+TEST_F(FfElementTest, FfHashStateCopyResumesFromPrefixForAllHashAlgs) {
+  HashAlg const hash_algs[] = {kSha256, kSha384, kSha512, kSha512_256};
+  FqElemStr const* expected[] = {
+      &this->fq_abc_sha256_str, &this->fq_abc_sha384_str,
+      &this->fq_abc_sha512_str, &this->fq_abc_sha512256_str};
+  for (size_t i = 0; i < sizeof(hash_algs) / sizeof(hash_algs[0]); i++) {
+    FfHashState* prefix = nullptr;
+    FfHashState* state = nullptr;
+    THROW_ON_EPIDERR(NewFfHashState(hash_algs[i], &prefix));
+    THROW_ON_EPIDERR(NewFfHashState(hash_algs[i], &state));
+    // "abc" finished twice from a copy of the "a" prefix
+    THROW_ON_EPIDERR(FfHashUpdate(prefix, sha_msg, 1));
+    for (int j = 0; j < 2; j++) {
+      FqElemStr fq_r_str;
+      THROW_ON_EPIDERR(FfHashUpdate(state, "x", 1));
+      EXPECT_EQ(kEpidNoErr, FfHashStateCopy(prefix, state));
+      THROW_ON_EPIDERR(FfHashUpdate(state, sha_msg + 1, 2));
+      THROW_ON_EPIDERR(FfHashFinal(this->fq, state, this->fq_result));
+      THROW_ON_EPIDERR(WriteFfElement(this->fq, this->fq_result, &fq_r_str,
+                                      sizeof(fq_r_str)));
+      EXPECT_EQ(*expected[i], fq_r_str) << "hash_alg: " << hash_algs[i];
+    }
+    DeleteFfHashState(&state);
+    DeleteFfHashState(&prefix);
+  }
+}
 ////////////////////////////////////////////////
 // FfMultiExp
 
@@ -2793,6 +2970,124 @@ TEST_F(FfElementTest, SscmFfMultiExpWorksGivenSixExponents) {
       << "FfSscmMultiExp: Finite field element does not "
          "match with reference value";
 }
+////////////////////////////////////////////////
+// FfCombTable
+
+FfCombTable* NewFfCombTableOf(FiniteField* ff, FfElement const* a) {
+  FfCombTable* table = nullptr;
+  THROW_ON_EPIDERR(NewFfCombTable(ff, &table));
+  EpidStatus sts = InitFfCombTable(ff, a, table);
+  if (kEpidNoErr != sts) {
+    DeleteFfCombTable(&table);
+    THROW_ON_EPIDERR(sts);
+  }
+  return table;
+}
+TEST_F(FfElementTest, NewFfCombTableFailsGivenNullPointer) {
+  FfCombTable* table = nullptr;
+  EXPECT_EQ(kEpidBadArgErr, NewFfCombTable(nullptr, &table));
+  EXPECT_EQ(kEpidBadArgErr, NewFfCombTable(this->fq12, nullptr));
+}
+TEST_F(FfElementTest, NewFfCombTableFailsGivenFieldOtherThanGt) {
+  FfCombTable* table = nullptr;
+  EXPECT_EQ(kEpidBadArgErr, NewFfCombTable(this->fq, &table));
+  EXPECT_EQ(kEpidBadArgErr, NewFfCombTable(this->fq6, &table));
+  EXPECT_EQ(kEpidBadArgErr, NewFfCombTable(this->epid11_GT, &table));
+}
+TEST_F(FfElementTest, DeleteFfCombTableNullsPointer) {
+  FfCombTable* table = nullptr;
+  THROW_ON_EPIDERR(NewFfCombTable(this->fq12, &table));
+  DeleteFfCombTable(&table);
+  EXPECT_EQ(nullptr, table);
+}
+TEST_F(FfElementTest, DeleteFfCombTableWorksGivenNullPointer) {
+  EXPECT_NO_THROW(DeleteFfCombTable(nullptr));
+  FfCombTable* table = nullptr;
+  EXPECT_NO_THROW(DeleteFfCombTable(&table));
+}
+TEST_F(FfElementTest, InitFfCombTableFailsGivenBadArgs) {
+  FfCombTable* table = nullptr;
+  THROW_ON_EPIDERR(NewFfCombTable(this->fq12, &table));
+  EXPECT_EQ(kEpidBadArgErr, InitFfCombTable(nullptr, this->fq12_g, table));
+  EXPECT_EQ(kEpidBadArgErr, InitFfCombTable(this->fq12, nullptr, table));
+  EXPECT_EQ(kEpidBadArgErr, InitFfCombTable(this->fq12, this->fq12_g, nullptr));
+  EXPECT_EQ(kEpidBadArgErr, InitFfCombTable(this->fq12, this->fq_a, table));
+  EXPECT_EQ(kEpidBadArgErr, InitFfCombTable(this->fq, this->fq_a, table));
+  DeleteFfCombTable(&table);
+}
+
+////////////////////////////////////////////////
+// FfMultiExpComb
+
+TEST_F(FfElementTest, FfMultiExpCombFailsGivenNullPointer) {
+  FfCombTable* table = NewFfCombTableOf(this->fq12, this->fq12_g);
+  FfCombTable const* tables[] = {table, table};
+  FfCombTable const* tables_withnull[] = {table, nullptr};
+  BigNumStr const* b[] = {&this->bn_a_str, &this->bn_a_str};
+  BigNumStr const* b_withnull[] = {&this->bn_a_str, nullptr};
+  size_t m = COUNT_OF(tables);
+  EXPECT_EQ(kEpidBadArgErr,
+            FfMultiExpComb(nullptr, tables, b, m, this->fq12_result));
+  EXPECT_EQ(kEpidBadArgErr,
+            FfMultiExpComb(this->fq12, nullptr, b, m, this->fq12_result));
+  EXPECT_EQ(kEpidBadArgErr,
+            FfMultiExpComb(this->fq12, tables, nullptr, m, this->fq12_result));
+  EXPECT_EQ(kEpidBadArgErr, FfMultiExpComb(this->fq12, tables, b, m, nullptr));
+  EXPECT_EQ(kEpidBadArgErr, FfMultiExpComb(this->fq12, tables_withnull, b, m,
+                                           this->fq12_result));
+  EXPECT_EQ(kEpidBadArgErr, FfMultiExpComb(this->fq12, tables, b_withnull, m,
+                                           this->fq12_result));
+  DeleteFfCombTable(&table);
+}
+TEST_F(FfElementTest, FfMultiExpCombFailsGivenArgumentsMismatch) {
+  FfCombTable* table = NewFfCombTableOf(this->fq12, this->fq12_g);
+  FfCombTable const* tables[] = {table};
+  BigNumStr const* b[] = {&this->bn_a_str};
+  EXPECT_EQ(kEpidBadArgErr,
+            FfMultiExpComb(this->fq12, tables, b, 0, this->fq12_result));
+  EXPECT_EQ(kEpidBadArgErr,
+            FfMultiExpComb(this->fq12, tables, b, 1, this->fq_result));
+  EXPECT_EQ(kEpidBadArgErr,
+            FfMultiExpComb(this->fq, tables, b, 1, this->fq_result));
+  DeleteFfCombTable(&table);
+}
+TEST_F(FfElementTest, FfMultiExpCombFailsGivenEmptyTable) {
+  FfCombTable* table = nullptr;
+  THROW_ON_EPIDERR(NewFfCombTable(this->fq12, &table));
+  FfCombTable const* tables[] = {table};
+  BigNumStr const* b[] = {&this->bn_a_str};
+  EXPECT_EQ(kEpidBadArgErr,
+            FfMultiExpComb(this->fq12, tables, b, 1, this->fq12_result));
+  DeleteFfCombTable(&table);
+}
+TEST_F(FfElementTest, FfMultiExpCombWorksGivenZeroExponent) {
+  FfCombTable* table = NewFfCombTableOf(this->fq12, this->fq12_g);
+  FfCombTable const* tables[] = {table};
+  BigNumStr const* b[] = {&this->bn_0_str};
+  FfElementObj one(&this->fq12, &this->bn_1_str, sizeof(this->bn_1_str));
+  EXPECT_EQ(kEpidNoErr,
+            FfMultiExpComb(this->fq12, tables, b, 1, this->fq12_result));
+  EXPECT_EQ(one, this->fq12_result);
+  DeleteFfCombTable(&table);
+}
+TEST_F(FfElementTest, FfMultiExpCombWorksGivenFourFq12Exponents) {
+  FfCombTable* tables[4];
+  BigNumStr const* b[4];
+  size_t m = 0;
+  for (m = 0; m < COUNT_OF(tables); m++) {
+    tables[m] = NewFfCombTableOf(
+        this->fq12, FfElementObj(&this->fq12, this->fq12_multi_exp_base_4[m]));
+    b[m] = &this->fq12_multi_exp_exp_4[m];
+  }
+  EXPECT_EQ(kEpidNoErr, FfMultiExpComb(this->fq12, (FfCombTable const**)tables,
+                                       b, COUNT_OF(tables), this->fq12_result));
+  EXPECT_EQ(FfElementObj(&this->fq12, this->fq12_multi_exp_res_4),
+            this->fq12_result);
+  for (m = 0; m < COUNT_OF(tables); m++) {
+    DeleteFfCombTable(&tables[m]);
+  }
+}
+
 ////////////////////////////////////////////////
 // FfGetRandom
 
@@ -24,6 +24,7 @@
 #include "epid/common-testhelper/epid_gtest-testhelper.h"
 #include "gtest/gtest.h"
 
+#include "epid/common-testhelper/bignum_wrapper-testhelper.h"
 #include "epid/common-testhelper/ecgroup_wrapper-testhelper.h"
 #include "epid/common-testhelper/ecpoint_wrapper-testhelper.h"
 #include "epid/common-testhelper/epid_params-testhelper.h"
@@ -50,6 +51,7 @@ class PairingTest : public Epid20Params, public ::testing::Test {
   static const BigNumStr t_str;
   static const G1ElemStr ga_elem_str;
   static const G2ElemStr gb_elem_str;
+  static const G2ElemStr gb_out_of_subgroup_str;
 
   virtual void SetUp() { params = new Epid20Params(); }
   virtual void TearDown() { delete params; }
@@ -83,6 +85,20 @@ const G2ElemStr PairingTest::gb_elem_str = {
     0x35, 0x14, 0x0e, 0xc9, 0xdf, 0xba, 0x9b, 0x6f, 0x3a, 0xca, 0x94, 0x9c,
     0x44, 0x89, 0x94, 0xa3, 0xeb, 0x61, 0x8b, 0x01,
 };
+// on the curve of G2, but not of the order p
+const G2ElemStr PairingTest::gb_out_of_subgroup_str = {
+    0xae, 0x97, 0xba, 0x94, 0xd0, 0xed, 0xa8, 0x2f, 0x8f, 0x6d, 0x05, 0x58,
+    0x4e, 0xf8, 0xaa, 0x38, 0x92, 0x27, 0x66, 0x58, 0x1e, 0x27, 0xa1, 0xc0,
+    0x8a, 0x6a, 0x63, 0xec, 0x24, 0xed, 0xe6, 0xa4, 0x18, 0xf1, 0x35, 0xd2,
+    0x5f, 0x55, 0x72, 0x03, 0x30, 0x18, 0x50, 0xc5, 0xa3, 0x8f, 0xd5, 0x47,
+    0x92, 0x3a, 0x73, 0x69, 0x94, 0xe3, 0xbf, 0x91, 0x1a, 0x61, 0xdb, 0xe2,
+    0x2e, 0x44, 0x15, 0x8b, 0x43, 0x7c, 0x82, 0x9a, 0x06, 0x6e, 0xc5, 0x3f,
+    0x90, 0x7e, 0x5c, 0xfc, 0xcd, 0x36, 0x2c, 0xf3, 0xaf, 0x48, 0xc0, 0x64,
+    0xdf, 0x9a, 0x97, 0xaf, 0x44, 0xd7, 0x86, 0x00, 0xc6, 0x40, 0x6b, 0x62,
+    0x18, 0xe2, 0xf1, 0x93, 0xe6, 0xcf, 0xba, 0x02, 0x4c, 0x4f, 0x6d, 0x4f,
+    0xa1, 0x72, 0x6e, 0xaa, 0x2d, 0xd8, 0xe7, 0x79, 0x88, 0x6e, 0xf0, 0xc0,
+    0x0c, 0x0b, 0x7f, 0x04, 0x25, 0x5f, 0xcb, 0x12,
+};
 ///////////////////////////////////////////////////////////////////////
 // NewPairingState / DeletePairingState
 
@@ -141,7 +157,7 @@ TEST_F(PairingTest, NewFailsGivenInvalidG1) {
   PairingState* ps = nullptr;
   EcGroup ga;
   ga.ipp_ec = nullptr;
-  ga.scratch_buffer = nullptr;
+  ga.scratch_buffer_size = 0;
   EXPECT_EQ(kEpidBadArgErr,
             NewPairingState(&ga, this->params->G2, this->params->GT,
                             &this->t_str, true, &ps));
@@ -153,7 +169,7 @@ TEST_F(PairingTest, NewFailsGivenInvalidG2) {
   PairingState* ps = nullptr;
   EcGroup gb;
   gb.ipp_ec = nullptr;
-  gb.scratch_buffer = nullptr;
+  gb.scratch_buffer_size = 0;
   EXPECT_EQ(kEpidBadArgErr,
             NewPairingState(this->params->G1, &gb, this->params->GT,
                             &this->t_str, true, &ps));
@@ -271,4 +287,321 @@ TEST_F(PairingTest, PairingFailsGivenInvalidGbElem) {
   EXPECT_EQ(kEpidBadArgErr, Pairing(ps, ga_elem, mismatched_gb_elem, r));
   DeletePairingState(&ps);
 }
+///////////////////////////////////////////////////////////////////////
+// PairingSetG2Frobenius
+
+TEST_F(PairingTest, SetG2FrobeniusFailsGivenNullPointer) {
+  EXPECT_EQ(kEpidBadArgErr, PairingSetG2Frobenius(nullptr));
+}
+TEST_F(PairingTest, SetG2FrobeniusFailsGivenWrongSignOfT) {
+  PairingState* ps = nullptr;
+  THROW_ON_EPIDERR(NewPairingState(this->params->G1, this->params->G2,
+                                   this->params->GT, &this->t_str, false,
+                                   &ps));
+  EXPECT_EQ(kEpidBadArgErr, PairingSetG2Frobenius(ps));
+  DeletePairingState(&ps);
+}
+TEST_F(PairingTest, PairingWithG2FrobeniusMatchesPairing) {
+  EcPointObj ga_elem(&this->params->G1, this->ga_elem_str);
+  EcPointObj gb_elem(&this->params->G2, this->gb_elem_str);
+  FfElementObj expected(&this->params->GT);
+  FfElementObj r(&this->params->GT);
+  GtElemStr expected_str = {0};
+  GtElemStr r_str = {0};
+  PairingState* ps = nullptr;
+  THROW_ON_EPIDERR(NewPairingState(this->params->G1, this->params->G2,
+                                   this->params->GT, &this->t_str, true, &ps));
+  THROW_ON_EPIDERR(Pairing(ps, ga_elem, gb_elem, expected));
+  EXPECT_EQ(kEpidNoErr, PairingSetG2Frobenius(ps));
+  EXPECT_EQ(kEpidNoErr, Pairing(ps, ga_elem, gb_elem, r));
+  DeletePairingState(&ps);
+
+  THROW_ON_EPIDERR(WriteFfElement(this->params->GT, r, &r_str, sizeof(r_str)));
+  THROW_ON_EPIDERR(WriteFfElement(this->params->GT, expected, &expected_str,
+                                  sizeof(expected_str)));
+  EXPECT_EQ(expected_str, r_str);
+}
+// test that with the endomorphism set pairing checks that the second
+// parameter of the pairing is in the subgroup of G2
+TEST_F(PairingTest, PairingFailsGivenGbElemOutOfSubgroupWithG2Frobenius) {
+  FfElementObj r(&this->params->GT);
+  EcPointObj ga_elem(&this->params->G1, this->ga_elem_str);
+  // read before the endomorphism is set, only the curve is checked
+  EcPointObj gb_elem(&this->params->G2, this->gb_out_of_subgroup_str);
+  PairingState* ps = nullptr;
+  THROW_ON_EPIDERR(NewPairingState(this->params->G1, this->params->G2,
+                                   this->params->GT, &this->t_str, true, &ps));
+  THROW_ON_EPIDERR(PairingSetG2Frobenius(ps));
+  EXPECT_EQ(kEpidBadArgErr, Pairing(ps, ga_elem, gb_elem, r));
+  DeletePairingState(&ps);
+}
+///////////////////////////////////////////////////////////////////////
+// PairingTrusted
+
+TEST_F(PairingTest, PairingTrustedMatchesPairing) {
+  EcPointObj ga_elem(&this->params->G1, this->ga_elem_str);
+  EcPointObj gb_elem(&this->params->G2, this->gb_elem_str);
+  for (bool neg : {true, false}) {
+    FfElementObj expected(&this->params->GT);
+    FfElementObj r(&this->params->GT);
+    GtElemStr expected_str = {0};
+    GtElemStr r_str = {0};
+    PairingState* ps = nullptr;
+    THROW_ON_EPIDERR(NewPairingState(this->params->G1, this->params->G2,
+                                     this->params->GT, &this->t_str, neg,
+                                     &ps));
+    EXPECT_EQ(kEpidNoErr, PairingTrusted(ps, ga_elem, gb_elem, r));
+    THROW_ON_EPIDERR(Pairing(ps, ga_elem, gb_elem, expected));
+    DeletePairingState(&ps);
+
+    THROW_ON_EPIDERR(
+        WriteFfElement(this->params->GT, r, &r_str, sizeof(r_str)));
+    THROW_ON_EPIDERR(WriteFfElement(this->params->GT, expected,
+                                    &expected_str, sizeof(expected_str)));
+    EXPECT_EQ(expected_str, r_str);
+  }
+}
+
+TEST_F(PairingTest, PairingTrustedFailsGivenNullParameters) {
+  FfElementObj r(&this->params->GT);
+  EcPointObj ga_elem(&this->params->G1, this->ga_elem_str);
+  EcPointObj gb_elem(&this->params->G2, this->gb_elem_str);
+  PairingState* ps = nullptr;
+  THROW_ON_EPIDERR(NewPairingState(this->params->G1, this->params->G2,
+                                   this->params->GT, &this->t_str, true, &ps));
+  EXPECT_EQ(kEpidBadArgErr, PairingTrusted(NULL, ga_elem, gb_elem, r));
+  EXPECT_EQ(kEpidBadArgErr, PairingTrusted(ps, NULL, gb_elem, r));
+  EXPECT_EQ(kEpidBadArgErr, PairingTrusted(ps, ga_elem, NULL, r));
+  EXPECT_EQ(kEpidBadArgErr, PairingTrusted(ps, ga_elem, gb_elem, NULL));
+  DeletePairingState(&ps);
+}
+
+///////////////////////////////////////////////////////////////////////
+// NewPreparedG2 / DeletePreparedG2 / PairingProduct
+
+TEST_F(PairingTest, DeletePreparedG2WorksGivenNullPointer) {
+  EXPECT_NO_THROW(DeletePreparedG2(nullptr));
+  PreparedG2* pb = nullptr;
+  EXPECT_NO_THROW(DeletePreparedG2(&pb));
+  EXPECT_EQ(nullptr, pb);
+}
+
+TEST_F(PairingTest, NewPreparedG2FailsGivenNullParameters) {
+  EcPointObj gb_elem(&this->params->G2, this->gb_elem_str);
+  PairingState* ps = nullptr;
+  PreparedG2* pb = nullptr;
+  THROW_ON_EPIDERR(NewPairingState(this->params->G1, this->params->G2,
+                                   this->params->GT, &this->t_str, true, &ps));
+  EXPECT_EQ(kEpidBadArgErr, NewPreparedG2(nullptr, gb_elem, &pb));
+  EXPECT_EQ(kEpidBadArgErr, NewPreparedG2(ps, nullptr, &pb));
+  EXPECT_EQ(kEpidBadArgErr, NewPreparedG2(ps, gb_elem, nullptr));
+  DeletePreparedG2(&pb);
+  DeletePairingState(&ps);
+}
+
+TEST_F(PairingTest, NewPreparedG2FailsGivenInvalidGbElem) {
+  // put G1 element instead of G2
+  EcPointObj mismatched_gb_elem(&this->params->G1, this->ga_elem_str);
+  PairingState* ps = nullptr;
+  PreparedG2* pb = nullptr;
+  THROW_ON_EPIDERR(NewPairingState(this->params->G1, this->params->G2,
+                                   this->params->GT, &this->t_str, true, &ps));
+  EXPECT_EQ(kEpidBadArgErr, NewPreparedG2(ps, mismatched_gb_elem, &pb));
+  DeletePreparedG2(&pb);
+  DeletePairingState(&ps);
+}
+
+// test that the product of one pairing matches Pairing for both
+// processing paths
+TEST_F(PairingTest, PairingProductMatchesPairingGivenOnePair) {
+  EcPointObj ga_elem(&this->params->G1, this->ga_elem_str);
+  EcPointObj gb_elem(&this->params->G2, this->gb_elem_str);
+  for (bool neg : {true, false}) {
+    FfElementObj expected(&this->params->GT);
+    FfElementObj r(&this->params->GT);
+    GtElemStr expected_str = {0};
+    GtElemStr r_str = {0};
+    PairingState* ps = nullptr;
+    PreparedG2* pb = nullptr;
+    THROW_ON_EPIDERR(NewPairingState(this->params->G1, this->params->G2,
+                                     this->params->GT, &this->t_str, neg,
+                                     &ps));
+    THROW_ON_EPIDERR(NewPreparedG2(ps, gb_elem, &pb));
+    EcPoint const* a[] = {ga_elem};
+    PreparedG2 const* b[] = {pb};
+    EXPECT_EQ(kEpidNoErr, PairingProduct(ps, a, b, 1, r));
+    THROW_ON_EPIDERR(Pairing(ps, ga_elem, gb_elem, expected));
+    DeletePreparedG2(&pb);
+    DeletePairingState(&ps);
+
+    THROW_ON_EPIDERR(
+        WriteFfElement(this->params->GT, r, &r_str, sizeof(r_str)));
+    THROW_ON_EPIDERR(WriteFfElement(this->params->GT, expected,
+                                    &expected_str, sizeof(expected_str)));
+    EXPECT_EQ(expected_str, r_str);
+  }
+}
+
+TEST_F(PairingTest, PairingProductWorksGivenTwoPairs) {
+  EcPointObj ga_elem(&this->params->G1, this->ga_elem_str);
+  EcPointObj gb_elem(&this->params->G2, this->gb_elem_str);
+  EcPointObj gb2_elem(&this->params->G2);
+  FfElementObj e1(&this->params->GT);
+  FfElementObj e2(&this->params->GT);
+  FfElementObj r(&this->params->GT);
+  GtElemStr expected_str = {0};
+  GtElemStr r_str = {0};
+  PairingState* ps = nullptr;
+  PreparedG2* pb[2] = {nullptr, nullptr};
+  THROW_ON_EPIDERR(EcMul(this->params->G2, gb_elem, gb_elem, gb2_elem));
+  THROW_ON_EPIDERR(NewPairingState(this->params->G1, this->params->G2,
+                                   this->params->GT, &this->t_str, true, &ps));
+  THROW_ON_EPIDERR(NewPreparedG2(ps, gb_elem, &pb[0]));
+  THROW_ON_EPIDERR(NewPreparedG2(ps, gb2_elem, &pb[1]));
+  EcPoint const* a[] = {ga_elem, ga_elem};
+  PreparedG2 const* b[] = {pb[0], pb[1]};
+  EXPECT_EQ(kEpidNoErr, PairingProduct(ps, a, b, 2, r));
+  THROW_ON_EPIDERR(Pairing(ps, ga_elem, gb_elem, e1));
+  THROW_ON_EPIDERR(Pairing(ps, ga_elem, gb2_elem, e2));
+  DeletePreparedG2(&pb[0]);
+  DeletePreparedG2(&pb[1]);
+  DeletePairingState(&ps);
+
+  THROW_ON_EPIDERR(FfMul(this->params->GT, e1, e2, e1));
+  THROW_ON_EPIDERR(WriteFfElement(this->params->GT, r, &r_str, sizeof(r_str)));
+  THROW_ON_EPIDERR(WriteFfElement(this->params->GT, e1, &expected_str,
+                                  sizeof(expected_str)));
+  EXPECT_EQ(expected_str, r_str);
+}
+
+// test that pairs with the identity of G1 do not contribute to the product
+TEST_F(PairingTest, PairingProductSkipsIdentityInGa) {
+  EcPointObj ga_elem(&this->params->G1, this->ga_elem_str);
+  EcPointObj identity(&this->params->G1);
+  EcPointObj gb_elem(&this->params->G2, this->gb_elem_str);
+  FfElementObj expected(&this->params->GT);
+  FfElementObj r(&this->params->GT);
+  GtElemStr expected_str = {0};
+  GtElemStr r_str = {0};
+  PairingState* ps = nullptr;
+  PreparedG2* pb = nullptr;
+  THROW_ON_EPIDERR(NewPairingState(this->params->G1, this->params->G2,
+                                   this->params->GT, &this->t_str, true, &ps));
+  THROW_ON_EPIDERR(NewPreparedG2(ps, gb_elem, &pb));
+  EcPoint const* a[] = {identity, ga_elem};
+  PreparedG2 const* b[] = {pb, pb};
+  EXPECT_EQ(kEpidNoErr, PairingProduct(ps, a, b, 2, r));
+  THROW_ON_EPIDERR(Pairing(ps, ga_elem, gb_elem, expected));
+  DeletePreparedG2(&pb);
+  DeletePairingState(&ps);
+
+  THROW_ON_EPIDERR(WriteFfElement(this->params->GT, r, &r_str, sizeof(r_str)));
+  THROW_ON_EPIDERR(WriteFfElement(this->params->GT, expected, &expected_str,
+                                  sizeof(expected_str)));
+  EXPECT_EQ(expected_str, r_str);
+}
+
+TEST_F(PairingTest, PairingProductTrustedMatchesPairingProduct) {
+  EcPointObj ga_elem(&this->params->G1, this->ga_elem_str);
+  EcPointObj gb_elem(&this->params->G2, this->gb_elem_str);
+  FfElementObj expected(&this->params->GT);
+  FfElementObj r(&this->params->GT);
+  GtElemStr expected_str = {0};
+  GtElemStr r_str = {0};
+  PairingState* ps = nullptr;
+  PreparedG2* pb = nullptr;
+  THROW_ON_EPIDERR(NewPairingState(this->params->G1, this->params->G2,
+                                   this->params->GT, &this->t_str, true, &ps));
+  THROW_ON_EPIDERR(NewPreparedG2(ps, gb_elem, &pb));
+  EcPoint const* a[] = {ga_elem, ga_elem};
+  PreparedG2 const* b[] = {pb, pb};
+  EXPECT_EQ(kEpidNoErr, PairingProductTrusted(ps, a, b, 2, r));
+  THROW_ON_EPIDERR(PairingProduct(ps, a, b, 2, expected));
+  DeletePreparedG2(&pb);
+  DeletePairingState(&ps);
+
+  THROW_ON_EPIDERR(WriteFfElement(this->params->GT, r, &r_str, sizeof(r_str)));
+  THROW_ON_EPIDERR(WriteFfElement(this->params->GT, expected, &expected_str,
+                                  sizeof(expected_str)));
+  EXPECT_EQ(expected_str, r_str);
+}
+
+TEST_F(PairingTest, PairingProductFailsGivenNullParameters) {
+  FfElementObj r(&this->params->GT);
+  EcPointObj ga_elem(&this->params->G1, this->ga_elem_str);
+  EcPointObj gb_elem(&this->params->G2, this->gb_elem_str);
+  PairingState* ps = nullptr;
+  PreparedG2* pb = nullptr;
+  THROW_ON_EPIDERR(NewPairingState(this->params->G1, this->params->G2,
+                                   this->params->GT, &this->t_str, true, &ps));
+  THROW_ON_EPIDERR(NewPreparedG2(ps, gb_elem, &pb));
+  EcPoint const* a[] = {ga_elem};
+  PreparedG2 const* b[] = {pb};
+  EcPoint const* null_a[] = {nullptr};
+  PreparedG2 const* null_b[] = {nullptr};
+  EXPECT_EQ(kEpidBadArgErr, PairingProduct(nullptr, a, b, 1, r));
+  EXPECT_EQ(kEpidBadArgErr, PairingProduct(ps, nullptr, b, 1, r));
+  EXPECT_EQ(kEpidBadArgErr, PairingProduct(ps, a, nullptr, 1, r));
+  EXPECT_EQ(kEpidBadArgErr, PairingProduct(ps, a, b, 1, nullptr));
+  EXPECT_EQ(kEpidBadArgErr, PairingProduct(ps, null_a, b, 1, r));
+  EXPECT_EQ(kEpidBadArgErr, PairingProduct(ps, a, null_b, 1, r));
+  EXPECT_EQ(kEpidBadArgErr, PairingProduct(ps, a, b, 0, r));
+  DeletePreparedG2(&pb);
+  DeletePairingState(&ps);
+}
+
+TEST_F(PairingTest, PairingProductFailsGivenInvalidGaElem) {
+  FfElementObj r(&this->params->GT);
+  // put G2 element instead of G1
+  EcPointObj mismatched_ga_elem(&this->params->G2, this->gb_elem_str);
+  EcPointObj gb_elem(&this->params->G2, this->gb_elem_str);
+  PairingState* ps = nullptr;
+  PreparedG2* pb = nullptr;
+  THROW_ON_EPIDERR(NewPairingState(this->params->G1, this->params->G2,
+                                   this->params->GT, &this->t_str, true, &ps));
+  THROW_ON_EPIDERR(NewPreparedG2(ps, gb_elem, &pb));
+  EcPoint const* a[] = {mismatched_ga_elem};
+  PreparedG2 const* b[] = {pb};
+  EXPECT_EQ(kEpidBadArgErr, PairingProduct(ps, a, b, 1, r));
+  DeletePreparedG2(&pb);
+  DeletePairingState(&ps);
+}
+
+///////////////////////////////////////////////////////////////////////
+// Temporaries
+
+// pairing and GT exponentiation are the deepest users of the per thread
+// stack of math temporaries, test that they leave it balanced
+TEST_F(PairingTest, PairingAndGtExpCanBeRepeated) {
+  const BigNumStr k_str = {
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x23, 0x45, 0x67};
+  EcPointObj ga_elem(&this->params->G1, this->ga_elem_str);
+  EcPointObj ga_k_elem(&this->params->G1);
+  EcPointObj gb_elem(&this->params->G2, this->gb_elem_str);
+  BigNumObj k(k_str);
+  FfElementObj e(&this->params->GT);
+  FfElementObj e_k(&this->params->GT);
+  FfElementObj r(&this->params->GT);
+  GtElemStr expected_str = {0};
+  GtElemStr r_str = {0};
+  PairingState* ps = nullptr;
+  THROW_ON_EPIDERR(NewPairingState(this->params->G1, this->params->G2,
+                                   this->params->GT, &this->t_str, true, &ps));
+  THROW_ON_EPIDERR(EcExp(this->params->G1, ga_elem, &k_str, ga_k_elem));
+  // enough rounds to run out of temporaries if any were not released
+  for (int i = 0; i < 16; i++) {
+    // e(a, b)^k = e(a^k, b)
+    EXPECT_EQ(kEpidNoErr, Pairing(ps, ga_elem, gb_elem, e));
+    EXPECT_EQ(kEpidNoErr, FfExp(this->params->GT, e, k, e_k));
+    EXPECT_EQ(kEpidNoErr, Pairing(ps, ga_k_elem, gb_elem, r));
+    THROW_ON_EPIDERR(WriteFfElement(this->params->GT, e_k, &expected_str,
+                                    sizeof(expected_str)));
+    THROW_ON_EPIDERR(
+        WriteFfElement(this->params->GT, r, &r_str, sizeof(r_str)));
+    EXPECT_EQ(expected_str, r_str) << "round " << i;
+  }
+  DeletePairingState(&ps);
+}
 }  // namespace
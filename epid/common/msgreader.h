@@ -0,0 +1,51 @@
+/*############################################################################
+  # Copyright 2016-2017 Intel Corporation
+  #
+  # Licensed under the Apache License, Version 2.0 (the "License");
+  # you may not use this file except in compliance with the License.
+  # You may obtain a copy of the License at
+  #
+  #     http://www.apache.org/licenses/LICENSE-2.0
+  #
+  # Unless required by applicable law or agreed to in writing, software
+  # distributed under the License is distributed on an "AS IS" BASIS,
+  # WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  # See the License for the specific language governing permissions and
+  # limitations under the License.
+  ############################################################################*/
+#ifndef EPID_COMMON_MSGREADER_H_
+#define EPID_COMMON_MSGREADER_H_
+/*!
+ * \file
+ * \brief Message reader interface.
+ */
+
+#include <stddef.h>
+#include "epid/common/bitsupplier.h"
+
+/// Reads part of a message.
+/*!
+  Streaming sign and verify functions use a ::MsgReader to get a
+  message that is not held in memory as a single buffer, for example a
+  large file. The message is read from the start to the end once for
+  each hash that includes it, in parts no larger than a few kilobytes.
+
+  When a task runner is used, the message may be read from several
+  threads at the same time, so a reader must not depend on the order
+  of calls.
+
+ \param[out] buf destination buffer for len bytes of the message.
+ \param[in] len number of bytes to read.
+ \param[in] offset position of the first byte to read, counting from
+ the start of the message.
+ \param[in] user_data user data that will be passed to the reader.
+ For example, this could be used to pass a file handle.
+
+ \returns zero on success and non-zero value on error.
+
+ \ingroup EpidCommon
+ */
+typedef int(__STDCALL* MsgReader)(void* buf, size_t len, size_t offset,
+                                  void* user_data);
+
+#endif  // EPID_COMMON_MSGREADER_H_
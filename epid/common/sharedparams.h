@@ -0,0 +1,70 @@
+/*############################################################################
+  # Copyright 2016-2017 Intel Corporation
+  #
+  # Licensed under the Apache License, Version 2.0 (the "License");
+  # you may not use this file except in compliance with the License.
+  # You may obtain a copy of the License at
+  #
+  #     http://www.apache.org/licenses/LICENSE-2.0
+  #
+  # Unless required by applicable law or agreed to in writing, software
+  # distributed under the License is distributed on an "AS IS" BASIS,
+  # WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  # See the License for the specific language governing permissions and
+  # limitations under the License.
+  ############################################################################*/
+#ifndef EPID_COMMON_SHAREDPARAMS_H_
+#define EPID_COMMON_SHAREDPARAMS_H_
+/*!
+ * \file
+ * \brief Shared Intel(R) EPID 2.0 parameters interface.
+ */
+
+#include "epid/common/errors.h"
+
+/// Intel(R) EPID 2.0 parameters that several contexts can share.
+/*!
+  Holds the fields, curves and pairing state built from the
+  Intel(R) EPID 2.0 parameters. Member and verifier contexts created
+  with these parameters use them instead of building their own copy,
+  so each context only holds data specific to its group.
+
+  The parameters are read-only once created. Each context created with
+  them holds a reference, and they are freed when the last reference is
+  released.
+
+  \note The reference count is not atomic. Contexts that share
+  parameters may be used from several threads, but must be created and
+  deleted from one thread at a time.
+
+  \ingroup EpidCommon
+ */
+typedef struct Epid2Params_ EpidSharedParams;
+
+/// Creates shared Intel(R) EPID 2.0 parameters.
+/*!
+ \param[out] params
+ Newly constructed parameters.
+
+ \returns ::EpidStatus
+
+ \see EpidSharedParamsDelete
+ \ingroup EpidCommon
+ */
+EpidStatus EpidSharedParamsCreate(EpidSharedParams** params);
+
+/// Releases shared Intel(R) EPID 2.0 parameters.
+/*!
+ Releases the reference taken by ::EpidSharedParamsCreate and sets the
+ pointer to NULL. Contexts created with the parameters keep them alive
+ until they are deleted.
+
+ \param[in,out] params
+ The parameters. Can be NULL.
+
+ \see EpidSharedParamsCreate
+ \ingroup EpidCommon
+ */
+void EpidSharedParamsDelete(EpidSharedParams** params);
+
+#endif  // EPID_COMMON_SHAREDPARAMS_H_
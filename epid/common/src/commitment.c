@@ -20,9 +20,8 @@
  */
 #include "epid/common/src/commitment.h"
 
-#include <limits.h>
 #include "epid/common/math/ecgroup.h"
-#include "epid/common/src/memory.h"
+#include "epid/common/math/finitefield.h"
 
 EpidStatus SetKeySpecificCommitValues(GroupPubKey const* pub_key,
                                       CommitValues* values) {
@@ -64,60 +63,85 @@ EpidStatus SetCalculatedCommitValues(G1ElemStr const* B, G1ElemStr const* K,
   return kEpidNoErr;
 }
 
+/// Hash the first prefix_len bytes of values into a new hash state
+static EpidStatus NewCommitValuesHash(CommitValues const* values,
+                                      size_t prefix_len, HashAlg hash_alg,
+                                      FfHashState** prefix) {
+  EpidStatus sts;
+  FfHashState* hash_state = NULL;
+
+  if (!values || !prefix) return kEpidBadArgErr;
+
+  sts = NewFfHashState(hash_alg, &hash_state);
+  if (kEpidNoErr != sts) return sts;
+  sts = FfHashUpdate(hash_state, values, prefix_len);
+  if (kEpidNoErr != sts) {
+    DeleteFfHashState(&hash_state);
+    return sts;
+  }
+  *prefix = hash_state;
+  return kEpidNoErr;
+}
+
+EpidStatus NewCommitHashPrefix(CommitValues const* values, HashAlg hash_alg,
+                               FfHashState** prefix) {
+  return NewCommitValuesHash(values, offsetof(CommitValues, B), hash_alg,
+                             prefix);
+}
+
+EpidStatus NewNrCommitHashPrefix(CommitValues const* values, HashAlg hash_alg,
+                                 FfHashState** prefix) {
+  return NewCommitValuesHash(values, offsetof(CommitValues, g2), hash_alg,
+                             prefix);
+}
+
 EpidStatus CalculateCommitmentHash(CommitValues const* values, FiniteField* Fp,
-                                   HashAlg hash_alg, void const* msg,
-                                   size_t msg_len, FfElement* c) {
+                                   HashAlg hash_alg, FfHashState const* prefix,
+                                   MsgSource* msg, FfElement* c) {
   EpidStatus sts;
 
   FfElement* t3 = NULL;
-  size_t t3mconcat_size = sizeof(FpElemStr) + msg_len;
-  uint8_t* t3mconcat_buf = NULL;
+  FfHashState* hash_state = NULL;
+  FpElemStr t3_str;
 
-  if (!values || !Fp || !c) return kEpidBadArgErr;
-  if (!msg && (0 != msg_len)) {
-    // if message is non-empty it must have both length and content
-    return kEpidBadArgErr;
-  }
-  if (SIZE_MAX - sizeof(FpElemStr) < msg_len) {
-    return kEpidBadArgErr;
-  }
+  if (!values || !Fp || !msg || !c) return kEpidBadArgErr;
 
   do {
     sts = NewFfElement(Fp, &t3);
     if (kEpidNoErr != sts) break;
+    sts = NewFfHashState(hash_alg, &hash_state);
+    if (kEpidNoErr != sts) break;
 
     // compute t3 = Fp.hash(p || g1 || g2 || h1 ||
     //  h2 || w || B || K || T || R1 || R2).
-    sts = FfHash(Fp, values, sizeof(*values), hash_alg, t3);
-    if (kEpidNoErr != sts) break;
-
-    //   compute c = Fp.hash(t3 || m).
-    t3mconcat_buf = SAFE_ALLOC(t3mconcat_size);
-    if (!t3mconcat_buf) {
-      sts = kEpidMemAllocErr;
-      break;
+    if (prefix) {
+      // resume after the key specific values
+      sts = FfHashStateCopy(prefix, hash_state);
+      if (kEpidNoErr != sts) break;
+      sts = FfHashUpdate(hash_state, &values->B,
+                         sizeof(*values) - offsetof(CommitValues, B));
+    } else {
+      sts = FfHashUpdate(hash_state, values, sizeof(*values));
     }
+    if (kEpidNoErr != sts) break;
+    sts = FfHashFinal(Fp, hash_state, t3);
+    if (kEpidNoErr != sts) break;
 
-    // get t3 into buffer
-    sts = WriteFfElement(Fp, t3, t3mconcat_buf, sizeof(FpElemStr));
+    //   compute c = Fp.hash(t3 || m), hashing m where it is stored.
+    sts = WriteFfElement(Fp, t3, &t3_str, sizeof(t3_str));
     if (kEpidNoErr != sts) break;
-    // get m into buffer
-    if (msg) {
-      // Memory copy is used to copy a message of variable length
-      if (0 != memcpy_S(t3mconcat_buf + sizeof(FpElemStr),
-                        t3mconcat_size - sizeof(FpElemStr), msg, msg_len)) {
-        sts = kEpidBadArgErr;
-        break;
-      }
-    }
 
-    sts = FfHash(Fp, t3mconcat_buf, t3mconcat_size, hash_alg, c);
+    sts = FfHashUpdate(hash_state, &t3_str, sizeof(t3_str));
+    if (kEpidNoErr != sts) break;
+    sts = FfHashUpdateMsg(hash_state, msg);
+    if (kEpidNoErr != sts) break;
+    sts = FfHashFinal(Fp, hash_state, c);
     if (kEpidNoErr != sts) break;
 
     sts = kEpidNoErr;
   } while (0);
 
-  SAFE_FREE(t3mconcat_buf);
+  DeleteFfHashState(&hash_state);
   DeleteFfElement(&t3);
 
   return sts;
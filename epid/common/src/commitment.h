@@ -25,11 +25,13 @@
 
 #include "epid/common/errors.h"
 #include "epid/common/types.h"
+#include "epid/common/src/msgsource.h"
 
 typedef struct FiniteField FiniteField;
 typedef struct EcPoint EcPoint;
 typedef struct EcGroup EcGroup;
 typedef struct FfElement FfElement;
+typedef struct FfHashState FfHashState;
 
 #pragma pack(1)
 /// Storage for values to create commitment in Sign and Verify algorithms
@@ -94,6 +96,50 @@ EpidStatus SetCalculatedCommitValues(G1ElemStr const* B, G1ElemStr const* K,
                                      EcGroup* G1, FfElement const* R2,
                                      FiniteField* GT, CommitValues* values);
 
+/// Hash group public key related fields of CommitValues structure
+/*!
+  Start a hash of p || g1 || g2 || h1 || h2 || w, the part of t3 that
+  is the same for every signature created or verified with a group
+  public key, so that CalculateCommitmentHash can resume from it.
+
+  Use DeleteFfHashState() to free memory.
+
+  \param[in] values
+  Commit values with the key specific fields set
+  \param[in] hash_alg
+  Hash algorithm to use
+  \param[out] prefix
+  Newly constructed hash state
+
+  \returns ::EpidStatus
+
+  \see SetKeySpecificCommitValues
+  \see CalculateCommitmentHash
+*/
+EpidStatus NewCommitHashPrefix(CommitValues const* values, HashAlg hash_alg,
+                               FfHashState** prefix);
+
+/// Hash the Intel(R) EPID 2.0 parameters that start a NrProve commitment
+/*!
+  Start a hash of p || g1, the constant start of the commitment hashed
+  by the NrProve and NrVerify algorithms.
+
+  Use DeleteFfHashState() to free memory.
+
+  \param[in] values
+  Commit values with the key specific fields set
+  \param[in] hash_alg
+  Hash algorithm to use
+  \param[out] prefix
+  Newly constructed hash state
+
+  \returns ::EpidStatus
+
+  \see SetKeySpecificCommitValues
+*/
+EpidStatus NewNrCommitHashPrefix(CommitValues const* values, HashAlg hash_alg,
+                                 FfHashState** prefix);
+
 /// Calculate Fp.hash(t3 || m) for Sign and Verfiy algorithms
 /*!
   Calculate c = Fp.hash(t3 || m) where t3 is
@@ -105,10 +151,11 @@ EpidStatus SetCalculatedCommitValues(G1ElemStr const* B, G1ElemStr const* K,
   Finite field to perfom hash operation in
   \param[in] hash_alg
   Hash algorithm to use
+  \param[in] prefix
+  Hash of the key specific commit values created with hash_alg by
+  NewCommitHashPrefix. If NULL they are hashed from values.
   \param[in] msg
   Message to hash
-  \param[in] msg_len
-  Size of msg buffer in bytes
   \param[out] c
   Result of calculation
 
@@ -116,10 +163,11 @@ EpidStatus SetCalculatedCommitValues(G1ElemStr const* B, G1ElemStr const* K,
 
   \see SetKeySpecificCommitValues
   \see SetCalculatedCommitValues
+  \see NewCommitHashPrefix
 */
 EpidStatus CalculateCommitmentHash(CommitValues const* values, FiniteField* Fp,
-                                   HashAlg hash_alg, void const* msg,
-                                   size_t msg_len, FfElement* c);
+                                   HashAlg hash_alg, FfHashState const* prefix,
+                                   MsgSource* msg, FfElement* c);
 
 /*! @} */
 #endif  // EPID_COMMON_SRC_COMMITMENT_H_
@@ -19,6 +19,7 @@
  * \brief Intel(R) EPID 2.0 constant parameters implementation.
  */
 #include "epid/common/src/epid2params.h"
+#include "epid/common/sharedparams.h"
 #include "epid/common/src/memory.h"
 
 /// create a new Finite Field Fp
@@ -176,6 +177,11 @@ EpidStatus CreateEpid2Params(Epid2Params_** params) {
     if (kEpidNoErr != result) {
       break;
     }
+    result = PairingSetG2Frobenius(internal_param->pairing_state);
+    if (kEpidNoErr != result) {
+      break;
+    }
+    internal_param->ref_count = 1;
     *params = internal_param;
     result = kEpidNoErr;
   } while (0);
@@ -204,7 +210,19 @@ EpidStatus CreateEpid2Params(Epid2Params_** params) {
   return result;
 }
 
+Epid2Params_* ShareEpid2Params(Epid2Params_* params) {
+  if (params) {
+    params->ref_count++;
+  }
+  return params;
+}
+
 void DeleteEpid2Params(Epid2Params_** epid_params) {
+  if (epid_params && *epid_params && (*epid_params)->ref_count > 1) {
+    (*epid_params)->ref_count--;
+    *epid_params = NULL;
+    return;
+  }
   if (epid_params && *epid_params) {
     DeletePairingState(&(*epid_params)->pairing_state);
 
@@ -229,6 +247,14 @@ void DeleteEpid2Params(Epid2Params_** epid_params) {
   }
 }
 
+EpidStatus EpidSharedParamsCreate(EpidSharedParams** params) {
+  return CreateEpid2Params(params);
+}
+
+void EpidSharedParamsDelete(EpidSharedParams** params) {
+  DeleteEpid2Params(params);
+}
+
 static EpidStatus NewFp(Epid2Params const* param, FiniteField** Fp) {
   EpidStatus result = kEpidErr;
   if (!param || !Fp) {
@@ -329,11 +355,22 @@ EpidStatus NewG1(Epid2Params const* param, FiniteField* Fq, EcGroup** G1) {
   FfElement* g1_y = NULL;
   BigNum* order = NULL;
   BigNum* cofactor = NULL;
+  FfElement* beta = NULL;
   // h = 1;
   const BigNumStr h1 = {
       {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
         0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01}}};
+  // beta = -(18t^3 + 18t^2 + 9t + 2) mod q, a cube root of unity in Fq
+  const FqElemStr glv_beta = {
+      {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x39, 0x88, 0xE1,
+        0x40, 0x92, 0x10, 0x18, 0x65, 0x9B, 0xCD, 0xD7, 0x9D, 0xF1, 0x93,
+        0x2D, 0x1E, 0xDB, 0x1C, 0x0A, 0x24, 0xA3, 0xA1, 0xB8, 0x07}}};
+  // lambda = -(36t^3 + 18t^2 + 6t + 2) mod p, (beta*x, y) = (x, y)^lambda
+  const BigNumStr glv_lambda = {
+      {{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x73, 0x11, 0xC2,
+        0x81, 0x24, 0x20, 0x30, 0xCE, 0x37, 0x9B, 0xAF, 0x3B, 0xE3, 0x21,
+        0xC3, 0x70, 0x67, 0x08, 0x1E, 0x93, 0x98, 0x53, 0x30, 0x16}}};
 
   if (!param || !Fq || !G1) {
     return kEpidBadArgErr;
@@ -398,10 +435,26 @@ EpidStatus NewG1(Epid2Params const* param, FiniteField* Fq, EcGroup** G1) {
     if (kEpidNoErr != result) {
       break;
     }
+    // split powers in G1 with the endomorphism of the curve
+    result = NewFfElement(Fq, &beta);
+    if (kEpidNoErr != result) {
+      break;
+    }
+    result = ReadFfElement(Fq, &glv_beta, sizeof(glv_beta), beta);
+    if (kEpidNoErr != result) {
+      break;
+    }
+    result = EcSetEndomorphism(ec, beta, &glv_lambda);
+    if (kEpidNoErr != result) {
+      break;
+    }
     *G1 = ec;
+    ec = NULL;
     result = kEpidNoErr;
   } while (0);
 
+  DeleteEcGroup(&ec);
+  DeleteFfElement(&beta);
   DeleteBigNum(&cofactor);
   DeleteBigNum(&order);
   DeleteFfElement(&g1_y);
@@ -48,6 +48,8 @@ typedef struct Epid2Params_ {
   EcGroup* G2;  ///< Elliptic curve group over finite field Fq2
 
   PairingState* pairing_state;  ///< Pairing state
+
+  size_t ref_count;  ///< Number of owners, see ShareEpid2Params
 } Epid2Params_;
 
 /// Constructs the internal representation of Epid2Params
@@ -62,9 +64,23 @@ typedef struct Epid2Params_ {
   \see DeleteEpid2Params
 */
 EpidStatus CreateEpid2Params(Epid2Params_** params);
+/// Adds an owner to the internal representation of Epid2Params
+/*!
+  The params are only freed once DeleteEpid2Params has been called by
+  each owner.
+
+  \param[in] params
+  Internal Epid2Params
+
+  \returns params
+
+  \see DeleteEpid2Params
+*/
+Epid2Params_* ShareEpid2Params(Epid2Params_* params);
 /// Deallocates storage for internal representation of Epid2Params
 /*!
-  Frees the memory and nulls the pointer.
+  Releases one owner and nulls the pointer. Frees the memory when no
+  owners are left.
 
   \param[in,out] epid_params
   params to be deallocated
@@ -0,0 +1,154 @@
+/*############################################################################
+  # Copyright 2016-2017 Intel Corporation
+  #
+  # Licensed under the Apache License, Version 2.0 (the "License");
+  # you may not use this file except in compliance with the License.
+  # You may obtain a copy of the License at
+  #
+  #     http://www.apache.org/licenses/LICENSE-2.0
+  #
+  # Unless required by applicable law or agreed to in writing, software
+  # distributed under the License is distributed on an "AS IS" BASIS,
+  # WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  # See the License for the specific language governing permissions and
+  # limitations under the License.
+  ############################################################################*/
+/*!
+ * \file
+ * \brief Hash set container implementation.
+ */
+#include "epid/common/src/hashset.h"
+#include <stdint.h>
+#include <string.h>
+#include "epid/common/src/memory.h"
+
+/// Smallest number of slots in a hash set
+#define HASH_SET_MIN_SLOTS ((size_t)16)
+
+/// Internal representation of a HashSet
+/*!
+ Open addressing with linear probing. The number of slots is a power of
+ two and at most half of them are used.
+ */
+struct HashSet {
+  size_t key_size;   ///< Size of key in bytes
+  uint8_t* keys;     ///< Buffer of num_slots keys
+  uint8_t* used;     ///< Flags marking the slots that hold a key
+  size_t num_slots;  ///< Number of slots
+  size_t size;       ///< Number of keys in the set
+};
+
+/// Hashes a key using 64-bit FNV-1a
+static size_t HashKey(void const* key, size_t key_size) {
+  uint8_t const* bytes = (uint8_t const*)key;
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  size_t i;
+  for (i = 0; i < key_size; i++) {
+    hash ^= bytes[i];
+    hash *= 0x100000001b3ULL;
+  }
+  return (size_t)(hash ^ (hash >> 32));
+}
+
+/// Finds the slot holding key or the empty slot where it belongs
+static size_t FindSlot(uint8_t const* keys, uint8_t const* used,
+                       size_t num_slots, size_t key_size, void const* key) {
+  size_t mask = num_slots - 1;
+  size_t slot = HashKey(key, key_size) & mask;
+  while (used[slot] && 0 != memcmp(keys + slot * key_size, key, key_size)) {
+    slot = (slot + 1) & mask;
+  }
+  return slot;
+}
+
+/// Reallocates slots so that the set can hold at least capacity keys
+static bool Reserve(HashSet* set, size_t capacity) {
+  size_t num_slots = HASH_SET_MIN_SLOTS;
+  uint8_t* keys = NULL;
+  uint8_t* used = NULL;
+  size_t i;
+  while (num_slots / 2 < capacity) {
+    if (num_slots > (SIZE_MAX / 2) / set->key_size) return false;
+    num_slots *= 2;
+  }
+  if (num_slots <= set->num_slots) return true;
+  keys = SAFE_ALLOC(num_slots * set->key_size);
+  used = SAFE_ALLOC(num_slots);
+  if (!keys || !used) {
+    SAFE_FREE(keys);
+    SAFE_FREE(used);
+    return false;
+  }
+  for (i = 0; i < set->num_slots; i++) {
+    if (set->used[i]) {
+      uint8_t const* key = set->keys + i * set->key_size;
+      size_t slot = FindSlot(keys, used, num_slots, set->key_size, key);
+      // Memory copy is used to copy a key of variable size
+      if (0 != memcpy_S(keys + slot * set->key_size, set->key_size, key,
+                        set->key_size)) {
+        SAFE_FREE(keys);
+        SAFE_FREE(used);
+        return false;
+      }
+      used[slot] = 1;
+    }
+  }
+  SAFE_FREE(set->keys);
+  SAFE_FREE(set->used);
+  set->keys = keys;
+  set->used = used;
+  set->num_slots = num_slots;
+  return true;
+}
+
+bool CreateHashSet(size_t key_size, size_t capacity, HashSet** set) {
+  HashSet* new_set = NULL;
+  if (!set || 0 == key_size) return false;
+  new_set = SAFE_ALLOC(sizeof(HashSet));
+  if (!new_set) return false;
+  new_set->key_size = key_size;
+  if (!Reserve(new_set, capacity)) {
+    DeleteHashSet(&new_set);
+    return false;
+  }
+  *set = new_set;
+  return true;
+}
+
+bool HashSetInsert(HashSet* set, void const* key) {
+  size_t slot = 0;
+  if (!set || !key) return false;
+  slot = FindSlot(set->keys, set->used, set->num_slots, set->key_size, key);
+  if (set->used[slot]) return true;
+  if (set->size + 1 > set->num_slots / 2) {
+    if (!Reserve(set, set->size + 1)) return false;
+    slot = FindSlot(set->keys, set->used, set->num_slots, set->key_size, key);
+  }
+  // Memory copy is used to copy a key of variable size
+  if (0 != memcpy_S(set->keys + slot * set->key_size, set->key_size, key,
+                    set->key_size)) {
+    return false;
+  }
+  set->used[slot] = 1;
+  set->size++;
+  return true;
+}
+
+bool HashSetContains(HashSet const* set, void const* key) {
+  size_t slot = 0;
+  if (!set || !key) return false;
+  slot = FindSlot(set->keys, set->used, set->num_slots, set->key_size, key);
+  return set->used[slot] ? true : false;
+}
+
+size_t HashSetGetSize(HashSet const* set) {
+  return set ? set->size : (size_t)0;
+}
+
+void DeleteHashSet(HashSet** set) {
+  if (set && *set) {
+    SAFE_FREE((*set)->keys);
+    SAFE_FREE((*set)->used);
+    SAFE_FREE(*set);
+  }
+}
@@ -0,0 +1,98 @@
+/*############################################################################
+  # Copyright 2016-2017 Intel Corporation
+  #
+  # Licensed under the Apache License, Version 2.0 (the "License");
+  # you may not use this file except in compliance with the License.
+  # You may obtain a copy of the License at
+  #
+  #     http://www.apache.org/licenses/LICENSE-2.0
+  #
+  # Unless required by applicable law or agreed to in writing, software
+  # distributed under the License is distributed on an "AS IS" BASIS,
+  # WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  # See the License for the specific language governing permissions and
+  # limitations under the License.
+  ############################################################################*/
+#ifndef EPID_COMMON_SRC_HASHSET_H_
+#define EPID_COMMON_SRC_HASHSET_H_
+/*!
+ * \file
+ * \brief Hash set container interface.
+ * \addtogroup EpidCommon
+ * @{
+ */
+#include <stddef.h>
+#include "epid/common/stdtypes.h"
+
+/// A set of fixed size keys
+/*!
+ Keys are compared as byte strings, so they must have a single encoding,
+ e.g. serialized group elements or identifiers.
+ */
+typedef struct HashSet HashSet;
+
+/// Create hash set
+/*!
+  \param[in] key_size
+  Size of a key in bytes
+  \param[in] capacity
+  Number of keys to reserve space for. The set grows as needed.
+  \param[out] set
+  Hash set context to be created
+
+  \returns true if operation succeed, false if set were failed to allocate
+
+  \see DeleteHashSet
+*/
+bool CreateHashSet(size_t key_size, size_t capacity, HashSet** set);
+
+/// Insert a key into the hash set
+/*!
+  Inserting a key that is already in the set has no effect.
+
+  \param[in,out] set
+  Hash set context
+  \param[in] key
+  Key to insert, key_size bytes
+
+  \returns true if operation succeed, false otherwise
+
+  \see CreateHashSet
+*/
+bool HashSetInsert(HashSet* set, void const* key);
+
+/// Check if a key is in the hash set
+/*!
+  \param[in] set
+  Hash set context
+  \param[in] key
+  Key to look up, key_size bytes
+
+  \returns true if key is in the set, false if it is not or set is NULL
+
+  \see CreateHashSet
+*/
+bool HashSetContains(HashSet const* set, void const* key);
+
+/// Get number of keys in the hash set
+/*!
+  \param[in] set
+  Hash set context
+
+  \returns Number of keys in the set or 0 if set is NULL
+
+  \see CreateHashSet
+*/
+size_t HashSetGetSize(HashSet const* set);
+
+/// Deallocates memory used for the hash set.
+/*!
+  \param[in,out] set
+  Hash set context
+
+  \see CreateHashSet
+*/
+void DeleteHashSet(HashSet** set);
+
+/*! @} */
+#endif  // EPID_COMMON_SRC_HASHSET_H_
@@ -21,6 +21,7 @@
 
 #include "epid/common/src/memory.h"
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -54,6 +55,44 @@ int memcpy_S(void* dest, size_t destsz, void const* src, size_t count) {
 
 void EpidZeroMemory(void* ptr, size_t size) { memset(ptr, 0, size); }
 
+#if !defined(EPID_THREAD_LOCAL)
+#if defined(_MSC_VER)
+/// Storage class of variables that have one instance per thread
+#define EPID_THREAD_LOCAL __declspec(thread)
+#else  // defined(_MSC_VER)
+/// Storage class of variables that have one instance per thread
+#define EPID_THREAD_LOCAL __thread
+#endif  // defined(_MSC_VER)
+#endif  // !defined(EPID_THREAD_LOCAL)
+
+/// Number of heap allocations made by the current thread
+static EPID_THREAD_LOCAL size_t g_alloc_count = 0;
+
+/// Arena EpidAlloc serves blocks from on the current thread
+static EPID_THREAD_LOCAL MemoryArena* g_arena = NULL;
+
+/// Scratch memory that EpidAlloc can serve blocks from
+struct MemoryArena {
+  void* block;        ///< heap block holding buffer
+  uint8_t* buffer;    ///< memory blocks are carved from
+  size_t capacity;    ///< size of buffer in bytes
+  size_t used;        ///< bytes carved from buffer so far
+  void* free_list;    ///< freed blocks of buffer available for reuse
+  size_t num_served;  ///< blocks of buffer currently in use
+  size_t live_size;   ///< bytes of all blocks currently in use
+  size_t peak_size;   ///< largest live_size since the arena last grew
+  bool overflowed;    ///< true if a block was taken from the heap instead
+};
+
+/// Takes a zero initialized block from the heap and counts it
+static void* CountedCalloc(size_t size) {
+  void* ptr = calloc(1, size);
+  if (ptr) {
+    g_alloc_count++;
+  }
+  return ptr;
+}
+
 #if defined(EPID_ENABLE_EPID_ZERO_MEMORY_ON_FREE)
 
 #if !defined(EPID_ALLOC_ALIGN)
@@ -61,33 +100,173 @@ void EpidZeroMemory(void* ptr, size_t size) { memset(ptr, 0, size); }
 #define EPID_ALLOC_ALIGN sizeof(size_t)
 #endif  // !defined(EPID_ALLOC_ALIGN)
 
+/// Rounds size up to a multiple of EPID_ALLOC_ALIGN
+#define ALIGN_UP(size) \
+  (((size) + EPID_ALLOC_ALIGN - 1) & (~(EPID_ALLOC_ALIGN - 1)))
+
 #pragma pack(1)
 /// Allocated memory block information
 typedef struct EpidAllocHeader {
   size_t length;  ///< number of bytes memory block is allocated for
-  void* ptr;      ///< pointer to whole memory block including EpidAllocHeader
+  /// pointer to whole memory block including EpidAllocHeader, NULL for
+  /// blocks carved from an arena or the next free block once they are freed
+  void* ptr;
+  MemoryArena* arena;  ///< arena the block was allocated from or NULL
 } EpidAllocHeader;
 #pragma pack()
 
+/// Bytes reserved in front of each arena block for its EpidAllocHeader
+#define ARENA_HEADER_SIZE ALIGN_UP(sizeof(EpidAllocHeader))
+
+/// Bytes of arena buffer used by a block of given length
+static size_t ArenaBlockSize(size_t length) {
+  return ARENA_HEADER_SIZE + ALIGN_UP(length);
+}
+
+/// Carves a block from the arena, returns NULL if it does not fit
+static void* ArenaAlloc(MemoryArena* arena, size_t size) {
+  size_t block_size = 0;
+  void** link = NULL;
+  uint8_t* ptr = NULL;
+  if (size > SIZE_MAX / 2) return NULL;
+  block_size = ArenaBlockSize(size);
+  // reuse a freed block of the same size if there is one
+  for (link = &arena->free_list; *link;
+       link = &((EpidAllocHeader*)*link)[-1].ptr) {
+    if (ArenaBlockSize(((EpidAllocHeader*)*link)[-1].length) == block_size) {
+      ptr = (uint8_t*)*link;
+      *link = ((EpidAllocHeader*)ptr)[-1].ptr;
+      break;
+    }
+  }
+  if (!ptr) {
+    if (block_size > arena->capacity - arena->used) return NULL;
+    ptr = arena->buffer + arena->used + ARENA_HEADER_SIZE;
+    arena->used += block_size;
+  }
+  memset(ptr, 0, size);
+  ((EpidAllocHeader*)ptr)[-1].length = size;
+  ((EpidAllocHeader*)ptr)[-1].ptr = NULL;
+  ((EpidAllocHeader*)ptr)[-1].arena = arena;
+  arena->num_served++;
+  return ptr;
+}
+
+/// Accounts for a block given to the caller while the arena is selected
+static void ArenaTrackAlloc(MemoryArena* arena, size_t size) {
+  arena->live_size += ArenaBlockSize(size);
+  if (arena->live_size > arena->peak_size) {
+    arena->peak_size = arena->live_size;
+  }
+}
+
+/// Returns a block allocated while the arena was selected
+static void ArenaFree(MemoryArena* arena, void* ptr) {
+  EpidAllocHeader* header = &((EpidAllocHeader*)ptr)[-1];
+  arena->live_size -= ArenaBlockSize(header->length);
+  if (header->ptr) {
+    // block did not fit in the arena and was taken from the heap
+    free(header->ptr);
+    return;
+  }
+  header->ptr = arena->free_list;
+  arena->free_list = ptr;
+  arena->num_served--;
+  if (0 == arena->num_served) {
+    arena->used = 0;
+    arena->free_list = NULL;
+  }
+}
+
+/// Grows the arena to fit the blocks that overflowed it
+static void ArenaGrow(MemoryArena* arena) {
+  size_t capacity = 0;
+  void* block = NULL;
+  if (!arena->overflowed || 0 != arena->num_served) return;
+  // reuse is by exact size, so leave room for blocks of other sizes
+  capacity = arena->peak_size;
+  if (capacity < arena->capacity) capacity = arena->capacity;
+  if (capacity > (SIZE_MAX - EPID_ALLOC_ALIGN) / 2) return;
+  capacity *= 2;
+  block = CountedCalloc(capacity + EPID_ALLOC_ALIGN - 1);
+  if (!block) return;
+  free(arena->block);
+  arena->block = block;
+  arena->buffer =
+      (uint8_t*)(((uintptr_t)block + EPID_ALLOC_ALIGN - 1) &
+                 (~(EPID_ALLOC_ALIGN - 1)));
+  arena->capacity = capacity;
+  arena->used = 0;
+  arena->free_list = NULL;
+  arena->peak_size = arena->live_size;
+  arena->overflowed = false;
+}
+
 #endif  // defined(EPID_ENABLE_EPID_ZERO_MEMORY_ON_FREE)
 
+MemoryArena* CreateMemoryArena(void) {
+  return (MemoryArena*)CountedCalloc(sizeof(MemoryArena));
+}
+
+void DeleteMemoryArena(MemoryArena** arena) {
+  if (arena && *arena) {
+    if (g_arena == *arena) {
+      g_arena = NULL;
+    }
+    if ((*arena)->block) {
+      EpidZeroMemory((*arena)->buffer, (*arena)->capacity);
+      free((*arena)->block);
+    }
+    free(*arena);
+    *arena = NULL;
+  }
+}
+
+MemoryArena* SetThreadMemoryArena(MemoryArena* arena) {
+  MemoryArena* prior_arena = g_arena;
+#if defined(EPID_ENABLE_EPID_ZERO_MEMORY_ON_FREE)
+  if (prior_arena && prior_arena != arena) {
+    ArenaGrow(prior_arena);
+  }
+#endif  // defined(EPID_ENABLE_EPID_ZERO_MEMORY_ON_FREE)
+  g_arena = arena;
+  return prior_arena;
+}
+
+size_t EpidGetAllocCount(void) { return g_alloc_count; }
+
 void* EpidAlloc(size_t size) {
 #if defined(EPID_ENABLE_EPID_ZERO_MEMORY_ON_FREE)
   void* ptr = NULL;
   if (size <= 0) return NULL;
+  if (g_arena) {
+    ptr = ArenaAlloc(g_arena, size);
+    if (ptr) {
+      ArenaTrackAlloc(g_arena, size);
+      return ptr;
+    }
+  }
+  if (size > SIZE_MAX - EPID_ALLOC_ALIGN - sizeof(EpidAllocHeader)) {
+    return NULL;
+  }
   // Allocate memory enough to store size bytes and EpidAllocHeader
-  ptr = calloc(1, size + EPID_ALLOC_ALIGN - 1 + sizeof(EpidAllocHeader));
+  ptr = CountedCalloc(size + EPID_ALLOC_ALIGN - 1 + sizeof(EpidAllocHeader));
   if (ptr) {
     void* aligned_pointer = (void*)(((uintptr_t)ptr + EPID_ALLOC_ALIGN +
                                      sizeof(EpidAllocHeader) - 1) &
                                     (~(EPID_ALLOC_ALIGN - 1)));
     ((EpidAllocHeader*)aligned_pointer)[-1].length = size;
     ((EpidAllocHeader*)aligned_pointer)[-1].ptr = ptr;
+    ((EpidAllocHeader*)aligned_pointer)[-1].arena = g_arena;
+    if (g_arena) {
+      g_arena->overflowed = true;
+      ArenaTrackAlloc(g_arena, size);
+    }
     return aligned_pointer;
   }
   return NULL;
 #else  // defined(EPID_ENABLE_EPID_ZERO_MEMORY_ON_FREE)
-  return calloc(1, size);
+  return CountedCalloc(size);
 #endif  // defined(EPID_ENABLE_EPID_ZERO_MEMORY_ON_FREE)
 }
 
@@ -107,7 +286,11 @@ void* EpidRealloc(void* ptr, size_t new_size) {
   }
   return new_ptr;
 #else   // defined(EPID_ENABLE_EPID_ZERO_MEMORY_ON_FREE)
-  return realloc(ptr, new_size);
+  void* new_ptr = realloc(ptr, new_size);
+  if (new_ptr) {
+    g_alloc_count++;
+  }
+  return new_ptr;
 #endif  // defined(EPID_ENABLE_EPID_ZERO_MEMORY_ON_FREE)
 }
 
@@ -115,7 +298,11 @@ void EpidFree(void* ptr) {
 #if defined(EPID_ENABLE_EPID_ZERO_MEMORY_ON_FREE)
   if (ptr) {
     EpidZeroMemory(ptr, ((EpidAllocHeader*)ptr)[-1].length);
-    free(((EpidAllocHeader*)ptr)[-1].ptr);
+    if (((EpidAllocHeader*)ptr)[-1].arena) {
+      ArenaFree(((EpidAllocHeader*)ptr)[-1].arena, ptr);
+    } else {
+      free(((EpidAllocHeader*)ptr)[-1].ptr);
+    }
   }
 #else   // defined(EPID_ENABLE_EPID_ZERO_MEMORY_ON_FREE)
   free(ptr);
@@ -100,6 +100,57 @@ void EpidFree(void* ptr);
 #define SAFE_REALLOC(ptr, size) EpidRealloc((ptr), (size))
 #endif  // !defined(SAFE_REALLOC)
 
+/// Scratch memory that EpidAlloc can serve blocks from
+typedef struct MemoryArena MemoryArena;
+
+/// Creates an empty memory arena
+/*!
+  The arena starts empty and grows to fit the blocks requested while it
+  is selected, see SetThreadMemoryArena. It must be deleted with
+  DeleteMemoryArena.
+
+  \returns pointer to the arena or NULL if memory allocation failed.
+ */
+MemoryArena* CreateMemoryArena(void);
+
+/// Deletes a memory arena
+/*!
+  All blocks allocated while the arena was selected must be freed
+  before it is deleted. If the arena is selected on the calling thread
+  the thread goes back to allocating from the heap.
+
+  \param[in,out] arena
+  arena to delete. Set to NULL on return.
+ */
+void DeleteMemoryArena(MemoryArena** arena);
+
+/// Selects the arena EpidAlloc serves blocks from on the calling thread
+/*!
+  While an arena is selected EpidAlloc carves blocks out of it and
+  EpidFree gives them back for reuse, so once the arena is large enough
+  a repeated sequence of allocations does not touch the heap. Blocks
+  that do not fit are taken from the heap, and the arena grows to fit
+  them the next time it is deselected with none of its blocks in use.
+
+  Blocks allocated while an arena is selected may be freed after it is
+  deselected, but not while the arena is in use by another thread.
+
+  \param[in] arena
+  arena to allocate from or NULL to allocate from the heap
+
+  \returns the arena that was selected before the call.
+ */
+MemoryArena* SetThreadMemoryArena(MemoryArena* arena);
+
+/// Gets the number of heap allocations made by the calling thread
+/*!
+  Counts the blocks EpidAlloc took from the heap, including memory
+  reserved for arenas. Blocks served from an arena are not counted.
+
+  \returns number of heap allocations since the thread started.
+ */
+size_t EpidGetAllocCount(void);
+
 /// Copies bytes between buffers with security ehancements
 /*!
   Copies count bytes from src to dest. If the source and destination
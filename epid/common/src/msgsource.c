@@ -0,0 +1,82 @@
+/*############################################################################
+  # Copyright 2016-2017 Intel Corporation
+  #
+  # Licensed under the Apache License, Version 2.0 (the "License");
+  # you may not use this file except in compliance with the License.
+  # You may obtain a copy of the License at
+  #
+  #     http://www.apache.org/licenses/LICENSE-2.0
+  #
+  # Unless required by applicable law or agreed to in writing, software
+  # distributed under the License is distributed on an "AS IS" BASIS,
+  # WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  # See the License for the specific language governing permissions and
+  # limitations under the License.
+  ############################################################################*/
+/*!
+ * \file
+ * \brief Message source implementation.
+ */
+#include "epid/common/src/msgsource.h"
+
+#include <stdint.h>
+
+#include "epid/common/math/finitefield.h"
+
+#ifndef MIN
+/// Evaluate to minimum of two values
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#endif  // MIN
+
+/// Size of the buffer a message is read into with a MsgReader
+#define MSG_READ_CHUNK_SIZE ((size_t)4096)
+
+EpidStatus InitMsgSourceFromBuffer(void const* msg, size_t msg_len,
+                                   MsgSource* source) {
+  if (!source) return kEpidBadArgErr;
+  if (!msg && (0 != msg_len)) {
+    // if message is non-empty it must have both length and content
+    return kEpidBadArgErr;
+  }
+  source->buf = msg;
+  source->reader = NULL;
+  source->reader_data = NULL;
+  source->len = msg_len;
+  source->read_failed = false;
+  return kEpidNoErr;
+}
+
+EpidStatus InitMsgSourceFromReader(MsgReader reader, void* reader_data,
+                                   size_t msg_len, MsgSource* source) {
+  if (!reader || !source) return kEpidBadArgErr;
+  source->buf = NULL;
+  source->reader = reader;
+  source->reader_data = reader_data;
+  source->len = msg_len;
+  source->read_failed = false;
+  return kEpidNoErr;
+}
+
+EpidStatus FfHashUpdateMsg(FfHashState* state, MsgSource* source) {
+  EpidStatus sts = kEpidNoErr;
+  uint8_t chunk[MSG_READ_CHUNK_SIZE];
+  size_t offset = 0;
+
+  if (!state || !source) return kEpidBadArgErr;
+  if (!source->reader) {
+    return FfHashUpdate(state, source->buf, source->len);
+  }
+
+  while (offset < source->len) {
+    size_t chunk_len = MIN(source->len - offset, sizeof(chunk));
+    if (0 != source->reader(chunk, chunk_len, offset, source->reader_data)) {
+      source->read_failed = true;
+      sts = kEpidErr;
+      break;
+    }
+    sts = FfHashUpdate(state, chunk, chunk_len);
+    if (kEpidNoErr != sts) break;
+    offset += chunk_len;
+  }
+  return sts;
+}
@@ -0,0 +1,94 @@
+/*############################################################################
+  # Copyright 2016-2017 Intel Corporation
+  #
+  # Licensed under the Apache License, Version 2.0 (the "License");
+  # you may not use this file except in compliance with the License.
+  # You may obtain a copy of the License at
+  #
+  #     http://www.apache.org/licenses/LICENSE-2.0
+  #
+  # Unless required by applicable law or agreed to in writing, software
+  # distributed under the License is distributed on an "AS IS" BASIS,
+  # WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  # See the License for the specific language governing permissions and
+  # limitations under the License.
+  ############################################################################*/
+#ifndef EPID_COMMON_SRC_MSGSOURCE_H_
+#define EPID_COMMON_SRC_MSGSOURCE_H_
+/*!
+ * \file
+ * \brief Message source interface.
+ * \addtogroup EpidCommon
+ * @{
+ */
+#include <stddef.h>
+
+#include "epid/common/errors.h"
+#include "epid/common/msgreader.h"
+#include "epid/common/stdtypes.h"
+
+typedef struct FfHashState FfHashState;
+
+/// A message held in a buffer or read with a MsgReader
+/*!
+ Lets sign and verify hash a message without knowing where it is
+ stored. Exactly one of buf and reader is used.
+ */
+typedef struct MsgSource {
+  void const* buf;    ///< message buffer or NULL if reader is used
+  MsgReader reader;   ///< message reader or NULL if buf is used
+  void* reader_data;  ///< user data passed to reader
+  size_t len;         ///< size of the message in bytes
+  bool read_failed;   ///< set by FfHashUpdateMsg when reader fails
+} MsgSource;
+
+/// Set up a message source for a message in a buffer
+/*!
+  \param[in] msg
+  Message buffer. Can be NULL if msg_len is 0.
+  \param[in] msg_len
+  Size of msg buffer in bytes
+  \param[out] source
+  Message source to set up
+
+  \returns ::EpidStatus
+*/
+EpidStatus InitMsgSourceFromBuffer(void const* msg, size_t msg_len,
+                                   MsgSource* source);
+
+/// Set up a message source for a message read with a MsgReader
+/*!
+  \param[in] reader
+  Message reader
+  \param[in] reader_data
+  User data passed to reader
+  \param[in] msg_len
+  Size of the message in bytes
+  \param[out] source
+  Message source to set up
+
+  \returns ::EpidStatus
+*/
+EpidStatus InitMsgSourceFromReader(MsgReader reader, void* reader_data,
+                                   size_t msg_len, MsgSource* source);
+
+/// Add a message to an incremental hash
+/*!
+  A message in a buffer is hashed in place. A message with a reader is
+  read from the start to the end in parts through a small stack buffer.
+  If the reader fails, source->read_failed is set so that callers can
+  tell a reader error from a failed check.
+
+  \param[in,out] state
+  Hash state
+  \param[in,out] source
+  Message to add
+
+  \returns ::EpidStatus
+
+  \see FfHashUpdate
+*/
+EpidStatus FfHashUpdateMsg(FfHashState* state, MsgSource* source);
+
+/*! @} */
+#endif  // EPID_COMMON_SRC_MSGSOURCE_H_
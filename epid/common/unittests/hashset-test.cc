@@ -0,0 +1,130 @@
+/*############################################################################
+  # Copyright 2016-2017 Intel Corporation
+  #
+  # Licensed under the Apache License, Version 2.0 (the "License");
+  # you may not use this file except in compliance with the License.
+  # You may obtain a copy of the License at
+  #
+  #     http://www.apache.org/licenses/LICENSE-2.0
+  #
+  # Unless required by applicable law or agreed to in writing, software
+  # distributed under the License is distributed on an "AS IS" BASIS,
+  # WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  # See the License for the specific language governing permissions and
+  # limitations under the License.
+  ############################################################################*/
+
+/*!
+ * \file
+ * \brief HashSet unit tests.
+ */
+#include <cstdint>
+#include <vector>
+
+#include "gtest/gtest.h"
+extern "C" {
+#include "epid/common/src/hashset.h"
+}
+
+namespace {
+
+/// A key made of one repeated 32-bit value
+struct TestKey {
+  uint32_t data[16];
+};
+
+TestKey MakeKey(uint32_t value) {
+  TestKey key;
+  for (auto& d : key.data) d = value;
+  return key;
+}
+
+TEST(HashSet, CreateFailsGivenNullPointer) {
+  EXPECT_FALSE(CreateHashSet(sizeof(TestKey), 0, nullptr));
+}
+
+TEST(HashSet, CreateFailsGivenZeroKeySize) {
+  HashSet* set = nullptr;
+  EXPECT_FALSE(CreateHashSet(0, 0, &set));
+}
+
+TEST(HashSet, DeleteWorksGivenNullPointer) {
+  DeleteHashSet(nullptr);
+  HashSet* set = nullptr;
+  DeleteHashSet(&set);
+  EXPECT_EQ(nullptr, set);
+}
+
+TEST(HashSet, DeleteNullsPointer) {
+  HashSet* set = nullptr;
+  ASSERT_TRUE(CreateHashSet(sizeof(TestKey), 0, &set));
+  DeleteHashSet(&set);
+  EXPECT_EQ(nullptr, set);
+}
+
+TEST(HashSet, ContainsReturnsFalseGivenNullArguments) {
+  HashSet* set = nullptr;
+  TestKey key = MakeKey(1);
+  EXPECT_FALSE(HashSetContains(nullptr, &key));
+  ASSERT_TRUE(CreateHashSet(sizeof(TestKey), 0, &set));
+  EXPECT_FALSE(HashSetContains(set, nullptr));
+  DeleteHashSet(&set);
+}
+
+TEST(HashSet, InsertFailsGivenNullArguments) {
+  HashSet* set = nullptr;
+  TestKey key = MakeKey(1);
+  EXPECT_FALSE(HashSetInsert(nullptr, &key));
+  ASSERT_TRUE(CreateHashSet(sizeof(TestKey), 0, &set));
+  EXPECT_FALSE(HashSetInsert(set, nullptr));
+  DeleteHashSet(&set);
+}
+
+TEST(HashSet, GetSizeReturnsZeroGivenNullPointer) {
+  EXPECT_EQ(0u, HashSetGetSize(nullptr));
+}
+
+TEST(HashSet, ContainsOnlyInsertedKeys) {
+  HashSet* set = nullptr;
+  TestKey zero = MakeKey(0);
+  TestKey key = MakeKey(5);
+  TestKey other = MakeKey(6);
+  ASSERT_TRUE(CreateHashSet(sizeof(TestKey), 0, &set));
+  EXPECT_FALSE(HashSetContains(set, &zero));
+  EXPECT_TRUE(HashSetInsert(set, &key));
+  EXPECT_TRUE(HashSetInsert(set, &zero));
+  EXPECT_TRUE(HashSetContains(set, &key));
+  EXPECT_TRUE(HashSetContains(set, &zero));
+  EXPECT_FALSE(HashSetContains(set, &other));
+  DeleteHashSet(&set);
+}
+
+TEST(HashSet, InsertIgnoresDuplicateKeys) {
+  HashSet* set = nullptr;
+  TestKey key = MakeKey(5);
+  ASSERT_TRUE(CreateHashSet(sizeof(TestKey), 0, &set));
+  EXPECT_TRUE(HashSetInsert(set, &key));
+  EXPECT_TRUE(HashSetInsert(set, &key));
+  EXPECT_EQ(1u, HashSetGetSize(set));
+  DeleteHashSet(&set);
+}
+
+TEST(HashSet, KeepsKeysWhenGrowingPastCapacity) {
+  HashSet* set = nullptr;
+  const uint32_t kNumKeys = 1000;
+  ASSERT_TRUE(CreateHashSet(sizeof(TestKey), 1, &set));
+  for (uint32_t i = 0; i < kNumKeys; i++) {
+    TestKey key = MakeKey(2 * i);
+    ASSERT_TRUE(HashSetInsert(set, &key));
+  }
+  EXPECT_EQ(kNumKeys, HashSetGetSize(set));
+  for (uint32_t i = 0; i < kNumKeys; i++) {
+    TestKey even = MakeKey(2 * i);
+    TestKey odd = MakeKey(2 * i + 1);
+    EXPECT_TRUE(HashSetContains(set, &even)) << i;
+    EXPECT_FALSE(HashSetContains(set, &odd)) << i;
+  }
+  DeleteHashSet(&set);
+}
+
+}  // namespace
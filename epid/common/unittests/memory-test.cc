@@ -0,0 +1,143 @@
+/*############################################################################
+  # Copyright 2016-2017 Intel Corporation
+  #
+  # Licensed under the Apache License, Version 2.0 (the "License");
+  # you may not use this file except in compliance with the License.
+  # You may obtain a copy of the License at
+  #
+  #     http://www.apache.org/licenses/LICENSE-2.0
+  #
+  # Unless required by applicable law or agreed to in writing, software
+  # distributed under the License is distributed on an "AS IS" BASIS,
+  # WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  # See the License for the specific language governing permissions and
+  # limitations under the License.
+  ############################################################################*/
+
+/*!
+ * \file
+ * \brief Memory arena unit tests.
+ */
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "gtest/gtest.h"
+extern "C" {
+#include "epid/common/src/memory.h"
+}
+
+namespace {
+
+/// Allocates and frees blocks of a few sizes, as a verify call would
+void AllocateAndFreeBlocks() {
+  std::vector<void*> blocks;
+  for (size_t size : {16, 100, 1000, 16, 4096}) {
+    blocks.push_back(EpidAlloc(size));
+  }
+  for (auto block : blocks) {
+    EpidFree(block);
+  }
+}
+
+TEST(MemoryArena, EpidAllocCountsHeapAllocations) {
+  size_t alloc_count = EpidGetAllocCount();
+  void* block = EpidAlloc(32);
+  ASSERT_NE(nullptr, block);
+  EXPECT_EQ(alloc_count + 1, EpidGetAllocCount());
+  EpidFree(block);
+}
+
+TEST(MemoryArena, DeleteWorksGivenNullPointer) {
+  MemoryArena* arena = nullptr;
+  DeleteMemoryArena(nullptr);
+  DeleteMemoryArena(&arena);
+  EXPECT_EQ(nullptr, arena);
+}
+
+TEST(MemoryArena, SetThreadMemoryArenaReturnsPriorArena) {
+  MemoryArena* arena = CreateMemoryArena();
+  ASSERT_NE(nullptr, arena);
+  EXPECT_EQ(nullptr, SetThreadMemoryArena(arena));
+  EXPECT_EQ(arena, SetThreadMemoryArena(nullptr));
+  DeleteMemoryArena(&arena);
+  EXPECT_EQ(nullptr, arena);
+}
+
+TEST(MemoryArena, DeleteDeselectsArena) {
+  MemoryArena* arena = CreateMemoryArena();
+  ASSERT_NE(nullptr, arena);
+  SetThreadMemoryArena(arena);
+  DeleteMemoryArena(&arena);
+  EXPECT_EQ(nullptr, SetThreadMemoryArena(nullptr));
+}
+
+TEST(MemoryArena, RepeatedAllocationsDoNotUseHeapOnceArenaGrew) {
+  MemoryArena* arena = CreateMemoryArena();
+  ASSERT_NE(nullptr, arena);
+  MemoryArena* prior_arena = SetThreadMemoryArena(arena);
+  AllocateAndFreeBlocks();
+  SetThreadMemoryArena(prior_arena);
+
+  size_t alloc_count = EpidGetAllocCount();
+  for (int i = 0; i < 3; i++) {
+    prior_arena = SetThreadMemoryArena(arena);
+    AllocateAndFreeBlocks();
+    SetThreadMemoryArena(prior_arena);
+  }
+  EXPECT_EQ(alloc_count, EpidGetAllocCount());
+  DeleteMemoryArena(&arena);
+}
+
+TEST(MemoryArena, ArenaBlocksAreZeroInitialized) {
+  MemoryArena* arena = CreateMemoryArena();
+  ASSERT_NE(nullptr, arena);
+  MemoryArena* prior_arena = SetThreadMemoryArena(arena);
+  AllocateAndFreeBlocks();
+  SetThreadMemoryArena(prior_arena);
+
+  prior_arena = SetThreadMemoryArena(arena);
+  uint8_t* block = (uint8_t*)EpidAlloc(100);
+  ASSERT_NE(nullptr, block);
+  memset(block, 0xff, 100);
+  EpidFree(block);
+  block = (uint8_t*)EpidAlloc(100);
+  ASSERT_NE(nullptr, block);
+  EXPECT_EQ(std::vector<uint8_t>(100, 0),
+            std::vector<uint8_t>(block, block + 100));
+  EpidFree(block);
+  SetThreadMemoryArena(prior_arena);
+  DeleteMemoryArena(&arena);
+}
+
+TEST(MemoryArena, ArenaBlocksCanBeFreedAfterArenaIsDeselected) {
+  MemoryArena* arena = CreateMemoryArena();
+  ASSERT_NE(nullptr, arena);
+  MemoryArena* prior_arena = SetThreadMemoryArena(arena);
+  void* block = EpidAlloc(64);
+  SetThreadMemoryArena(prior_arena);
+  ASSERT_NE(nullptr, block);
+  EpidFree(block);
+  DeleteMemoryArena(&arena);
+}
+
+TEST(MemoryArena, EpidReallocKeepsContentOfArenaBlock) {
+  MemoryArena* arena = CreateMemoryArena();
+  ASSERT_NE(nullptr, arena);
+  MemoryArena* prior_arena = SetThreadMemoryArena(arena);
+  AllocateAndFreeBlocks();
+  SetThreadMemoryArena(prior_arena);
+
+  prior_arena = SetThreadMemoryArena(arena);
+  uint8_t* block = (uint8_t*)EpidAlloc(16);
+  ASSERT_NE(nullptr, block);
+  for (uint8_t i = 0; i < 16; i++) block[i] = i;
+  uint8_t* grown = (uint8_t*)EpidRealloc(block, 100);
+  ASSERT_NE(nullptr, grown);
+  for (uint8_t i = 0; i < 16; i++) EXPECT_EQ(i, grown[i]);
+  EpidFree(grown);
+  SetThreadMemoryArena(prior_arena);
+  DeleteMemoryArena(&arena);
+}
+
+}  // namespace
@@ -26,6 +26,8 @@ extern "C" {
 #include "epid/common/bitsupplier.h"
 #include "epid/common/epiddefs.h"
 #include "epid/common/errors.h"
+#include "epid/common/msgreader.h"
+#include "epid/common/sharedparams.h"
 #include "epid/common/types.h"
 
 /// Internal context of member.
@@ -93,6 +95,33 @@ EpidStatus EPID_API EpidMemberGetSize(MemberParams const* params,
  */
 EpidStatus EPID_API EpidMemberInit(MemberParams const* params, MemberCtx* ctx);
 
+/// Initializes a new member context that uses shared parameters.
+/*!
+ Same as ::EpidMemberInit, but the context uses shared_params rather
+ than building its own fields, curves and pairing state.
+
+ The context holds a reference to shared_params until it is
+ de-initialized, so shared_params may be released with
+ ::EpidSharedParamsDelete while the context is in use.
+
+ \param[in] params
+ Implementation specific configuration parameters.
+ \param[in] shared_params
+ Shared Intel(R) EPID 2.0 parameters.
+ \param[in,out] ctx
+ An existing buffer that will be used as a ::MemberCtx.
+
+ \warning ctx must be a buffer of at least the size reported by
+ ::EpidMemberGetSize for the same parameters.
+
+ \returns ::EpidStatus
+ \see EpidSharedParamsCreate
+ \see EpidMemberDeinit
+ */
+EpidStatus EPID_API EpidMemberInitWithParams(MemberParams const* params,
+                                             EpidSharedParams* shared_params,
+                                             MemberCtx* ctx);
+
 /// Creates a request to join a group.
 /*!
 The created request is part of the interaction with an issuer needed to join
@@ -333,6 +362,48 @@ EpidStatus EPID_API EpidSign(MemberCtx const* ctx, void const* msg,
                              size_t basename_len, EpidSignature* sig,
                              size_t sig_len);
 
+/// Writes an Intel(R) EPID signature of a message that is read in parts.
+/*!
+ Same as EpidSign, but the message is read with a ::MsgReader instead
+ of being passed in a buffer, so it does not have to fit in memory. The
+ message is read once for the basic signature and once for each entry
+ in the signature based revocation list.
+
+ \param[in] ctx
+ The member context.
+ \param[in] reader
+ The message reader.
+ \param[in] reader_data
+ User data passed to each call of reader.
+ \param[in] msg_len
+ The length in bytes of message.
+ \param[in] basename
+ Optional basename, as for EpidSign.
+ \param[in] basename_len
+ The size of basename in bytes. Must be 0 if basename is NULL.
+ \param[out] sig
+ The generated signature
+ \param[in] sig_len
+ The size of signature in bytes. Must be equal to value returned by
+ EpidGetSigSize().
+
+ \returns ::EpidStatus
+
+ \retval ::kEpidErr
+ The reader failed.
+
+ \note
+ If the result is not ::kEpidNoErr the content of sig is undefined.
+
+ \see EpidSign
+ \see MsgReader
+ */
+EpidStatus EPID_API EpidSignFromReader(MemberCtx const* ctx, MsgReader reader,
+                                       void* reader_data, size_t msg_len,
+                                       void const* basename,
+                                       size_t basename_len,
+                                       EpidSignature* sig, size_t sig_len);
+
 /// Registers a basename with a member.
 /*!
 
@@ -22,6 +22,8 @@
 #include <epid/member/api.h>
 
 #include <string.h>
+#include "epid/common/math/finitefield.h"
+#include "epid/common/src/commitment.h"
 #include "epid/common/src/endian_convert.h"
 #include "epid/common/src/epid2params.h"
 #include "epid/common/src/memory.h"
@@ -51,7 +53,9 @@ EpidStatus EpidMemberGetSize(MemberParams const* params, size_t* context_size) {
   return kEpidNoErr;
 }
 
-EpidStatus EpidMemberInit(MemberParams const* params, MemberCtx* ctx) {
+/// Initializes a member context that uses shared_params, or its own if NULL
+static EpidStatus InitMember(MemberParams const* params,
+                             Epid2Params_* shared_params, MemberCtx* ctx) {
   EpidStatus sts = kEpidErr;
 
   if (!params || !ctx) {
@@ -75,8 +79,12 @@ EpidStatus EpidMemberInit(MemberParams const* params, MemberCtx* ctx) {
     sts = CreateBasenames(&ctx->allowed_basenames);
     BREAK_ON_EPID_ERROR(sts);
     // Internal representation of Epid2Params
-    sts = CreateEpid2Params(&ctx->epid2_params);
-    BREAK_ON_EPID_ERROR(sts);
+    if (shared_params) {
+      ctx->epid2_params = ShareEpid2Params(shared_params);
+    } else {
+      sts = CreateEpid2Params(&ctx->epid2_params);
+      BREAK_ON_EPID_ERROR(sts);
+    }
 
     // create TPM2 context
     sts = Tpm2CreateContext(params, ctx->epid2_params, &ctx->rnd_func,
@@ -126,6 +134,19 @@ EpidStatus EpidMemberInit(MemberParams const* params, MemberCtx* ctx) {
   return (sts);
 }
 
+EpidStatus EpidMemberInit(MemberParams const* params, MemberCtx* ctx) {
+  return InitMember(params, NULL, ctx);
+}
+
+EpidStatus EpidMemberInitWithParams(MemberParams const* params,
+                                    EpidSharedParams* shared_params,
+                                    MemberCtx* ctx) {
+  if (!shared_params) {
+    return kEpidBadArgErr;
+  }
+  return InitMember(params, shared_params, ctx);
+}
+
 void EpidMemberDeinit(MemberCtx* ctx) {
   size_t i = 0;
   size_t presig_size = 0;
@@ -152,6 +173,7 @@ void EpidMemberDeinit(MemberCtx* ctx) {
   DeleteFfElement((FfElement**)&ctx->e22);
   DeleteFfElement((FfElement**)&ctx->e2w);
   DeleteFfElement((FfElement**)&ctx->ea2);
+  ClearCommitHashPrefixes(ctx);
   Tpm2DeleteContext(&ctx->tpm2_ctx);
   DeleteEpid2Params(&ctx->epid2_params);
   DeleteBasenames(&ctx->allowed_basenames);
@@ -228,11 +250,50 @@ EpidStatus EpidMemberSetHashAlg(MemberCtx* ctx, HashAlg hash_alg) {
   do {
     sts = Tpm2SetHashAlg(ctx->tpm2_ctx, hash_alg);
     BREAK_ON_EPID_ERROR(sts);
+    if (ctx->commit_hash_prefix) {
+      sts = UpdateCommitHashPrefixes(ctx, hash_alg);
+      if (kEpidNoErr != sts) {
+        (void)Tpm2SetHashAlg(ctx->tpm2_ctx, ctx->hash_alg);
+        break;
+      }
+    }
     ctx->hash_alg = hash_alg;
   } while (0);
   return sts;
 }
 
+EpidStatus UpdateCommitHashPrefixes(MemberCtx* ctx, HashAlg hash_alg) {
+  EpidStatus sts = kEpidErr;
+  FfHashState* commit_hash_prefix = NULL;
+  FfHashState* nr_commit_hash_prefix = NULL;
+  if (!ctx) return kEpidBadArgErr;
+  do {
+    CommitValues values;
+    sts = SetKeySpecificCommitValues(&ctx->pub_key, &values);
+    BREAK_ON_EPID_ERROR(sts);
+    sts = NewCommitHashPrefix(&values, hash_alg, &commit_hash_prefix);
+    BREAK_ON_EPID_ERROR(sts);
+    sts = NewNrCommitHashPrefix(&values, hash_alg, &nr_commit_hash_prefix);
+    BREAK_ON_EPID_ERROR(sts);
+    ClearCommitHashPrefixes(ctx);
+    ctx->commit_hash_prefix = commit_hash_prefix;
+    ctx->nr_commit_hash_prefix = nr_commit_hash_prefix;
+    commit_hash_prefix = NULL;
+    nr_commit_hash_prefix = NULL;
+    sts = kEpidNoErr;
+  } while (0);
+  DeleteFfHashState(&nr_commit_hash_prefix);
+  DeleteFfHashState(&commit_hash_prefix);
+  return sts;
+}
+
+void ClearCommitHashPrefixes(MemberCtx* ctx) {
+  if (ctx) {
+    DeleteFfHashState(&ctx->nr_commit_hash_prefix);
+    DeleteFfHashState(&ctx->commit_hash_prefix);
+  }
+}
+
 EpidStatus EpidMemberSetSigRl(MemberCtx* ctx, SigRl const* sig_rl,
                               size_t sig_rl_size) {
   if (!ctx || !sig_rl) {
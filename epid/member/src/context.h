@@ -35,6 +35,7 @@ typedef struct AllowedBasenames AllowedBasenames;
 typedef struct Stack Stack;
 typedef struct EcPoint EcPoint;
 typedef struct FfElement FfElement;
+typedef struct FfHashState FfHashState;
 /// \endcond
 
 /// Member context definition
@@ -48,6 +49,8 @@ struct MemberCtx {
   SigRl const* sig_rl;         ///< Signature based revocation list - not owned
   AllowedBasenames* allowed_basenames;  ///< Base name list
   HashAlg hash_alg;                     ///< Hash algorithm to use
+  FfHashState* commit_hash_prefix;  ///< Hash of key specific commit values
+  FfHashState* nr_commit_hash_prefix;  ///< Hash of p || g1 for NrProve
   MembershipCredential credential;      ///< Membership credential
   bool primary_key_set;                 ///< primary key is set
   bool precomp_ready;  ///< provisioned precomputed value is ready for use
@@ -96,4 +99,15 @@ typedef struct PreComputedSignature {
 /// Minimally provision member with f
 EpidStatus EpidMemberInitialProvision(MemberCtx* ctx);
 
+/// Hashes the commit values that do not change between signatures
+/*!
+ Replaces commit_hash_prefix and nr_commit_hash_prefix with hashes of
+ the commit values of pub_key made with hash_alg. The context is not
+ changed on failure.
+ */
+EpidStatus UpdateCommitHashPrefixes(MemberCtx* ctx, HashAlg hash_alg);
+
+/// Drops the hashes of commit values made for the previous group key
+void ClearCommitHashPrefixes(MemberCtx* ctx);
+
 #endif  // EPID_MEMBER_SRC_CONTEXT_H_
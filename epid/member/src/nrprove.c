@@ -58,6 +58,17 @@ EpidStatus EpidNrProve(MemberCtx const* ctx, void const* msg, size_t msg_len,
                        void const* basename, size_t basename_len,
                        BasicSignature const* sig, SigRlEntry const* sigrl_entry,
                        NrProof* proof) {
+  MsgSource source;
+  EpidStatus sts = InitMsgSourceFromBuffer(msg, msg_len, &source);
+  if (kEpidNoErr != sts) return sts;
+  return NrProve(ctx, &source, basename, basename_len, sig, sigrl_entry,
+                 proof);
+}
+
+EpidStatus NrProve(MemberCtx const* ctx, MsgSource* msg,
+                   void const* basename, size_t basename_len,
+                   BasicSignature const* sig, SigRlEntry const* sigrl_entry,
+                   NrProof* proof) {
   EpidStatus sts = kEpidErr;
 
   EcPoint* B = NULL;
@@ -83,7 +94,7 @@ EpidStatus EpidNrProve(MemberCtx const* ctx, void const* msg, size_t msg_len,
   BigNumStr nu_str = {0};
   BigNumStr rmu_str = {0};
 
-  if (!ctx || (0 != msg_len && !msg) || !sig || !sigrl_entry || !proof)
+  if (!ctx || !msg || !sig || !sigrl_entry || !proof)
     return kEpidBadArgErr;
   if (!basename || 0 == basename_len) {
     // basename should not be empty
@@ -215,8 +226,9 @@ EpidStatus EpidNrProve(MemberCtx const* ctx, void const* msg, size_t msg_len,
     sts = WriteEcPoint(G1, t, &commit_out.R2, sizeof(commit_out.R2));
     BREAK_ON_EPID_ERROR(sts);
 
-    sts = HashNrProveCommitment(Fp, ctx->hash_alg, &sig->B, &sig->K,
-                                sigrl_entry, &commit_out, msg, msg_len, &c_str);
+    sts = HashNrProveCommitment(Fp, ctx->hash_alg, ctx->nr_commit_hash_prefix,
+                                &sig->B, &sig->K, sigrl_entry, &commit_out, msg,
+                                &c_str);
     BREAK_ON_EPID_ERROR(sts);
 
     digest = SAFE_ALLOC(digest_len);
@@ -20,6 +20,7 @@
 
 #include <stddef.h>
 #include "epid/common/errors.h"
+#include "epid/common/src/msgsource.h"
 
 /// \cond
 typedef struct MemberCtx MemberCtx;
@@ -68,4 +69,32 @@ EpidStatus EpidNrProve(MemberCtx const* ctx, void const* msg, size_t msg_len,
                        BasicSignature const* sig, SigRlEntry const* sigrl_entry,
                        NrProof* proof);
 
+/// Calculates a non-revoked proof for a message from a message source.
+/*!
+ Same as EpidNrProve but the message can be read in parts.
+
+ \param[in] ctx
+ The member context.
+ \param[in] msg
+ The message.
+ \param[in] basename
+ The basename used in SignBasic.
+ \param[in] basename_len
+ The length of the basename.
+ \param[in] sig
+ The basic signature.
+ \param[in] sigrl_entry
+ The signature based revocation list entry.
+ \param[out] proof
+ The generated non-revoked proof.
+
+ \returns ::EpidStatus
+
+ \see EpidNrProve
+ */
+EpidStatus NrProve(MemberCtx const* ctx, MsgSource* msg,
+                   void const* basename, size_t basename_len,
+                   BasicSignature const* sig, SigRlEntry const* sigrl_entry,
+                   NrProof* proof);
+
 #endif  // EPID_MEMBER_SRC_NRPROVE_H_
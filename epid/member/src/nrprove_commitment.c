@@ -20,7 +20,7 @@
 
 #include <stdint.h>
 #include "epid/common/math/finitefield.h"
-#include "epid/common/src/memory.h"
+#include "epid/common/src/msgsource.h"
 
 /// Handle SDK Error with Break
 #define BREAK_ON_EPID_ERROR(ret) \
@@ -38,66 +38,61 @@ typedef struct NrProveCommitValues {
   G1ElemStr rlB;  //!< (element of G1): one entry in SigRL
   G1ElemStr rlK;  //!< (element of G1): one entry in SigRL
   NrProveCommitOutput commit_out;  //!< output of NrProveCommit
-  uint8_t msg[1];                  //!< message
 } NrProveCommitValues;
 #pragma pack()
 
 EpidStatus HashNrProveCommitment(FiniteField* Fp, HashAlg hash_alg,
+                                 FfHashState const* prefix,
                                  G1ElemStr const* B_str, G1ElemStr const* K_str,
                                  SigRlEntry const* sigrl_entry,
                                  NrProveCommitOutput const* commit_out,
-                                 void const* msg, size_t msg_len,
-                                 FpElemStr* c_str) {
+                                 MsgSource* msg, FpElemStr* c_str) {
   EpidStatus sts = kEpidErr;
   FfElement* c = NULL;
-  NrProveCommitValues* commit_values = NULL;
+  FfHashState* hash_state = NULL;
 
-  if (!Fp || !B_str || !K_str || !sigrl_entry || !commit_out ||
-      (0 != msg_len && !msg) || !c_str) {
+  if (!Fp || !B_str || !K_str || !sigrl_entry || !commit_out || !msg ||
+      !c_str) {
     return kEpidBadArgErr;
   }
 
-  if (msg_len >
-      ((SIZE_MAX - sizeof(*commit_values)) + sizeof(*commit_values->msg)))
-    return kEpidBadArgErr;
-
   do {
-    size_t const commit_len =
-        sizeof(*commit_values) - sizeof(*commit_values->msg) + msg_len;
+    NrProveCommitValues commit_values;
     Epid2Params params = {
 #include "epid/common/src/epid2params_ate.inc"
     };
 
-    commit_values = SAFE_ALLOC(commit_len);
-    if (!commit_values) {
-      sts = kEpidMemAllocErr;
-      BREAK_ON_EPID_ERROR(sts);
-    }
-
-    commit_values->p = params.p;
-    commit_values->g1 = params.g1;
-    commit_values->B = *B_str;
-    commit_values->K = *K_str;
-    commit_values->rlB = sigrl_entry->b;
-    commit_values->rlK = sigrl_entry->k;
-    commit_values->commit_out = *commit_out;
-
-    // commit_values is allocated such that there are msg_len bytes available
-    // starting at commit_values->msg
-    if (msg) {
-      // Memory copy is used to copy a message of variable length
-      if (0 != memcpy_S(&commit_values->msg[0], msg_len, msg, msg_len)) {
-        sts = kEpidBadArgErr;
-        BREAK_ON_EPID_ERROR(sts);
-      }
-    }
+    commit_values.p = params.p;
+    commit_values.g1 = params.g1;
+    commit_values.B = *B_str;
+    commit_values.K = *K_str;
+    commit_values.rlB = sigrl_entry->b;
+    commit_values.rlK = sigrl_entry->k;
+    commit_values.commit_out = *commit_out;
 
     sts = NewFfElement(Fp, &c);
     BREAK_ON_EPID_ERROR(sts);
+    sts = NewFfHashState(hash_alg, &hash_state);
+    BREAK_ON_EPID_ERROR(sts);
 
     // 7.  The member computes c = Fp.hash(p || g1 || B || K || B' ||
     //     K' || T || R1 || R2 || m).
-    sts = FfHash(Fp, commit_values, commit_len, hash_alg, c);
+    //     m is hashed where it is stored rather than copied after the
+    //     values.
+    if (prefix) {
+      // resume after p || g1, hashed when the key was set
+      sts = FfHashStateCopy(prefix, hash_state);
+      BREAK_ON_EPID_ERROR(sts);
+      sts = FfHashUpdate(hash_state, &commit_values.B,
+                         sizeof(commit_values) -
+                             offsetof(NrProveCommitValues, B));
+    } else {
+      sts = FfHashUpdate(hash_state, &commit_values, sizeof(commit_values));
+    }
+    BREAK_ON_EPID_ERROR(sts);
+    sts = FfHashUpdateMsg(hash_state, msg);
+    BREAK_ON_EPID_ERROR(sts);
+    sts = FfHashFinal(Fp, hash_state, c);
     BREAK_ON_EPID_ERROR(sts);
 
     sts = WriteFfElement(Fp, c, c_str, sizeof(*c_str));
@@ -106,7 +101,7 @@ EpidStatus HashNrProveCommitment(FiniteField* Fp, HashAlg hash_alg,
     sts = kEpidNoErr;
   } while (0);
 
-  SAFE_FREE(commit_values);
+  DeleteFfHashState(&hash_state);
   DeleteFfElement(&c);
 
   return sts;
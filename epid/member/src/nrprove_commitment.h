@@ -21,12 +21,14 @@
 #include <stddef.h>
 #include "epid/common/errors.h"
 #include "epid/common/types.h"  // HashAlg, G1ElemStr
+#include "epid/common/src/msgsource.h"
 
 /// \cond
 typedef struct FiniteField FiniteField;
 typedef struct FpElemStr FpElemStr;
 typedef struct SigRlEntry SigRlEntry;
 typedef struct NrProveCommitOutput NrProveCommitOutput;
+typedef struct FfHashState FfHashState;
 /// \endcond
 
 #pragma pack(1)
@@ -47,6 +49,9 @@ typedef struct NrProveCommitOutput {
   \param[in] hash_alg
   The hash algorithm.
 
+  \param[in] prefix
+  Hash of p || g1 made with hash_alg, or NULL to hash them here.
+
   \param[in] B_str
   The B value from the ::BasicSignature.
 
@@ -63,9 +68,6 @@ typedef struct NrProveCommitOutput {
   \param[in] msg
   The message.
 
-  \param[in] msg_len
-  The size of message in bytes.
-
   \param[out] c_str
   The resulting commitment hash.
 
@@ -73,10 +75,10 @@ typedef struct NrProveCommitOutput {
 
  */
 EpidStatus HashNrProveCommitment(FiniteField* Fp, HashAlg hash_alg,
+                                 FfHashState const* prefix,
                                  G1ElemStr const* B_str, G1ElemStr const* K_str,
                                  SigRlEntry const* sigrl_entry,
                                  NrProveCommitOutput const* commit_out,
-                                 void const* msg, size_t msg_len,
-                                 FpElemStr* c_str);
+                                 MsgSource* msg, FpElemStr* c_str);
 
 #endif  // EPID_MEMBER_SRC_NRPROVE_COMMITMENT_H_
@@ -46,6 +46,7 @@ EpidStatus PrecomputeMemberPairing(Epid2Params_ const* epid2_params,
     PairingState* ps_ctx = epid2_params->pairing_state;
     EcPoint* g2 = epid2_params->g2;
 
+    // the group public key and A are validated as they are read
     sts = CreateGroupPubKey(pub_key, G1, G2, &pub_key_);
     BREAK_ON_EPID_ERROR(sts);
 
@@ -53,19 +54,19 @@ EpidStatus PrecomputeMemberPairing(Epid2Params_ const* epid2_params,
     BREAK_ON_EPID_ERROR(sts);
 
     // 1. The member computes e12 = pairing(h1, g2).
-    sts = Pairing(ps_ctx, pub_key_->h1, g2, e);
+    sts = PairingTrusted(ps_ctx, pub_key_->h1, g2, e);
     BREAK_ON_EPID_ERROR(sts);
     sts = WriteFfElement(GT, e, &precomp->e12, sizeof(precomp->e12));
     BREAK_ON_EPID_ERROR(sts);
 
     // 2.  The member computes e22 = pairing(h2, g2).
-    sts = Pairing(ps_ctx, pub_key_->h2, g2, e);
+    sts = PairingTrusted(ps_ctx, pub_key_->h2, g2, e);
     BREAK_ON_EPID_ERROR(sts);
     sts = WriteFfElement(GT, e, &precomp->e22, sizeof(precomp->e22));
     BREAK_ON_EPID_ERROR(sts);
 
     // 3.  The member computes e2w = pairing(h2, w).
-    sts = Pairing(ps_ctx, pub_key_->h2, pub_key_->w, e);
+    sts = PairingTrusted(ps_ctx, pub_key_->h2, pub_key_->w, e);
     BREAK_ON_EPID_ERROR(sts);
     sts = WriteFfElement(GT, e, &precomp->e2w, sizeof(precomp->e2w));
     BREAK_ON_EPID_ERROR(sts);
@@ -75,7 +76,7 @@ EpidStatus PrecomputeMemberPairing(Epid2Params_ const* epid2_params,
     BREAK_ON_EPID_ERROR(sts);
     sts = ReadEcPoint(G1, A_str, sizeof(*A_str), A);
     BREAK_ON_EPID_ERROR(sts);
-    sts = Pairing(ps_ctx, A, g2, e);
+    sts = PairingTrusted(ps_ctx, A, g2, e);
     BREAK_ON_EPID_ERROR(sts);
     sts = WriteFfElement(GT, e, &precomp->ea2, sizeof(precomp->ea2));
     BREAK_ON_EPID_ERROR(sts);
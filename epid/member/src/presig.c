@@ -113,6 +113,10 @@ EpidStatus MemberComputePreSig(MemberCtx const* ctx,
   } p2x = {0};
   FfElement* p2y = NULL;
 
+  EcPoint** g1_temps[] = {&B, &k, &t, &e};
+  FfElement** fp_temps[] = {&a, &rx, &rb, &t1, &t2};
+  uint8_t* temps = NULL;
+
   if (!ctx || !precompsig || !ctx->epid2_params) {
     return kEpidBadArgErr;
   }
@@ -128,6 +132,12 @@ EpidStatus MemberComputePreSig(MemberCtx const* ctx,
     EcPoint const* A = ctx->A;
     FfElement const* x = ctx->x;
     PairingState* ps_ctx = ctx->epid2_params->pairing_state;
+    size_t g1_size = 0;
+    size_t gt_size = 0;
+    size_t fp_size = 0;
+    size_t fq_size = 0;
+    uint8_t* next = NULL;
+    size_t i = 0;
 
     const BigNumStr kOne = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
                             0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1};
@@ -135,30 +145,37 @@ EpidStatus MemberComputePreSig(MemberCtx const* ctx,
     //    ea2). Refer to Section 3.5 for the computation of these
     //    values.
 
-    sts = NewFfElement(Fq, &p2y);
     // The following variables B, K, T, R1 (elements of G1), R2
     // (elements of GT), a, b, rx, rf, ra, rb, t1, t2 (256-bit
-    // integers) are used.
-    BREAK_ON_EPID_ERROR(sts);
-    sts = NewEcPoint(G1, &B);
-    BREAK_ON_EPID_ERROR(sts);
-    sts = NewEcPoint(G1, &k);
-    BREAK_ON_EPID_ERROR(sts);
-    sts = NewEcPoint(G1, &t);
+    // integers) are used. All temporaries are placed in one block.
+    sts = EcPointGetSize(G1, &g1_size);
     BREAK_ON_EPID_ERROR(sts);
-    sts = NewEcPoint(G1, &e);
+    sts = FfElementGetSize(GT, &gt_size);
     BREAK_ON_EPID_ERROR(sts);
-    sts = NewFfElement(GT, &R2);
+    sts = FfElementGetSize(Fp, &fp_size);
     BREAK_ON_EPID_ERROR(sts);
-    sts = NewFfElement(Fp, &a);
+    sts = FfElementGetSize(Fq, &fq_size);
     BREAK_ON_EPID_ERROR(sts);
-    sts = NewFfElement(Fp, &rx);
-    BREAK_ON_EPID_ERROR(sts);
-    sts = NewFfElement(Fp, &rb);
+    temps = SAFE_ALLOC(COUNT_OF(g1_temps) * g1_size + gt_size +
+                       COUNT_OF(fp_temps) * fp_size + fq_size);
+    if (!temps) {
+      sts = kEpidMemAllocErr;
+      break;
+    }
+    next = temps;
+    for (i = 0; i < COUNT_OF(g1_temps) && kEpidNoErr == sts; i++) {
+      sts = InitEcPoint(G1, next, g1_size, g1_temps[i]);
+      next += g1_size;
+    }
+    for (i = 0; i < COUNT_OF(fp_temps) && kEpidNoErr == sts; i++) {
+      sts = InitFfElement(Fp, next, fp_size, fp_temps[i]);
+      next += fp_size;
+    }
     BREAK_ON_EPID_ERROR(sts);
-    sts = NewFfElement(Fp, &t1);
+    sts = InitFfElement(GT, next, gt_size, &R2);
     BREAK_ON_EPID_ERROR(sts);
-    sts = NewFfElement(Fp, &t2);
+    next += gt_size;
+    sts = InitFfElement(Fq, next, fq_size, &p2y);
     BREAK_ON_EPID_ERROR(sts);
 
     // 3. The member computes B = G1.getRandom().
@@ -279,17 +296,7 @@ EpidStatus MemberComputePreSig(MemberCtx const* ctx,
   EpidZeroMemory(&t2_str, sizeof(t2_str));
   EpidZeroMemory(&p2x, sizeof(p2x));
 
-  DeleteFfElement(&p2y);
-  DeleteEcPoint(&B);
-  DeleteEcPoint(&k);
-  DeleteEcPoint(&t);
-  DeleteEcPoint(&e);
-  DeleteFfElement(&R2);
-  DeleteFfElement(&a);
-  DeleteFfElement(&rx);
-  DeleteFfElement(&rb);
-  DeleteFfElement(&t1);
-  DeleteFfElement(&t2);
+  SAFE_FREE(temps);
 
   return sts;
 }
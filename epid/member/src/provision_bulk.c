@@ -78,6 +78,7 @@ EpidStatus EpidProvisionKey(MemberCtx* ctx, GroupPubKey const* pub_key,
     }
 
     ctx->pub_key = *pub_key;
+    ClearCommitHashPrefixes(ctx);
     ctx->is_provisioned = true;
 
     ctx->credential.A = credential.A;
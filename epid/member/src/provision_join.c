@@ -79,6 +79,7 @@ EpidStatus EpidProvisionCredential(MemberCtx* ctx, GroupPubKey const* pub_key,
     ctx->credential.x = credential->x;
     ctx->credential.gid = credential->gid;
     ctx->pub_key = *pub_key;
+    ClearCommitHashPrefixes(ctx);
     ctx->is_provisioned = true;
   }
   return sts;
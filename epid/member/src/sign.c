@@ -31,20 +31,14 @@
     break;                       \
   }
 
-EpidStatus EpidSign(MemberCtx const* ctx, void const* msg, size_t msg_len,
-                    void const* basename, size_t basename_len,
-                    EpidSignature* sig, size_t sig_len) {
+/// Writes a signature of a message from a message source
+static EpidStatus SignMsg(MemberCtx const* ctx, MsgSource* msg,
+                          void const* basename, size_t basename_len,
+                          EpidSignature* sig, size_t sig_len) {
   EpidStatus sts = kEpidErr;
   uint32_t num_sig_rl = 0;
   OctStr32 octstr32_0 = {{0x00, 0x00, 0x00, 0x00}};
   BigNumStr rnd_bsn = {0};
-  if (!ctx || !sig) {
-    return kEpidBadArgErr;
-  }
-  if (!msg && (0 != msg_len)) {
-    // if message is non-empty it must have both length and content
-    return kEpidBadArgErr;
-  }
   if (!basename && (0 != basename_len)) {
     // if basename is non-empty it must have both length and content
     return kEpidBadArgErr;
@@ -57,8 +51,7 @@ EpidStatus EpidSign(MemberCtx const* ctx, void const* msg, size_t msg_len,
   }
 
   // 11. The member sets sigma0 = (B, K, T, c, sx, sf, sa, sb).
-  sts = EpidSignBasic(ctx, msg, msg_len, basename, basename_len, &sig->sigma0,
-                      &rnd_bsn);
+  sts = SignBasic(ctx, msg, basename, basename_len, &sig->sigma0, &rnd_bsn);
   if (kEpidNoErr != sts) {
     return sts;
   }
@@ -88,11 +81,11 @@ EpidStatus EpidSign(MemberCtx const* ctx, void const* msg, size_t msg_len,
     num_sig_rl = ntohl(ctx->sig_rl->n2);
     for (i = 0; i < num_sig_rl; i++) {
       if (basename) {
-        sts = EpidNrProve(ctx, msg, msg_len, basename, basename_len,
-                          &sig->sigma0, &ctx->sig_rl->bk[i], &sig->sigma[i]);
+        sts = NrProve(ctx, msg, basename, basename_len, &sig->sigma0,
+                      &ctx->sig_rl->bk[i], &sig->sigma[i]);
       } else {
-        sts = EpidNrProve(ctx, msg, msg_len, &rnd_bsn, sizeof(rnd_bsn),
-                          &sig->sigma0, &ctx->sig_rl->bk[i], &sig->sigma[i]);
+        sts = NrProve(ctx, msg, &rnd_bsn, sizeof(rnd_bsn), &sig->sigma0,
+                      &ctx->sig_rl->bk[i], &sig->sigma[i]);
       }
       if (kEpidNoErr != sts) {
         nr_prove_status = sts;
@@ -109,3 +102,35 @@ EpidStatus EpidSign(MemberCtx const* ctx, void const* msg, size_t msg_len,
   //      member returns "revoked", otherwise returns "succeeded".
   return kEpidNoErr;
 }
+
+EpidStatus EpidSign(MemberCtx const* ctx, void const* msg, size_t msg_len,
+                    void const* basename, size_t basename_len,
+                    EpidSignature* sig, size_t sig_len) {
+  MsgSource source;
+  EpidStatus sts = kEpidErr;
+  if (!ctx || !sig) {
+    return kEpidBadArgErr;
+  }
+  // if message is non-empty it must have both length and content
+  sts = InitMsgSourceFromBuffer(msg, msg_len, &source);
+  if (kEpidNoErr != sts) {
+    return sts;
+  }
+  return SignMsg(ctx, &source, basename, basename_len, sig, sig_len);
+}
+
+EpidStatus EpidSignFromReader(MemberCtx const* ctx, MsgReader reader,
+                              void* reader_data, size_t msg_len,
+                              void const* basename, size_t basename_len,
+                              EpidSignature* sig, size_t sig_len) {
+  MsgSource source;
+  EpidStatus sts = kEpidErr;
+  if (!ctx || !sig) {
+    return kEpidBadArgErr;
+  }
+  sts = InitMsgSourceFromReader(reader, reader_data, msg_len, &source);
+  if (kEpidNoErr != sts) {
+    return sts;
+  }
+  return SignMsg(ctx, &source, basename, basename_len, sig, sig_len);
+}
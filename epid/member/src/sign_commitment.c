@@ -29,13 +29,13 @@
 
 EpidStatus HashSignCommitment(FiniteField* Fp, HashAlg hash_alg,
                               GroupPubKey const* pub_key,
+                              FfHashState const* prefix,
                               SignCommitOutput const* commit_out,
-                              void const* msg, size_t msg_len,
-                              FpElemStr* c_str) {
+                              MsgSource* msg, FpElemStr* c_str) {
   EpidStatus sts = kEpidErr;
   FfElement* c = NULL;
 
-  if (!Fp || !commit_out || (0 != msg_len && !msg) || !c_str) {
+  if (!Fp || !commit_out || !msg || !c_str) {
     return kEpidBadArgErr;
   }
 
@@ -56,7 +56,7 @@ EpidStatus HashSignCommitment(FiniteField* Fp, HashAlg hash_alg,
     // 5.  The member computes t3 = Fp.hash(p || g1 || g2 || h1 || h2
     //     || w || B || K || T || R1 || R2).
     // 6.  The member computes c = Fp.hash(t3 || m).
-    sts = CalculateCommitmentHash(&values, Fp, hash_alg, msg, msg_len, c);
+    sts = CalculateCommitmentHash(&values, Fp, hash_alg, prefix, msg, c);
     BREAK_ON_EPID_ERROR(sts);
 
     sts = WriteFfElement(Fp, c, c_str, sizeof(*c_str));
@@ -21,6 +21,7 @@
 #include <stddef.h>
 #include "epid/common/errors.h"
 #include "epid/common/types.h"  // HashAlg
+#include "epid/common/src/msgsource.h"
 
 #pragma pack(1)
 /// Result of Sign Commit
@@ -38,6 +39,7 @@ typedef struct SignCommitOutput SignCommitOutput;
 /// \cond
 typedef struct FiniteField FiniteField;
 typedef struct FpElemStr FpElemStr;
+typedef struct FfHashState FfHashState;
 /// \endcond
 
 /// Calculates commitment hash of sign commit
@@ -49,15 +51,19 @@ typedef struct FpElemStr FpElemStr;
   \param[in] hash_alg
   The hash algorithm.
 
+  \param[in] pub_key
+  The group public key.
+
+  \param[in] prefix
+  Hash of the commit values of pub_key made with hash_alg, or NULL to
+  hash them from pub_key.
+
   \param[in] commit_out
   The output from the sign commit.
 
   \param[in] msg
   The message.
 
-  \param[in] msg_len
-  The size of message in bytes.
-
   \param[out] c_str
   The resulting commitment hash.
 
@@ -66,8 +72,8 @@ typedef struct FpElemStr FpElemStr;
  */
 EpidStatus HashSignCommitment(FiniteField* Fp, HashAlg hash_alg,
                               GroupPubKey const* pub_key,
+                              FfHashState const* prefix,
                               SignCommitOutput const* commit_out,
-                              void const* msg, size_t msg_len,
-                              FpElemStr* c_str);
+                              MsgSource* msg, FpElemStr* c_str);
 
 #endif  // EPID_MEMBER_SRC_SIGN_COMMITMENT_H_
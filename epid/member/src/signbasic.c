@@ -46,6 +46,15 @@
 EpidStatus EpidSignBasic(MemberCtx const* ctx, void const* msg, size_t msg_len,
                          void const* basename, size_t basename_len,
                          BasicSignature* sig, BigNumStr* rnd_bsn) {
+  MsgSource source;
+  EpidStatus sts = InitMsgSourceFromBuffer(msg, msg_len, &source);
+  if (kEpidNoErr != sts) return sts;
+  return SignBasic(ctx, &source, basename, basename_len, sig, rnd_bsn);
+}
+
+EpidStatus SignBasic(MemberCtx const* ctx, MsgSource* msg,
+                     void const* basename, size_t basename_len,
+                     BasicSignature* sig, BigNumStr* rnd_bsn) {
   EpidStatus sts = kEpidErr;
 
   EcPoint* B = NULL;
@@ -72,13 +81,13 @@ EpidStatus EpidSignBasic(MemberCtx const* ctx, void const* msg, size_t msg_len,
   FfElement* c = NULL;
   uint8_t* digest = NULL;
 
+  EcPoint** g1_temps[] = {&B, &t, &k, &e};
+  FfElement** fp_temps[] = {&t1, &t2, &a, &b, &rx, &ra, &rb, &t3, &c};
+  uint8_t* temps = NULL;
+
   PreComputedSignature curr_presig = {0};
 
-  if (!ctx || !sig) {
-    return kEpidBadArgErr;
-  }
-  if (!msg && (0 != msg_len)) {
-    // if message is non-empty it must have both length and content
+  if (!ctx || !msg || !sig) {
     return kEpidBadArgErr;
   }
   if (!basename && (0 != basename_len)) {
@@ -105,6 +114,12 @@ EpidStatus EpidSignBasic(MemberCtx const* ctx, void const* msg, size_t msg_len,
     size_t digest_size = 0;
     uint16_t* rf_ctr = (uint16_t*)&ctx->rf_ctr;
     FfElement const* x = ctx->x;
+    size_t g1_size = 0;
+    size_t gt_size = 0;
+    size_t fp_size = 0;
+    size_t fq_size = 0;
+    uint8_t* next = NULL;
+    size_t i = 0;
 
     if (basename) {
       if (!IsBasenameAllowed(ctx->allowed_basenames, basename, basename_len)) {
@@ -113,39 +128,43 @@ EpidStatus EpidSignBasic(MemberCtx const* ctx, void const* msg, size_t msg_len,
       }
     }
 
-    sts = NewEcPoint(G1, &B);
-    BREAK_ON_EPID_ERROR(sts);
-    sts = NewEcPoint(G1, &k);
+    // All temporaries are placed in one block
+    sts = EcPointGetSize(G1, &g1_size);
     BREAK_ON_EPID_ERROR(sts);
-    sts = NewEcPoint(G1, &t);
+    sts = FfElementGetSize(GT, &gt_size);
     BREAK_ON_EPID_ERROR(sts);
-    sts = NewEcPoint(G1, &e);
+    sts = FfElementGetSize(Fp, &fp_size);
     BREAK_ON_EPID_ERROR(sts);
-    sts = NewFfElement(GT, &R2);
+    sts = FfElementGetSize(Fq, &fq_size);
     BREAK_ON_EPID_ERROR(sts);
-    sts = NewFfElement(Fq, &p2y);
+    temps = SAFE_ALLOC(COUNT_OF(g1_temps) * g1_size + gt_size +
+                       COUNT_OF(fp_temps) * fp_size + fq_size);
+    if (!temps) {
+      sts = kEpidMemAllocErr;
+      break;
+    }
+    next = temps;
+    for (i = 0; i < COUNT_OF(g1_temps) && kEpidNoErr == sts; i++) {
+      sts = InitEcPoint(G1, next, g1_size, g1_temps[i]);
+      next += g1_size;
+    }
+    for (i = 0; i < COUNT_OF(fp_temps) && kEpidNoErr == sts; i++) {
+      sts = InitFfElement(Fp, next, fp_size, fp_temps[i]);
+      next += fp_size;
+    }
     BREAK_ON_EPID_ERROR(sts);
-    sts = NewFfElement(Fp, &t1);
+    sts = InitFfElement(GT, next, gt_size, &R2);
     BREAK_ON_EPID_ERROR(sts);
-    sts = NewFfElement(Fp, &t2);
+    next += gt_size;
+    sts = InitFfElement(Fq, next, fq_size, &p2y);
     BREAK_ON_EPID_ERROR(sts);
+
     p2x = (struct p2x_t*)SAFE_ALLOC(sizeof(struct p2x_t) + basename_len - 1);
     if (!p2x) {
       sts = kEpidMemAllocErr;
       break;
     }
 
-    sts = NewFfElement(Fp, &a);
-    BREAK_ON_EPID_ERROR(sts);
-    sts = NewFfElement(Fp, &b);
-    BREAK_ON_EPID_ERROR(sts);
-    sts = NewFfElement(Fp, &rx);
-    BREAK_ON_EPID_ERROR(sts);
-    sts = NewFfElement(Fp, &ra);
-    BREAK_ON_EPID_ERROR(sts);
-    sts = NewFfElement(Fp, &rb);
-    BREAK_ON_EPID_ERROR(sts);
-
     sts = MemberGetPreSig((MemberCtx*)ctx, &curr_presig);
     BREAK_ON_EPID_ERROR(sts);
 
@@ -246,8 +265,8 @@ EpidStatus EpidSignBasic(MemberCtx const* ctx, void const* msg, size_t msg_len,
 
     commit_out.T = curr_presig.T;
 
-    sts = HashSignCommitment(Fp, ctx->hash_alg, &ctx->pub_key, &commit_out, msg,
-                             msg_len, &c_str);
+    sts = HashSignCommitment(Fp, ctx->hash_alg, &ctx->pub_key,
+                             ctx->commit_hash_prefix, &commit_out, msg, &c_str);
     BREAK_ON_EPID_ERROR(sts);
 
     digest_size = EpidGetHashSize(ctx->hash_alg);
@@ -259,12 +278,6 @@ EpidStatus EpidSignBasic(MemberCtx const* ctx, void const* msg, size_t msg_len,
     memcpy_S(digest + digest_size - sizeof(c_str), sizeof(c_str), &c_str,
              sizeof(c_str));
 
-    sts = NewFfElement(Fp, &t3);
-    BREAK_ON_EPID_ERROR(sts);
-
-    sts = NewFfElement(Fp, &c);
-    BREAK_ON_EPID_ERROR(sts);
-
     sts = ReadFfElement(Fp, &c_str, sizeof(c_str), c);
     BREAK_ON_EPID_ERROR(sts);
 
@@ -315,25 +328,8 @@ EpidStatus EpidSignBasic(MemberCtx const* ctx, void const* msg, size_t msg_len,
 
   EpidZeroMemory(&curr_presig, sizeof(curr_presig));
 
-  DeleteEcPoint(&B);
-  DeleteEcPoint(&k);
-  DeleteEcPoint(&t);
-  DeleteEcPoint(&e);
-  DeleteFfElement(&R2);
-  DeleteFfElement(&p2y);
-  DeleteFfElement(&t1);
-  DeleteFfElement(&t2);
-
-  DeleteFfElement(&a);
-  DeleteFfElement(&b);
-  DeleteFfElement(&rx);
-  DeleteFfElement(&ra);
-  DeleteFfElement(&rb);
-
+  SAFE_FREE(temps);
   SAFE_FREE(p2x);
-
-  DeleteFfElement(&t3);
-  DeleteFfElement(&c);
   SAFE_FREE(digest);
 
   return sts;
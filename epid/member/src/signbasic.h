@@ -20,6 +20,7 @@
 
 #include <stddef.h>
 #include "epid/common/errors.h"
+#include "epid/common/src/msgsource.h"
 
 /// \cond
 typedef struct MemberCtx MemberCtx;
@@ -67,4 +68,29 @@ EpidStatus EpidSignBasic(MemberCtx const* ctx, void const* msg, size_t msg_len,
                          void const* basename, size_t basename_len,
                          BasicSignature* sig, BigNumStr* rnd_bsn);
 
+/// Creates a basic signature of a message from a message source.
+/*!
+ Same as EpidSignBasic but the message can be read in parts.
+
+ \param[in] ctx
+ The member context.
+ \param[in] msg
+ The message.
+ \param[in] basename
+ Optional basename, as for EpidSignBasic.
+ \param[in] basename_len
+ The size of basename in bytes. Must be 0 if basename is NULL.
+ \param[out] sig
+ The generated basic signature
+ \param[out] rnd_bsn
+ Random basename, can be NULL if basename is provided.
+
+ \returns ::EpidStatus
+
+ \see EpidSignBasic
+ */
+EpidStatus SignBasic(MemberCtx const* ctx, MsgSource* msg,
+                     void const* basename, size_t basename_len,
+                     BasicSignature* sig, BigNumStr* rnd_bsn);
+
 #endif  // EPID_MEMBER_SRC_SIGNBASIC_H_
@@ -87,6 +87,9 @@ EpidStatus EpidMemberStartup(MemberCtx* ctx) {
     sts = MemberReadPrecomputation(ctx, &ctx->precomp);
     BREAK_ON_EPID_ERROR(sts);
 
+    sts = UpdateCommitHashPrefixes(ctx, ctx->hash_alg);
+    BREAK_ON_EPID_ERROR(sts);
+
     sts = kEpidNoErr;
   } while (0);
 
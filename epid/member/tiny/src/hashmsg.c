@@ -0,0 +1,45 @@
+/*############################################################################
+# Copyright 2017 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+############################################################################*/
+/// Message hashing implementation
+/*! \file */
+
+#include "epid/member/tiny/src/hashmsg.h"
+
+#include "epid/member/tiny/math/hashwrap.h"
+
+/// Size of the buffer a message is read into with a MsgReader
+#define MSG_READ_CHUNK_SIZE 256
+
+EpidStatus TinyHashMsg(tiny_sha* s, TinyMsg const* msg) {
+  uint8_t chunk[MSG_READ_CHUNK_SIZE];
+  size_t offset = 0;
+  if (!msg->reader) {
+    tinysha_update(s, msg->buf, msg->len);
+    return kEpidNoErr;
+  }
+  while (offset < msg->len) {
+    size_t chunk_len = msg->len - offset;
+    if (chunk_len > sizeof(chunk)) {
+      chunk_len = sizeof(chunk);
+    }
+    if (0 != msg->reader(chunk, chunk_len, offset, msg->reader_data)) {
+      return kEpidErr;
+    }
+    tinysha_update(s, chunk, chunk_len);
+    offset += chunk_len;
+  }
+  return kEpidNoErr;
+}
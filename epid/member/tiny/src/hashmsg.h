@@ -0,0 +1,53 @@
+/*############################################################################
+# Copyright 2017 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+############################################################################*/
+/// Message hashing for sign
+/*! \file */
+
+#ifndef EPID_MEMBER_TINY_SRC_HASHMSG_H_
+#define EPID_MEMBER_TINY_SRC_HASHMSG_H_
+
+#include <stddef.h>
+
+#include "epid/common/errors.h"
+#include "epid/common/msgreader.h"
+
+/// \cond
+typedef struct tiny_sha tiny_sha;
+/// \endcond
+
+/// Message to sign, held in a buffer or read with a MsgReader
+typedef struct TinyMsg {
+  void const* buf;    ///< message buffer or NULL if reader is used
+  MsgReader reader;   ///< message reader or NULL if buf is used
+  void* reader_data;  ///< user data passed to reader
+  size_t len;         ///< size of the message in bytes
+} TinyMsg;
+
+/// Hashes a message into state
+/*!
+
+\param[in,out] s
+The hash state.
+
+\param[in] msg
+The message. A message with a reader is read in parts through a small
+stack buffer.
+
+\returns ::kEpidErr if the reader failed, ::kEpidNoErr otherwise.
+*/
+EpidStatus TinyHashMsg(tiny_sha* s, TinyMsg const* msg);
+
+#endif  // EPID_MEMBER_TINY_SRC_HASHMSG_H_
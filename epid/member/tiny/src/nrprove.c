@@ -36,6 +36,17 @@ static const EccPointFq epid20_g1 = {
 EpidStatus EpidNrProve(MemberCtx const* ctx, void const* msg, size_t msg_len,
                        NativeBasicSignature const* sig,
                        SigRlEntry const* sigrl_entry, NrProof* proof) {
+  TinyMsg tiny_msg;
+  tiny_msg.buf = msg;
+  tiny_msg.reader = NULL;
+  tiny_msg.reader_data = NULL;
+  tiny_msg.len = msg_len;
+  return EpidNrProveMsg(ctx, &tiny_msg, sig, sigrl_entry, proof);
+}
+
+EpidStatus EpidNrProveMsg(MemberCtx const* ctx, TinyMsg const* msg,
+                          NativeBasicSignature const* sig,
+                          SigRlEntry const* sigrl_entry, NrProof* proof) {
   EpidStatus sts = kEpidBadArgErr;
   FpElem mu;
   FpElem rmu;
@@ -112,7 +123,10 @@ EpidStatus EpidNrProve(MemberCtx const* ctx, void const* msg, size_t msg_len,
     tinysha_update(&sha_state, (void const*)&T_str, sizeof(T_str));
     tinysha_update(&sha_state, (void const*)&R1_str, sizeof(R1_str));
     tinysha_update(&sha_state, (void const*)&R2_str, sizeof(R2_str));
-    tinysha_update(&sha_state, msg, msg_len);
+    sts = TinyHashMsg(&sha_state, msg);
+    if (kEpidNoErr != sts) {
+      break;
+    }
     tinysha_final(digest.digest, &sha_state);
     FpFromHash(&c, digest.digest, tinysha_digest_size(&sha_state));
     // 8. The member computes smu = (rmu + c * mu) mod p.
@@ -20,6 +20,7 @@
 
 #include <stddef.h>
 #include "epid/common/errors.h"
+#include "epid/member/tiny/src/hashmsg.h"
 
 /// \cond
 typedef struct MemberCtx MemberCtx;
@@ -63,4 +64,14 @@ EpidStatus EpidNrProve(MemberCtx const* ctx, void const* msg, size_t msg_len,
                        NativeBasicSignature const* sig,
                        SigRlEntry const* sigrl_entry, NrProof* proof);
 
+/// Calculates a non-revoked proof for a message read in parts.
+/*!
+ Same as EpidNrProve() but the message can be read with a ::MsgReader.
+
+ \see EpidNrProve
+ */
+EpidStatus EpidNrProveMsg(MemberCtx const* ctx, TinyMsg const* msg,
+                          NativeBasicSignature const* sig,
+                          SigRlEntry const* sigrl_entry, NrProof* proof);
+
 #endif  // EPID_MEMBER_TINY_SRC_NRPROVE_H_
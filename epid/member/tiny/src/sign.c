@@ -43,20 +43,13 @@ size_t EPID_API EpidGetSigSize(SigRl const* sig_rl) {
   }
 }
 
-EpidStatus EPID_API EpidSign(MemberCtx const* ctx, void const* msg,
-                             size_t msg_len, void const* basename,
-                             size_t basename_len, EpidSignature* sig,
-                             size_t sig_len) {
+/// Writes a signature of a message held in a buffer or read in parts
+static EpidStatus SignMsg(MemberCtx const* ctx, TinyMsg const* msg,
+                          void const* basename, size_t basename_len,
+                          EpidSignature* sig, size_t sig_len) {
   EpidStatus sts = kEpidErr;
   OctStr32 octstr32_0 = {{0x00, 0x00, 0x00, 0x00}};
   NativeBasicSignature sigma0;
-  if (!ctx || !sig) {
-    return kEpidBadArgErr;
-  }
-  if (!msg && (0 != msg_len)) {
-    // if message is non-empty it must have both length and content
-    return kEpidBadArgErr;
-  }
   if (!ctx->is_provisioned) {
     return kEpidOutOfSequenceError;
   }
@@ -69,7 +62,7 @@ EpidStatus EPID_API EpidSign(MemberCtx const* ctx, void const* msg,
   }
 
   // 11. The member sets sigma0 = (B, K, T, c, sx, sf, sa, sb).
-  sts = EpidSignBasic(ctx, msg, msg_len, basename, basename_len, &sigma0);
+  sts = EpidSignBasicMsg(ctx, msg, basename, basename_len, &sigma0);
   if (kEpidNoErr != sts) {
     return sts;
   }
@@ -92,8 +85,8 @@ EpidStatus EPID_API EpidSign(MemberCtx const* ctx, void const* msg,
     //      will be given in the next subsection.
     num_sig_rl = be32toh(ctx->sig_rl->n2);
     for (i = 0; i < num_sig_rl; i++) {
-      sts = EpidNrProve(ctx, msg, msg_len, &sigma0, &ctx->sig_rl->bk[i],
-                        &sig->sigma[i]);
+      sts = EpidNrProveMsg(ctx, msg, &sigma0, &ctx->sig_rl->bk[i],
+                           &sig->sigma[i]);
       if (kEpidNoErr != sts) {
         nr_prove_status = sts;
       }
@@ -115,3 +108,38 @@ EpidStatus EPID_API EpidSign(MemberCtx const* ctx, void const* msg,
   //      member returns "revoked", otherwise returns "succeeded".
   return kEpidNoErr;
 }
+
+EpidStatus EPID_API EpidSign(MemberCtx const* ctx, void const* msg,
+                             size_t msg_len, void const* basename,
+                             size_t basename_len, EpidSignature* sig,
+                             size_t sig_len) {
+  TinyMsg tiny_msg;
+  if (!ctx || !sig) {
+    return kEpidBadArgErr;
+  }
+  if (!msg && (0 != msg_len)) {
+    // if message is non-empty it must have both length and content
+    return kEpidBadArgErr;
+  }
+  tiny_msg.buf = msg;
+  tiny_msg.reader = NULL;
+  tiny_msg.reader_data = NULL;
+  tiny_msg.len = msg_len;
+  return SignMsg(ctx, &tiny_msg, basename, basename_len, sig, sig_len);
+}
+
+EpidStatus EPID_API EpidSignFromReader(MemberCtx const* ctx, MsgReader reader,
+                                       void* reader_data, size_t msg_len,
+                                       void const* basename,
+                                       size_t basename_len,
+                                       EpidSignature* sig, size_t sig_len) {
+  TinyMsg tiny_msg;
+  if (!ctx || !reader || !sig) {
+    return kEpidBadArgErr;
+  }
+  tiny_msg.buf = NULL;
+  tiny_msg.reader = reader;
+  tiny_msg.reader_data = reader_data;
+  tiny_msg.len = msg_len;
+  return SignMsg(ctx, &tiny_msg, basename, basename_len, sig, sig_len);
+}
@@ -58,6 +58,17 @@ static const G1ElemStr epid20_g1_str = {
 EpidStatus EpidSignBasic(MemberCtx const* ctx, void const* msg, size_t msg_len,
                          void const* basename, size_t basename_len,
                          NativeBasicSignature* sig) {
+  TinyMsg tiny_msg;
+  tiny_msg.buf = msg;
+  tiny_msg.reader = NULL;
+  tiny_msg.reader_data = NULL;
+  tiny_msg.len = msg_len;
+  return EpidSignBasicMsg(ctx, &tiny_msg, basename, basename_len, sig);
+}
+
+EpidStatus EpidSignBasicMsg(MemberCtx const* ctx, TinyMsg const* msg,
+                            void const* basename, size_t basename_len,
+                            NativeBasicSignature* sig) {
   EpidStatus sts = kEpidErr;
   PreComputedSignatureData presig;
   tiny_sha sha_state;
@@ -135,7 +146,10 @@ EpidStatus EpidSignBasic(MemberCtx const* ctx, void const* msg, size_t msg_len,
     tinysha_init(ctx->hash_alg, &sha_state);
     FpSerialize(&fp_str, &sig->c);
     tinysha_update(&sha_state, (void const*)&fp_str, sizeof(fp_str));
-    tinysha_update(&sha_state, msg, msg_len);
+    sts = TinyHashMsg(&sha_state, msg);
+    if (kEpidNoErr != sts) {
+      break;
+    }
     tinysha_final(digest.digest, &sha_state);
 
     FpFromHash(&sig->c, digest.digest, tinysha_digest_size(&sha_state));
@@ -23,6 +23,7 @@
 
 #include "epid/common/errors.h"
 #include "epid/member/tiny/math/mathtypes.h"
+#include "epid/member/tiny/src/hashmsg.h"
 
 /// \cond
 typedef struct MemberCtx MemberCtx;
@@ -34,4 +35,9 @@ EpidStatus EpidSignBasic(MemberCtx const* ctx, void const* msg, size_t msg_len,
                          void const* basename, size_t basename_len,
                          NativeBasicSignature* sig);
 
+/// Compute Intel(R) EPID Basic Signature of a message read in parts.
+EpidStatus EpidSignBasicMsg(MemberCtx const* ctx, TinyMsg const* msg,
+                            void const* basename, size_t basename_len,
+                            NativeBasicSignature* sig);
+
 #endif  // EPID_MEMBER_TINY_SRC_SIGNBASIC_H_
@@ -89,7 +89,6 @@ EpidStatus Tpm2Commit(Tpm2Ctx* ctx, EcPoint const* p1, void const* s2,
 
   do {
     G1ElemStr point_str = {0};
-    BigNumStr r_str = {0};
     const BigNumStr kOne = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
                             0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1};
     bool is_equal = false;
@@ -131,21 +130,13 @@ EpidStatus Tpm2Commit(Tpm2Ctx* ctx, EcPoint const* p1, void const* s2,
     BREAK_ON_EPID_ERROR(sts);
     sts = InsertR(ctx, r, &ctr);
     BREAK_ON_EPID_ERROR(sts);
-    sts = WriteFfElement(Fp, r, &r_str, sizeof(r_str));
-    BREAK_ON_EPID_ERROR(sts);
     // step i: if s2 is not an Empty Buffer, set K = [ds](x2, y2) and L =
     // [r](x2, y2)
     if (s2) {
-      BigNumStr f_str = {0};
-      do {
-        sts = WriteFfElement(Fp, ctx->f, &f_str, sizeof(f_str));
-        BREAK_ON_EPID_ERROR(sts);
-        sts = EcExp(G1, point, &f_str, k);
-        BREAK_ON_EPID_ERROR(sts);
-      } while (0);
-      EpidZeroMemory(&f_str, sizeof(f_str));
+      // ds and r are used as powers without being serialized
+      sts = EcExpFp(G1, point, Fp, ctx->f, k);
       BREAK_ON_EPID_ERROR(sts);
-      sts = EcExp(G1, point, &r_str, l);
+      sts = EcExpFp(G1, point, Fp, r, l);
       BREAK_ON_EPID_ERROR(sts);
       sts = EcIsEqual(G1, k, infinity, &is_equal);
       BREAK_ON_EPID_ERROR(sts);
@@ -162,11 +153,11 @@ EpidStatus Tpm2Commit(Tpm2Ctx* ctx, EcPoint const* p1, void const* s2,
     }
     // step j: if p1 is not an Empty Point, set E = [r](p1 )
     if (p1) {
-      sts = EcExp(G1, p1, &r_str, e);
+      sts = EcExpFp(G1, p1, Fp, r, e);
       BREAK_ON_EPID_ERROR(sts);
     } else {
       // step k: if p1 is an Empty Point and s2 is an Empty Buffer, set E = [r]G
-      sts = EcExp(G1, ctx->epid2_params->g1, &r_str, e);
+      sts = EcExpFp(G1, ctx->epid2_params->g1, Fp, r, e);
       BREAK_ON_EPID_ERROR(sts);
     }
     sts = EcIsEqual(G1, e, infinity, &is_equal);
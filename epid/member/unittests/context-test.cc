@@ -146,6 +146,51 @@ TEST_F(EpidMemberTest, InitSucceedsGivenValidParametersWithNoF) {
   EpidMemberDeinit(ctx);
 }
 
+//////////////////////////////////////////////////////////////////////////
+// EpidMemberInitWithParams Tests
+TEST_F(EpidMemberTest, InitWithParamsFailsGivenNullParameters) {
+  size_t ctx_size = 0;
+  MemberCtx* ctx = nullptr;
+  Prng my_prng;
+  MemberParams params = {0};
+  EpidSharedParams* shared_params = nullptr;
+  std::vector<uint8_t> ctx_buf;
+  SetMemberParams(&Prng::Generate, &my_prng, nullptr, &params);
+  EXPECT_EQ(kEpidNoErr, EpidMemberGetSize(&params, &ctx_size));
+  ctx_buf.resize(ctx_size);
+  ctx = (MemberCtx*)&ctx_buf[0];
+  THROW_ON_EPIDERR(EpidSharedParamsCreate(&shared_params));
+
+  EXPECT_EQ(kEpidBadArgErr, EpidMemberInitWithParams(nullptr, shared_params,
+                                                     ctx));
+  EXPECT_EQ(kEpidBadArgErr, EpidMemberInitWithParams(&params, nullptr, ctx));
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidMemberInitWithParams(&params, shared_params, nullptr));
+  EpidSharedParamsDelete(&shared_params);
+}
+
+TEST_F(EpidMemberTest, InitWithParamsSharesParamsBetweenContexts) {
+  size_t ctx_size = 0;
+  Prng my_prng;
+  MemberParams params = {0};
+  EpidSharedParams* shared_params = nullptr;
+  SetMemberParams(&Prng::Generate, &my_prng, nullptr, &params);
+  EXPECT_EQ(kEpidNoErr, EpidMemberGetSize(&params, &ctx_size));
+  std::vector<uint8_t> ctx1_buf(ctx_size);
+  std::vector<uint8_t> ctx2_buf(ctx_size);
+  MemberCtx* ctx1 = (MemberCtx*)&ctx1_buf[0];
+  MemberCtx* ctx2 = (MemberCtx*)&ctx2_buf[0];
+  THROW_ON_EPIDERR(EpidSharedParamsCreate(&shared_params));
+
+  EXPECT_EQ(kEpidNoErr, EpidMemberInitWithParams(&params, shared_params, ctx1));
+  EXPECT_EQ(kEpidNoErr, EpidMemberInitWithParams(&params, shared_params, ctx2));
+  EXPECT_EQ(shared_params, ctx1->epid2_params);
+  EXPECT_EQ(shared_params, ctx2->epid2_params);
+  EpidSharedParamsDelete(&shared_params);
+  EpidMemberDeinit(ctx1);
+  EpidMemberDeinit(ctx2);
+}
+
 //////////////////////////////////////////////////////////////////////////
 // EpidMemberDelete Tests
 TEST_F(EpidMemberTest, DeleteWorksGivenNullMemberCtx) {
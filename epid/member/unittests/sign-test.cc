@@ -18,6 +18,7 @@
  * \file
  * \brief Sign unit tests.
  */
+#include <cstring>
 #include <vector>
 
 #include "epid/common-testhelper/epid_gtest-testhelper.h"
@@ -30,6 +31,7 @@ extern "C" {
 }
 
 #include "epid/common-testhelper/errors-testhelper.h"
+#include "epid/common-testhelper/mem_params-testhelper.h"
 #include "epid/common-testhelper/prng-testhelper.h"
 #include "epid/common-testhelper/verifier_wrapper-testhelper.h"
 #include "epid/member/unittests/member-testhelper.h"
@@ -1157,4 +1159,111 @@ TEST_F(EpidMemberTest, SignsMsgContainingAllPossibleBytesNoSigRl) {
             EpidVerify(ctx, sig, sig_len, msg.data(), msg.size()));
 }
 
+TEST_F(EpidMemberTest, SignsMessageGivenSharedParams) {
+  Prng my_prng;
+  MemberParams params = {0};
+  EpidSharedParams* shared_params = nullptr;
+  VerifierCtx* verifier = nullptr;
+  size_t ctx_size = 0;
+  auto& msg = this->kMsg0;
+  std::vector<uint8_t> sig_data(EpidGetSigSize(nullptr));
+  EpidSignature* sig = reinterpret_cast<EpidSignature*>(sig_data.data());
+  SetMemberParams(&Prng::Generate, &my_prng, &this->kMemberPrivateKey.f,
+                  &params);
+  THROW_ON_EPIDERR(EpidMemberGetSize(&params, &ctx_size));
+  std::vector<uint8_t> ctx_buf(ctx_size);
+  MemberCtx* member = (MemberCtx*)&ctx_buf[0];
+  THROW_ON_EPIDERR(EpidSharedParamsCreate(&shared_params));
+  THROW_ON_EPIDERR(EpidMemberInitWithParams(&params, shared_params, member));
+  THROW_ON_EPIDERR(EpidVerifierCreateWithParams(&this->kGroupPublicKey,
+                                                nullptr, shared_params,
+                                                &verifier));
+  // the contexts keep the params after the creator releases them
+  EpidSharedParamsDelete(&shared_params);
+  THROW_ON_EPIDERR(EpidProvisionKey(member, &this->kGroupPublicKey,
+                                    &this->kMemberPrivateKey, nullptr));
+  THROW_ON_EPIDERR(EpidMemberStartup(member));
+
+  EXPECT_EQ(kEpidNoErr, EpidSign(member, msg.data(), msg.size(), nullptr, 0,
+                                 sig, sig_data.size()));
+  EXPECT_EQ(kEpidSigValid,
+            EpidVerify(verifier, sig, sig_data.size(), msg.data(), msg.size()));
+  EpidVerifierDelete(&verifier);
+  EpidMemberDeinit(member);
+}
+
+/////////////////////////////////////////////////////////////////////////
+// EpidSignFromReader
+
+/// Reads a message held in a std::vector
+int __STDCALL ReadMsgFromVector(void* buf, size_t len, size_t offset,
+                                void* user_data) {
+  auto const* msg = static_cast<std::vector<uint8_t> const*>(user_data);
+  if (offset > msg->size() || len > msg->size() - offset) {
+    return -1;
+  }
+  memcpy(buf, msg->data() + offset, len);
+  return 0;
+}
+
+/// Fails every read
+int __STDCALL FailingMsgReader(void*, size_t, size_t, void*) { return -1; }
+
+TEST_F(EpidMemberTest, SignFromReaderFailsGivenNullParameters) {
+  Prng my_prng;
+  MemberCtxObj member(this->kGroupPublicKey, this->kMemberPrivateKey,
+                      this->kMemberPrecomp, &Prng::Generate, &my_prng);
+  auto msg = this->kMsg0;
+  std::vector<uint8_t> sig(EpidGetSigSize(nullptr));
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidSignFromReader(nullptr, ReadMsgFromVector, &msg, msg.size(),
+                               nullptr, 0, (EpidSignature*)sig.data(),
+                               sig.size()));
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidSignFromReader(member, nullptr, &msg, msg.size(), nullptr, 0,
+                               (EpidSignature*)sig.data(), sig.size()));
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidSignFromReader(member, ReadMsgFromVector, &msg, msg.size(),
+                               nullptr, 0, nullptr, sig.size()));
+}
+
+TEST_F(EpidMemberTest, SignFromReaderReturnsReaderError) {
+  Prng my_prng;
+  MemberCtxObj member(this->kGroupPublicKey, this->kMemberPrivateKey,
+                      this->kMemberPrecomp, &Prng::Generate, &my_prng);
+  std::vector<uint8_t> sig(EpidGetSigSize(nullptr));
+  EXPECT_EQ(kEpidErr, EpidSignFromReader(member, FailingMsgReader, nullptr,
+                                         this->kMsg0.size(), nullptr, 0,
+                                         (EpidSignature*)sig.data(),
+                                         sig.size()));
+}
+
+TEST_F(EpidMemberTest, SignsLongMessageFromReaderWithSigRl) {
+  Prng my_prng;
+  MemberCtxObj member(this->kGroupPublicKey, this->kMemberPrivateKey,
+                      this->kMemberPrecomp, &Prng::Generate, &my_prng);
+  SigRl const* srl =
+      reinterpret_cast<SigRl const*>(this->kSigRl5EntryData.data());
+  size_t srl_size = this->kSigRl5EntryData.size() * sizeof(uint8_t);
+  std::vector<uint8_t> sig_data(EpidGetSigSize(srl));
+  EpidSignature* sig = reinterpret_cast<EpidSignature*>(sig_data.data());
+  size_t sig_len = sig_data.size() * sizeof(uint8_t);
+  VerifierCtxObj ctx(this->kGroupPublicKey);
+  THROW_ON_EPIDERR(EpidVerifierSetSigRl(ctx, srl, srl_size));
+  // long enough to be read in several parts, the last one partial
+  std::vector<uint8_t> msg(100001);
+  for (size_t n = 0; n < msg.size(); n++) {
+    msg.at(n) = (uint8_t)n;
+  }
+  THROW_ON_EPIDERR(EpidMemberSetSigRl(member, srl, srl_size));
+  EXPECT_EQ(kEpidNoErr,
+            EpidSignFromReader(member, ReadMsgFromVector, &msg, msg.size(),
+                               nullptr, 0, sig, sig_len));
+  EXPECT_EQ(kEpidSigValid,
+            EpidVerify(ctx, sig, sig_len, msg.data(), msg.size()));
+  EXPECT_EQ(kEpidSigValid, EpidVerifyFromReader(ctx, sig, sig_len,
+                                                ReadMsgFromVector, &msg,
+                                                msg.size()));
+}
+
 }  // namespace
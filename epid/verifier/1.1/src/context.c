@@ -61,6 +61,19 @@ static bool Epid11IsGroupRlValid(Epid11GroupRl const* group_rl,
   }
   return true;
 }
+
+/// Internal function to find a group in a group revocation list
+static bool Epid11IsGroupInGroupRl(Epid11GroupId const* gid,
+                                   Epid11GroupRl const* group_rl) {
+  size_t grouprl_count = ntohl(group_rl->n3);
+  size_t i = 0;
+  for (i = 0; i < grouprl_count; ++i) {
+    if (0 == memcmp(gid, &group_rl->gid[i], sizeof(*gid))) {
+      return true;
+    }
+  }
+  return false;
+}
 /// Internal function to prove if signature based revocation list is valid
 bool Epid11IsSigRlValid(Epid11GroupId const* gid, Epid11SigRl const* sig_rl,
                         size_t sig_rl_size) {
@@ -159,6 +172,7 @@ EpidStatus Epid11VerifierCreate(Epid11GroupPubKey const* pub_key,
     BREAK_ON_EPID_ERROR(result);
     verifier_ctx->sig_rl = NULL;
     verifier_ctx->group_rl = NULL;
+    verifier_ctx->is_group_revoked = false;
     verifier_ctx->priv_rl = NULL;
     *ctx = verifier_ctx;
     result = kEpidNoErr;
@@ -291,6 +305,8 @@ EpidStatus Epid11VerifierSetGroupRl(Epid11VerifierCtx* ctx,
     }
   }
   ctx->group_rl = grp_rl;
+  // the list cannot change while it is set, so look the group up once
+  ctx->is_group_revoked = Epid11IsGroupInGroupRl(&ctx->pub_key->gid, grp_rl);
 
   return kEpidNoErr;
 }
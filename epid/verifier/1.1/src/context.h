@@ -36,6 +36,7 @@ struct Epid11VerifierCtx {
   Epid11PrivRl const* priv_rl;    ///< Private key based RL - not owned
   Epid11SigRl const* sig_rl;      ///< Signature based RL - not owned
   Epid11GroupRl const* group_rl;  ///< Group RL - not owned
+  bool is_group_revoked;          ///< Group is listed in group_rl
 
   Epid11Params_* epid11_params;      ///< Intel(R) EPID 1.1 params
   Epid11CommitValues commit_values;  ///< Hashed values to create commitment
@@ -28,10 +28,6 @@ static size_t Epid11GetSignatureRlCount(Epid11Signature const* sig) {
   return (!sig) ? 0 : ntohl(sig->n2);
 }
 
-static size_t Epid11GetGroupRlCount(Epid11GroupRl const* rl) {
-  return (!rl) ? 0 : ntohl(rl->n3);
-}
-
 static size_t Epid11GetSigRlCount(Epid11SigRl const* rl) {
   return (!rl) ? 0 : ntohl(rl->n2);
 }
@@ -182,13 +178,10 @@ EpidStatus Epid11Verify(Epid11VerifierCtx const* ctx,
   // Step 5. If GroupRL is provided as input,...
   if (ctx->group_rl) {
     // ...the verifier verifies that gid has not been revoked, i.e.,
-    // gid does not match any entry in Group-RL.
-    size_t grouprl_count = Epid11GetGroupRlCount(ctx->group_rl);
-    for (i = 0; i < grouprl_count; ++i) {
-      if (0 == memcmp(&ctx->pub_key->gid, &ctx->group_rl->gid[i],
-                      sizeof(ctx->pub_key->gid))) {
-        return kEpidSigRevokedInGroupRl;
-      }
+    // gid does not match any entry in Group-RL. The Group-RL is searched
+    // once when it is set.
+    if (ctx->is_group_revoked) {
+      return kEpidSigRevokedInGroupRl;
     }
   }
 
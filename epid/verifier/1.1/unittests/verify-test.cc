@@ -212,6 +212,29 @@ TEST_F(Epid11VerifierTest, VerifyRejectsFromGroupRlLastEntry) {
                          sig.size(), msg.data(), msg.size()));
 }
 
+TEST_F(Epid11VerifierTest, VerifyAcceptsSigAfterGroupRlUpdateDropsGroup) {
+  auto& pub_key = this->kPubKeyStr;
+  auto& msg = this->kMsg0;
+  auto& bsn = this->kBsn0;
+  auto& grp_rl = this->kGrpRlRevokedGrpXSingleEntry;
+  auto& sig = this->kSigGrpXMember0Sha256Bsn0Msg0;
+  // a newer list that revokes some other group instead
+  std::vector<uint8_t> new_grp_rl = grp_rl;
+  Epid11GroupRl* new_rl = reinterpret_cast<Epid11GroupRl*>(new_grp_rl.data());
+  new_rl->version.data[3]++;
+  new_rl->gid[0].data[0] ^= 0xff;
+
+  Epid11VerifierCtxObj verifier(pub_key);
+  THROW_ON_EPIDERR(Epid11VerifierSetGroupRl(
+      verifier, (Epid11GroupRl const*)grp_rl.data(), grp_rl.size()));
+  THROW_ON_EPIDERR(Epid11VerifierSetGroupRl(
+      verifier, (Epid11GroupRl const*)new_grp_rl.data(), new_grp_rl.size()));
+  THROW_ON_EPIDERR(Epid11VerifierSetBasename(verifier, bsn.data(), bsn.size()));
+  EXPECT_EQ(kEpidSigValid,
+            Epid11Verify(verifier, (Epid11Signature const*)sig.data(),
+                         sig.size(), msg.data(), msg.size()));
+}
+
 /////////////////////////////////////////////////////////////////////
 //
 //   4.1.2 step 6 - If SIG-RL is provided as input, the verifier
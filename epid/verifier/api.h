@@ -18,6 +18,8 @@
 
 #include <stddef.h>
 #include "epid/common/errors.h"
+#include "epid/common/msgreader.h"
+#include "epid/common/sharedparams.h"
 #include "epid/common/stdtypes.h"
 #include "epid/common/types.h"
 
@@ -33,6 +35,14 @@
   Defines the APIs needed by Intel(R) EPID verifiers. Each verifier
   context (::VerifierCtx) represents a verifier for a single group.
 
+  The read-only functions EpidVerify, EpidVerifyFromReader,
+  EpidVerifyBatch, EpidVerifyBasicSig, EpidNrVerify,
+  EpidCheckPrivRlEntry, EpidVerifierWritePrecomp and
+  EpidGetVerifierRlSize may be called concurrently from several threads
+  on the same context. Functions that change the context, including
+  EpidWriteVerifierRl, must not run at the same time as any other
+  function using that context.
+
   To use this module, include the header epid/verifier/api.h.
 
   \ingroup EpidModule
@@ -93,6 +103,38 @@ EpidStatus EpidVerifierCreate(GroupPubKey const* pub_key,
                               VerifierPrecomp const* precomp,
                               VerifierCtx** ctx);
 
+/// Creates a new verifier context that uses shared parameters.
+/*!
+ Same as EpidVerifierCreate(), but the context uses params rather
+ than building its own fields, curves and pairing state. This makes
+ creating many verifier contexts faster and each of them smaller.
+
+ The context holds a reference to params, so params may be released
+ with EpidSharedParamsDelete() while the context is in use.
+
+ \param[in] pub_key
+ The group certificate.
+ \param[in] precomp
+ Optional pre-computed data. If NULL the value is computed internally and is
+ readable using EpidVerifierWritePrecomp().
+ \param[in] params
+ Shared Intel(R) EPID 2.0 parameters.
+ \param[out] ctx
+ Newly constructed verifier context.
+
+ \returns ::EpidStatus
+
+ \note
+ If the result is not ::kEpidNoErr the content of ctx is undefined.
+
+ \see EpidSharedParamsCreate
+ \see EpidVerifierDelete
+ */
+EpidStatus EpidVerifierCreateWithParams(GroupPubKey const* pub_key,
+                                        VerifierPrecomp const* precomp,
+                                        EpidSharedParams* params,
+                                        VerifierCtx** ctx);
+
 /// Deletes an existing verifier context.
 /*!
  Must be called to safely release a verifier context created using
@@ -130,6 +172,82 @@ void EpidVerifierDelete(VerifierCtx** ctx);
 EpidStatus EpidVerifierWritePrecomp(VerifierCtx const* ctx,
                                     VerifierPrecomp* precomp);
 
+/// Header of a verifier pre-computation store.
+/*!
+ A pre-computation store holds the ::VerifierPrecomp of many groups in
+ one buffer, so that it can be kept in a single file and mapped into
+ memory. The header is followed by count ::VerifierPrecomp records
+ sorted by group ID in ascending byte order. Each record starts with
+ its group ID, so the records are also the index of the store.
+
+ \see EpidVerifierWritePrecompStore
+ */
+#pragma pack(1)
+typedef struct VerifierPrecompStoreHeader {
+  OctStr32 magic;    ///< "EPVP"
+  OctStr32 version;  ///< store format version, currently 1
+  OctStr32 count;    ///< number of records
+} VerifierPrecompStoreHeader;
+#pragma pack()
+
+/// Serializes pre-computed verifier settings into a pre-computation store.
+/*!
+ Writes a ::VerifierPrecompStoreHeader followed by the entries of
+ precomps sorted by group ID.
+
+ To determine the required size of the store, provide a null pointer
+ for the store.
+
+ \param[in] precomps
+ The pre-computed settings of each group, in any order.
+ \param[in] count
+ The number of entries in precomps.
+ \param[out] store
+ The pre-computation store. If NULL, store_size is filled with the
+ required size.
+ \param[in,out] store_size
+ The size of store in bytes.
+
+ \returns ::EpidStatus
+
+ \retval ::kEpidDuplicateErr
+ Two entries of precomps have the same group ID.
+
+ \see EpidVerifierFindPrecomp
+ */
+EpidStatus EpidVerifierWritePrecompStore(VerifierPrecomp const* precomps,
+                                         size_t count, void* store,
+                                         size_t* store_size);
+
+/// Finds the pre-computed verifier settings of a group in a store.
+/*!
+ Looks up gid with a binary search of the store. On success precomp
+ points into store, so it can be passed to EpidVerifierCreate without
+ copying and stays valid as long as the store does. Looking up a group
+ touches only the pages of the store that the search visits.
+
+ \param[in] store
+ A pre-computation store written by EpidVerifierWritePrecompStore, for
+ example a mapped file.
+ \param[in] store_size
+ The size of store in bytes.
+ \param[in] gid
+ The group to look up.
+ \param[out] precomp
+ The pre-computed settings of the group, or NULL if the store has no
+ entry for gid.
+
+ \returns ::EpidStatus
+
+ \retval ::kEpidBadArgErr
+ The store header is not valid or does not match store_size.
+
+ \see EpidVerifierCreate
+ */
+EpidStatus EpidVerifierFindPrecomp(void const* store, size_t store_size,
+                                   GroupId const* gid,
+                                   VerifierPrecomp const** precomp);
+
 /// Sets the private key based revocation list.
 /*!
  The caller is responsible for ensuring the revocation list is authorized,
@@ -137,6 +255,10 @@ EpidStatus EpidVerifierWritePrecomp(VerifierCtx const* ctx,
  of the revocation list. The call fails if trying to set an older version
  of the revocation list than was last set.
 
+ If a basename is set, the verifier computes B = G1.hash(bsn) raised to each
+ f in the list here and when the basename changes, so that checking a
+ signature against the list is a single lookup of K.
+
  \attention
  The memory pointed to by priv_rl is accessed directly by the verifier
  until a new list is set or the verifier is destroyed. Do not modify the
@@ -311,6 +433,10 @@ EpidStatus EpidVerifierSetHashAlg(VerifierCtx* ctx, HashAlg hash_alg);
   A successful call to this function will clear the current verifier
   blacklist.
 
+  \note
+  If a private key based revocation list is set, changing the basename
+  recomputes its lookup index, which costs one exponentiation per entry.
+
   \param[in, out] ctx
   The verifier context.
   \param[in] basename
@@ -329,6 +455,108 @@ EpidStatus EpidVerifierSetHashAlg(VerifierCtx* ctx, HashAlg hash_alg);
 EpidStatus EpidVerifierSetBasename(VerifierCtx* ctx, void const* basename,
                                    size_t basename_len);
 
+/// A unit of work handed to an ::EpidTaskRunner.
+/*!
+ \param[in] task_ctx
+ The task context passed to the runner.
+ \param[in] task_index
+ Index of the task to run, from 0 to num_tasks - 1.
+
+ \returns ::EpidStatus
+
+ \see EpidTaskRunner
+ */
+typedef EpidStatus (*EpidTask)(void* task_ctx, size_t task_index);
+
+/// Runs a set of independent tasks, possibly in parallel.
+/*!
+  The SDK provides ::EpidTaskRunner as a function prototype so that you
+  can plug your own worker pool into the verifier.
+
+  The runner must call `task(task_ctx, i)` for each `i` in
+  `[0, num_tasks)`, in any order and from any number of threads, and
+  must not return before all the calls it started have returned.
+
+  Once a task has returned a value other than ::kEpidNoErr the runner
+  may skip the tasks it has not yet started.
+
+ \param[in] task
+ The task to run.
+ \param[in] task_ctx
+ Task context to pass to each call of task.
+ \param[in] num_tasks
+ Number of tasks to run.
+ \param[in] user_data
+ User data passed along with the runner, e.g. to
+ ::EpidVerifierSetSigRlRunner.
+
+ \returns ::kEpidNoErr if every task returned ::kEpidNoErr, otherwise
+ the status returned by one of the failed tasks, or an error of the
+ runner itself.
+
+ \see EpidVerifierSetSigRlRunner
+ \see EpidVerifierSetPrivRlRunner
+ */
+typedef EpidStatus (*EpidTaskRunner)(EpidTask task, void* task_ctx,
+                                     size_t num_tasks, void* user_data);
+
+/// Sets the task runner used to check non-revoked proofs against SigRL.
+/*!
+  By default ::EpidVerify checks the non-revoked proofs for all SigRL
+  entries one after the other on the calling thread. If a runner is
+  set, ::EpidVerify hands each SigRL entry to the runner as a separate
+  task, so that the checks for large SigRLs can be spread across a
+  worker pool.
+
+  The result of ::EpidVerify does not depend on the runner: a signature
+  that fails any non-revoked proof is reported as
+  ::kEpidSigRevokedInSigRl.
+
+  \param[in, out] ctx
+  The verifier context.
+  \param[in] runner
+  The task runner. Pass NULL to check entries serially.
+  \param[in] user_data
+  User data passed to each call of runner.
+
+  \returns ::EpidStatus
+
+  \see EpidTaskRunner
+  \see EpidVerifierSetSigRl
+  \see EpidVerify
+ */
+EpidStatus EpidVerifierSetSigRlRunner(VerifierCtx* ctx, EpidTaskRunner runner,
+                                      void* user_data);
+
+/// Sets the task runner used to check signatures against PrivRL.
+/*!
+  By default ::EpidVerify checks a random base signature against all
+  PrivRL entries on the calling thread. If a runner is set, ::EpidVerify
+  splits the PrivRL into runs of consecutive entries and hands each run
+  to the runner as a separate task.
+
+  Signatures with a basename set by ::EpidVerifierSetBasename are
+  checked with a single lookup and do not use the runner.
+
+  The result of ::EpidVerify does not depend on the runner: a signature
+  that matches any PrivRL entry is reported as ::kEpidSigRevokedInPrivRl.
+
+  \param[in, out] ctx
+  The verifier context.
+  \param[in] runner
+  The task runner. Pass NULL to check entries serially.
+  \param[in] user_data
+  User data passed to each call of runner.
+
+  \returns ::EpidStatus
+
+  \see EpidTaskRunner
+  \see EpidVerifierSetPrivRl
+  \see EpidVerify
+ */
+EpidStatus EpidVerifierSetPrivRlRunner(VerifierCtx* ctx, EpidTaskRunner runner,
+                                       void* user_data);
+
 /// Verifies a signature and checks revocation status.
 /*!
  \param[in] ctx
@@ -372,6 +600,152 @@ EpidStatus EpidVerifierSetBasename(VerifierCtx* ctx, void const* basename,
 EpidStatus EpidVerify(VerifierCtx const* ctx, EpidSignature const* sig,
                       size_t sig_len, void const* msg, size_t msg_len);
 
+/// Verifies a signature of a message that is read in parts.
+/*!
+ Same as EpidVerify, but the message is read with a ::MsgReader
+ instead of being passed in a buffer, so it does not have to fit in
+ memory. The message is read once for the basic signature and once for
+ each non-revoked proof.
+
+ \param[in] ctx
+ The verifier context.
+ \param[in] sig
+ The signature.
+ \param[in] sig_len
+ The size of sig in bytes.
+ \param[in] reader
+ The message reader.
+ \param[in] reader_data
+ User data passed to each call of reader.
+ \param[in] msg_len
+ The size of the message in bytes.
+
+ \returns ::EpidStatus
+
+ \retval ::kEpidErr
+ The reader failed or a verification step failed. See EpidVerify for
+ the other values.
+
+ \see EpidVerify
+ \see MsgReader
+ */
+EpidStatus EpidVerifyFromReader(VerifierCtx const* ctx,
+                                EpidSignature const* sig, size_t sig_len,
+                                MsgReader reader, void* reader_data,
+                                size_t msg_len);
+
+/// Verifies a batch of signatures and checks their revocation status.
+/*!
+ Verifies n signatures against the same verifier context. Work that
+ depends only on the context, such as group based revocation list
+ lookup, is done once for the whole batch.
+
+ Each signature is verified individually and its result is reported
+ in the corresponding entry of results. The status written for a
+ signature is the same status EpidVerify would return for it.
+
+ \param[in] ctx
+ The verifier context.
+ \param[in] sigs
+ Array of n pointers to signatures.
+ \param[in] sig_lens
+ Array of n signature sizes in bytes.
+ \param[in] msgs
+ Array of n pointers to messages that were signed.
+ \param[in] msg_lens
+ Array of n message sizes in bytes.
+ \param[in] n
+ The number of signatures in the batch.
+ \param[out] results
+ Array of n statuses, one for each signature.
+
+ \returns ::EpidStatus
+
+ \retval ::kEpidNoErr
+ All signatures were processed and results were written. This does
+ not mean that the signatures are valid.
+
+ \note
+ If the result is not ::kEpidNoErr the content of results is undefined.
+
+ \see EpidVerify
+ */
+EpidStatus EpidVerifyBatch(VerifierCtx const* ctx,
+                           EpidSignature const* const* sigs,
+                           size_t const* sig_lens, void const* const* msgs,
+                           size_t const* msg_lens, size_t n,
+                           EpidStatus* results);
+
+/// Scratch memory for verifying signatures without heap allocation.
+typedef struct VerifierWorkspace VerifierWorkspace;
+
+/// Creates a verifier workspace.
+/*!
+ A workspace holds the temporary values used while verifying a
+ signature with EpidVerifyWithWorkspace(). It starts empty and grows to
+ fit the first signatures it is used for, after which verifying
+ similar signatures does not allocate memory on the calling thread.
+
+ A workspace is not tied to a verifier context, but it must not be used
+ by more than one thread at a time. Threads that verify signatures
+ concurrently should each use their own workspace.
+
+ \param[out] workspace
+ Newly constructed workspace.
+
+ \returns ::EpidStatus
+
+ \note
+ If the result is not ::kEpidNoErr the content of workspace is undefined.
+
+ \see EpidVerifierWorkspaceDelete
+ \see EpidVerifyWithWorkspace
+ */
+EpidStatus EpidVerifierWorkspaceCreate(VerifierWorkspace** workspace);
+
+/// Deletes an existing verifier workspace.
+/*!
+ Frees memory used by the workspace and sets the workspace pointer to
+ NULL.
+
+ \param[in,out] workspace
+ The verifier workspace. Can be NULL.
+
+ \see EpidVerifierWorkspaceCreate
+ */
+void EpidVerifierWorkspaceDelete(VerifierWorkspace** workspace);
+
+/// Verifies a signature using a workspace for temporary values.
+/*!
+ Same as EpidVerify() but takes the temporary values it needs from
+ workspace instead of the heap.
+
+ Tasks that a SigRL or PrivRL runner executes on other threads still
+ allocate their temporary values from the heap.
+
+ \param[in] ctx
+ The verifier context.
+ \param[in,out] workspace
+ The verifier workspace.
+ \param[in] sig
+ The signature.
+ \param[in] sig_len
+ The size of sig in bytes.
+ \param[in] msg
+ The message that was signed.
+ \param[in] msg_len
+ The size of msg in bytes.
+
+ \returns ::EpidStatus
+
+ \see EpidVerify
+ \see EpidVerifierWorkspaceCreate
+ */
+EpidStatus EpidVerifyWithWorkspace(VerifierCtx const* ctx,
+                                   VerifierWorkspace* workspace,
+                                   EpidSignature const* sig, size_t sig_len,
+                                   void const* msg, size_t msg_len);
+
 /// Determines if two signatures are linked.
 /*!
 
@@ -583,6 +957,316 @@ EpidStatus EpidWriteVerifierRl(VerifierCtx const* ctx, VerifierRl* ver_rl,
 EpidStatus EpidBlacklistSig(VerifierCtx* ctx, EpidSignature const* sig,
                             size_t sig_len, void const* msg, size_t msg_len);
 
+/// Verifier contexts for many groups, created on demand.
+/*!
+ A registry owns one verifier context for each group that has been used
+ recently. Groups are added with their public key and, if available,
+ their pre-computed data. A context is created the first time a group is
+ used, and the least recently used context is deleted when the registry
+ is full.
+
+ Contexts in a registry share one set of Intel(R) EPID 2.0 parameters
+ (see ::EpidSharedParams). The pre-computed data of a group is kept
+ when its context is deleted, so creating it again does not compute
+ pairings.
+
+ Every registry function may change the registry, so a registry must
+ not be used by more than one thread at a time.
+ */
+typedef struct VerifierRegistry VerifierRegistry;
+
+/// Usage counters of a ::VerifierRegistry.
+typedef struct VerifierRegistryStats {
+  uint64_t hits;       ///< Uses of a group whose context was resident
+  uint64_t misses;     ///< Uses of a group whose context had to be created
+  uint64_t evictions;  ///< Contexts deleted to make room or undo an update
+  size_t resident;     ///< Number of contexts currently resident
+  size_t groups;       ///< Number of groups added to the registry
+} VerifierRegistryStats;
+
+/// Creates a new verifier registry.
+/*!
+ \param[in] max_contexts
+ The largest number of verifier contexts to keep at a time. Must not
+ be zero.
+ \param[out] registry
+ Newly constructed verifier registry.
+
+ \returns ::EpidStatus
+
+ \see EpidRegistryDelete
+ */
+EpidStatus EpidRegistryCreate(size_t max_contexts,
+                              VerifierRegistry** registry);
+
+/// Deletes an existing verifier registry.
+/*!
+ Deletes the verifier contexts of the registry, frees memory used by
+ the registry, and sets the registry pointer to NULL.
+
+ \param[in,out] registry
+ The verifier registry. Can be NULL.
+
+ \see EpidRegistryCreate
+ */
+void EpidRegistryDelete(VerifierRegistry** registry);
+
+/// Adds a group to a verifier registry.
+/*!
+ The registry keeps copies of pub_key and precomp. Adding a group that
+ is already in the registry replaces its public key and pre-computed
+ data and deletes its verifier context. Revocation lists set for the
+ group are kept.
+
+ \param[in,out] registry
+ The verifier registry.
+ \param[in] pub_key
+ The group certificate.
+ \param[in] precomp
+ Optional pre-computed data. If NULL it is taken from the
+ pre-computation store of the registry, or computed when the group is
+ first used.
+
+ \returns ::EpidStatus
+
+ \see EpidVerifierCreate
+ */
+EpidStatus EpidRegistryAddGroup(VerifierRegistry* registry,
+                                GroupPubKey const* pub_key,
+                                VerifierPrecomp const* precomp);
+
+/// Sets the private key based revocation list of a group in a registry.
+/*!
+ The group is chosen by the group ID in priv_rl. The revocation list is
+ not copied and must stay valid while the registry is in use. If the
+ verifier context of the group is not resident, the list is applied
+ when the context is next created, so setting it does not create a
+ context.
+
+ \param[in,out] registry
+ The verifier registry.
+ \param[in] priv_rl
+ The private key based revocation list.
+ \param[in] priv_rl_size
+ The size of the private key based revocation list in bytes.
+
+ \returns ::EpidStatus
+
+ \see EpidVerifierSetPrivRl
+ */
+EpidStatus EpidRegistrySetPrivRl(VerifierRegistry* registry,
+                                 PrivRl const* priv_rl, size_t priv_rl_size);
+
+/// Sets the signature based revocation list of a group in a registry.
+/*!
+ The group is chosen by the group ID in sig_rl. The revocation list is
+ not copied and must stay valid while the registry is in use. If the
+ verifier context of the group is not resident, the list is applied
+ when the context is next created.
+
+ \param[in,out] registry
+ The verifier registry.
+ \param[in] sig_rl
+ The signature based revocation list.
+ \param[in] sig_rl_size
+ The size of the signature based revocation list in bytes.
+
+ \returns ::EpidStatus
+
+ \see EpidVerifierSetSigRl
+ */
+EpidStatus EpidRegistrySetSigRl(VerifierRegistry* registry,
+                                SigRl const* sig_rl, size_t sig_rl_size);
+
+/// Sets the verifier revocation list of a group in a registry.
+/*!
+ The group is chosen by the group ID in ver_rl. The registry keeps a
+ copy of the list and applies it to the verifier context of the group
+ each time the context is created.
+
+ A basename must be set with ::EpidRegistrySetBasename first. Setting
+ the basename or changing the hash algorithm drops the verifier
+ revocation lists of every group.
+
+ If the verifier context of the group is not resident, the basename
+ hash in the list is checked when the context is next created, and a
+ list that does not match makes the group unusable until a matching
+ list is set.
+
+ \param[in,out] registry
+ The verifier registry.
+ \param[in] ver_rl
+ The verifier revocation list.
+ \param[in] ver_rl_size
+ The size of the verifier revocation list in bytes.
+
+ \returns ::EpidStatus
+
+ \retval ::kEpidInconsistentBasenameSetErr
+ The registry has no basename.
+
+ \see EpidVerifierSetVerifierRl
+ \see EpidRegistryBlacklistSig
+ */
+EpidStatus EpidRegistrySetVerifierRl(VerifierRegistry* registry,
+                                     VerifierRl const* ver_rl,
+                                     size_t ver_rl_size);
+
+/// Sets the group based revocation list of a registry.
+/*!
+ The list applies to every group in the registry. It is not copied and
+ must stay valid while the registry is in use. Groups that are not
+ resident get the list when their verifier context is next created.
+
+ \param[in,out] registry
+ The verifier registry.
+ \param[in] grp_rl
+ The group based revocation list.
+ \param[in] grp_rl_size
+ The size of the group based revocation list in bytes.
+
+ \returns ::EpidStatus
+
+ \see EpidVerifierSetGroupRl
+ */
+EpidStatus EpidRegistrySetGroupRl(VerifierRegistry* registry,
+                                  GroupRl const* grp_rl, size_t grp_rl_size);
+
+/// Sets the hash algorithm used by every group in a registry.
+/*!
+ Changing the hash algorithm drops the verifier revocation lists of
+ every group.
+
+ \param[in,out] registry
+ The verifier registry.
+ \param[in] hash_alg
+ The hash algorithm.
+
+ \returns ::EpidStatus
+
+ \see EpidVerifierSetHashAlg
+ */
+EpidStatus EpidRegistrySetHashAlg(VerifierRegistry* registry,
+                                  HashAlg hash_alg);
+
+/// Sets the basename used by every group in a registry.
+/*!
+ Drops the verifier revocation lists of every group, as
+ ::EpidVerifierSetBasename does.
+
+ \param[in,out] registry
+ The verifier registry.
+ \param[in] basename
+ The basename. Pass NULL for random base.
+ \param[in] basename_len
+ Number of bytes in basename buffer. Must be 0 if basename is NULL.
+
+ \returns ::EpidStatus
+
+ \see EpidVerifierSetBasename
+ */
+EpidStatus EpidRegistrySetBasename(VerifierRegistry* registry,
+                                   void const* basename, size_t basename_len);
+
+/// Sets the pre-computation store of a registry.
+/*!
+ Groups added without pre-computed data take it from the store when
+ their verifier context is created. Groups that are not in the store
+ compute it instead. The store is not copied and must stay valid while
+ the registry is in use.
+
+ \param[in,out] registry
+ The verifier registry.
+ \param[in] store
+ A pre-computation store, for example a mapped file. Pass NULL to stop
+ using a store.
+ \param[in] store_size
+ The size of store in bytes. Must be 0 if store is NULL.
+
+ \returns ::EpidStatus
+
+ \see EpidVerifierWritePrecompStore
+ */
+EpidStatus EpidRegistrySetPrecompStore(VerifierRegistry* registry,
+                                       void const* store, size_t store_size);
+
+/// Verifies a signature with the verifier context of its group.
+/*!
+ Intel(R) EPID 2.0 signatures do not contain the group ID, so the
+ caller passes the group the signature claims to be from, for example
+ the group ID that came with the signature.
+
+ The verifier context of the group is created if it is not resident,
+ which may delete the least recently used context.
+
+ \param[in,out] registry
+ The verifier registry.
+ \param[in] gid
+ The group of the signer. Must have been added to the registry.
+ \param[in] sig
+ The signature.
+ \param[in] sig_len
+ The size of sig in bytes.
+ \param[in] msg
+ The message that was signed.
+ \param[in] msg_len
+ The size of msg in bytes.
+
+ \returns ::EpidStatus
+
+ \retval ::kEpidBadArgErr
+ gid has not been added to the registry.
+
+ \see EpidVerify
+ */
+EpidStatus EpidRegistryVerify(VerifierRegistry* registry, GroupId const* gid,
+                              EpidSignature const* sig, size_t sig_len,
+                              void const* msg, size_t msg_len);
+
+/// Adds a valid name-based signature to the blacklist of its group.
+/*!
+ The verifier context of the group is created if it is not resident.
+ The registry keeps a copy of the updated list, so the signature stays
+ revoked when the context is deleted and created again.
+
+ \param[in,out] registry
+ The verifier registry.
+ \param[in] gid
+ The group of the signer. Must have been added to the registry.
+ \param[in] sig
+ The name-based signature to revoke.
+ \param[in] sig_len
+ The size of sig in bytes.
+ \param[in] msg
+ The message that was signed.
+ \param[in] msg_len
+ The size of msg in bytes.
+
+ \returns ::EpidStatus
+
+ \retval ::kEpidBadArgErr
+ gid has not been added to the registry.
+
+ \see EpidBlacklistSig
+ \see EpidRegistrySetVerifierRl
+ */
+EpidStatus EpidRegistryBlacklistSig(VerifierRegistry* registry,
+                                    GroupId const* gid,
+                                    EpidSignature const* sig, size_t sig_len,
+                                    void const* msg, size_t msg_len);
+
+/// Gets the usage counters of a verifier registry.
+/*!
+ \param[in] registry
+ The verifier registry.
+ \param[out] stats
+ The usage counters.
+
+ \returns ::EpidStatus
+ */
+EpidStatus EpidRegistryGetStats(VerifierRegistry const* registry,
+                                VerifierRegistryStats* stats);
+
 /*! @} */
 
 #endif  // EPID_VERIFIER_API_H_
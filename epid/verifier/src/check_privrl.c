@@ -0,0 +1,162 @@
+/*############################################################################
+  # Copyright 2016-2017 Intel Corporation
+  #
+  # Licensed under the Apache License, Version 2.0 (the "License");
+  # you may not use this file except in compliance with the License.
+  # You may obtain a copy of the License at
+  #
+  #     http://www.apache.org/licenses/LICENSE-2.0
+  #
+  # Unless required by applicable law or agreed to in writing, software
+  # distributed under the License is distributed on an "AS IS" BASIS,
+  # WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  # See the License for the specific language governing permissions and
+  # limitations under the License.
+  ############################################################################*/
+
+/*!
+ * \file
+ * \brief EpidCheckPrivRl implementation.
+ */
+
+#include "epid/verifier/src/check_privrl.h"
+#include "epid/common/src/endian_convert.h"
+#include "epid/verifier/api.h"
+#include "epid/verifier/src/context.h"
+
+/// Handle SDK Error with Break
+#define BREAK_ON_EPID_ERROR(ret) \
+  if (kEpidNoErr != (ret)) {     \
+    break;                       \
+  }
+
+/// Smallest PrivRL for which a table of B pays for itself
+#define PRIVRL_TABLE_MIN_COUNT (5)
+
+/// Number of PrivRL entries checked by one runner task
+#define PRIVRL_ENTRIES_PER_TASK (64)
+
+/// Values of a signature shared by the checks of all PrivRL entries
+typedef struct PrivRlScan {
+  VerifierCtx const* ctx;       ///< verifier context
+  EcPoint const* b;             ///< B of the signature
+  EcPoint const* k;             ///< K of the signature
+  EcPointTable const* b_table;  ///< multiples of B, can be NULL
+  size_t count;                 ///< number of PrivRL entries
+} PrivRlScan;
+
+/// Checks PrivRL entries [begin, end) against the signature
+static EpidStatus ScanPrivRl(PrivRlScan const* scan, size_t begin,
+                             size_t end) {
+  EpidStatus result = kEpidErr;
+  EcGroup* G1 = scan->ctx->epid2_params->G1;
+  FiniteField* Fp = scan->ctx->epid2_params->Fp;
+  FfElement* ff_elem = NULL;
+  EcPoint* t4 = NULL;
+  do {
+    size_t i = 0;
+    result = NewFfElement(Fp, &ff_elem);
+    BREAK_ON_EPID_ERROR(result);
+    result = NewEcPoint(G1, &t4);
+    BREAK_ON_EPID_ERROR(result);
+    for (i = begin; i < end; i++) {
+      BigNumStr const* f = (BigNumStr const*)&scan->ctx->priv_rl->f[i];
+      bool compare_result = false;
+      // ReadFfElement checks that the value f is in the field
+      result = ReadFfElement(Fp, f, sizeof(*f), ff_elem);
+      BREAK_ON_EPID_ERROR(result);
+      // t4 = G1.exp(B, f[i])
+      if (scan->b_table) {
+        EcPointTable const* b_table = scan->b_table;
+        result = EcMultiExpTable(G1, &b_table, &f, 1, t4);
+      } else {
+        result = EcExp(G1, scan->b, f, t4);
+      }
+      BREAK_ON_EPID_ERROR(result);
+      result = EcIsEqual(G1, t4, scan->k, &compare_result);
+      BREAK_ON_EPID_ERROR(result);
+      // if t4 == k, sig revoked in PrivRl
+      if (compare_result) {
+        result = kEpidSigRevokedInPrivRl;
+        break;
+      }
+    }
+  } while (0);
+  DeleteEcPoint(&t4);
+  DeleteFfElement(&ff_elem);
+  if (kEpidNoErr != result) {
+    return kEpidSigRevokedInPrivRl;
+  }
+  return kEpidNoErr;
+}
+
+/// Checks one run of PrivRL entries
+static EpidStatus ScanPrivRlTask(void* task_ctx, size_t task_index) {
+  PrivRlScan const* scan = (PrivRlScan const*)task_ctx;
+  size_t begin = task_index * PRIVRL_ENTRIES_PER_TASK;
+  size_t end = begin + PRIVRL_ENTRIES_PER_TASK;
+  if (end > scan->count) {
+    end = scan->count;
+  }
+  return ScanPrivRl(scan, begin, end);
+}
+
+EpidStatus EpidCheckPrivRl(VerifierCtx const* ctx, BasicSignature const* sig) {
+  // as with EpidCheckPrivRlEntry, a signature that cannot be checked is
+  // treated as revoked
+  EpidStatus result = kEpidSigRevokedInPrivRl;
+  EpidStatus sts = kEpidErr;
+  EcPoint* b = NULL;
+  EcPoint* k = NULL;
+  EcPointTable* b_table = NULL;
+  if (!ctx || !sig) {
+    return kEpidBadArgErr;
+  }
+  if (!ctx->priv_rl) {
+    return kEpidNoErr;
+  }
+  if (!ctx->epid2_params || !ctx->epid2_params->G1 ||
+      !ctx->epid2_params->Fp) {
+    return kEpidBadArgErr;
+  }
+  do {
+    EcGroup* G1 = ctx->epid2_params->G1;
+    size_t num_tasks = 0;
+    PrivRlScan scan;
+    scan.ctx = ctx;
+    scan.count = ntohl(ctx->priv_rl->n1);
+    if (0 == scan.count) {
+      result = kEpidNoErr;
+      break;
+    }
+    sts = NewEcPoint(G1, &b);
+    BREAK_ON_EPID_ERROR(sts);
+    sts = NewEcPoint(G1, &k);
+    BREAK_ON_EPID_ERROR(sts);
+    sts = ReadEcPoint(G1, &sig->B, sizeof(sig->B), b);
+    BREAK_ON_EPID_ERROR(sts);
+    sts = ReadEcPoint(G1, &sig->K, sizeof(sig->K), k);
+    BREAK_ON_EPID_ERROR(sts);
+    if (scan.count >= PRIVRL_TABLE_MIN_COUNT) {
+      sts = NewEcPointTable(G1, b, &b_table);
+      BREAK_ON_EPID_ERROR(sts);
+    }
+    scan.b = b;
+    scan.k = k;
+    scan.b_table = b_table;
+    num_tasks = (scan.count + PRIVRL_ENTRIES_PER_TASK - 1) /
+                PRIVRL_ENTRIES_PER_TASK;
+    if (ctx->priv_rl_runner && num_tasks > 1) {
+      // failed tasks report kEpidSigRevokedInPrivRl, so any other status
+      // comes from the runner itself
+      result = ctx->priv_rl_runner(ScanPrivRlTask, &scan, num_tasks,
+                                   ctx->priv_rl_runner_data);
+    } else {
+      result = ScanPrivRl(&scan, 0, scan.count);
+    }
+  } while (0);
+  DeleteEcPointTable(&b_table);
+  DeleteEcPoint(&k);
+  DeleteEcPoint(&b);
+  return result;
+}
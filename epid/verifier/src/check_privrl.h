@@ -0,0 +1,57 @@
+/*############################################################################
+  # Copyright 2016-2017 Intel Corporation
+  #
+  # Licensed under the Apache License, Version 2.0 (the "License");
+  # you may not use this file except in compliance with the License.
+  # You may obtain a copy of the License at
+  #
+  #     http://www.apache.org/licenses/LICENSE-2.0
+  #
+  # Unless required by applicable law or agreed to in writing, software
+  # distributed under the License is distributed on an "AS IS" BASIS,
+  # WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  # See the License for the specific language governing permissions and
+  # limitations under the License.
+  ############################################################################*/
+/// Private key based revocation check internal interface.
+/*! \file */
+#ifndef EPID_VERIFIER_SRC_CHECK_PRIVRL_H_
+#define EPID_VERIFIER_SRC_CHECK_PRIVRL_H_
+
+#include "epid/common/errors.h"
+
+/// \cond
+typedef struct VerifierCtx VerifierCtx;
+typedef struct BasicSignature BasicSignature;
+/// \endcond
+
+/// Checks a basic signature against every entry of the PrivRL.
+/*!
+ Computes t4 = G1.exp(B, f[i]) for each entry of the private key based
+ revocation list set in the verifier and checks that G1.isEqual(t4, K) =
+ false.
+
+ B and K are decoded once per call, and for larger lists the powers of B
+ are computed from a fixed-base table built once per call. If the
+ verifier has a PrivRL runner the entries are split across tasks.
+
+ \param[in] ctx
+ The verifier context.
+ \param[in] sig
+ The basic signature.
+
+ \returns ::EpidStatus
+
+ \retval ::kEpidNoErr
+ Signature does not match any entry or no PrivRL is set
+ \retval ::kEpidSigRevokedInPrivRl
+ Signature matches an entry, or an entry could not be checked
+
+ Any other status is an error of the PrivRL runner.
+
+ \see EpidCheckPrivRlEntry
+ \see EpidVerifierSetPrivRlRunner
+ */
+EpidStatus EpidCheckPrivRl(VerifierCtx const* ctx, BasicSignature const* sig);
+
+#endif  // EPID_VERIFIER_SRC_CHECK_PRIVRL_H_
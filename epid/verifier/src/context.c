@@ -25,6 +25,7 @@
 #include "epid/common/src/epid2params.h"
 #include "epid/common/src/memory.h"
 #include "epid/common/src/sigrlvalid.h"
+#include "epid/verifier/src/rlvalid.h"
 #include "epid/verifier/api.h"
 
 /// Handle SDK Error with Break
@@ -32,6 +33,10 @@
   if (kEpidNoErr != (ret)) {     \
     break;                       \
   }
+
+/// Count of elements in array
+#define COUNT_OF(A) (sizeof(A) / sizeof((A)[0]))
+
 /// create Verifier precomp of the VerifierCtx
 static EpidStatus DoPrecomputation(VerifierCtx* ctx);
 
@@ -39,81 +44,75 @@ static EpidStatus DoPrecomputation(VerifierCtx* ctx);
 static EpidStatus ReadPrecomputation(VerifierPrecomp const* precomp_str,
                                      VerifierCtx* ctx);
 
-/// Internal function to prove if group based revocation list is valid
-static bool IsGroupRlValid(GroupRl const* group_rl, size_t grp_rl_size) {
-  const size_t kMinGroupRlSize = sizeof(GroupRl) - sizeof(GroupId);
-  size_t input_grp_rl_size = 0;
+/// Creates the comb tables of e12, e22, e2w and eg12
+static EpidStatus CreateGtTables(VerifierCtx* ctx);
 
-  if (!group_rl || grp_rl_size < kMinGroupRlSize) {
-    return false;
-  }
-  if (ntohl(group_rl->n3) > (SIZE_MAX - kMinGroupRlSize) / sizeof(GroupId)) {
-    return false;
-  }
-  input_grp_rl_size = kMinGroupRlSize + (ntohl(group_rl->n3) * sizeof(GroupId));
-  if (input_grp_rl_size != grp_rl_size) {
-    return false;
-  }
-  return true;
-}
+/// Deletes the comb tables of e12, e22, e2w and eg12
+static void DeleteGtTables(VerifierCtx* ctx);
 
-/// Internal function to verify if private key based revocation list is valid
-static bool IsPrivRlValid(GroupId const* gid, PrivRl const* priv_rl,
-                          size_t priv_rl_size) {
-  const size_t kMinPrivRlSize = sizeof(PrivRl) - sizeof(FpElemStr);
-  size_t input_priv_rl_size = 0;
+/// Rebuild the PrivRL index for the basename of the VerifierCtx
+static void UpdatePrivRlIndex(VerifierCtx* ctx);
 
-  if (!gid || !priv_rl || kMinPrivRlSize > priv_rl_size) {
-    return false;
-  }
-  if (ntohl(priv_rl->n1) >
-      (SIZE_MAX - kMinPrivRlSize) / sizeof(priv_rl->f[0])) {
-    return false;
-  }
-  // sanity check of input PrivRl size
-  input_priv_rl_size =
-      kMinPrivRlSize + ntohl(priv_rl->n1) * sizeof(priv_rl->f[0]);
-  if (input_priv_rl_size != priv_rl_size) {
-    return false;
-  }
-  // verify that gid given and gid in PrivRl match
-  if (0 != memcmp(gid, &priv_rl->gid, sizeof(*gid))) {
-    return false;
+/// Hashes the commit values that do not change between signatures
+static EpidStatus UpdateCommitHashPrefixes(VerifierCtx* ctx,
+                                           HashAlg hash_alg);
+
+/// Internal function to find a group in a group revocation list
+static bool IsGroupInGroupRl(GroupId const* gid, GroupRl const* group_rl) {
+  size_t grouprl_count = ntohl(group_rl->n3);
+  size_t i = 0;
+  for (i = 0; i < grouprl_count; ++i) {
+    if (0 == memcmp(gid, &group_rl->gid[i], sizeof(*gid))) {
+      return true;
+    }
   }
-  return true;
+  return false;
 }
 
-/// Internal function to verify if verifier revocation list is valid
-static bool IsVerifierRlValid(GroupId const* gid, VerifierRl const* ver_rl,
-                              size_t ver_rl_size) {
-  const size_t kMinVerifierRlSize = sizeof(VerifierRl) - sizeof(G1ElemStr);
-  size_t expected_verifier_rl_size = 0;
+/// Smallest number of K a growing verifier revocation list has room for
+#define VERIFIER_RL_MIN_CAPACITY ((size_t)16)
 
-  if (!gid || !ver_rl || kMinVerifierRlSize > ver_rl_size) {
-    return false;
-  }
-  if (ntohl(ver_rl->n4) >
-      (SIZE_MAX - kMinVerifierRlSize) / sizeof(ver_rl->K[0])) {
-    return false;
+/// Frees the verifier revocation list and its index
+static void DeleteVerifierRl(VerifierCtx* ctx) {
+  SAFE_FREE(ctx->verifier_rl);
+  ctx->verifier_rl_capacity = 0;
+  DeleteHashSet(&ctx->verifier_rl_index);
+}
+
+/// Makes room for one more K in the verifier revocation list
+static EpidStatus ReserveVerifierRlEntry(VerifierCtx* ctx) {
+  const size_t kEmptyVerifierRlSize =
+      sizeof(VerifierRl) - sizeof(ctx->verifier_rl->K[0]);
+  size_t n4 = ntohl(ctx->verifier_rl->n4);
+  size_t capacity = ctx->verifier_rl_capacity;
+  VerifierRl* verifier_rl = NULL;
+  if (n4 < capacity) {
+    return kEpidNoErr;
   }
-  // sanity check of input VerifierRl size
-  expected_verifier_rl_size =
-      kMinVerifierRlSize + ntohl(ver_rl->n4) * sizeof(ver_rl->K[0]);
-  if (expected_verifier_rl_size != ver_rl_size) {
-    return false;
+  // grow geometrically so that blacklisting n signatures copies O(n) bytes
+  if (capacity < VERIFIER_RL_MIN_CAPACITY) {
+    capacity = VERIFIER_RL_MIN_CAPACITY;
+  } else if (capacity > (SIZE_MAX - kEmptyVerifierRlSize) /
+                            sizeof(ctx->verifier_rl->K[0]) / 2) {
+    return kEpidMemAllocErr;
+  } else {
+    capacity *= 2;
   }
-
-  // verify that gid in public key and gid in SigRl match
-  if (0 != memcmp(gid, &ver_rl->gid, sizeof(*gid))) {
-    return false;
+  verifier_rl = SAFE_REALLOC(
+      ctx->verifier_rl,
+      kEmptyVerifierRlSize + capacity * sizeof(ctx->verifier_rl->K[0]));
+  if (!verifier_rl) {
+    return kEpidMemAllocErr;
   }
-
-  return true;
+  ctx->verifier_rl = verifier_rl;
+  ctx->verifier_rl_capacity = capacity;
+  return kEpidNoErr;
 }
 
-EpidStatus EpidVerifierCreate(GroupPubKey const* pubkey,
-                              VerifierPrecomp const* precomp,
-                              VerifierCtx** ctx) {
+/// Creates a verifier context that uses params, or its own if NULL
+static EpidStatus CreateVerifier(GroupPubKey const* pubkey,
+                                 VerifierPrecomp const* precomp,
+                                 Epid2Params_* params, VerifierCtx** ctx) {
   EpidStatus result = kEpidErr;
   VerifierCtx* verifier_ctx = NULL;
   if (!pubkey || !ctx) {
@@ -134,9 +133,13 @@ EpidStatus EpidVerifierCreate(GroupPubKey const* pubkey,
 #endif
 
     // Internal representation of Epid2Params
-    result = CreateEpid2Params(&verifier_ctx->epid2_params);
-    if (kEpidNoErr != result) {
-      break;
+    if (params) {
+      verifier_ctx->epid2_params = ShareEpid2Params(params);
+    } else {
+      result = CreateEpid2Params(&verifier_ctx->epid2_params);
+      if (kEpidNoErr != result) {
+        break;
+      }
     }
     // Internal representation of Group Pub Key
     result = CreateGroupPubKey(pubkey, verifier_ctx->epid2_params->G1,
@@ -150,6 +153,10 @@ EpidStatus EpidVerifierCreate(GroupPubKey const* pubkey,
     if (kEpidNoErr != result) {
       break;
     }
+    result = UpdateCommitHashPrefixes(verifier_ctx, verifier_ctx->hash_alg);
+    if (kEpidNoErr != result) {
+      break;
+    }
     // Allocate verifier_ctx->e12
     result = NewFfElement(verifier_ctx->epid2_params->GT, &verifier_ctx->e12);
     if (kEpidNoErr != result) {
@@ -179,49 +186,121 @@ EpidStatus EpidVerifierCreate(GroupPubKey const* pubkey,
     if (kEpidNoErr != result) {
       break;
     }
+    result = CreateGtTables(verifier_ctx);
+    if (kEpidNoErr != result) {
+      break;
+    }
+    // Miller loop lines of g2 and w for the pairing of EpidVerify
+    result = NewPreparedG2(verifier_ctx->epid2_params->pairing_state,
+                           verifier_ctx->epid2_params->g2,
+                           &verifier_ctx->g2_prepared);
+    if (kEpidNoErr != result) {
+      break;
+    }
+    result = NewPreparedG2(verifier_ctx->epid2_params->pairing_state,
+                           verifier_ctx->pub_key->w, &verifier_ctx->w_prepared);
+    if (kEpidNoErr != result) {
+      break;
+    }
     verifier_ctx->sig_rl = NULL;
     verifier_ctx->group_rl = NULL;
+    verifier_ctx->is_group_revoked = false;
     verifier_ctx->priv_rl = NULL;
     verifier_ctx->verifier_rl = NULL;
+    verifier_ctx->verifier_rl_capacity = 0;
+    verifier_ctx->verifier_rl_index = NULL;
     verifier_ctx->was_verifier_rl_updated = false;
     verifier_ctx->basename_hash = NULL;
     verifier_ctx->basename = NULL;
     verifier_ctx->basename_len = 0;
+    verifier_ctx->priv_rl_index = NULL;
     *ctx = verifier_ctx;
     result = kEpidNoErr;
   } while (0);
 
   if (kEpidNoErr != result && verifier_ctx) {
+    DeletePreparedG2(&verifier_ctx->w_prepared);
+    DeletePreparedG2(&verifier_ctx->g2_prepared);
+    DeleteGtTables(verifier_ctx);
     DeleteFfElement(&verifier_ctx->eg12);
     DeleteFfElement(&verifier_ctx->e2w);
     DeleteFfElement(&verifier_ctx->e22);
     DeleteFfElement(&verifier_ctx->e12);
     DeleteEpid2Params(&verifier_ctx->epid2_params);
     DeleteGroupPubKey(&verifier_ctx->pub_key);
+    DeleteFfHashState(&verifier_ctx->nr_commit_hash_prefix);
+    DeleteFfHashState(&verifier_ctx->commit_hash_prefix);
     SAFE_FREE(verifier_ctx);
   }
   return result;
 }
 
+EpidStatus EpidVerifierCreate(GroupPubKey const* pubkey,
+                              VerifierPrecomp const* precomp,
+                              VerifierCtx** ctx) {
+  return CreateVerifier(pubkey, precomp, NULL, ctx);
+}
+
+EpidStatus EpidVerifierCreateWithParams(GroupPubKey const* pubkey,
+                                        VerifierPrecomp const* precomp,
+                                        EpidSharedParams* params,
+                                        VerifierCtx** ctx) {
+  if (!params) {
+    return kEpidBadArgErr;
+  }
+  return CreateVerifier(pubkey, precomp, params, ctx);
+}
+
 void EpidVerifierDelete(VerifierCtx** ctx) {
   if (ctx && *ctx) {
+    DeletePreparedG2(&(*ctx)->w_prepared);
+    DeletePreparedG2(&(*ctx)->g2_prepared);
+    DeleteGtTables(*ctx);
     DeleteFfElement(&(*ctx)->eg12);
     DeleteFfElement(&(*ctx)->e2w);
     DeleteFfElement(&(*ctx)->e22);
     DeleteFfElement(&(*ctx)->e12);
     DeleteGroupPubKey(&(*ctx)->pub_key);
     DeleteEpid2Params(&(*ctx)->epid2_params);
+    DeleteFfHashState(&(*ctx)->nr_commit_hash_prefix);
+    DeleteFfHashState(&(*ctx)->commit_hash_prefix);
     (*ctx)->priv_rl = NULL;
     (*ctx)->sig_rl = NULL;
     (*ctx)->group_rl = NULL;
-    SAFE_FREE((*ctx)->verifier_rl);
+    DeleteVerifierRl(*ctx);
     DeleteEcPoint(&(*ctx)->basename_hash);
     SAFE_FREE((*ctx)->basename);
     (*ctx)->basename_len = 0;
+    DeleteHashSet(&(*ctx)->priv_rl_index);
     SAFE_FREE(*ctx);
   }
 }
 
+EpidStatus EpidVerifierWorkspaceCreate(VerifierWorkspace** workspace) {
+  VerifierWorkspace* new_workspace = NULL;
+  if (!workspace) {
+    return kEpidBadArgErr;
+  }
+  new_workspace = SAFE_ALLOC(sizeof(VerifierWorkspace));
+  if (!new_workspace) {
+    return kEpidMemAllocErr;
+  }
+  new_workspace->arena = CreateMemoryArena();
+  if (!new_workspace->arena) {
+    SAFE_FREE(new_workspace);
+    return kEpidMemAllocErr;
+  }
+  *workspace = new_workspace;
+  return kEpidNoErr;
+}
+
+void EpidVerifierWorkspaceDelete(VerifierWorkspace** workspace) {
+  if (workspace && *workspace) {
+    DeleteMemoryArena(&(*workspace)->arena);
+    SAFE_FREE(*workspace);
+  }
+}
+
 EpidStatus EpidVerifierWritePrecomp(VerifierCtx const* ctx,
                                     VerifierPrecomp* precomp) {
   EpidStatus result = kEpidErr;
@@ -284,6 +363,7 @@ EpidStatus EpidVerifierSetPrivRl(VerifierCtx* ctx, PrivRl const* priv_rl,
     }
   }
   ctx->priv_rl = priv_rl;
+  UpdatePrivRlIndex(ctx);
   return kEpidNoErr;
 }
 
@@ -329,6 +409,8 @@ EpidStatus EpidVerifierSetGroupRl(VerifierCtx* ctx, GroupRl const* grp_rl,
     }
   }
   ctx->group_rl = grp_rl;
+  // the list cannot change while it is set, so look the group up once
+  ctx->is_group_revoked = IsGroupInGroupRl(&ctx->pub_key->gid, grp_rl);
 
   return kEpidNoErr;
 }
@@ -336,10 +418,13 @@ EpidStatus EpidVerifierSetGroupRl(VerifierCtx* ctx, GroupRl const* grp_rl,
 EpidStatus EpidVerifierSetVerifierRl(VerifierCtx* ctx, VerifierRl const* ver_rl,
                                      size_t ver_rl_size) {
   VerifierRl* verifier_rl = NULL;
+  HashSet* verifier_rl_index = NULL;
   EpidStatus res = kEpidErr;
   EcPoint* B = NULL;
   bool cmp_result = false;
   EcGroup* G1 = NULL;
+  size_t n4 = 0;
+  size_t i = 0;
   if (!ctx || !ver_rl || !ctx->pub_key || !ctx->epid2_params ||
       !ctx->epid2_params->G1) {
     return kEpidBadArgErr;
@@ -383,13 +468,30 @@ EpidStatus EpidVerifierSetVerifierRl(VerifierCtx* ctx, VerifierRl const* ver_rl,
       res = kEpidBadArgErr;
       break;
     }
+    n4 = ntohl(ver_rl->n4);
+    if (!CreateHashSet(sizeof(ver_rl->K[0]), n4, &verifier_rl_index)) {
+      res = kEpidMemAllocErr;
+      break;
+    }
+    for (i = 0; i < n4; i++) {
+      if (!HashSetInsert(verifier_rl_index, &ver_rl->K[i])) {
+        res = kEpidMemAllocErr;
+        break;
+      }
+    }
+    BREAK_ON_EPID_ERROR(res);
     res = kEpidNoErr;
   } while (0);
   DeleteEcPoint(&B);
-  SAFE_FREE(ctx->verifier_rl);
+  DeleteVerifierRl(ctx);
   if (kEpidNoErr == res) {
     ctx->verifier_rl = verifier_rl;
+    ctx->verifier_rl_capacity = n4;
+    ctx->verifier_rl_index = verifier_rl_index;
     ctx->was_verifier_rl_updated = false;
+  } else {
+    SAFE_FREE(verifier_rl);
+    DeleteHashSet(&verifier_rl_index);
   }
   return res;
 }
@@ -448,6 +550,7 @@ EpidStatus EpidBlacklistSig(VerifierCtx* ctx, EpidSignature const* sig,
                             size_t sig_len, void const* msg, size_t msg_len) {
   EpidStatus result = kEpidErr;
   VerifierRl* ver_rl = NULL;
+  bool is_new_rl = false;
   if (!ctx || !sig || (!msg && msg_len > 0) || !ctx->epid2_params ||
       !ctx->epid2_params->G1) {
     return kEpidBadArgErr;
@@ -461,11 +564,14 @@ EpidStatus EpidBlacklistSig(VerifierCtx* ctx, EpidSignature const* sig,
 
   do {
     EcGroup* G1 = ctx->epid2_params->G1;
+    uint32_t prior_rl_version = 0;
     uint32_t n4 = 0;
     result = EpidVerify(ctx, sig, sig_len, msg, msg_len);
     BREAK_ON_EPID_ERROR(result);
 
     if (!ctx->verifier_rl) {
+      HashSet* verifier_rl_index = NULL;
+      is_new_rl = true;
       ver_rl = SAFE_ALLOC(sizeof(VerifierRl));
       if (!ver_rl) {
         result = kEpidMemAllocErr;
@@ -476,32 +582,40 @@ EpidStatus EpidBlacklistSig(VerifierCtx* ctx, EpidSignature const* sig,
       result =
           WriteEcPoint(G1, ctx->basename_hash, &(ver_rl->B), sizeof(ver_rl->B));
       BREAK_ON_EPID_ERROR(result);
-    } else {
-      uint32_t prior_rl_version = ntohl(ctx->verifier_rl->version);
-      n4 = ntohl(ctx->verifier_rl->n4);
-
-      if (prior_rl_version == UINT32_MAX || n4 == UINT32_MAX) {
-        result = kEpidBadArgErr;
-        break;
-      }
-      ver_rl = SAFE_REALLOC(
-          ctx->verifier_rl,
-          EpidGetVerifierRlSize(ctx) + sizeof(((VerifierRl*)0)->K[0]));
-      if (!ver_rl) {
+      if (!CreateHashSet(sizeof(ver_rl->K[0]), 0, &verifier_rl_index)) {
         result = kEpidMemAllocErr;
         break;
       }
+      ctx->verifier_rl = ver_rl;
+      ctx->verifier_rl_capacity = 1;
+      ctx->verifier_rl_index = verifier_rl_index;
+      ver_rl = NULL;
+    }
+    prior_rl_version = ntohl(ctx->verifier_rl->version);
+    n4 = ntohl(ctx->verifier_rl->n4);
+    if (prior_rl_version == UINT32_MAX || n4 == UINT32_MAX) {
+      result = kEpidBadArgErr;
+      break;
+    }
+    result = ReserveVerifierRlEntry(ctx);
+    BREAK_ON_EPID_ERROR(result);
+    if (!HashSetInsert(ctx->verifier_rl_index, &sig->sigma0.K)) {
+      result = kEpidMemAllocErr;
+      break;
     }
 
     ctx->was_verifier_rl_updated = true;
     ++n4;
-    ver_rl->K[n4 - 1] = sig->sigma0.K;
+    ctx->verifier_rl->K[n4 - 1] = sig->sigma0.K;
 
-    *((uint32_t*)(&ver_rl->n4)) = htonl(n4);
-    ctx->verifier_rl = ver_rl;
+    *((uint32_t*)(&ctx->verifier_rl->n4)) = htonl(n4);
     result = kEpidNoErr;
   } while (0);
-  if (kEpidNoErr != result) SAFE_FREE(ver_rl);
+  if (kEpidNoErr != result && is_new_rl) {
+    // do not keep an empty list that was only created for this call
+    DeleteVerifierRl(ctx);
+  }
+  SAFE_FREE(ver_rl);
   return result;
 }
 
@@ -523,6 +637,13 @@ EpidStatus EpidVerifierSetHashAlg(VerifierCtx* ctx, HashAlg hash_alg) {
       ctx->hash_alg = previous_hash_alg;
       return result;
     }
+    result = UpdateCommitHashPrefixes(ctx, hash_alg);
+    if (kEpidNoErr != result) {
+      ctx->hash_alg = previous_hash_alg;
+      // restore the basename hash made with the previous algorithm
+      (void)EpidVerifierSetBasename(ctx, ctx->basename, ctx->basename_len);
+      return result;
+    }
   }
   result = kEpidNoErr;
   return result;
@@ -547,6 +668,7 @@ EpidStatus EpidVerifierSetBasename(VerifierCtx* ctx, void const* basename,
     ctx->was_verifier_rl_updated = false;
     SAFE_FREE(ctx->basename);
     ctx->basename_len = 0;
+    UpdatePrivRlIndex(ctx);
     return kEpidNoErr;
   }
 
@@ -572,7 +694,7 @@ EpidStatus EpidVerifierSetBasename(VerifierCtx* ctx, void const* basename,
       }
     }
 
-    SAFE_FREE(ctx->verifier_rl);
+    DeleteVerifierRl(ctx);
 
     DeleteEcPoint(&ctx->basename_hash);
     ctx->basename_hash = basename_hash;
@@ -582,6 +704,7 @@ EpidStatus EpidVerifierSetBasename(VerifierCtx* ctx, void const* basename,
     for (i = 0; i < basename_len; i++) {
       ctx->basename[i] = ((uint8_t*)basename)[i];
     }
+    UpdatePrivRlIndex(ctx);
     result = kEpidNoErr;
   } while (0);
 
@@ -592,6 +715,115 @@ EpidStatus EpidVerifierSetBasename(VerifierCtx* ctx, void const* basename,
   return result;
 }
 
+EpidStatus EpidVerifierSetSigRlRunner(VerifierCtx* ctx, EpidTaskRunner runner,
+                                      void* user_data) {
+  if (!ctx) {
+    return kEpidBadArgErr;
+  }
+  ctx->sig_rl_runner = runner;
+  ctx->sig_rl_runner_data = runner ? user_data : NULL;
+  return kEpidNoErr;
+}
+
+EpidStatus EpidVerifierSetPrivRlRunner(VerifierCtx* ctx, EpidTaskRunner runner,
+                                       void* user_data) {
+  if (!ctx) {
+    return kEpidBadArgErr;
+  }
+  ctx->priv_rl_runner = runner;
+  ctx->priv_rl_runner_data = runner ? user_data : NULL;
+  return kEpidNoErr;
+}
+
+static void UpdatePrivRlIndex(VerifierCtx* ctx) {
+  EpidStatus result = kEpidErr;
+  HashSet* index = NULL;
+  EcPointTable* b_table = NULL;
+  EcPoint* t4 = NULL;
+  FfElement* f = NULL;
+  DeleteHashSet(&ctx->priv_rl_index);
+  // Only a basename fixes B for every signature. Without an index the
+  // verifier checks each PrivRL entry, so failures here are not fatal.
+  if (!ctx->priv_rl || !ctx->basename_hash) {
+    return;
+  }
+  do {
+    EcGroup* G1 = ctx->epid2_params->G1;
+    FiniteField* Fp = ctx->epid2_params->Fp;
+    size_t privrl_count = ntohl(ctx->priv_rl->n1);
+    size_t i = 0;
+    if (!CreateHashSet(sizeof(G1ElemStr), privrl_count, &index)) {
+      result = kEpidMemAllocErr;
+      break;
+    }
+    result = NewEcPointTable(G1, ctx->basename_hash, &b_table);
+    BREAK_ON_EPID_ERROR(result);
+    result = NewEcPoint(G1, &t4);
+    BREAK_ON_EPID_ERROR(result);
+    result = NewFfElement(Fp, &f);
+    BREAK_ON_EPID_ERROR(result);
+    for (i = 0; i < privrl_count; i++) {
+      EcPointTable const* b = b_table;
+      BigNumStr const* exp = (BigNumStr const*)&ctx->priv_rl->f[i];
+      G1ElemStr t4_str;
+      // an f[i] outside of Fp fails the check of every signature, leave
+      // that to the per entry check
+      result = ReadFfElement(Fp, exp, sizeof(*exp), f);
+      BREAK_ON_EPID_ERROR(result);
+      // t4 = G1.exp(B, f[i])
+      result = EcMultiExpTable(G1, &b, &exp, 1, t4);
+      BREAK_ON_EPID_ERROR(result);
+      result = WriteEcPoint(G1, t4, &t4_str, sizeof(t4_str));
+      BREAK_ON_EPID_ERROR(result);
+      if (!HashSetInsert(index, &t4_str)) {
+        result = kEpidMemAllocErr;
+        break;
+      }
+    }
+    BREAK_ON_EPID_ERROR(result);
+    ctx->priv_rl_index = index;
+    index = NULL;
+  } while (0);
+  DeleteFfElement(&f);
+  DeleteEcPoint(&t4);
+  DeleteEcPointTable(&b_table);
+  DeleteHashSet(&index);
+}
+
+static EpidStatus UpdateCommitHashPrefixes(VerifierCtx* ctx,
+                                           HashAlg hash_alg) {
+  EpidStatus result = kEpidErr;
+  FfHashState* commit_hash_prefix = NULL;
+  FfHashState* nr_commit_hash_prefix = NULL;
+  do {
+    result = NewCommitHashPrefix(&ctx->commit_values, hash_alg,
+                                 &commit_hash_prefix);
+    if (kEpidNoErr != result) {
+      break;
+    }
+    result = NewNrCommitHashPrefix(&ctx->commit_values, hash_alg,
+                                   &nr_commit_hash_prefix);
+    if (kEpidNoErr != result) {
+      break;
+    }
+    DeleteFfHashState(&ctx->commit_hash_prefix);
+    DeleteFfHashState(&ctx->nr_commit_hash_prefix);
+    ctx->commit_hash_prefix = commit_hash_prefix;
+    ctx->nr_commit_hash_prefix = nr_commit_hash_prefix;
+    commit_hash_prefix = NULL;
+    nr_commit_hash_prefix = NULL;
+    result = kEpidNoErr;
+  } while (0);
+  DeleteFfHashState(&nr_commit_hash_prefix);
+  DeleteFfHashState(&commit_hash_prefix);
+  return result;
+}
+
+/// eg12 = pairing(g1, g2) for the Intel(R) EPID 2.0 parameters
+static const GtElemStr kEg12Str = {{
+#include "epid/common/src/epid2params_eg12_ate.inc"
+}};
+
 static EpidStatus DoPrecomputation(VerifierCtx* ctx) {
   EpidStatus result = kEpidErr;
   FfElement* e12 = NULL;
@@ -617,23 +849,26 @@ static EpidStatus DoPrecomputation(VerifierCtx* ctx) {
   eg12 = ctx->eg12;
   ps_ctx = params->pairing_state;
   // do precomputation
+  // h1, h2 and w were validated by CreateGroupPubKey
   // 1. The verifier computes e12 = pairing(h1, g2).
-  result = Pairing(ps_ctx, pub_key->h1, params->g2, e12);
+  result = PairingTrusted(ps_ctx, pub_key->h1, params->g2, e12);
   if (kEpidNoErr != result) {
     return result;
   }
   // 2. The verifier computes e22 = pairing(h2, g2).
-  result = Pairing(ps_ctx, pub_key->h2, params->g2, e22);
+  result = PairingTrusted(ps_ctx, pub_key->h2, params->g2, e22);
   if (kEpidNoErr != result) {
     return result;
   }
   // 3. The verifier computes e2w = pairing(h2, w).
-  result = Pairing(ps_ctx, pub_key->h2, pub_key->w, e2w);
+  result = PairingTrusted(ps_ctx, pub_key->h2, pub_key->w, e2w);
   if (kEpidNoErr != result) {
     return result;
   }
   // 4. The verifier computes eg12 = pairing(g1, g2).
-  result = Pairing(ps_ctx, params->g1, params->g2, eg12);
+  //    eg12 only depends on the Intel(R) EPID 2.0 parameters, so the
+  //    precomputed value is read instead.
+  result = ReadFfElement(params->GT, &kEg12Str, sizeof(kEg12Str), eg12);
   if (kEpidNoErr != result) {
     return result;
   }
@@ -685,3 +920,46 @@ static EpidStatus ReadPrecomputation(VerifierPrecomp const* precomp_str,
   }
   return kEpidNoErr;
 }
+
+static EpidStatus CreateGtTables(VerifierCtx* ctx) {
+  EpidStatus result = kEpidErr;
+  FiniteField* GT = NULL;
+  FfElement const* elements[4];
+  FfCombTable** tables[4];
+  size_t i = 0;
+  if (!ctx || !ctx->epid2_params || !ctx->epid2_params->GT) {
+    return kEpidBadArgErr;
+  }
+  GT = ctx->epid2_params->GT;
+  elements[0] = ctx->e12;
+  elements[1] = ctx->e22;
+  elements[2] = ctx->e2w;
+  elements[3] = ctx->eg12;
+  tables[0] = &ctx->e12_table;
+  tables[1] = &ctx->e22_table;
+  tables[2] = &ctx->e2w_table;
+  tables[3] = &ctx->eg12_table;
+  // the elements are pairing results, so they are in the cyclotomic
+  // subgroup the tables need
+  for (i = 0; i < COUNT_OF(tables); i++) {
+    result = NewFfCombTable(GT, tables[i]);
+    if (kEpidNoErr != result) {
+      break;
+    }
+    result = InitFfCombTable(GT, elements[i], *tables[i]);
+    if (kEpidNoErr != result) {
+      break;
+    }
+  }
+  if (kEpidNoErr != result) {
+    DeleteGtTables(ctx);
+  }
+  return result;
+}
+
+static void DeleteGtTables(VerifierCtx* ctx) {
+  DeleteFfCombTable(&ctx->eg12_table);
+  DeleteFfCombTable(&ctx->e2w_table);
+  DeleteFfCombTable(&ctx->e22_table);
+  DeleteFfCombTable(&ctx->e12_table);
+}
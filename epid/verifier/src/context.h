@@ -21,9 +21,13 @@
  */
 #include "epid/common/math/ecgroup.h"
 #include "epid/common/math/finitefield.h"
+#include "epid/common/math/pairing.h"
 #include "epid/common/src/commitment.h"
 #include "epid/common/src/epid2params.h"
 #include "epid/common/src/grouppubkey.h"
+#include "epid/common/src/hashset.h"
+#include "epid/common/src/memory.h"
+#include "epid/verifier/api.h"
 
 /// Verifier context definition
 struct VerifierCtx {
@@ -35,13 +39,34 @@ struct VerifierCtx {
   PrivRl const* priv_rl;    ///< Private key based revocation list - not owned
   SigRl const* sig_rl;      ///< Signature based revocation list - not owned
   GroupRl const* group_rl;  ///< Group revocation list - not owned
+  bool is_group_revoked;    ///< Group is listed in group_rl
   VerifierRl* verifier_rl;  ///< Verifier revocation list
+  size_t verifier_rl_capacity;  ///< Number of K verifier_rl has room for
+  HashSet* verifier_rl_index;   ///< K entries of verifier_rl
   bool was_verifier_rl_updated;  ///< Indicates if blacklist was updated
   Epid2Params_* epid2_params;    ///< Intel(R) EPID 2.0 params
+  FfCombTable* e12_table;        ///< comb table of e12
+  FfCombTable* e22_table;        ///< comb table of e22
+  FfCombTable* e2w_table;        ///< comb table of e2w
+  FfCombTable* eg12_table;       ///< comb table of eg12
+  PreparedG2* g2_prepared;       ///< Miller loop lines of g2
+  PreparedG2* w_prepared;        ///< Miller loop lines of pub_key->w
   CommitValues commit_values;  ///< Values that are hashed to create commitment
   HashAlg hash_alg;            ///< Hash algorithm to use
+  FfHashState* commit_hash_prefix;  ///< Hash of key specific commit_values
+  FfHashState* nr_commit_hash_prefix;  ///< Hash of p || g1 for NrVerify
   EcPoint* basename_hash;      ///< EcHash of the basename (NULL = random base)
   uint8_t* basename;           ///< Basename to use
   size_t basename_len;         ///< Number of bytes in basename
+  HashSet* priv_rl_index;  ///< K revoked by PrivRL for basename (NULL = none)
+  EpidTaskRunner sig_rl_runner;  ///< Runner for SigRL checks (NULL = serial)
+  void* sig_rl_runner_data;      ///< User data passed to sig_rl_runner
+  EpidTaskRunner priv_rl_runner;  ///< Runner for PrivRL checks (NULL = serial)
+  void* priv_rl_runner_data;       ///< User data passed to priv_rl_runner
+};
+
+/// Verifier workspace definition
+struct VerifierWorkspace {
+  MemoryArena* arena;  ///< memory temporary values are allocated from
 };
 #endif  // EPID_VERIFIER_SRC_CONTEXT_H_
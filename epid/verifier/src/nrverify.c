@@ -19,9 +19,11 @@
  * \brief NrVerfy implementation.
  */
 
+#include <string.h>
 #include "epid/common/src/memory.h"
 #include "epid/verifier/api.h"
 #include "epid/verifier/src/context.h"
+#include "epid/verifier/src/nrverify.h"
 
 /// Handle SDK Error with Break
 #define BREAK_ON_EPID_ERROR(ret) \
@@ -41,97 +43,167 @@ typedef struct NrVerifyCommitValues {
   G1ElemStr t;     //!< element of G1
   G1ElemStr r1;    //!< element of G1
   G1ElemStr r2;    //!< element of G1
-  uint8_t msg[1];  //!< message
 } NrVerifyCommitValues;
 #pragma pack()
 
-EpidStatus EpidNrVerify(VerifierCtx const* ctx, BasicSignature const* sig,
-                        void const* msg, size_t msg_len,
-                        SigRlEntry const* sigrl_entry, NrProof const* proof) {
-  size_t const cv_header_len = sizeof(NrVerifyCommitValues) - sizeof(uint8_t);
+/// Scratch values reused across the proofs of a batch
+typedef struct NrVerifyScratch {
+  EcPoint* t_pt;            //!< T of the proof
+  EcPoint* k_pt;            //!< K of the basic signature
+  EcPoint* b_pt;            //!< B of the basic signature
+  EcPoint* kp_pt;           //!< K' of the SigRL entry
+  EcPoint* bp_pt;           //!< B' of the SigRL entry
+  FfElement* c_el;          //!< c of the proof
+  FfElement* nc_el;         //!< -c mod p
+  FfElement* smu_el;        //!< smu of the proof
+  FfElement* snu_el;        //!< snu of the proof
+  FfElement* commit_hash;   //!< recomputed challenge
+  FfHashState* hash_state;  //!< state of the challenge hash
+} NrVerifyScratch;
+
+/// Fixed-base tables for the points of a basic signature
+struct NrVerifyPrecomp {
+  EcPointTable* k_table;  //!< multiples of K
+  EcPointTable* b_table;  //!< multiples of B
+};
+
+EpidStatus NewNrVerifyPrecomp(VerifierCtx const* ctx, BasicSignature const* sig,
+                              NrVerifyPrecomp** precomp) {
   EpidStatus sts = kEpidErr;
-  NrVerifyCommitValues* commit_values = NULL;
-  size_t const commit_len = sizeof(*commit_values) + msg_len - 1;
-  EcPoint* t_pt = NULL;
+  NrVerifyPrecomp* new_precomp = NULL;
   EcPoint* k_pt = NULL;
   EcPoint* b_pt = NULL;
-  EcPoint* kp_pt = NULL;
-  EcPoint* bp_pt = NULL;
-  EcPoint* r1_pt = NULL;
-  EcPoint* r2_pt = NULL;
-  FfElement* c_el = NULL;
-  FfElement* nc_el = NULL;
-  FfElement* smu_el = NULL;
-  FfElement* snu_el = NULL;
-  FfElement* commit_hash = NULL;
-  if (!ctx || !sig || !proof || !sigrl_entry) {
+  if (!ctx || !sig || !precomp) {
     return kEpidBadArgErr;
   }
-  if (!msg && (0 != msg_len)) {
-    return kEpidBadArgErr;
-  }
-  if (msg_len > (SIZE_MAX - cv_header_len)) {
-    return kEpidBadArgErr;
-  }
-  if (!ctx->epid2_params || !ctx->epid2_params->G1 || !ctx->epid2_params->Fp) {
+  if (!ctx->epid2_params || !ctx->epid2_params->G1) {
     return kEpidBadArgErr;
   }
   do {
     EcGroup* G1 = ctx->epid2_params->G1;
-    FiniteField* Fp = ctx->epid2_params->Fp;
-    G1ElemStr const* b = &sig->B;
-    G1ElemStr const* k = &sig->K;
-    G1ElemStr const* bp = &sigrl_entry->b;
-    G1ElemStr const* kp = &sigrl_entry->k;
-    EcPoint const* r1p[2];
-    FpElemStr const* r1b[2];
-    EcPoint const* r2p[3];
-    FpElemStr const* r2b[3];
-    FpElemStr nc_str;
-    bool t_is_identity;
-    bool c_is_equal;
-
-    commit_values = SAFE_ALLOC(commit_len);
-    if (commit_values == NULL) {
+    new_precomp = SAFE_ALLOC(sizeof(*new_precomp));
+    if (!new_precomp) {
       sts = kEpidMemAllocErr;
       break;
     }
-
-    // allocate local memory
-    sts = NewEcPoint(G1, &t_pt);
-    BREAK_ON_EPID_ERROR(sts);
     sts = NewEcPoint(G1, &k_pt);
     BREAK_ON_EPID_ERROR(sts);
     sts = NewEcPoint(G1, &b_pt);
     BREAK_ON_EPID_ERROR(sts);
-    sts = NewEcPoint(G1, &kp_pt);
+    sts = ReadEcPoint(G1, &sig->K, sizeof(sig->K), k_pt);
+    if (kEpidNoErr != sts) {
+      sts = kEpidBadArgErr;
+      break;
+    }
+    sts = ReadEcPoint(G1, &sig->B, sizeof(sig->B), b_pt);
+    if (kEpidNoErr != sts) {
+      sts = kEpidBadArgErr;
+      break;
+    }
+    sts = NewEcPointTable(G1, k_pt, &new_precomp->k_table);
     BREAK_ON_EPID_ERROR(sts);
-    sts = NewEcPoint(G1, &bp_pt);
+    sts = NewEcPointTable(G1, b_pt, &new_precomp->b_table);
     BREAK_ON_EPID_ERROR(sts);
-    sts = NewEcPoint(G1, &r1_pt);
+    *precomp = new_precomp;
+    new_precomp = NULL;
+    sts = kEpidNoErr;
+  } while (0);
+  DeleteEcPoint(&b_pt);
+  DeleteEcPoint(&k_pt);
+  DeleteNrVerifyPrecomp(&new_precomp);
+  return sts;
+}
+
+void DeleteNrVerifyPrecomp(NrVerifyPrecomp** precomp) {
+  if (precomp && *precomp) {
+    DeleteEcPointTable(&(*precomp)->b_table);
+    DeleteEcPointTable(&(*precomp)->k_table);
+    SAFE_FREE(*precomp);
+  }
+}
+
+static void DeleteNrVerifyScratch(NrVerifyScratch* scratch) {
+  DeleteFfHashState(&scratch->hash_state);
+  DeleteFfElement(&scratch->commit_hash);
+  DeleteFfElement(&scratch->snu_el);
+  DeleteFfElement(&scratch->smu_el);
+  DeleteFfElement(&scratch->nc_el);
+  DeleteFfElement(&scratch->c_el);
+  DeleteEcPoint(&scratch->bp_pt);
+  DeleteEcPoint(&scratch->kp_pt);
+  DeleteEcPoint(&scratch->b_pt);
+  DeleteEcPoint(&scratch->k_pt);
+  DeleteEcPoint(&scratch->t_pt);
+}
+
+static EpidStatus NewNrVerifyScratch(VerifierCtx const* ctx,
+                                     NrVerifyScratch* scratch) {
+  EpidStatus sts = kEpidErr;
+  EcGroup* G1 = ctx->epid2_params->G1;
+  FiniteField* Fp = ctx->epid2_params->Fp;
+  memset(scratch, 0, sizeof(*scratch));
+  do {
+    sts = NewEcPoint(G1, &scratch->t_pt);
+    BREAK_ON_EPID_ERROR(sts);
+    sts = NewEcPoint(G1, &scratch->k_pt);
+    BREAK_ON_EPID_ERROR(sts);
+    sts = NewEcPoint(G1, &scratch->b_pt);
+    BREAK_ON_EPID_ERROR(sts);
+    sts = NewEcPoint(G1, &scratch->kp_pt);
+    BREAK_ON_EPID_ERROR(sts);
+    sts = NewEcPoint(G1, &scratch->bp_pt);
     BREAK_ON_EPID_ERROR(sts);
-    sts = NewEcPoint(G1, &r2_pt);
+    sts = NewFfElement(Fp, &scratch->c_el);
     BREAK_ON_EPID_ERROR(sts);
-    sts = NewFfElement(Fp, &c_el);
+    sts = NewFfElement(Fp, &scratch->nc_el);
     BREAK_ON_EPID_ERROR(sts);
-    sts = NewFfElement(Fp, &nc_el);
+    sts = NewFfElement(Fp, &scratch->smu_el);
     BREAK_ON_EPID_ERROR(sts);
-    sts = NewFfElement(Fp, &smu_el);
+    sts = NewFfElement(Fp, &scratch->snu_el);
     BREAK_ON_EPID_ERROR(sts);
-    sts = NewFfElement(Fp, &snu_el);
+    sts = NewFfElement(Fp, &scratch->commit_hash);
     BREAK_ON_EPID_ERROR(sts);
-    sts = NewFfElement(Fp, &commit_hash);
+    sts = NewFfHashState(ctx->hash_alg, &scratch->hash_state);
     BREAK_ON_EPID_ERROR(sts);
+  } while (0);
+  if (kEpidNoErr != sts) {
+    DeleteNrVerifyScratch(scratch);
+  }
+  return sts;
+}
+
+/// Computes R1 and R2 of a proof, steps 1 to 6 of nrVerify
+static EpidStatus NrVerifyCommitPoints(VerifierCtx const* ctx,
+                                       BasicSignature const* sig,
+                                       NrVerifyPrecomp const* precomp,
+                                       SigRlEntry const* sigrl_entry,
+                                       NrProof const* proof,
+                                       NrVerifyScratch* scratch,
+                                       EcPoint* r1_pt, EcPoint* r2_pt) {
+  EpidStatus sts = kEpidErr;
+  do {
+    EcGroup* G1 = ctx->epid2_params->G1;
+    FiniteField* Fp = ctx->epid2_params->Fp;
+    G1ElemStr const* b = &sig->B;
+    G1ElemStr const* k = &sig->K;
+    G1ElemStr const* bp = &sigrl_entry->b;
+    G1ElemStr const* kp = &sigrl_entry->k;
+    EcPoint const* r1p[2];
+    FpElemStr const* r1b[2];
+    FfElement const* r1e[2];
+    EcPoint const* r2p[3];
+    FfElement const* r2b[3];
+    bool t_is_identity;
 
     // 1. The verifier verifies that G1.inGroup(T) = true.
-    sts = ReadEcPoint(G1, &proof->T, sizeof(proof->T), t_pt);
+    sts = ReadEcPoint(G1, &proof->T, sizeof(proof->T), scratch->t_pt);
     if (kEpidNoErr != sts) {
       sts = kEpidBadArgErr;
       break;
     }
 
     // 2. The verifier verifies that G1.isIdentity(T) = false.
-    sts = EcIsIdentity(G1, t_pt, &t_is_identity);
+    sts = EcIsIdentity(G1, scratch->t_pt, &t_is_identity);
     BREAK_ON_EPID_ERROR(sts);
     if (t_is_identity) {
       sts = kEpidBadArgErr;
@@ -139,87 +211,119 @@ EpidStatus EpidNrVerify(VerifierCtx const* ctx, BasicSignature const* sig,
     }
 
     // 3. The verifier verifies that c, smu, snu in [0, p-1].
-    sts = ReadFfElement(Fp, &proof->c, sizeof(proof->c), c_el);
+    sts = ReadFfElement(Fp, &proof->c, sizeof(proof->c), scratch->c_el);
     BREAK_ON_EPID_ERROR(sts);
-    sts = ReadFfElement(Fp, &proof->smu, sizeof(proof->smu), smu_el);
+    sts = ReadFfElement(Fp, &proof->smu, sizeof(proof->smu), scratch->smu_el);
     BREAK_ON_EPID_ERROR(sts);
-    sts = ReadFfElement(Fp, &proof->snu, sizeof(proof->snu), snu_el);
+    sts = ReadFfElement(Fp, &proof->snu, sizeof(proof->snu), scratch->snu_el);
     BREAK_ON_EPID_ERROR(sts);
 
     // 4. The verifier computes nc = (- c) mod p.
-    sts = FfNeg(Fp, c_el, nc_el);
-    BREAK_ON_EPID_ERROR(sts);
-
-    sts = WriteFfElement(Fp, nc_el, &nc_str, sizeof(nc_str));
+    sts = FfNeg(Fp, scratch->c_el, scratch->nc_el);
     BREAK_ON_EPID_ERROR(sts);
 
     // 5. The verifier computes R1 = G1.multiExp(K, smu, B, snu).
-    sts = ReadEcPoint(G1, k, sizeof(*k), k_pt);
-    if (kEpidNoErr != sts) {
-      sts = kEpidBadArgErr;
-      break;
-    }
-    sts = ReadEcPoint(G1, b, sizeof(*b), b_pt);
-    if (kEpidNoErr != sts) {
-      sts = kEpidBadArgErr;
-      break;
-    }
-    r1p[0] = k_pt;
-    r1p[1] = b_pt;
     r1b[0] = &proof->smu;
     r1b[1] = &proof->snu;
-    sts = EcMultiExp(G1, r1p, (const BigNumStr**)r1b, 2, r1_pt);
-    BREAK_ON_EPID_ERROR(sts);
+    if (precomp) {
+      // K and B are the same for every SigRL entry, use their tables
+      EcPointTable const* r1t[2];
+      r1t[0] = precomp->k_table;
+      r1t[1] = precomp->b_table;
+      sts = EcMultiExpTable(G1, r1t, (const BigNumStr**)r1b, 2, r1_pt);
+      BREAK_ON_EPID_ERROR(sts);
+    } else {
+      sts = ReadEcPoint(G1, k, sizeof(*k), scratch->k_pt);
+      if (kEpidNoErr != sts) {
+        sts = kEpidBadArgErr;
+        break;
+      }
+      sts = ReadEcPoint(G1, b, sizeof(*b), scratch->b_pt);
+      if (kEpidNoErr != sts) {
+        sts = kEpidBadArgErr;
+        break;
+      }
+      r1p[0] = scratch->k_pt;
+      r1p[1] = scratch->b_pt;
+      r1e[0] = scratch->smu_el;
+      r1e[1] = scratch->snu_el;
+      sts = EcMultiExpFp(G1, r1p, Fp, r1e, 2, r1_pt);
+      BREAK_ON_EPID_ERROR(sts);
+    }
 
     // 6. The verifier computes R2 = G1.multiExp(K', smu, B', snu, T, nc).
-    sts = ReadEcPoint(G1, kp, sizeof(*kp), kp_pt);
+    sts = ReadEcPoint(G1, kp, sizeof(*kp), scratch->kp_pt);
     if (kEpidNoErr != sts) {
       sts = kEpidBadArgErr;
       break;
     }
-    sts = ReadEcPoint(G1, bp, sizeof(*bp), bp_pt);
+    sts = ReadEcPoint(G1, bp, sizeof(*bp), scratch->bp_pt);
     if (kEpidNoErr != sts) {
       sts = kEpidBadArgErr;
       break;
     }
-    r2p[0] = kp_pt;
-    r2p[1] = bp_pt;
-    r2p[2] = t_pt;
-    r2b[0] = &proof->smu;
-    r2b[1] = &proof->snu;
-    r2b[2] = &nc_str;
-    sts = EcMultiExp(G1, r2p, (const BigNumStr**)r2b, 3, r2_pt);
+    r2p[0] = scratch->kp_pt;
+    r2p[1] = scratch->bp_pt;
+    r2p[2] = scratch->t_pt;
+    r2b[0] = scratch->smu_el;
+    r2b[1] = scratch->snu_el;
+    r2b[2] = scratch->nc_el;
+    sts = EcMultiExpFp(G1, r2p, Fp, r2b, 3, r2_pt);
     BREAK_ON_EPID_ERROR(sts);
+    sts = kEpidNoErr;
+  } while (0);
+  return sts;
+}
+
+/// Checks the challenge of a proof, step 7 of nrVerify
+static EpidStatus NrVerifyCommitHash(VerifierCtx const* ctx,
+                                     BasicSignature const* sig,
+                                     MsgSource* msg,
+                                     SigRlEntry const* sigrl_entry,
+                                     NrProof const* proof,
+                                     G1ElemStr const* r1, G1ElemStr const* r2,
+                                     NrVerifyScratch* scratch) {
+  EpidStatus sts = kEpidErr;
+  NrVerifyCommitValues commit_values;
+  do {
+    FiniteField* Fp = ctx->epid2_params->Fp;
+    bool c_is_equal;
 
     // 7. The verifier verifies c = Fp.hash(p || g1 || B || K ||
     //    B' || K' || T || R1 || R2 || m).
     //    Refer to Section 7.1 for hash operation over a prime field.
 
-    // commit_values is allocated such that there are msg_len bytes available
-    // starting at commit_values->msg
-    if (msg) {
-      // Memory copy is used to copy a message of variable length
-      if (0 != memcpy_S(&commit_values->msg[0], msg_len, msg, msg_len)) {
-        sts = kEpidBadArgErr;
-        break;
-      }
+    commit_values.p = ctx->commit_values.p;
+    commit_values.g1 = ctx->commit_values.g1;
+    commit_values.b = sig->B;
+    commit_values.k = sig->K;
+    commit_values.bp = sigrl_entry->b;
+    commit_values.kp = sigrl_entry->k;
+    commit_values.t = proof->T;
+    commit_values.r1 = *r1;
+    commit_values.r2 = *r2;
+    // m is hashed where it is stored rather than copied after the values
+    if (ctx->nr_commit_hash_prefix) {
+      // resume after p || g1, hashed when the hash algorithm was set
+      sts = FfHashStateCopy(ctx->nr_commit_hash_prefix, scratch->hash_state);
+      BREAK_ON_EPID_ERROR(sts);
+      sts = FfHashUpdate(scratch->hash_state, &commit_values.b,
+                         sizeof(commit_values) -
+                             offsetof(NrVerifyCommitValues, b));
+    } else {
+      // FfHashFinal leaves the state ready for the next proof
+      sts = FfHashUpdate(scratch->hash_state, &commit_values,
+                         sizeof(commit_values));
     }
-    commit_values->p = ctx->commit_values.p;
-    commit_values->g1 = ctx->commit_values.g1;
-    commit_values->b = sig->B;
-    commit_values->k = sig->K;
-    commit_values->bp = sigrl_entry->b;
-    commit_values->kp = sigrl_entry->k;
-    commit_values->t = proof->T;
-    sts =
-        WriteEcPoint(G1, r1_pt, &commit_values->r1, sizeof(commit_values->r1));
     BREAK_ON_EPID_ERROR(sts);
-    sts =
-        WriteEcPoint(G1, r2_pt, &commit_values->r2, sizeof(commit_values->r2));
+    sts = FfHashUpdateMsg(scratch->hash_state, msg);
+    BREAK_ON_EPID_ERROR(sts);
+    sts = FfHashFinal(Fp, scratch->hash_state, scratch->commit_hash);
     BREAK_ON_EPID_ERROR(sts);
-    sts = FfHash(Fp, commit_values, commit_len, ctx->hash_alg, commit_hash);
+    // c was range checked in step 3
+    sts = ReadFfElement(Fp, &proof->c, sizeof(proof->c), scratch->c_el);
     BREAK_ON_EPID_ERROR(sts);
-    sts = FfIsEqual(Fp, c_el, commit_hash, &c_is_equal);
+    sts = FfIsEqual(Fp, scratch->c_el, scratch->commit_hash, &c_is_equal);
     BREAK_ON_EPID_ERROR(sts);
     if (!c_is_equal) {
       sts = kEpidBadArgErr;
@@ -227,18 +331,98 @@ EpidStatus EpidNrVerify(VerifierCtx const* ctx, BasicSignature const* sig,
     }
     sts = kEpidNoErr;
   } while (0);
-  SAFE_FREE(commit_values);
-  DeleteFfElement(&commit_hash);
-  DeleteFfElement(&snu_el);
-  DeleteFfElement(&smu_el);
-  DeleteFfElement(&nc_el);
-  DeleteFfElement(&c_el);
-  DeleteEcPoint(&r2_pt);
-  DeleteEcPoint(&r1_pt);
-  DeleteEcPoint(&bp_pt);
-  DeleteEcPoint(&kp_pt);
-  DeleteEcPoint(&b_pt);
-  DeleteEcPoint(&k_pt);
-  DeleteEcPoint(&t_pt);
+  return sts;
+}
+
+EpidStatus EpidNrVerify(VerifierCtx const* ctx, BasicSignature const* sig,
+                        void const* msg, size_t msg_len,
+                        SigRlEntry const* sigrl_entry, NrProof const* proof) {
+  MsgSource source;
+  EpidStatus sts = InitMsgSourceFromBuffer(msg, msg_len, &source);
+  if (kEpidNoErr != sts) return sts;
+  return EpidNrVerifyWithPrecomp(ctx, sig, NULL, &source, sigrl_entry, proof);
+}
+
+EpidStatus EpidNrVerifyWithPrecomp(VerifierCtx const* ctx,
+                                   BasicSignature const* sig,
+                                   NrVerifyPrecomp const* precomp,
+                                   MsgSource* msg,
+                                   SigRlEntry const* sigrl_entry,
+                                   NrProof const* proof) {
+  return EpidNrVerifyBatch(ctx, sig, precomp, msg, sigrl_entry, proof, 1);
+}
+
+EpidStatus EpidNrVerifyBatch(VerifierCtx const* ctx, BasicSignature const* sig,
+                             NrVerifyPrecomp const* precomp,
+                             MsgSource* msg,
+                             SigRlEntry const* sigrl_entries,
+                             NrProof const* proofs, size_t count) {
+  EpidStatus sts = kEpidErr;
+  NrVerifyScratch scratch;
+  EcPoint* r_pt[2 * NR_VERIFY_BATCH_SIZE] = {0};
+  G1ElemStr r_str[2 * NR_VERIFY_BATCH_SIZE];
+  OctStr r_str_ptr[2 * NR_VERIFY_BATCH_SIZE];
+  size_t batch_size = 0;
+  size_t i = 0;
+  if (!ctx || !sig || !msg || !proofs || !sigrl_entries || 0 == count) {
+    return kEpidBadArgErr;
+  }
+  if (!ctx->epid2_params || !ctx->epid2_params->G1 || !ctx->epid2_params->Fp) {
+    return kEpidBadArgErr;
+  }
+  sts = NewNrVerifyScratch(ctx, &scratch);
+  if (kEpidNoErr != sts) {
+    return sts;
+  }
+  batch_size = (count < NR_VERIFY_BATCH_SIZE) ? count : NR_VERIFY_BATCH_SIZE;
+  do {
+    EcGroup* G1 = ctx->epid2_params->G1;
+    size_t start = 0;
+    for (i = 0; i < 2 * batch_size; i++) {
+      sts = NewEcPoint(G1, &r_pt[i]);
+      BREAK_ON_EPID_ERROR(sts);
+      r_str_ptr[i] = &r_str[i];
+    }
+    BREAK_ON_EPID_ERROR(sts);
+
+    for (start = 0; start < count && kEpidNoErr == sts; start += batch_size) {
+      size_t n = count - start;
+      size_t computed = 0;
+      EpidStatus commit_sts = kEpidNoErr;
+      if (n > batch_size) {
+        n = batch_size;
+      }
+      // Steps 1 to 6 for the whole batch. Stop at the first failure, but
+      // still check the proofs before it so that failures are reported
+      // in the same order as when verifying one proof at a time.
+      for (computed = 0; computed < n; computed++) {
+        commit_sts = NrVerifyCommitPoints(
+            ctx, sig, precomp, &sigrl_entries[start + computed],
+            &proofs[start + computed], &scratch, r_pt[2 * computed],
+            r_pt[2 * computed + 1]);
+        if (kEpidNoErr != commit_sts) break;
+      }
+      if (computed > 0) {
+        // R1 and R2 are hashed in affine form, share one inversion
+        sts = WriteEcPoints(G1, (EcPoint const**)r_pt, 2 * computed,
+                            r_str_ptr, sizeof(r_str[0]));
+        BREAK_ON_EPID_ERROR(sts);
+      }
+      // Step 7 for each computed proof
+      for (i = 0; i < computed; i++) {
+        sts = NrVerifyCommitHash(ctx, sig, msg, &sigrl_entries[start + i],
+                                 &proofs[start + i], &r_str[2 * i],
+                                 &r_str[2 * i + 1], &scratch);
+        BREAK_ON_EPID_ERROR(sts);
+      }
+      if (kEpidNoErr == sts) {
+        sts = commit_sts;
+      }
+    }
+  } while (0);
+  for (i = 0; i < 2 * batch_size; i++) {
+    DeleteEcPoint(&r_pt[i]);
+  }
+  DeleteNrVerifyScratch(&scratch);
   return sts;
 }
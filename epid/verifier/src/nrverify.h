@@ -0,0 +1,136 @@
+/*############################################################################
+  # Copyright 2016 Intel Corporation
+  #
+  # Licensed under the Apache License, Version 2.0 (the "License");
+  # you may not use this file except in compliance with the License.
+  # You may obtain a copy of the License at
+  #
+  #     http://www.apache.org/licenses/LICENSE-2.0
+  #
+  # Unless required by applicable law or agreed to in writing, software
+  # distributed under the License is distributed on an "AS IS" BASIS,
+  # WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  # See the License for the specific language governing permissions and
+  # limitations under the License.
+  ############################################################################*/
+/// Non-revoked proof verification internal interface.
+/*! \file */
+#ifndef EPID_VERIFIER_SRC_NRVERIFY_H_
+#define EPID_VERIFIER_SRC_NRVERIFY_H_
+
+#include <stddef.h>
+#include "epid/common/errors.h"
+#include "epid/common/src/msgsource.h"
+
+/// \cond
+typedef struct VerifierCtx VerifierCtx;
+typedef struct BasicSignature BasicSignature;
+typedef struct SigRlEntry SigRlEntry;
+typedef struct NrProof NrProof;
+/// \endcond
+
+/// Most non-revoked proofs EpidNrVerifyBatch finishes together
+#define NR_VERIFY_BATCH_SIZE (16)
+
+/// Values of a basic signature shared by all of its non-revoked proofs
+typedef struct NrVerifyPrecomp NrVerifyPrecomp;
+
+/// Precomputes the values shared by the non-revoked proofs of a signature.
+/*!
+ Decodes B and K of the basic signature and builds tables of their
+ multiples, so that the non-revoked proof for each SigRL entry can
+ compute R1 without any point doublings.
+
+ Building the tables costs a few exponentiations and is only worth it
+ for signatures checked against several SigRL entries.
+
+ Use DeleteNrVerifyPrecomp() to free memory.
+
+ \param[in] ctx
+ The verifier context.
+ \param[in] sig
+ The basic signature.
+ \param[out] precomp
+ The newly constructed precomputed values.
+
+ \returns ::EpidStatus
+
+ \see DeleteNrVerifyPrecomp
+ \see EpidNrVerifyWithPrecomp
+ */
+EpidStatus NewNrVerifyPrecomp(VerifierCtx const* ctx, BasicSignature const* sig,
+                              NrVerifyPrecomp** precomp);
+
+/// Deletes values precomputed by NewNrVerifyPrecomp.
+/*!
+ \param[in,out] precomp
+ The precomputed values. Can be NULL. Nulls the pointer.
+
+ \see NewNrVerifyPrecomp
+ */
+void DeleteNrVerifyPrecomp(NrVerifyPrecomp** precomp);
+
+/// Verifies the non-revoked proof for a single SigRL entry.
+/*!
+ Same as EpidNrVerify but reuses values precomputed for the signature.
+
+ \param[in] ctx
+ The verifier context.
+ \param[in] sig
+ The basic signature.
+ \param[in] precomp
+ Values precomputed for sig by NewNrVerifyPrecomp. Pass NULL to compute
+ everything from sig.
+ \param[in] msg
+ The message that was signed.
+ \param[in] sigrl_entry
+ The signature based revocation list entry.
+ \param[in] proof
+ The non-revoked proof.
+
+ \returns ::EpidStatus
+
+ \see EpidNrVerify
+ \see NewNrVerifyPrecomp
+ */
+EpidStatus EpidNrVerifyWithPrecomp(VerifierCtx const* ctx,
+                                   BasicSignature const* sig,
+                                   NrVerifyPrecomp const* precomp,
+                                   MsgSource* msg,
+                                   SigRlEntry const* sigrl_entry,
+                                   NrProof const* proof);
+
+/// Verifies the non-revoked proofs for consecutive SigRL entries.
+/*!
+ Same as calling EpidNrVerifyWithPrecomp on each entry in turn and
+ stopping at the first failure, but computes the commitments R1 and R2
+ of up to ::NR_VERIFY_BATCH_SIZE proofs before hashing them, so that
+ they are converted to affine coordinates with a single inversion.
+
+ \param[in] ctx
+ The verifier context.
+ \param[in] sig
+ The basic signature.
+ \param[in] precomp
+ Values precomputed for sig by NewNrVerifyPrecomp. Pass NULL to compute
+ everything from sig.
+ \param[in] msg
+ The message that was signed.
+ \param[in] sigrl_entries
+ The signature based revocation list entries.
+ \param[in] proofs
+ The non-revoked proofs, one for each entry.
+ \param[in] count
+ The number of entries and proofs.
+
+ \returns ::EpidStatus of the first proof that fails to verify
+
+ \see EpidNrVerifyWithPrecomp
+ */
+EpidStatus EpidNrVerifyBatch(VerifierCtx const* ctx, BasicSignature const* sig,
+                             NrVerifyPrecomp const* precomp,
+                             MsgSource* msg,
+                             SigRlEntry const* sigrl_entries,
+                             NrProof const* proofs, size_t count);
+
+#endif  // EPID_VERIFIER_SRC_NRVERIFY_H_
@@ -0,0 +1,127 @@
+/*############################################################################
+  # Copyright 2017 Intel Corporation
+  #
+  # Licensed under the Apache License, Version 2.0 (the "License");
+  # you may not use this file except in compliance with the License.
+  # You may obtain a copy of the License at
+  #
+  #     http://www.apache.org/licenses/LICENSE-2.0
+  #
+  # Unless required by applicable law or agreed to in writing, software
+  # distributed under the License is distributed on an "AS IS" BASIS,
+  # WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  # See the License for the specific language governing permissions and
+  # limitations under the License.
+  ############################################################################*/
+/*!
+ * \file
+ * \brief Verifier pre-computation store implementation.
+ */
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "epid/common/src/endian_convert.h"
+#include "epid/common/src/memory.h"
+#include "epid/verifier/api.h"
+
+/// Magic number at the start of a pre-computation store
+static const OctStr32 kPrecompStoreMagic = {{'E', 'P', 'V', 'P'}};
+/// Pre-computation store format version
+#define PRECOMP_STORE_VERSION 1
+
+/// Orders pre-computed settings by group ID for qsort
+static int ComparePrecompGid(void const* a, void const* b) {
+  return memcmp(&((VerifierPrecomp const*)a)->gid,
+                &((VerifierPrecomp const*)b)->gid, sizeof(GroupId));
+}
+
+/// Gets the size of a store with count records, or 0 if it is too large
+static size_t PrecompStoreSize(size_t count) {
+  if (count > UINT32_MAX ||
+      count > (SIZE_MAX - sizeof(VerifierPrecompStoreHeader)) /
+                  sizeof(VerifierPrecomp)) {
+    return 0;
+  }
+  return sizeof(VerifierPrecompStoreHeader) + count * sizeof(VerifierPrecomp);
+}
+
+EpidStatus EpidVerifierWritePrecompStore(VerifierPrecomp const* precomps,
+                                         size_t count, void* store,
+                                         size_t* store_size) {
+  VerifierPrecompStoreHeader* header = (VerifierPrecompStoreHeader*)store;
+  VerifierPrecomp* records = NULL;
+  size_t required_size = 0;
+  size_t i = 0;
+  if ((!precomps && 0 != count) || !store_size) {
+    return kEpidBadArgErr;
+  }
+  required_size = PrecompStoreSize(count);
+  if (0 == required_size) {
+    return kEpidBadArgErr;
+  }
+  if (!store) {
+    *store_size = required_size;
+    return kEpidNoErr;
+  }
+  if (*store_size < required_size) {
+    return kEpidBadArgErr;
+  }
+  records = (VerifierPrecomp*)(header + 1);
+  if (count) {
+    if (0 != memcpy_S(records,
+                      *store_size - sizeof(VerifierPrecompStoreHeader),
+                      precomps, count * sizeof(VerifierPrecomp))) {
+      return kEpidErr;
+    }
+    qsort(records, count, sizeof(VerifierPrecomp), ComparePrecompGid);
+  }
+  for (i = 1; i < count; i++) {
+    if (0 == ComparePrecompGid(&records[i - 1], &records[i])) {
+      return kEpidDuplicateErr;
+    }
+  }
+  header->magic = kPrecompStoreMagic;
+  *((uint32_t*)(&header->version)) = htonl(PRECOMP_STORE_VERSION);
+  *((uint32_t*)(&header->count)) = htonl((uint32_t)count);
+  *store_size = required_size;
+  return kEpidNoErr;
+}
+
+EpidStatus EpidVerifierFindPrecomp(void const* store, size_t store_size,
+                                   GroupId const* gid,
+                                   VerifierPrecomp const** precomp) {
+  VerifierPrecompStoreHeader const* header =
+      (VerifierPrecompStoreHeader const*)store;
+  VerifierPrecomp const* records = NULL;
+  size_t low = 0;
+  size_t high = 0;
+  if (!store || !gid || !precomp) {
+    return kEpidBadArgErr;
+  }
+  *precomp = NULL;
+  if (store_size < sizeof(VerifierPrecompStoreHeader) ||
+      0 != memcmp(&header->magic, &kPrecompStoreMagic,
+                  sizeof(kPrecompStoreMagic)) ||
+      PRECOMP_STORE_VERSION != ntohl(header->version)) {
+    return kEpidBadArgErr;
+  }
+  high = ntohl(header->count);
+  if (store_size != PrecompStoreSize(high)) {
+    return kEpidBadArgErr;
+  }
+  records = (VerifierPrecomp const*)(header + 1);
+  // search [low, high) for gid
+  while (low < high) {
+    size_t mid = low + (high - low) / 2;
+    int cmp = memcmp(gid, &records[mid].gid, sizeof(GroupId));
+    if (0 == cmp) {
+      *precomp = &records[mid];
+      break;
+    } else if (cmp < 0) {
+      high = mid;
+    } else {
+      low = mid + 1;
+    }
+  }
+  return kEpidNoErr;
+}
@@ -0,0 +1,687 @@
+/*############################################################################
+  # Copyright 2016-2017 Intel Corporation
+  #
+  # Licensed under the Apache License, Version 2.0 (the "License");
+  # you may not use this file except in compliance with the License.
+  # You may obtain a copy of the License at
+  #
+  #     http://www.apache.org/licenses/LICENSE-2.0
+  #
+  # Unless required by applicable law or agreed to in writing, software
+  # distributed under the License is distributed on an "AS IS" BASIS,
+  # WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  # See the License for the specific language governing permissions and
+  # limitations under the License.
+  ############################################################################*/
+/*!
+ * \file
+ * \brief Verifier registry implementation.
+ */
+#include <stddef.h>
+#include <string.h>
+#include "epid/common/sharedparams.h"
+#include "epid/common/src/endian_convert.h"
+#include "epid/common/src/memory.h"
+#include "epid/common/src/sigrlvalid.h"
+#include "epid/verifier/api.h"
+#include "epid/verifier/src/rlvalid.h"
+
+/// Smallest number of slots in the group index of a registry
+#define REGISTRY_MIN_SLOTS ((size_t)16)
+
+/// A group known to a verifier registry
+typedef struct RegistryGroup {
+  GroupPubKey pub_key;          ///< Group public key
+  VerifierPrecomp precomp;      ///< Pre-computed data, valid if has_precomp
+  bool has_precomp;             ///< precomp holds the data of pub_key
+  PrivRl const* priv_rl;        ///< Private key based revocation list
+  size_t priv_rl_size;          ///< Size of priv_rl in bytes
+  SigRl const* sig_rl;          ///< Signature based revocation list
+  size_t sig_rl_size;           ///< Size of sig_rl in bytes
+  VerifierRl* verifier_rl;      ///< Verifier revocation list - owned copy
+  size_t verifier_rl_size;      ///< Size of verifier_rl in bytes
+  VerifierCtx* ctx;             ///< Verifier context (NULL = not resident)
+  struct RegistryGroup* newer;  ///< Next more recently used resident group
+  struct RegistryGroup* older;  ///< Next less recently used resident group
+} RegistryGroup;
+
+/// Verifier registry definition
+/*!
+ Groups are found through an open addressing table with linear probing
+ keyed by group ID. Resident groups are also kept in a list ordered by
+ use, from newest to oldest.
+ */
+struct VerifierRegistry {
+  EpidSharedParams* params;     ///< Parameters shared by all contexts
+  RegistryGroup** slots;        ///< Group index, NULL marks an empty slot
+  size_t num_slots;             ///< Number of slots, a power of two
+  size_t num_groups;            ///< Number of groups in the index
+  size_t max_contexts;          ///< Largest number of resident contexts
+  RegistryGroup* newest;        ///< Most recently used resident group
+  RegistryGroup* oldest;        ///< Least recently used resident group
+  GroupRl const* group_rl;      ///< Group based revocation list - not owned
+  size_t group_rl_size;         ///< Size of group_rl in bytes
+  HashAlg hash_alg;             ///< Hash algorithm, valid if hash_alg_set
+  bool hash_alg_set;            ///< Hash algorithm was set
+  uint8_t* basename;            ///< Basename (NULL = random base)
+  size_t basename_len;          ///< Number of bytes in basename
+  VerifierRegistryStats stats;  ///< Usage counters
+  void const* precomp_store;    ///< Pre-computation store - not owned
+  size_t precomp_store_size;    ///< Size of precomp_store in bytes
+};
+
+/// Hashes a group ID using 64-bit FNV-1a
+static size_t HashGroupId(GroupId const* gid) {
+  uint8_t const* bytes = (uint8_t const*)gid;
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  size_t i;
+  for (i = 0; i < sizeof(*gid); i++) {
+    hash ^= bytes[i];
+    hash *= 0x100000001b3ULL;
+  }
+  return (size_t)(hash ^ (hash >> 32));
+}
+
+/// Finds the slot holding gid or the empty slot where it belongs
+static size_t FindSlot(RegistryGroup* const* slots, size_t num_slots,
+                       GroupId const* gid) {
+  size_t mask = num_slots - 1;
+  size_t slot = HashGroupId(gid) & mask;
+  while (slots[slot] && 0 != memcmp(&slots[slot]->pub_key.gid, gid,
+                                    sizeof(*gid))) {
+    slot = (slot + 1) & mask;
+  }
+  return slot;
+}
+
+/// Doubles the number of slots in the group index
+static bool GrowIndex(VerifierRegistry* registry) {
+  size_t num_slots = registry->num_slots * 2;
+  RegistryGroup** slots = NULL;
+  size_t i;
+  if (num_slots < registry->num_slots ||
+      num_slots > SIZE_MAX / sizeof(RegistryGroup*)) {
+    return false;
+  }
+  slots = SAFE_ALLOC(num_slots * sizeof(RegistryGroup*));
+  if (!slots) {
+    return false;
+  }
+  for (i = 0; i < registry->num_slots; i++) {
+    RegistryGroup* group = registry->slots[i];
+    if (group) {
+      slots[FindSlot(slots, num_slots, &group->pub_key.gid)] = group;
+    }
+  }
+  SAFE_FREE(registry->slots);
+  registry->slots = slots;
+  registry->num_slots = num_slots;
+  return true;
+}
+
+/// Finds a group in the registry, NULL if it was not added
+static RegistryGroup* FindGroup(VerifierRegistry const* registry,
+                                GroupId const* gid) {
+  return registry->slots[FindSlot(registry->slots, registry->num_slots, gid)];
+}
+
+/// Removes a resident group from the use list
+static void Unlink(VerifierRegistry* registry, RegistryGroup* group) {
+  if (group->newer) {
+    group->newer->older = group->older;
+  } else {
+    registry->newest = group->older;
+  }
+  if (group->older) {
+    group->older->newer = group->newer;
+  } else {
+    registry->oldest = group->newer;
+  }
+  group->newer = NULL;
+  group->older = NULL;
+}
+
+/// Adds a resident group to the use list as the most recently used
+static void LinkNewest(VerifierRegistry* registry, RegistryGroup* group) {
+  group->older = registry->newest;
+  group->newer = NULL;
+  if (registry->newest) {
+    registry->newest->newer = group;
+  } else {
+    registry->oldest = group;
+  }
+  registry->newest = group;
+}
+
+/// Deletes the verifier context of a resident group
+static void Evict(VerifierRegistry* registry, RegistryGroup* group) {
+  Unlink(registry, group);
+  EpidVerifierDelete(&group->ctx);
+  registry->stats.resident--;
+}
+
+/// Checks that a revocation list is newer than the one it replaces
+static bool IsNewerRl(OctStr32 const* current_ver, OctStr32 const* new_ver) {
+  return !current_ver || ntohl(*current_ver) < ntohl(*new_ver);
+}
+
+/// Frees the stored verifier revocation lists of every group
+/*!
+ A verifier revocation list holds the hash of the basename, so it is
+ dropped whenever a context would drop it.
+ */
+static void DeleteVerifierRls(VerifierRegistry* registry) {
+  size_t i;
+  for (i = 0; i < registry->num_slots; i++) {
+    RegistryGroup* group = registry->slots[i];
+    if (group) {
+      SAFE_FREE(group->verifier_rl);
+      group->verifier_rl_size = 0;
+    }
+  }
+}
+
+/// Keeps a copy of the verifier revocation list of a resident group
+static EpidStatus SaveVerifierRl(RegistryGroup* group) {
+  EpidStatus sts = kEpidErr;
+  VerifierRl* ver_rl = NULL;
+  size_t ver_rl_size = EpidGetVerifierRlSize(group->ctx);
+  if (0 == ver_rl_size) {
+    return kEpidErr;
+  }
+  ver_rl = SAFE_ALLOC(ver_rl_size);
+  if (!ver_rl) {
+    return kEpidMemAllocErr;
+  }
+  sts = EpidWriteVerifierRl(group->ctx, ver_rl, ver_rl_size);
+  if (kEpidNoErr != sts) {
+    SAFE_FREE(ver_rl);
+    return sts;
+  }
+  SAFE_FREE(group->verifier_rl);
+  group->verifier_rl = ver_rl;
+  group->verifier_rl_size = ver_rl_size;
+  return kEpidNoErr;
+}
+
+/// Creates the verifier context of a group and applies registry settings
+static EpidStatus CreateGroupCtx(VerifierRegistry* registry,
+                                 RegistryGroup* group, VerifierCtx** ctx) {
+  EpidStatus sts = kEpidErr;
+  VerifierCtx* new_ctx = NULL;
+  VerifierPrecomp const* precomp = NULL;
+  do {
+    if (group->has_precomp) {
+      precomp = &group->precomp;
+    } else if (registry->precomp_store) {
+      sts = EpidVerifierFindPrecomp(registry->precomp_store,
+                                    registry->precomp_store_size,
+                                    &group->pub_key.gid, &precomp);
+      if (kEpidNoErr != sts) {
+        break;
+      }
+    }
+    sts = EpidVerifierCreateWithParams(&group->pub_key, precomp,
+                                       registry->params, &new_ctx);
+    if (kEpidNoErr != sts) {
+      break;
+    }
+    if (!precomp) {
+      // keep the pairings so that creating the context again is cheap
+      sts = EpidVerifierWritePrecomp(new_ctx, &group->precomp);
+      if (kEpidNoErr != sts) {
+        break;
+      }
+      group->has_precomp = true;
+    }
+    if (registry->hash_alg_set) {
+      sts = EpidVerifierSetHashAlg(new_ctx, registry->hash_alg);
+      if (kEpidNoErr != sts) {
+        break;
+      }
+    }
+    sts = EpidVerifierSetBasename(new_ctx, registry->basename,
+                                  registry->basename_len);
+    if (kEpidNoErr != sts) {
+      break;
+    }
+    if (registry->group_rl) {
+      sts = EpidVerifierSetGroupRl(new_ctx, registry->group_rl,
+                                   registry->group_rl_size);
+      if (kEpidNoErr != sts) {
+        break;
+      }
+    }
+    if (group->priv_rl) {
+      sts = EpidVerifierSetPrivRl(new_ctx, group->priv_rl,
+                                  group->priv_rl_size);
+      if (kEpidNoErr != sts) {
+        break;
+      }
+    }
+    if (group->sig_rl) {
+      sts = EpidVerifierSetSigRl(new_ctx, group->sig_rl, group->sig_rl_size);
+      if (kEpidNoErr != sts) {
+        break;
+      }
+    }
+    if (group->verifier_rl) {
+      sts = EpidVerifierSetVerifierRl(new_ctx, group->verifier_rl,
+                                      group->verifier_rl_size);
+      if (kEpidNoErr != sts) {
+        break;
+      }
+    }
+    *ctx = new_ctx;
+    new_ctx = NULL;
+    sts = kEpidNoErr;
+  } while (0);
+  EpidVerifierDelete(&new_ctx);
+  return sts;
+}
+
+/// Gets the verifier context of a group, creating it if not resident
+static EpidStatus UseGroup(VerifierRegistry* registry, RegistryGroup* group,
+                           VerifierCtx** ctx) {
+  EpidStatus sts = kEpidErr;
+  if (group->ctx) {
+    registry->stats.hits++;
+    Unlink(registry, group);
+    LinkNewest(registry, group);
+    *ctx = group->ctx;
+    return kEpidNoErr;
+  }
+  registry->stats.misses++;
+  sts = CreateGroupCtx(registry, group, &group->ctx);
+  if (kEpidNoErr != sts) {
+    return sts;
+  }
+  if (registry->stats.resident >= registry->max_contexts) {
+    Evict(registry, registry->oldest);
+    registry->stats.evictions++;
+  }
+  LinkNewest(registry, group);
+  registry->stats.resident++;
+  *ctx = group->ctx;
+  return kEpidNoErr;
+}
+
+EpidStatus EpidRegistryCreate(size_t max_contexts,
+                              VerifierRegistry** registry) {
+  EpidStatus sts = kEpidErr;
+  VerifierRegistry* new_registry = NULL;
+  if (!registry || 0 == max_contexts) {
+    return kEpidBadArgErr;
+  }
+  do {
+    new_registry = SAFE_ALLOC(sizeof(VerifierRegistry));
+    if (!new_registry) {
+      sts = kEpidMemAllocErr;
+      break;
+    }
+    new_registry->slots =
+        SAFE_ALLOC(REGISTRY_MIN_SLOTS * sizeof(RegistryGroup*));
+    if (!new_registry->slots) {
+      sts = kEpidMemAllocErr;
+      break;
+    }
+    new_registry->num_slots = REGISTRY_MIN_SLOTS;
+    sts = EpidSharedParamsCreate(&new_registry->params);
+    if (kEpidNoErr != sts) {
+      break;
+    }
+    new_registry->num_groups = 0;
+    new_registry->max_contexts = max_contexts;
+    new_registry->newest = NULL;
+    new_registry->oldest = NULL;
+    new_registry->group_rl = NULL;
+    new_registry->group_rl_size = 0;
+    new_registry->hash_alg_set = false;
+    new_registry->basename = NULL;
+    new_registry->basename_len = 0;
+    memset(&new_registry->stats, 0, sizeof(new_registry->stats));
+    *registry = new_registry;
+    new_registry = NULL;
+    sts = kEpidNoErr;
+  } while (0);
+  EpidRegistryDelete(&new_registry);
+  return sts;
+}
+
+void EpidRegistryDelete(VerifierRegistry** registry) {
+  if (registry && *registry) {
+    size_t i;
+    if ((*registry)->slots) {
+      for (i = 0; i < (*registry)->num_slots; i++) {
+        RegistryGroup* group = (*registry)->slots[i];
+        if (group) {
+          EpidVerifierDelete(&group->ctx);
+          SAFE_FREE(group->verifier_rl);
+          SAFE_FREE(group);
+        }
+      }
+    }
+    SAFE_FREE((*registry)->slots);
+    SAFE_FREE((*registry)->basename);
+    EpidSharedParamsDelete(&(*registry)->params);
+    SAFE_FREE(*registry);
+  }
+}
+
+EpidStatus EpidRegistryAddGroup(VerifierRegistry* registry,
+                                GroupPubKey const* pub_key,
+                                VerifierPrecomp const* precomp) {
+  RegistryGroup* group = NULL;
+  size_t slot = 0;
+  if (!registry || !pub_key) {
+    return kEpidBadArgErr;
+  }
+  if (precomp && 0 != memcmp(&precomp->gid, &pub_key->gid,
+                             sizeof(pub_key->gid))) {
+    return kEpidBadArgErr;
+  }
+  slot = FindSlot(registry->slots, registry->num_slots, &pub_key->gid);
+  group = registry->slots[slot];
+  if (group) {
+    // replace the key, the context is created again when next used
+    if (group->ctx) {
+      Evict(registry, group);
+    }
+  } else {
+    if (registry->num_groups + 1 > registry->num_slots / 2) {
+      if (!GrowIndex(registry)) {
+        return kEpidMemAllocErr;
+      }
+      slot = FindSlot(registry->slots, registry->num_slots, &pub_key->gid);
+    }
+    group = SAFE_ALLOC(sizeof(RegistryGroup));
+    if (!group) {
+      return kEpidMemAllocErr;
+    }
+    group->priv_rl = NULL;
+    group->priv_rl_size = 0;
+    group->sig_rl = NULL;
+    group->sig_rl_size = 0;
+    group->verifier_rl = NULL;
+    group->verifier_rl_size = 0;
+    group->ctx = NULL;
+    group->newer = NULL;
+    group->older = NULL;
+    registry->slots[slot] = group;
+    registry->num_groups++;
+    registry->stats.groups = registry->num_groups;
+  }
+  group->pub_key = *pub_key;
+  group->has_precomp = precomp ? true : false;
+  if (precomp) {
+    group->precomp = *precomp;
+  }
+  return kEpidNoErr;
+}
+
+EpidStatus EpidRegistrySetPrivRl(VerifierRegistry* registry,
+                                 PrivRl const* priv_rl, size_t priv_rl_size) {
+  RegistryGroup* group = NULL;
+  if (!registry || !priv_rl || priv_rl_size < sizeof(priv_rl->gid)) {
+    return kEpidBadArgErr;
+  }
+  group = FindGroup(registry, &priv_rl->gid);
+  if (!group || !IsPrivRlValid(&group->pub_key.gid, priv_rl, priv_rl_size)) {
+    return kEpidBadArgErr;
+  }
+  if (!IsNewerRl(group->priv_rl ? &group->priv_rl->version : NULL,
+                 &priv_rl->version)) {
+    return kEpidBadArgErr;
+  }
+  // a group that is not resident gets the list when its context is created
+  if (group->ctx) {
+    EpidStatus sts = EpidVerifierSetPrivRl(group->ctx, priv_rl, priv_rl_size);
+    if (kEpidNoErr != sts) {
+      return sts;
+    }
+  }
+  group->priv_rl = priv_rl;
+  group->priv_rl_size = priv_rl_size;
+  return kEpidNoErr;
+}
+
+EpidStatus EpidRegistrySetSigRl(VerifierRegistry* registry,
+                                SigRl const* sig_rl, size_t sig_rl_size) {
+  RegistryGroup* group = NULL;
+  if (!registry || !sig_rl || sig_rl_size < sizeof(sig_rl->gid)) {
+    return kEpidBadArgErr;
+  }
+  group = FindGroup(registry, &sig_rl->gid);
+  if (!group || !IsSigRlValid(&group->pub_key.gid, sig_rl, sig_rl_size)) {
+    return kEpidBadArgErr;
+  }
+  if (!IsNewerRl(group->sig_rl ? &group->sig_rl->version : NULL,
+                 &sig_rl->version)) {
+    return kEpidBadArgErr;
+  }
+  if (group->ctx) {
+    EpidStatus sts = EpidVerifierSetSigRl(group->ctx, sig_rl, sig_rl_size);
+    if (kEpidNoErr != sts) {
+      return sts;
+    }
+  }
+  group->sig_rl = sig_rl;
+  group->sig_rl_size = sig_rl_size;
+  return kEpidNoErr;
+}
+
+EpidStatus EpidRegistrySetVerifierRl(VerifierRegistry* registry,
+                                     VerifierRl const* ver_rl,
+                                     size_t ver_rl_size) {
+  RegistryGroup* group = NULL;
+  VerifierRl* ver_rl_copy = NULL;
+  if (!registry || !ver_rl || ver_rl_size < sizeof(ver_rl->gid)) {
+    return kEpidBadArgErr;
+  }
+  group = FindGroup(registry, &ver_rl->gid);
+  if (!group ||
+      !IsVerifierRlValid(&group->pub_key.gid, ver_rl, ver_rl_size)) {
+    return kEpidBadArgErr;
+  }
+  if (!registry->basename) {
+    return kEpidInconsistentBasenameSetErr;
+  }
+  if (!IsNewerRl(group->verifier_rl ? &group->verifier_rl->version : NULL,
+                 &ver_rl->version)) {
+    return kEpidBadArgErr;
+  }
+  ver_rl_copy = SAFE_ALLOC(ver_rl_size);
+  if (!ver_rl_copy) {
+    return kEpidMemAllocErr;
+  }
+  if (0 != memcpy_S(ver_rl_copy, ver_rl_size, ver_rl, ver_rl_size)) {
+    SAFE_FREE(ver_rl_copy);
+    return kEpidBadArgErr;
+  }
+  // B is checked against the basename when the list reaches a context
+  if (group->ctx) {
+    EpidStatus sts =
+        EpidVerifierSetVerifierRl(group->ctx, ver_rl_copy, ver_rl_size);
+    if (kEpidNoErr != sts) {
+      SAFE_FREE(ver_rl_copy);
+      return sts;
+    }
+  }
+  SAFE_FREE(group->verifier_rl);
+  group->verifier_rl = ver_rl_copy;
+  group->verifier_rl_size = ver_rl_size;
+  return kEpidNoErr;
+}
+
+EpidStatus EpidRegistrySetGroupRl(VerifierRegistry* registry,
+                                  GroupRl const* grp_rl, size_t grp_rl_size) {
+  RegistryGroup* group = NULL;
+  if (!registry || !grp_rl || !IsGroupRlValid(grp_rl, grp_rl_size)) {
+    return kEpidBadArgErr;
+  }
+  if (!IsNewerRl(registry->group_rl ? &registry->group_rl->version : NULL,
+                 &grp_rl->version)) {
+    return kEpidBadArgErr;
+  }
+  // every resident context has the same lists, so a list rejected by one
+  // is rejected by the first
+  for (group = registry->newest; group; group = group->older) {
+    EpidStatus sts = EpidVerifierSetGroupRl(group->ctx, grp_rl, grp_rl_size);
+    if (kEpidNoErr != sts) {
+      return sts;
+    }
+  }
+  registry->group_rl = grp_rl;
+  registry->group_rl_size = grp_rl_size;
+  return kEpidNoErr;
+}
+
+EpidStatus EpidRegistrySetHashAlg(VerifierRegistry* registry,
+                                  HashAlg hash_alg) {
+  RegistryGroup* group = NULL;
+  if (!registry) {
+    return kEpidBadArgErr;
+  }
+  if (kSha256 != hash_alg && kSha384 != hash_alg && kSha512 != hash_alg &&
+      kSha512_256 != hash_alg)
+    return kEpidBadArgErr;
+  for (group = registry->newest; group; group = group->older) {
+    EpidStatus sts = EpidVerifierSetHashAlg(group->ctx, hash_alg);
+    if (kEpidNoErr != sts) {
+      return sts;
+    }
+  }
+  if (!registry->hash_alg_set || registry->hash_alg != hash_alg) {
+    // the basename hash may have changed, so drop the verifier lists;
+    // a context keeps its list if hash_alg matched its default, so set
+    // the basename again to drop it there too
+    if (registry->basename) {
+      for (group = registry->newest; group; group = group->older) {
+        EpidStatus sts = EpidVerifierSetBasename(
+            group->ctx, registry->basename, registry->basename_len);
+        if (kEpidNoErr != sts) {
+          return sts;
+        }
+      }
+    }
+    DeleteVerifierRls(registry);
+  }
+  registry->hash_alg = hash_alg;
+  registry->hash_alg_set = true;
+  return kEpidNoErr;
+}
+
+EpidStatus EpidRegistrySetBasename(VerifierRegistry* registry,
+                                   void const* basename, size_t basename_len) {
+  RegistryGroup* group = NULL;
+  uint8_t* basename_copy = NULL;
+  if (!registry || (!basename && 0 != basename_len) ||
+      (basename && 0 == basename_len)) {
+    return kEpidBadArgErr;
+  }
+  if (basename) {
+    basename_copy = SAFE_ALLOC(basename_len);
+    if (!basename_copy) {
+      return kEpidMemAllocErr;
+    }
+    if (0 != memcpy_S(basename_copy, basename_len, basename, basename_len)) {
+      SAFE_FREE(basename_copy);
+      return kEpidErr;
+    }
+  }
+  for (group = registry->newest; group; group = group->older) {
+    EpidStatus sts =
+        EpidVerifierSetBasename(group->ctx, basename, basename_len);
+    if (kEpidNoErr != sts) {
+      SAFE_FREE(basename_copy);
+      return sts;
+    }
+  }
+  DeleteVerifierRls(registry);
+  SAFE_FREE(registry->basename);
+  registry->basename = basename_copy;
+  registry->basename_len = basename_len;
+  return kEpidNoErr;
+}
+
+EpidStatus EpidRegistrySetPrecompStore(VerifierRegistry* registry,
+                                       void const* store, size_t store_size) {
+  if (!registry || (!store && 0 != store_size)) {
+    return kEpidBadArgErr;
+  }
+  if (store) {
+    // look up any group to check the header of the store
+    GroupId gid = {0};
+    VerifierPrecomp const* precomp = NULL;
+    EpidStatus sts =
+        EpidVerifierFindPrecomp(store, store_size, &gid, &precomp);
+    if (kEpidNoErr != sts) {
+      return sts;
+    }
+  }
+  registry->precomp_store = store;
+  registry->precomp_store_size = store_size;
+  return kEpidNoErr;
+}
+
+EpidStatus EpidRegistryVerify(VerifierRegistry* registry, GroupId const* gid,
+                              EpidSignature const* sig, size_t sig_len,
+                              void const* msg, size_t msg_len) {
+  EpidStatus sts = kEpidErr;
+  RegistryGroup* group = NULL;
+  VerifierCtx* ctx = NULL;
+  if (!registry || !gid) {
+    return kEpidBadArgErr;
+  }
+  group = FindGroup(registry, gid);
+  if (!group) {
+    return kEpidBadArgErr;
+  }
+  sts = UseGroup(registry, group, &ctx);
+  if (kEpidNoErr != sts) {
+    return sts;
+  }
+  return EpidVerify(ctx, sig, sig_len, msg, msg_len);
+}
+
+EpidStatus EpidRegistryBlacklistSig(VerifierRegistry* registry,
+                                    GroupId const* gid,
+                                    EpidSignature const* sig, size_t sig_len,
+                                    void const* msg, size_t msg_len) {
+  EpidStatus sts = kEpidErr;
+  RegistryGroup* group = NULL;
+  VerifierCtx* ctx = NULL;
+  if (!registry || !gid) {
+    return kEpidBadArgErr;
+  }
+  group = FindGroup(registry, gid);
+  if (!group) {
+    return kEpidBadArgErr;
+  }
+  sts = UseGroup(registry, group, &ctx);
+  if (kEpidNoErr != sts) {
+    return sts;
+  }
+  sts = EpidBlacklistSig(ctx, sig, sig_len, msg, msg_len);
+  if (kEpidNoErr != sts) {
+    return sts;
+  }
+  sts = SaveVerifierRl(group);
+  if (kEpidNoErr != sts) {
+    // the context would be the only holder of the new entry and lose it
+    // when evicted, so drop it now
+    Evict(registry, group);
+    registry->stats.evictions++;
+    return sts;
+  }
+  return kEpidNoErr;
+}
+
+EpidStatus EpidRegistryGetStats(VerifierRegistry const* registry,
+                                VerifierRegistryStats* stats) {
+  if (!registry || !stats) {
+    return kEpidBadArgErr;
+  }
+  *stats = registry->stats;
+  return kEpidNoErr;
+}
@@ -0,0 +1,94 @@
+/*############################################################################
+  # Copyright 2016-2017 Intel Corporation
+  #
+  # Licensed under the Apache License, Version 2.0 (the "License");
+  # you may not use this file except in compliance with the License.
+  # You may obtain a copy of the License at
+  #
+  #     http://www.apache.org/licenses/LICENSE-2.0
+  #
+  # Unless required by applicable law or agreed to in writing, software
+  # distributed under the License is distributed on an "AS IS" BASIS,
+  # WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  # See the License for the specific language governing permissions and
+  # limitations under the License.
+  ############################################################################*/
+/*!
+ * \file
+ * \brief Revocation list validity checking implementation.
+ */
+#include "epid/verifier/src/rlvalid.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#include "epid/common/src/endian_convert.h"
+
+bool IsGroupRlValid(GroupRl const* group_rl, size_t grp_rl_size) {
+  const size_t kMinGroupRlSize = sizeof(GroupRl) - sizeof(GroupId);
+  size_t input_grp_rl_size = 0;
+
+  if (!group_rl || grp_rl_size < kMinGroupRlSize) {
+    return false;
+  }
+  if (ntohl(group_rl->n3) > (SIZE_MAX - kMinGroupRlSize) / sizeof(GroupId)) {
+    return false;
+  }
+  input_grp_rl_size = kMinGroupRlSize + (ntohl(group_rl->n3) * sizeof(GroupId));
+  if (input_grp_rl_size != grp_rl_size) {
+    return false;
+  }
+  return true;
+}
+
+bool IsPrivRlValid(GroupId const* gid, PrivRl const* priv_rl,
+                   size_t priv_rl_size) {
+  const size_t kMinPrivRlSize = sizeof(PrivRl) - sizeof(FpElemStr);
+  size_t input_priv_rl_size = 0;
+
+  if (!gid || !priv_rl || kMinPrivRlSize > priv_rl_size) {
+    return false;
+  }
+  if (ntohl(priv_rl->n1) >
+      (SIZE_MAX - kMinPrivRlSize) / sizeof(priv_rl->f[0])) {
+    return false;
+  }
+  // sanity check of input PrivRl size
+  input_priv_rl_size =
+      kMinPrivRlSize + ntohl(priv_rl->n1) * sizeof(priv_rl->f[0]);
+  if (input_priv_rl_size != priv_rl_size) {
+    return false;
+  }
+  // verify that gid given and gid in PrivRl match
+  if (0 != memcmp(gid, &priv_rl->gid, sizeof(*gid))) {
+    return false;
+  }
+  return true;
+}
+
+bool IsVerifierRlValid(GroupId const* gid, VerifierRl const* ver_rl,
+                       size_t ver_rl_size) {
+  const size_t kMinVerifierRlSize = sizeof(VerifierRl) - sizeof(G1ElemStr);
+  size_t expected_verifier_rl_size = 0;
+
+  if (!gid || !ver_rl || kMinVerifierRlSize > ver_rl_size) {
+    return false;
+  }
+  if (ntohl(ver_rl->n4) >
+      (SIZE_MAX - kMinVerifierRlSize) / sizeof(ver_rl->K[0])) {
+    return false;
+  }
+  // sanity check of input VerifierRl size
+  expected_verifier_rl_size =
+      kMinVerifierRlSize + ntohl(ver_rl->n4) * sizeof(ver_rl->K[0]);
+  if (expected_verifier_rl_size != ver_rl_size) {
+    return false;
+  }
+
+  // verify that gid in public key and gid in SigRl match
+  if (0 != memcmp(gid, &ver_rl->gid, sizeof(*gid))) {
+    return false;
+  }
+
+  return true;
+}
@@ -0,0 +1,70 @@
+/*############################################################################
+  # Copyright 2016-2017 Intel Corporation
+  #
+  # Licensed under the Apache License, Version 2.0 (the "License");
+  # you may not use this file except in compliance with the License.
+  # You may obtain a copy of the License at
+  #
+  #     http://www.apache.org/licenses/LICENSE-2.0
+  #
+  # Unless required by applicable law or agreed to in writing, software
+  # distributed under the License is distributed on an "AS IS" BASIS,
+  # WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  # See the License for the specific language governing permissions and
+  # limitations under the License.
+  ############################################################################*/
+/// Revocation list validity checking internal interface.
+/*! \file */
+#ifndef EPID_VERIFIER_SRC_RLVALID_H_
+#define EPID_VERIFIER_SRC_RLVALID_H_
+
+#include <stddef.h>
+
+#include "epid/common/stdtypes.h"
+#include "epid/common/types.h"
+
+/// Checks that a group based revocation list is well formed
+/*!
+  \param[in] group_rl
+  Group based revocation list
+  \param[in] grp_rl_size
+  Size of group based revocation list in bytes
+
+  \returns true if revocation list is valid
+  \returns false if revocation list is invalid
+*/
+bool IsGroupRlValid(GroupRl const* group_rl, size_t grp_rl_size);
+
+/// Checks that a private key based revocation list is valid for a group
+/*!
+  \param[in] gid
+  Group id
+  \param[in] priv_rl
+  Private key based revocation list
+  \param[in] priv_rl_size
+  Size of private key based revocation list in bytes
+
+  \returns true if revocation list is valid
+  \returns false if revocation list is invalid
+*/
+bool IsPrivRlValid(GroupId const* gid, PrivRl const* priv_rl,
+                   size_t priv_rl_size);
+
+/// Checks that a verifier revocation list is valid for a group
+/*!
+  The basename of the list is not checked.
+
+  \param[in] gid
+  Group id
+  \param[in] ver_rl
+  Verifier revocation list
+  \param[in] ver_rl_size
+  Size of verifier revocation list in bytes
+
+  \returns true if revocation list is valid
+  \returns false if revocation list is invalid
+*/
+bool IsVerifierRlValid(GroupId const* gid, VerifierRl const* ver_rl,
+                       size_t ver_rl_size);
+
+#endif  // EPID_VERIFIER_SRC_RLVALID_H_
@@ -21,7 +21,10 @@
 #include <string.h>
 #include "epid/common/src/endian_convert.h"
 #include "epid/verifier/api.h"
+#include "epid/verifier/src/check_privrl.h"
 #include "epid/verifier/src/context.h"
+#include "epid/verifier/src/nrverify.h"
+#include "epid/verifier/src/verifybasic.h"
 
 /// Handle SDK Error with Break
 #define BREAK_ON_EPID_ERROR(ret) \
@@ -29,6 +32,12 @@
     break;                       \
   }
 
+/// Smallest SigRL for which B and K tables pay for themselves
+#define NR_VERIFY_PRECOMP_MIN_SIGRL_COUNT (5)
+
+/// SigRL entries checked by one task of the SigRL runner
+#define NR_VERIFY_TASK_SIGRL_COUNT (4)
+
 static size_t EpidGetSignatureRlCount(EpidSignature const* sig) {
   if (!sig)
     return 0;
@@ -36,50 +45,85 @@ static size_t EpidGetSignatureRlCount(EpidSignature const* sig) {
     return ntohl(sig->n2);
 }
 
-static size_t EpidGetGroupRlCount(GroupRl const* rl) {
+static size_t EpidGetSigRlCount(SigRl const* rl) {
   if (!rl)
     return 0;
   else
-    return ntohl(rl->n3);
+    return ntohl(rl->n2);
 }
 
-static size_t EpidGetPrivRlCount(PrivRl const* rl) {
-  if (!rl)
-    return 0;
-  else
-    return ntohl(rl->n1);
-}
+/// Revocation list checks that depend only on the verifier context
+typedef struct VerifyRlPrecheck {
+  bool group_revoked;          ///< gid matches an entry in GroupRL
+  bool priv_rl_gid_match;      ///< gid in PrivRL matches public key
+  bool sig_rl_gid_match;       ///< gid in SigRL matches public key
+  bool verifier_rl_gid_match;  ///< gid in VerifierRL matches public key
+} VerifyRlPrecheck;
 
-static size_t EpidGetSigRlCount(SigRl const* rl) {
-  if (!rl)
-    return 0;
-  else
-    return ntohl(rl->n2);
+/// Evaluates the signature independent parts of the revocation checks
+static void PrecheckRevocationLists(VerifierCtx const* ctx,
+                                    VerifyRlPrecheck* precheck) {
+  // the GroupRL is searched once when it is set
+  precheck->group_revoked = ctx->group_rl && ctx->is_group_revoked;
+  precheck->priv_rl_gid_match = false;
+  precheck->sig_rl_gid_match = false;
+  precheck->verifier_rl_gid_match = false;
+  if (ctx->priv_rl) {
+    precheck->priv_rl_gid_match =
+        (0 == memcmp(&ctx->pub_key->gid, &ctx->priv_rl->gid,
+                     sizeof(ctx->pub_key->gid)));
+  }
+  if (ctx->sig_rl) {
+    precheck->sig_rl_gid_match =
+        (0 == memcmp(&ctx->pub_key->gid, &ctx->sig_rl->gid,
+                     sizeof(ctx->pub_key->gid)));
+  }
+  if (ctx->verifier_rl) {
+    precheck->verifier_rl_gid_match =
+        (0 == memcmp(&ctx->pub_key->gid, &ctx->verifier_rl->gid,
+                     sizeof(ctx->pub_key->gid)));
+  }
 }
 
-static size_t EpidGetVerifierRlCount(VerifierRl const* rl) {
-  if (!rl)
-    return 0;
-  else
-    return ntohl(rl->n4);
+/// Signature data shared by the SigRL non-revoked proof tasks
+typedef struct NrVerifyTaskCtx {
+  VerifierCtx const* ctx;    ///< verifier context
+  EpidSignature const* sig;  ///< signature being verified
+  NrVerifyPrecomp const* precomp;  ///< tables for sigma0, can be NULL
+  MsgSource const* msg;            ///< message that was signed
+  size_t sigrl_count;              ///< number of SigRL entries
+} NrVerifyTaskCtx;
+
+/// Checks the non-revoked proofs for a run of SigRL entries
+static EpidStatus NrVerifyTask(void* task_ctx, size_t task_index) {
+  NrVerifyTaskCtx const* nr_ctx = (NrVerifyTaskCtx const*)task_ctx;
+  size_t first = task_index * NR_VERIFY_TASK_SIGRL_COUNT;
+  size_t count = nr_ctx->sigrl_count - first;
+  // tasks may run at the same time, so each records reader failures in
+  // its own copy of the message source
+  MsgSource msg = *nr_ctx->msg;
+  EpidStatus sts = kEpidErr;
+  if (count > NR_VERIFY_TASK_SIGRL_COUNT) {
+    count = NR_VERIFY_TASK_SIGRL_COUNT;
+  }
+  sts = EpidNrVerifyBatch(nr_ctx->ctx, &nr_ctx->sig->sigma0, nr_ctx->precomp,
+                          &msg, &nr_ctx->ctx->sig_rl->bk[first],
+                          &nr_ctx->sig->sigma[first], count);
+  if (sts != kEpidNoErr) {
+    return msg.read_failed ? sts : kEpidSigRevokedInSigRl;
+  }
+  return kEpidNoErr;
 }
 
-// implements section 4.1.2 "Verify algorithm" from Intel(R) EPID 2.0 Spec
-EpidStatus EpidVerify(VerifierCtx const* ctx, EpidSignature const* sig,
-                      size_t sig_len, void const* msg, size_t msg_len) {
-  // Step 1. Setup
+/// Verifies a signature using precomputed revocation list checks
+static EpidStatus VerifyWithPrecheck(VerifierCtx const* ctx,
+                                     VerifyRlPrecheck const* precheck,
+                                     EpidSignature const* sig, size_t sig_len,
+                                     MsgSource* msg) {
   size_t const sig_header_len = (sizeof(EpidSignature) - sizeof(NrProof));
   EpidStatus sts = kEpidErr;
   size_t rl_count = 0;
-  size_t i;
-  if (!ctx || !sig) {
-    return kEpidBadArgErr;
-  }
-  if (!msg && (0 != msg_len)) {
-    // if message is non-empty it must have both length and content
-    return kEpidBadArgErr;
-  }
-  if (!ctx->epid2_params || !ctx->pub_key) {
+  if (!sig || !msg) {
     return kEpidBadArgErr;
   }
   if (sig_len < sig_header_len) {
@@ -91,57 +135,59 @@ EpidStatus EpidVerify(VerifierCtx const* ctx, EpidSignature const* sig,
     return kEpidBadArgErr;
   }
   // Step 2. The verifier verifies the basic signature Sigma0 as follows:
-  sts = EpidVerifyBasicSig(ctx, &sig->sigma0, msg, msg_len);
+  sts = VerifyBasicSig(ctx, &sig->sigma0, msg);
   if (sts != kEpidNoErr) {
+    if (msg->read_failed) {
+      // the reader failed, which says nothing about the signature
+      return sts;
+    }
     // p. If any of the above verifications fails, the verifier aborts and
     // outputs 1
     return kEpidSigInvalid;
   }
 
   // Step 3. If GroupRL is provided,
-  if (ctx->group_rl) {
-    // a. The verifier verifies that gid does not match any entry in GroupRL.
-    size_t grouprl_count = EpidGetGroupRlCount(ctx->group_rl);
-    for (i = 0; i < grouprl_count; ++i) {
-      if (0 == memcmp(&ctx->pub_key->gid, &ctx->group_rl->gid[i],
-                      sizeof(ctx->pub_key->gid))) {
-        // b. If gid matches an entry in GroupRL, aborts and returns 2.
-        return kEpidSigRevokedInGroupRl;
-      }
-    }
+  // a. The verifier verifies that gid does not match any entry in GroupRL.
+  if (precheck->group_revoked) {
+    // b. If gid matches an entry in GroupRL, aborts and returns 2.
+    return kEpidSigRevokedInGroupRl;
   }
 
   // Step  4. If PrivRL is provided,
   if (ctx->priv_rl) {
-    size_t privrl_count = EpidGetPrivRlCount(ctx->priv_rl);
     // a. The verifier verifies that gid in the public key and in PrivRL match.
     // If mismatch, abort and return "operation failed".
-    if (0 != memcmp(&ctx->pub_key->gid, &ctx->priv_rl->gid,
-                    sizeof(ctx->pub_key->gid))) {
+    if (!precheck->priv_rl_gid_match) {
       return kEpidBadArgErr;
     }
     // b. For i = 0, ..., n1-1, the verifier computes t4 =G1.exp(B, f[i]) and
     // verifies that G1.isEqual(t4, K) = false. A faster private-key revocation
     // check algorithm is provided in Section 4.5.
-    for (i = 0; i < privrl_count; ++i) {
-      sts = EpidCheckPrivRlEntry(ctx, &sig->sigma0, &ctx->priv_rl->f[i]);
-      if (sts != kEpidNoErr) {
+    if (ctx->priv_rl_index) {
+      // With a basename B is fixed, so every t4 was computed when the
+      // PrivRL or basename was set
+      if (HashSetContains(ctx->priv_rl_index, &sig->sigma0.K)) {
         // c. If the above step fails, the verifier aborts and output 3.
         return kEpidSigRevokedInPrivRl;
       }
+    } else {
+      sts = EpidCheckPrivRl(ctx, &sig->sigma0);
+      if (sts != kEpidNoErr) {
+        // c. If the above step fails, the verifier aborts and output 3.
+        return sts;
+      }
     }
   }
 
   // Step 5. If SigRL is provided,
   if (ctx->sig_rl) {
     size_t sigrl_count = EpidGetSigRlCount(ctx->sig_rl);
+    NrVerifyPrecomp* precomp = NULL;
     // a. The verifier verifies that gid in the public key and in SigRL match.
     // If mismatch, abort and return "operation failed".
-    if (0 != memcmp(&ctx->pub_key->gid, &ctx->sig_rl->gid,
-                    sizeof(ctx->pub_key->gid))) {
+    if (!precheck->sig_rl_gid_match) {
       return kEpidBadArgErr;
     }
-
     // b. The verifier verifies that RLver in Sigma and in SigRL match. If
     // mismatch, abort and output "operation failed".
     if (0 != memcmp(&ctx->sig_rl->version, &sig->rl_ver,
@@ -158,22 +204,47 @@ EpidStatus EpidVerify(VerifierCtx const* ctx, EpidSignature const* sig,
     // d. For i = 0, ..., n2-1, the verifier verifies nrVerify(B, K, B[i],
     // K[i], Sigma[i]) = true. The details of nrVerify() will be given in the
     // next subsection.
-    for (i = 0; i < sigrl_count; ++i) {
-      sts = EpidNrVerify(ctx, &sig->sigma0, msg, msg_len, &ctx->sig_rl->bk[i],
-                         &sig->sigma[i]);
-      if (sts != kEpidNoErr) {
-        // e. If the above step fails, the verifier aborts and output 4.
-        return kEpidSigRevokedInSigRl;
+    if (sigrl_count >= NR_VERIFY_PRECOMP_MIN_SIGRL_COUNT) {
+      // B and K are shared by every proof, so tabulate them once. On
+      // failure each proof falls back to decoding them itself.
+      if (kEpidNoErr != NewNrVerifyPrecomp(ctx, &sig->sigma0, &precomp)) {
+        precomp = NULL;
+      }
+    }
+    sts = kEpidNoErr;
+    if (ctx->sig_rl_runner && sigrl_count > 1) {
+      NrVerifyTaskCtx nr_ctx;
+      nr_ctx.ctx = ctx;
+      nr_ctx.sig = sig;
+      nr_ctx.precomp = precomp;
+      nr_ctx.msg = msg;
+      nr_ctx.sigrl_count = sigrl_count;
+      // failed tasks report kEpidSigRevokedInSigRl or a reader error, so
+      // any other status comes from the runner itself
+      sts = ctx->sig_rl_runner(
+          NrVerifyTask, &nr_ctx,
+          (sigrl_count + NR_VERIFY_TASK_SIGRL_COUNT - 1) /
+              NR_VERIFY_TASK_SIGRL_COUNT,
+          ctx->sig_rl_runner_data);
+    } else if (sigrl_count > 0) {
+      sts = EpidNrVerifyBatch(ctx, &sig->sigma0, precomp, msg,
+                              ctx->sig_rl->bk, sig->sigma, sigrl_count);
+      if (kEpidNoErr != sts && !msg->read_failed) {
+        sts = kEpidSigRevokedInSigRl;
       }
     }
+    DeleteNrVerifyPrecomp(&precomp);
+    if (sts != kEpidNoErr) {
+      // e. If the above step fails, the verifier aborts and output 4.
+      return sts;
+    }
   }
 
   // Step 6. If VerifierRL is provided,
   if (ctx->verifier_rl) {
     // a. The verifier verifies that gid in the public key and in VerifierRL
     // match. If mismatch, abort and return "operation failed".
-    if (0 != memcmp(&ctx->pub_key->gid, &ctx->verifier_rl->gid,
-                    sizeof(ctx->pub_key->gid))) {
+    if (!precheck->verifier_rl_gid_match) {
       return kEpidBadArgErr;
     }
 
@@ -181,14 +252,10 @@ EpidStatus EpidVerify(VerifierCtx const* ctx, EpidSignature const* sig,
     // match. If mismatch, go to step 7.
     if (0 ==
         memcmp(&ctx->verifier_rl->B, &sig->sigma0.B, sizeof(sig->sigma0.B))) {
-      size_t verifierrl_count = EpidGetVerifierRlCount(ctx->verifier_rl);
       // c. For i = 0, ..., n4-1, the verifier verifies that K != K[i].
-      for (i = 0; i < verifierrl_count; ++i) {
-        if (0 == memcmp(&ctx->verifier_rl->K[i], &sig->sigma0.K,
-                        sizeof(sig->sigma0.K))) {
-          // d. If the above step fails, the verifier aborts and output 5.
-          return kEpidSigRevokedInVerifierRl;
-        }
+      if (HashSetContains(ctx->verifier_rl_index, &sig->sigma0.K)) {
+        // d. If the above step fails, the verifier aborts and output 5.
+        return kEpidSigRevokedInVerifierRl;
       }
     }
   }
@@ -196,3 +263,89 @@ EpidStatus EpidVerify(VerifierCtx const* ctx, EpidSignature const* sig,
   // Step 7. If all the above verifications succeed, the verifier outputs 0.
   return kEpidSigValid;
 }
+
+// implements section 4.1.2 "Verify algorithm" from Intel(R) EPID 2.0 Spec
+EpidStatus EpidVerify(VerifierCtx const* ctx, EpidSignature const* sig,
+                      size_t sig_len, void const* msg, size_t msg_len) {
+  // Step 1. Setup
+  VerifyRlPrecheck precheck;
+  MsgSource source;
+  EpidStatus sts = kEpidErr;
+  if (!ctx || !sig) {
+    return kEpidBadArgErr;
+  }
+  if (!ctx->epid2_params || !ctx->pub_key) {
+    return kEpidBadArgErr;
+  }
+  sts = InitMsgSourceFromBuffer(msg, msg_len, &source);
+  if (kEpidNoErr != sts) {
+    return sts;
+  }
+  PrecheckRevocationLists(ctx, &precheck);
+  return VerifyWithPrecheck(ctx, &precheck, sig, sig_len, &source);
+}
+
+EpidStatus EpidVerifyFromReader(VerifierCtx const* ctx,
+                                EpidSignature const* sig, size_t sig_len,
+                                MsgReader reader, void* reader_data,
+                                size_t msg_len) {
+  VerifyRlPrecheck precheck;
+  MsgSource source;
+  EpidStatus sts = kEpidErr;
+  if (!ctx || !sig) {
+    return kEpidBadArgErr;
+  }
+  if (!ctx->epid2_params || !ctx->pub_key) {
+    return kEpidBadArgErr;
+  }
+  sts = InitMsgSourceFromReader(reader, reader_data, msg_len, &source);
+  if (kEpidNoErr != sts) {
+    return sts;
+  }
+  PrecheckRevocationLists(ctx, &precheck);
+  return VerifyWithPrecheck(ctx, &precheck, sig, sig_len, &source);
+}
+
+EpidStatus EpidVerifyWithWorkspace(VerifierCtx const* ctx,
+                                   VerifierWorkspace* workspace,
+                                   EpidSignature const* sig, size_t sig_len,
+                                   void const* msg, size_t msg_len) {
+  EpidStatus sts = kEpidErr;
+  MemoryArena* prior_arena = NULL;
+  if (!workspace || !workspace->arena) {
+    return kEpidBadArgErr;
+  }
+  prior_arena = SetThreadMemoryArena(workspace->arena);
+  sts = EpidVerify(ctx, sig, sig_len, msg, msg_len);
+  SetThreadMemoryArena(prior_arena);
+  return sts;
+}
+
+EpidStatus EpidVerifyBatch(VerifierCtx const* ctx,
+                           EpidSignature const* const* sigs,
+                           size_t const* sig_lens, void const* const* msgs,
+                           size_t const* msg_lens, size_t n,
+                           EpidStatus* results) {
+  VerifyRlPrecheck precheck;
+  size_t i;
+  if (!ctx) {
+    return kEpidBadArgErr;
+  }
+  if (0 != n && (!sigs || !sig_lens || !msgs || !msg_lens || !results)) {
+    return kEpidBadArgErr;
+  }
+  if (!ctx->epid2_params || !ctx->pub_key) {
+    return kEpidBadArgErr;
+  }
+  // Step 1. Setup is shared by all signatures in the batch
+  PrecheckRevocationLists(ctx, &precheck);
+  for (i = 0; i < n; ++i) {
+    MsgSource source;
+    results[i] = InitMsgSourceFromBuffer(msgs[i], msg_lens[i], &source);
+    if (kEpidNoErr == results[i]) {
+      results[i] =
+          VerifyWithPrecheck(ctx, &precheck, sigs[i], sig_lens[i], &source);
+    }
+  }
+  return kEpidNoErr;
+}
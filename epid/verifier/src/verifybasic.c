@@ -22,6 +22,7 @@
 #include "epid/common/src/memory.h"
 #include "epid/verifier/api.h"
 #include "epid/verifier/src/context.h"
+#include "epid/verifier/src/verifybasic.h"
 
 /// Handle SDK Error with Break
 #define BREAK_ON_EPID_ERROR(ret) \
@@ -34,6 +35,14 @@
 
 EpidStatus EpidVerifyBasicSig(VerifierCtx const* ctx, BasicSignature const* sig,
                               void const* msg, size_t msg_len) {
+  MsgSource source;
+  EpidStatus res = InitMsgSourceFromBuffer(msg, msg_len, &source);
+  if (kEpidNoErr != res) return res;
+  return VerifyBasicSig(ctx, sig, &source);
+}
+
+EpidStatus VerifyBasicSig(VerifierCtx const* ctx, BasicSignature const* sig,
+                          MsgSource* msg) {
   EpidStatus res = kEpidNotImpl;
 
   EcPoint* B = NULL;
@@ -41,8 +50,8 @@ EpidStatus EpidVerifyBasicSig(VerifierCtx const* ctx, BasicSignature const* sig,
   EcPoint* T = NULL;
   EcPoint* R1 = NULL;
   EcPoint* t4 = NULL;
-
-  EcPoint* t1 = NULL;
+  EcPoint* Tnsx = NULL;
+  EcPoint* Tnc = NULL;
 
   FfElement* R2 = NULL;
   FfElement* t2 = NULL;
@@ -56,74 +65,68 @@ EpidStatus EpidVerifyBasicSig(VerifierCtx const* ctx, BasicSignature const* sig,
   FfElement* nsx = NULL;
   FfElement* c_hash = NULL;
 
-  if (!ctx || !sig) return kEpidBadArgErr;
-  if (!msg && (0 != msg_len)) {
-    // if message is non-empty it must have both length and content
-    return kEpidBadArgErr;
-  }
+  EcPoint** g1_temps[] = {&B, &K, &T, &R1, &t4, &Tnsx, &Tnc};
+  FfElement** gt_temps[] = {&R2, &t2};
+  FfElement** fp_temps[] = {&c, &sx, &sf, &sa, &sb, &nc, &nsx, &c_hash};
+  uint8_t* temps = NULL;
+
+  if (!ctx || !sig || !msg) return kEpidBadArgErr;
   if (!ctx->epid2_params || !ctx->pub_key) return kEpidBadArgErr;
 
   do {
     bool cmp_result = false;
-    BigNumStr c_str = {0};
-    BigNumStr sf_str = {0};
-    BigNumStr nc_str = {0};
-    BigNumStr nsx_str = {0};
-    BigNumStr sb_str = {0};
-    BigNumStr sa_str = {0};
+    size_t g1_size = 0;
+    size_t gt_size = 0;
+    size_t fp_size = 0;
+    uint8_t* next = NULL;
+    size_t i = 0;
     // handy shorthands:
     EcGroup* G1 = ctx->epid2_params->G1;
     EcGroup* G2 = ctx->epid2_params->G2;
     FiniteField* GT = ctx->epid2_params->GT;
     FiniteField* Fp = ctx->epid2_params->Fp;
     EcPoint* g1 = ctx->epid2_params->g1;
-    EcPoint* g2 = ctx->epid2_params->g2;
-    EcPoint* w = ctx->pub_key->w;
+    PreparedG2 const* g2_prepared = ctx->g2_prepared;
+    PreparedG2 const* w_prepared = ctx->w_prepared;
     CommitValues commit_values = ctx->commit_values;
     EcPoint* basename_hash = ctx->basename_hash;
 
-    if (!G1 || !G2 || !GT || !Fp || !g1 || !g2 || !w) {
+    if (!G1 || !G2 || !GT || !Fp || !g1 || !g2_prepared || !w_prepared) {
       res = kEpidBadArgErr;
       BREAK_ON_EPID_ERROR(res);
     }
 
     // The following variables B, K, T, R1, t4 (elements of G1), t1
     // (element of G2), R2, t2 (elements of GT), c, sx, sf, sa, sb,
-    // nc, nsx, t3 (256-bit integers) are used.
-    res = NewEcPoint(G1, &B);
-    BREAK_ON_EPID_ERROR(res);
-    res = NewEcPoint(G1, &K);
-    BREAK_ON_EPID_ERROR(res);
-    res = NewEcPoint(G1, &T);
-    BREAK_ON_EPID_ERROR(res);
-    res = NewEcPoint(G1, &R1);
-    BREAK_ON_EPID_ERROR(res);
-    res = NewEcPoint(G1, &t4);
-    BREAK_ON_EPID_ERROR(res);
-
-    res = NewEcPoint(G2, &t1);
-    BREAK_ON_EPID_ERROR(res);
-
-    res = NewFfElement(GT, &R2);
-    BREAK_ON_EPID_ERROR(res);
-    res = NewFfElement(GT, &t2);
-    BREAK_ON_EPID_ERROR(res);
-
-    res = NewFfElement(Fp, &c);
-    BREAK_ON_EPID_ERROR(res);
-    res = NewFfElement(Fp, &sx);
-    BREAK_ON_EPID_ERROR(res);
-    res = NewFfElement(Fp, &sf);
-    BREAK_ON_EPID_ERROR(res);
-    res = NewFfElement(Fp, &sa);
+    // nc, nsx, t3 (256-bit integers) are used. t1 is not computed, see
+    // step k; Tnsx and Tnc (elements of G1) are used in its place.
+    // All temporaries are placed in one block
+    res = EcPointGetSize(G1, &g1_size);
     BREAK_ON_EPID_ERROR(res);
-    res = NewFfElement(Fp, &sb);
+    res = FfElementGetSize(GT, &gt_size);
     BREAK_ON_EPID_ERROR(res);
-    res = NewFfElement(Fp, &nc);
+    res = FfElementGetSize(Fp, &fp_size);
     BREAK_ON_EPID_ERROR(res);
-    res = NewFfElement(Fp, &nsx);
-    BREAK_ON_EPID_ERROR(res);
-    res = NewFfElement(Fp, &c_hash);
+    temps = SAFE_ALLOC(COUNT_OF(g1_temps) * g1_size +
+                       COUNT_OF(gt_temps) * gt_size +
+                       COUNT_OF(fp_temps) * fp_size);
+    if (!temps) {
+      res = kEpidMemAllocErr;
+      break;
+    }
+    next = temps;
+    for (i = 0; i < COUNT_OF(g1_temps) && kEpidNoErr == res; i++) {
+      res = InitEcPoint(G1, next, g1_size, g1_temps[i]);
+      next += g1_size;
+    }
+    for (i = 0; i < COUNT_OF(gt_temps) && kEpidNoErr == res; i++) {
+      res = InitFfElement(GT, next, gt_size, gt_temps[i]);
+      next += gt_size;
+    }
+    for (i = 0; i < COUNT_OF(fp_temps) && kEpidNoErr == res; i++) {
+      res = InitFfElement(Fp, next, fp_size, fp_temps[i]);
+      next += fp_size;
+    }
     BREAK_ON_EPID_ERROR(res);
 
     // 1. The verifier expect pre-computation is done (e12, e22, e2w,
@@ -180,8 +183,6 @@ EpidStatus EpidVerifyBasicSig(VerifierCtx const* ctx, BasicSignature const* sig,
       }
       break;
     }
-    res = WriteFfElement(Fp, c, &c_str, sizeof(c_str));
-    BREAK_ON_EPID_ERROR(res);
     res = ReadFfElement(Fp, &(sig->sx), sizeof(sig->sx), sx);
     if (kEpidNoErr != res) {
       if (kEpidBadArgErr == res) {
@@ -217,54 +218,55 @@ EpidStatus EpidVerifyBasicSig(VerifierCtx const* ctx, BasicSignature const* sig,
     res = FfNeg(Fp, sx, nsx);
     BREAK_ON_EPID_ERROR(res);
     //   i. The verifier computes R1 = G1.multiExp(B, sf, K, nc).
-    res = WriteFfElement(Fp, sf, &sf_str, sizeof(sf_str));
-    BREAK_ON_EPID_ERROR(res);
-    res = WriteFfElement(Fp, nc, &nc_str, sizeof(nc_str));
-    BREAK_ON_EPID_ERROR(res);
+    //      The powers are taken from the Fp elements directly.
     {
       EcPoint const* points[2];
-      BigNumStr const* exponents[2];
+      FfElement const* exponents[2];
       points[0] = B;
       points[1] = K;
-      exponents[0] = &sf_str;
-      exponents[1] = &nc_str;
-      res = EcMultiExp(G1, points, exponents, COUNT_OF(points), R1);
+      exponents[0] = sf;
+      exponents[1] = nc;
+      res = EcMultiExpFp(G1, points, Fp, exponents, COUNT_OF(points), R1);
       BREAK_ON_EPID_ERROR(res);
     }
     //   j. The verifier computes t1 = G2.multiExp(g2, nsx, w, nc).
-    res = WriteFfElement(Fp, nsx, &nsx_str, sizeof(nsx_str));
+    //   k. The verifier computes R2 = pairing(T, t1).
+    //      By bilinearity R2 = pairing(T^nsx, g2) * pairing(T^nc, w).
+    //      g2 and w are fixed, so this is computed from their prepared
+    //      Miller loop lines with a single final exponentiation. T was
+    //      validated when read, so T^nsx and T^nc are not checked again.
+    res = EcExpFp(G1, T, Fp, nsx, Tnsx);
+    BREAK_ON_EPID_ERROR(res);
+    res = EcExpFp(G1, T, Fp, nc, Tnc);
     BREAK_ON_EPID_ERROR(res);
     {
       EcPoint const* points[2];
-      BigNumStr const* exponents[2];
-      points[0] = g2;
-      points[1] = w;
-      exponents[0] = &nsx_str;
-      exponents[1] = &nc_str;
-      res = EcMultiExp(G2, points, exponents, COUNT_OF(points), t1);
+      PreparedG2 const* prepared[2];
+      points[0] = Tnsx;
+      points[1] = Tnc;
+      prepared[0] = g2_prepared;
+      prepared[1] = w_prepared;
+      res = PairingProductTrusted(ctx->epid2_params->pairing_state, points,
+                                  prepared, COUNT_OF(points), R2);
       BREAK_ON_EPID_ERROR(res);
     }
-    //   k. The verifier computes R2 = pairing(T, t1).
-    res = Pairing(ctx->epid2_params->pairing_state, T, t1, R2);
-    BREAK_ON_EPID_ERROR(res);
     //   l. The verifier compute t2 = GT.multiExp(e12, sf, e22, sb,
     //      e2w, sa, eg12, c).
-    res = WriteFfElement(Fp, sb, &sb_str, sizeof(sb_str));
-    BREAK_ON_EPID_ERROR(res);
-    res = WriteFfElement(Fp, sa, &sa_str, sizeof(sa_str));
-    BREAK_ON_EPID_ERROR(res);
+    //      e12, e22, e2w and eg12 are fixed, so their comb tables are used.
+    //      sf, sb, sa and c were range checked when read, so the powers
+    //      are taken from the signature as is.
     {
-      FfElement const* points[4];
+      FfCombTable const* tables[4];
       BigNumStr const* exponents[4];
-      points[0] = ctx->e12;
-      points[1] = ctx->e22;
-      points[2] = ctx->e2w;
-      points[3] = ctx->eg12;
-      exponents[0] = &sf_str;
-      exponents[1] = &sb_str;
-      exponents[2] = &sa_str;
-      exponents[3] = &c_str;
-      res = FfMultiExp(GT, points, exponents, COUNT_OF(points), t2);
+      tables[0] = ctx->e12_table;
+      tables[1] = ctx->e22_table;
+      tables[2] = ctx->e2w_table;
+      tables[3] = ctx->eg12_table;
+      exponents[0] = (BigNumStr const*)&sig->sf;
+      exponents[1] = (BigNumStr const*)&sig->sb;
+      exponents[2] = (BigNumStr const*)&sig->sa;
+      exponents[3] = (BigNumStr const*)&sig->c;
+      res = FfMultiExpComb(GT, tables, exponents, COUNT_OF(tables), t2);
       BREAK_ON_EPID_ERROR(res);
     }
     //   m. The verifier compute R2 = GT.mul(R2, t2).
@@ -276,8 +278,8 @@ EpidStatus EpidVerifyBasicSig(VerifierCtx const* ctx, BasicSignature const* sig,
     res = SetCalculatedCommitValues(&sig->B, &sig->K, &sig->T, R1, G1, R2, GT,
                                     &commit_values);
     BREAK_ON_EPID_ERROR(res);
-    res = CalculateCommitmentHash(&commit_values, Fp, ctx->hash_alg, msg,
-                                  msg_len, c_hash);
+    res = CalculateCommitmentHash(&commit_values, Fp, ctx->hash_alg,
+                                  ctx->commit_hash_prefix, msg, c_hash);
     BREAK_ON_EPID_ERROR(res);
 
     res = FfIsEqual(Fp, c, c_hash, &cmp_result);
@@ -292,25 +294,7 @@ EpidStatus EpidVerifyBasicSig(VerifierCtx const* ctx, BasicSignature const* sig,
     res = kEpidNoErr;
   } while (0);
 
-  DeleteEcPoint(&B);
-  DeleteEcPoint(&K);
-  DeleteEcPoint(&T);
-  DeleteEcPoint(&R1);
-  DeleteEcPoint(&t4);
-
-  DeleteEcPoint(&t1);
-
-  DeleteFfElement(&R2);
-  DeleteFfElement(&t2);
-
-  DeleteFfElement(&c);
-  DeleteFfElement(&sx);
-  DeleteFfElement(&sf);
-  DeleteFfElement(&sa);
-  DeleteFfElement(&sb);
-  DeleteFfElement(&nc);
-  DeleteFfElement(&nsx);
-  DeleteFfElement(&c_hash);
+  SAFE_FREE(temps);
 
   return (res);
 }
@@ -0,0 +1,47 @@
+/*############################################################################
+  # Copyright 2016-2017 Intel Corporation
+  #
+  # Licensed under the Apache License, Version 2.0 (the "License");
+  # you may not use this file except in compliance with the License.
+  # You may obtain a copy of the License at
+  #
+  #     http://www.apache.org/licenses/LICENSE-2.0
+  #
+  # Unless required by applicable law or agreed to in writing, software
+  # distributed under the License is distributed on an "AS IS" BASIS,
+  # WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  # See the License for the specific language governing permissions and
+  # limitations under the License.
+  ############################################################################*/
+/// Basic signature verification internal interface.
+/*! \file */
+#ifndef EPID_VERIFIER_SRC_VERIFYBASIC_H_
+#define EPID_VERIFIER_SRC_VERIFYBASIC_H_
+
+#include "epid/common/errors.h"
+#include "epid/common/src/msgsource.h"
+
+/// \cond
+typedef struct VerifierCtx VerifierCtx;
+typedef struct BasicSignature BasicSignature;
+/// \endcond
+
+/// Verifies a basic signature of a message from a message source.
+/*!
+ Same as EpidVerifyBasicSig but the message can be read in parts.
+
+ \param[in] ctx
+ The verifier context.
+ \param[in] sig
+ The basic signature.
+ \param[in] msg
+ The message that was signed.
+
+ \returns ::EpidStatus
+
+ \see EpidVerifyBasicSig
+ */
+EpidStatus VerifyBasicSig(VerifierCtx const* ctx, BasicSignature const* sig,
+                          MsgSource* msg);
+
+#endif  // EPID_VERIFIER_SRC_VERIFYBASIC_H_
@@ -91,6 +91,67 @@ TEST_F(EpidVerifierTest, CreateFailsGivenBadGroupIdInPrecomp) {
   EXPECT_EQ(kEpidBadArgErr,
             EpidVerifierCreate(&this->kPubKeyStr, &verifier_precomp, &ctx));
 }
+TEST_F(EpidVerifierTest, CreateSetsEg12ToPairingOfGenerators) {
+  VerifierCtxObj verifier(this->kPubKeyStr);
+  Epid2Params_* params = ((VerifierCtx*)verifier)->epid2_params;
+  FfElement* eg12 = nullptr;
+  bool is_equal = false;
+  THROW_ON_EPIDERR(NewFfElement(params->GT, &eg12));
+  THROW_ON_EPIDERR(
+      Pairing(params->pairing_state, params->g1, params->g2, eg12));
+  EXPECT_EQ(kEpidNoErr, FfIsEqual(params->GT, eg12,
+                                  ((VerifierCtx*)verifier)->eg12, &is_equal));
+  DeleteFfElement(&eg12);
+  EXPECT_TRUE(is_equal);
+}
+//////////////////////////////////////////////////////////////////////////
+// EpidVerifierCreateWithParams Tests
+TEST_F(EpidVerifierTest, CreateWithParamsFailsGivenNullPointer) {
+  VerifierCtx* ctx = nullptr;
+  EpidSharedParams* params = nullptr;
+  THROW_ON_EPIDERR(EpidSharedParamsCreate(&params));
+  EXPECT_EQ(kEpidBadArgErr, EpidVerifierCreateWithParams(
+                                &this->kPubKeyStr, nullptr, nullptr, &ctx));
+  EXPECT_EQ(kEpidBadArgErr, EpidVerifierCreateWithParams(nullptr, nullptr,
+                                                         params, &ctx));
+  EXPECT_EQ(kEpidBadArgErr, EpidVerifierCreateWithParams(
+                                &this->kPubKeyStr, nullptr, params, nullptr));
+  EpidSharedParamsDelete(&params);
+}
+TEST_F(EpidVerifierTest, CreateWithParamsSharesParamsBetweenContexts) {
+  VerifierCtx* ctx1 = nullptr;
+  VerifierCtx* ctx2 = nullptr;
+  EpidSharedParams* params = nullptr;
+  THROW_ON_EPIDERR(EpidSharedParamsCreate(&params));
+  EXPECT_EQ(kEpidNoErr, EpidVerifierCreateWithParams(&this->kPubKeyStr,
+                                                     nullptr, params, &ctx1));
+  EXPECT_EQ(kEpidNoErr, EpidVerifierCreateWithParams(&this->kGrpXKey, nullptr,
+                                                     params, &ctx2));
+  ASSERT_NE(nullptr, ctx1);
+  ASSERT_NE(nullptr, ctx2);
+  EXPECT_EQ(params, ctx1->epid2_params);
+  EXPECT_EQ(params, ctx2->epid2_params);
+  EpidVerifierDelete(&ctx1);
+  EpidVerifierDelete(&ctx2);
+  EpidSharedParamsDelete(&params);
+  EXPECT_EQ(nullptr, params);
+}
+TEST_F(EpidVerifierTest, CreateWithParamsMatchesPrecompOfCreate) {
+  VerifierCtx* ctx = nullptr;
+  EpidSharedParams* params = nullptr;
+  VerifierPrecomp precomp;
+  VerifierPrecomp shared_precomp;
+  VerifierCtxObj verifier(this->kPubKeyStr);
+  THROW_ON_EPIDERR(EpidVerifierWritePrecomp(verifier, &precomp));
+  THROW_ON_EPIDERR(EpidSharedParamsCreate(&params));
+  THROW_ON_EPIDERR(
+      EpidVerifierCreateWithParams(&this->kPubKeyStr, nullptr, params, &ctx));
+  // the context keeps the params after the creator releases them
+  EpidSharedParamsDelete(&params);
+  EXPECT_EQ(kEpidNoErr, EpidVerifierWritePrecomp(ctx, &shared_precomp));
+  EpidVerifierDelete(&ctx);
+  EXPECT_EQ(precomp, shared_precomp);
+}
 //////////////////////////////////////////////////////////////////////////
 // EpidVerifierDelete Tests
 TEST_F(EpidVerifierTest, DeleteNullsVerifierCtx) {
@@ -242,6 +303,55 @@ TEST_F(EpidVerifierTest, SetPrivRlFailsGivenOldVersion) {
             EpidVerifierSetPrivRl(verifier, &prl, sizeof(prl) - sizeof(prl.f)));
 }
 
+TEST_F(EpidVerifierTest, SetPrivRlDoesNotIndexPrivRlGivenRandomBase) {
+  VerifierCtxObj verifier(this->kGrpXKey);
+  VerifierCtx* ctx = verifier;
+  auto& priv_rl = this->kGrpXPrivRl;
+  THROW_ON_EPIDERR(EpidVerifierSetPrivRl(ctx, (PrivRl const*)priv_rl.data(),
+                                         priv_rl.size()));
+  EXPECT_EQ(nullptr, ctx->priv_rl_index);
+}
+
+TEST_F(EpidVerifierTest, SetPrivRlIndexesEveryEntryGivenBasename) {
+  VerifierCtxObj verifier(this->kGrpXKey);
+  VerifierCtx* ctx = verifier;
+  auto& priv_rl = this->kGrpXPrivRl;
+  auto& basename = this->kBsn0;
+  THROW_ON_EPIDERR(
+      EpidVerifierSetBasename(ctx, basename.data(), basename.size()));
+  THROW_ON_EPIDERR(EpidVerifierSetPrivRl(ctx, (PrivRl const*)priv_rl.data(),
+                                         priv_rl.size()));
+  ASSERT_NE(nullptr, ctx->priv_rl_index);
+  EXPECT_EQ(ntohl(((PrivRl const*)priv_rl.data())->n1),
+            HashSetGetSize(ctx->priv_rl_index));
+}
+
+TEST_F(EpidVerifierTest, SetPrivRlDoesNotIndexCorruptedPrivRl) {
+  VerifierCtxObj verifier(this->kGrpXKey);
+  VerifierCtx* ctx = verifier;
+  auto& priv_rl = this->kGrpXCorruptedPrivRl;
+  auto& basename = this->kBsn0;
+  THROW_ON_EPIDERR(
+      EpidVerifierSetBasename(ctx, basename.data(), basename.size()));
+  THROW_ON_EPIDERR(EpidVerifierSetPrivRl(ctx, (PrivRl const*)priv_rl.data(),
+                                         priv_rl.size()));
+  EXPECT_EQ(nullptr, ctx->priv_rl_index);
+}
+
+TEST_F(EpidVerifierTest, SetBasenameResetsPrivRlIndexGivenNullBasename) {
+  VerifierCtxObj verifier(this->kGrpXKey);
+  VerifierCtx* ctx = verifier;
+  auto& priv_rl = this->kGrpXPrivRl;
+  auto& basename = this->kBsn0;
+  THROW_ON_EPIDERR(EpidVerifierSetPrivRl(ctx, (PrivRl const*)priv_rl.data(),
+                                         priv_rl.size()));
+  THROW_ON_EPIDERR(
+      EpidVerifierSetBasename(ctx, basename.data(), basename.size()));
+  EXPECT_NE(nullptr, ctx->priv_rl_index);
+  THROW_ON_EPIDERR(EpidVerifierSetBasename(ctx, nullptr, 0));
+  EXPECT_EQ(nullptr, ctx->priv_rl_index);
+}
+
 //////////////////////////////////////////////////////////////////////////
 // EpidVerifierSetSigRl
 TEST_F(EpidVerifierTest, SetSigRlFailsGivenNullPointer) {
@@ -638,6 +748,20 @@ TEST_F(EpidVerifierTest, CanSetVerifierRlTwice) {
                             this->kGrpXBsn0Sha256VerRl.size()));
 }
 
+TEST_F(EpidVerifierTest, SetVerifierRlIndexesAllEntries) {
+  VerifierCtxObj verifier(this->kGrpXKey);
+  VerifierCtx* ctx = verifier;
+  auto const& ver_rl = this->kGrpXBsn0VerRlSingleEntry;
+  VerifierRl const* ver_rl_ptr =
+      reinterpret_cast<VerifierRl const*>(ver_rl.data());
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha256));
+  THROW_ON_EPIDERR(EpidVerifierSetBasename(verifier, this->kBsn0.data(),
+                                           this->kBsn0.size()));
+  EXPECT_EQ(kEpidNoErr,
+            EpidVerifierSetVerifierRl(verifier, ver_rl_ptr, ver_rl.size()));
+  EXPECT_EQ((size_t)1, HashSetGetSize(ctx->verifier_rl_index));
+  EXPECT_TRUE(HashSetContains(ctx->verifier_rl_index, &ver_rl_ptr->K[0]));
+}
 TEST_F(EpidVerifierTest, SetVerifierRlFailsGivenBadGroupId) {
   VerifierCtxObj verifier(this->kPubKeyStr, this->kVerifierPrecompStr);
   VerifierRl ver_rl = {{0}, {{0}, {0}}, {0}, {0}, {{{0}, {0}}}};
@@ -1012,6 +1136,55 @@ TEST_F(EpidVerifierTest, BlacklistSigWorksForMsgContainingAllPossibleBytes) {
   EXPECT_EQ(n4_expected, ver_rl->n4);
   EXPECT_EQ(rlver_expected, ver_rl->version);
 }
+TEST_F(EpidVerifierTest, BlacklistSigRejectsSigBlacklistedBefore) {
+  VerifierCtxObj verifier(this->kGrpXKey);
+  auto sig = this->kSigGrpXMember0Sha256Bsn0Msg0;
+  auto msg = this->kMsg0;
+  auto bsn = this->kBsn0;
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha256));
+  THROW_ON_EPIDERR(EpidVerifierSetBasename(verifier, bsn.data(), bsn.size()));
+  THROW_ON_EPIDERR(EpidBlacklistSig(verifier, (EpidSignature*)sig.data(),
+                                    sig.size(), msg.data(), msg.size()));
+  EXPECT_EQ(kEpidSigRevokedInVerifierRl,
+            EpidBlacklistSig(verifier, (EpidSignature*)sig.data(), sig.size(),
+                             msg.data(), msg.size()));
+  EXPECT_EQ(sizeof(VerifierRl), EpidGetVerifierRlSize(verifier));
+}
+TEST_F(EpidVerifierTest, BlacklistSigKeepsEntriesWhenVerifierRlGrows) {
+  VerifierCtxObj verifier(this->kGrpXKey);
+  VerifierCtx* ctx = verifier;
+  auto sig = this->kSigGrpXMember0Sha256Bsn0Msg0;
+  auto msg = this->kMsg0;
+  auto bsn = this->kBsn0;
+  // fill a list past the point where blacklisting has to grow it
+  const size_t kPriorCount = 16;
+  auto const& single_entry = this->kGrpXBsn0VerRlSingleEntry;
+  std::vector<uint8_t> ver_rl_buf(single_entry.begin(), single_entry.end());
+  ver_rl_buf.resize(single_entry.size() +
+                    (kPriorCount - 1) * sizeof(((VerifierRl*)0)->K[0]));
+  VerifierRl* prior_rl = (VerifierRl*)ver_rl_buf.data();
+  for (size_t i = 1; i < kPriorCount; i++) {
+    memset(&prior_rl->K[i], (int)i, sizeof(prior_rl->K[i]));
+  }
+  prior_rl->n4 = {0x00, 0x00, 0x00, (uint8_t)kPriorCount};
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha256));
+  THROW_ON_EPIDERR(EpidVerifierSetBasename(verifier, bsn.data(), bsn.size()));
+  THROW_ON_EPIDERR(
+      EpidVerifierSetVerifierRl(verifier, prior_rl, ver_rl_buf.size()));
+  EXPECT_EQ(kEpidNoErr, EpidBlacklistSig(verifier, (EpidSignature*)sig.data(),
+                                         sig.size(), msg.data(), msg.size()));
+  EXPECT_EQ(kPriorCount + 1, HashSetGetSize(ctx->verifier_rl_index));
+
+  std::vector<uint8_t> ver_rl_vec(EpidGetVerifierRlSize(verifier));
+  VerifierRl* ver_rl = (VerifierRl*)ver_rl_vec.data();
+  THROW_ON_EPIDERR(EpidWriteVerifierRl(verifier, ver_rl, ver_rl_vec.size()));
+  OctStr32 n4_expected = {0x00, 0x00, 0x00, (uint8_t)(kPriorCount + 1)};
+  EXPECT_EQ(n4_expected, ver_rl->n4);
+  EXPECT_EQ(0, memcmp(prior_rl->K, ver_rl->K,
+                      kPriorCount * sizeof(ver_rl->K[0])));
+  EXPECT_EQ(0, memcmp(&((EpidSignature const*)sig.data())->sigma0.K,
+                      &ver_rl->K[kPriorCount], sizeof(ver_rl->K[0])));
+}
 //////////////////////////////////////////////////////////////////////////
 // EpidVerifierSetHashAlg
 TEST_F(EpidVerifierTest, SetHashAlgFailsGivenNullPointer) {
@@ -1108,4 +1281,73 @@ TEST_F(EpidVerifierTest, SetBasenameAcceptsBsnContainingAllPossibleBytes) {
   EXPECT_EQ(kEpidNoErr,
             EpidVerifierSetBasename(ctx, basename.data(), basename.size()));
 }
+
+//////////////////////////////////////////////////////////////////////////
+// EpidVerifierSetSigRlRunner
+EpidStatus StubTaskRunner(EpidTask, void*, size_t, void*) { return kEpidNoErr; }
+TEST_F(EpidVerifierTest, SetSigRlRunnerFailsGivenNullContext) {
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidVerifierSetSigRlRunner(nullptr, StubTaskRunner, nullptr));
+}
+TEST_F(EpidVerifierTest, DefaultSigRlRunnerIsNull) {
+  VerifierCtxObj verifier(this->kPubKeyStr, this->kVerifierPrecompStr);
+  VerifierCtx* ctx = verifier;
+  EXPECT_EQ(nullptr, ctx->sig_rl_runner);
+}
+TEST_F(EpidVerifierTest, SetSigRlRunnerCanSetAndResetRunner) {
+  VerifierCtxObj verifier(this->kPubKeyStr, this->kVerifierPrecompStr);
+  VerifierCtx* ctx = verifier;
+  int user_data = 0;
+  EXPECT_EQ(kEpidNoErr,
+            EpidVerifierSetSigRlRunner(ctx, StubTaskRunner, &user_data));
+  EXPECT_EQ(&StubTaskRunner, ctx->sig_rl_runner);
+  EXPECT_EQ(&user_data, ctx->sig_rl_runner_data);
+  EXPECT_EQ(kEpidNoErr, EpidVerifierSetSigRlRunner(ctx, nullptr, &user_data));
+  EXPECT_EQ(nullptr, ctx->sig_rl_runner);
+  EXPECT_EQ(nullptr, ctx->sig_rl_runner_data);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// EpidVerifierSetPrivRlRunner
+TEST_F(EpidVerifierTest, SetPrivRlRunnerFailsGivenNullContext) {
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidVerifierSetPrivRlRunner(nullptr, StubTaskRunner, nullptr));
+}
+TEST_F(EpidVerifierTest, DefaultPrivRlRunnerIsNull) {
+  VerifierCtxObj verifier(this->kPubKeyStr, this->kVerifierPrecompStr);
+  VerifierCtx* ctx = verifier;
+  EXPECT_EQ(nullptr, ctx->priv_rl_runner);
+}
+TEST_F(EpidVerifierTest, SetPrivRlRunnerCanSetAndResetRunner) {
+  VerifierCtxObj verifier(this->kPubKeyStr, this->kVerifierPrecompStr);
+  VerifierCtx* ctx = verifier;
+  int user_data = 0;
+  EXPECT_EQ(kEpidNoErr,
+            EpidVerifierSetPrivRlRunner(ctx, StubTaskRunner, &user_data));
+  EXPECT_EQ(&StubTaskRunner, ctx->priv_rl_runner);
+  EXPECT_EQ(&user_data, ctx->priv_rl_runner_data);
+  EXPECT_EQ(kEpidNoErr, EpidVerifierSetPrivRlRunner(ctx, nullptr, &user_data));
+  EXPECT_EQ(nullptr, ctx->priv_rl_runner);
+  EXPECT_EQ(nullptr, ctx->priv_rl_runner_data);
+}
+//////////////////////////////////////////////////////////////////////////
+// EpidVerifierWorkspaceCreate
+TEST_F(EpidVerifierTest, WorkspaceCreateFailsGivenNullPointer) {
+  EXPECT_EQ(kEpidBadArgErr, EpidVerifierWorkspaceCreate(nullptr));
+}
+TEST_F(EpidVerifierTest, WorkspaceCreateSucceedsAndDeleteNullsPointer) {
+  VerifierWorkspace* workspace = nullptr;
+  EXPECT_EQ(kEpidNoErr, EpidVerifierWorkspaceCreate(&workspace));
+  EXPECT_NE(nullptr, workspace);
+  EpidVerifierWorkspaceDelete(&workspace);
+  EXPECT_EQ(nullptr, workspace);
+}
+//////////////////////////////////////////////////////////////////////////
+// EpidVerifierWorkspaceDelete
+TEST_F(EpidVerifierTest, WorkspaceDeleteWorksGivenNullPointer) {
+  VerifierWorkspace* workspace = nullptr;
+  EpidVerifierWorkspaceDelete(nullptr);
+  EpidVerifierWorkspaceDelete(&workspace);
+  EXPECT_EQ(nullptr, workspace);
+}
 }  // namespace
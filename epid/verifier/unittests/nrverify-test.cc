@@ -19,11 +19,15 @@
  * \brief NrVerify unit tests.
  */
 
+#include <cstring>
+#include <vector>
+
 #include "epid/common-testhelper/epid_gtest-testhelper.h"
 #include "gtest/gtest.h"
 
 extern "C" {
 #include "epid/verifier/api.h"
+#include "epid/verifier/src/nrverify.h"
 }
 
 #include "epid/common-testhelper/errors-testhelper.h"
@@ -289,4 +293,195 @@ TEST_F(EpidVerifierTest, NrVerifyAcceptsMsgContainingAllPossibleBytes) {
                          &sig_rl->bk[0], &epid_signature->sigma[0]));
 }
 
+/////////////////////////////////////////////////////////////////////
+// Precomputed B and K tables
+
+TEST_F(EpidVerifierTest, NewNrVerifyPrecompFailsGivenNullParameters) {
+  VerifierCtxObj verifier(this->kGrp01Key);
+  EpidSignature const* epid_signature = reinterpret_cast<EpidSignature const*>(
+      this->kSigGrp01Member0Sha256RandombaseTest0.data());
+  NrVerifyPrecomp* precomp = nullptr;
+  EXPECT_EQ(kEpidBadArgErr,
+            NewNrVerifyPrecomp(nullptr, &epid_signature->sigma0, &precomp));
+  EXPECT_EQ(kEpidBadArgErr, NewNrVerifyPrecomp(verifier, nullptr, &precomp));
+  EXPECT_EQ(kEpidBadArgErr,
+            NewNrVerifyPrecomp(verifier, &epid_signature->sigma0, nullptr));
+}
+
+TEST_F(EpidVerifierTest, DeleteNrVerifyPrecompWorksGivenNullPointer) {
+  EXPECT_NO_THROW(DeleteNrVerifyPrecomp(nullptr));
+  NrVerifyPrecomp* precomp = nullptr;
+  EXPECT_NO_THROW(DeleteNrVerifyPrecomp(&precomp));
+}
+
+TEST_F(EpidVerifierTest, NrVerifyWithPrecompRejectsSigWithInvalidCommitment) {
+  VerifierCtxObj verifier(this->kGrp01Key);
+  EpidSignature const* epid_signature = reinterpret_cast<EpidSignature const*>(
+      this->kSigGrp01Member0Sha256RandombaseTest0.data());
+  SigRl const* sig_rl =
+      reinterpret_cast<SigRl const*>(this->kGrp01SigRl.data());
+  std::vector<uint8_t> test_msg = this->kTest0;
+  test_msg[0]++;
+  MsgSource msg;
+  THROW_ON_EPIDERR(
+      InitMsgSourceFromBuffer(test_msg.data(), test_msg.size(), &msg));
+  NrVerifyPrecomp* precomp = nullptr;
+  THROW_ON_EPIDERR(
+      NewNrVerifyPrecomp(verifier, &epid_signature->sigma0, &precomp));
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidNrVerifyWithPrecomp(verifier, &epid_signature->sigma0, precomp,
+                                    &msg, &sig_rl->bk[0],
+                                    &epid_signature->sigma[0]));
+  DeleteNrVerifyPrecomp(&precomp);
+}
+
+TEST_F(EpidVerifierTest, NrVerifyWithPrecompAcceptsSigWithRandomBaseName) {
+  VerifierCtxObj verifier(this->kPubKeyIkgfStr);
+  EpidSignature const* epid_signature = reinterpret_cast<EpidSignature const*>(
+      this->kSigMember0Sha256RandombaseMsg0Ikgf.data());
+  SigRl const* sig_rl = reinterpret_cast<SigRl const*>(this->kSigRlIkgf.data());
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha256));
+  MsgSource msg;
+  THROW_ON_EPIDERR(
+      InitMsgSourceFromBuffer(this->kMsg0.data(), this->kMsg0.size(), &msg));
+  NrVerifyPrecomp* precomp = nullptr;
+  THROW_ON_EPIDERR(
+      NewNrVerifyPrecomp(verifier, &epid_signature->sigma0, &precomp));
+  // the same tables serve every entry
+  for (size_t i = 0; i < 3; ++i) {
+    EXPECT_EQ(kEpidSigValid,
+              EpidNrVerifyWithPrecomp(verifier, &epid_signature->sigma0,
+                                      precomp, &msg, &sig_rl->bk[i],
+                                      &epid_signature->sigma[i]))
+        << "entry " << i;
+  }
+  DeleteNrVerifyPrecomp(&precomp);
+}
+
+/////////////////////////////////////////////////////////////////////
+// Batches of SigRL entries
+
+TEST_F(EpidVerifierTest, NrVerifyBatchFailsGivenNullParameters) {
+  VerifierCtxObj verifier(this->kGrp01Key);
+  EpidSignature const* epid_signature = reinterpret_cast<EpidSignature const*>(
+      this->kSigGrp01Member0Sha256RandombaseTest0.data());
+  SigRl const* sig_rl =
+      reinterpret_cast<SigRl const*>(this->kGrp01SigRl.data());
+  MsgSource msg;
+  THROW_ON_EPIDERR(
+      InitMsgSourceFromBuffer(this->kTest0.data(), this->kTest0.size(), &msg));
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidNrVerifyBatch(nullptr, &epid_signature->sigma0, nullptr, &msg,
+                              sig_rl->bk, epid_signature->sigma, 1));
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidNrVerifyBatch(verifier, nullptr, nullptr, &msg, sig_rl->bk,
+                              epid_signature->sigma, 1));
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidNrVerifyBatch(verifier, &epid_signature->sigma0, nullptr,
+                              nullptr, sig_rl->bk, epid_signature->sigma, 1));
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidNrVerifyBatch(verifier, &epid_signature->sigma0, nullptr, &msg,
+                              nullptr, epid_signature->sigma, 1));
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidNrVerifyBatch(verifier, &epid_signature->sigma0, nullptr, &msg,
+                              sig_rl->bk, nullptr, 1));
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidNrVerifyBatch(verifier, &epid_signature->sigma0, nullptr, &msg,
+                              sig_rl->bk, epid_signature->sigma, 0));
+}
+
+TEST_F(EpidVerifierTest, NrVerifyBatchAcceptsSigWithRandomBaseName) {
+  VerifierCtxObj verifier(this->kPubKeyIkgfStr);
+  EpidSignature const* epid_signature = reinterpret_cast<EpidSignature const*>(
+      this->kSigMember0Sha256RandombaseMsg0Ikgf.data());
+  SigRl const* sig_rl = reinterpret_cast<SigRl const*>(this->kSigRlIkgf.data());
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha256));
+  MsgSource msg;
+  THROW_ON_EPIDERR(
+      InitMsgSourceFromBuffer(this->kMsg0.data(), this->kMsg0.size(), &msg));
+  NrVerifyPrecomp* precomp = nullptr;
+  THROW_ON_EPIDERR(
+      NewNrVerifyPrecomp(verifier, &epid_signature->sigma0, &precomp));
+  EXPECT_EQ(kEpidSigValid,
+            EpidNrVerifyBatch(verifier, &epid_signature->sigma0, nullptr, &msg,
+                              sig_rl->bk, epid_signature->sigma, 3));
+  EXPECT_EQ(kEpidSigValid,
+            EpidNrVerifyBatch(verifier, &epid_signature->sigma0, precomp, &msg,
+                              sig_rl->bk, epid_signature->sigma, 3));
+  DeleteNrVerifyPrecomp(&precomp);
+}
+
+TEST_F(EpidVerifierTest, NrVerifyBatchRejectsSigWithOneBadProof) {
+  VerifierCtxObj verifier(this->kPubKeyIkgfStr);
+  EpidSignature const* epid_signature = reinterpret_cast<EpidSignature const*>(
+      this->kSigMember0Sha256RandombaseMsg0Ikgf.data());
+  SigRl const* sig_rl = reinterpret_cast<SigRl const*>(this->kSigRlIkgf.data());
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha256));
+  MsgSource msg;
+  THROW_ON_EPIDERR(
+      InitMsgSourceFromBuffer(this->kMsg0.data(), this->kMsg0.size(), &msg));
+  std::vector<NrProof> proofs(epid_signature->sigma,
+                              epid_signature->sigma + 3);
+  // a bad challenge fails in the hashing pass
+  proofs[1].c.data.data[31]++;
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidNrVerifyBatch(verifier, &epid_signature->sigma0, nullptr, &msg,
+                              sig_rl->bk, proofs.data(), proofs.size()));
+  // a T outside G1 fails before the commitments are hashed
+  proofs[1] = epid_signature->sigma[1];
+  proofs[2].T.x.data.data[31]++;
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidNrVerifyBatch(verifier, &epid_signature->sigma0, nullptr, &msg,
+                              sig_rl->bk, proofs.data(), proofs.size()));
+}
+
+/// Reads a message held in a std::vector
+int __STDCALL ReadMsgFromVector(void* buf, size_t len, size_t offset,
+                                void* user_data) {
+  auto const* msg = static_cast<std::vector<uint8_t> const*>(user_data);
+  if (offset > msg->size() || len > msg->size() - offset) {
+    return -1;
+  }
+  memcpy(buf, msg->data() + offset, len);
+  return 0;
+}
+
+/// Fails every read
+int __STDCALL FailingMsgReader(void*, size_t, size_t, void*) { return -1; }
+
+TEST_F(EpidVerifierTest, NrVerifyBatchRecordsReaderFailureInMsgSource) {
+  VerifierCtxObj verifier(this->kPubKeyIkgfStr);
+  EpidSignature const* epid_signature = reinterpret_cast<EpidSignature const*>(
+      this->kSigMember0Sha256RandombaseMsg0Ikgf.data());
+  SigRl const* sig_rl = reinterpret_cast<SigRl const*>(this->kSigRlIkgf.data());
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha256));
+  MsgSource msg;
+  THROW_ON_EPIDERR(InitMsgSourceFromReader(FailingMsgReader, nullptr,
+                                           this->kMsg0.size(), &msg));
+  EXPECT_FALSE(msg.read_failed);
+  EXPECT_EQ(kEpidErr,
+            EpidNrVerifyBatch(verifier, &epid_signature->sigma0, nullptr, &msg,
+                              sig_rl->bk, epid_signature->sigma, 3));
+  EXPECT_TRUE(msg.read_failed);
+}
+
+TEST_F(EpidVerifierTest, NrVerifyBatchDoesNotRecordReaderFailureForBadProof) {
+  VerifierCtxObj verifier(this->kPubKeyIkgfStr);
+  EpidSignature const* epid_signature = reinterpret_cast<EpidSignature const*>(
+      this->kSigMember0Sha256RandombaseMsg0Ikgf.data());
+  SigRl const* sig_rl = reinterpret_cast<SigRl const*>(this->kSigRlIkgf.data());
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha256));
+  std::vector<uint8_t> msg_buf = this->kMsg0;
+  MsgSource msg;
+  THROW_ON_EPIDERR(InitMsgSourceFromReader(ReadMsgFromVector, &msg_buf,
+                                           msg_buf.size(), &msg));
+  std::vector<NrProof> proofs(epid_signature->sigma,
+                              epid_signature->sigma + 3);
+  proofs[1].c.data.data[31]++;
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidNrVerifyBatch(verifier, &epid_signature->sigma0, nullptr, &msg,
+                              sig_rl->bk, proofs.data(), proofs.size()));
+  EXPECT_FALSE(msg.read_failed);
+}
+
 }  // namespace
@@ -0,0 +1,213 @@
+/*############################################################################
+  # Copyright 2017 Intel Corporation
+  #
+  # Licensed under the Apache License, Version 2.0 (the "License");
+  # you may not use this file except in compliance with the License.
+  # You may obtain a copy of the License at
+  #
+  #     http://www.apache.org/licenses/LICENSE-2.0
+  #
+  # Unless required by applicable law or agreed to in writing, software
+  # distributed under the License is distributed on an "AS IS" BASIS,
+  # WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  # See the License for the specific language governing permissions and
+  # limitations under the License.
+  ############################################################################*/
+
+/*!
+ * \file
+ * \brief Verifier pre-computation store unit tests.
+ */
+
+#include <cstring>
+#include <vector>
+
+#include "epid/common-testhelper/epid_gtest-testhelper.h"
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "epid/verifier/api.h"
+}
+
+#include "epid/common-testhelper/errors-testhelper.h"
+#include "epid/common-testhelper/verifier_wrapper-testhelper.h"
+#include "epid/verifier/unittests/verifier-testhelper.h"
+
+namespace {
+
+/// Pre-computed settings of group X followed by those of kPubKeyStr
+std::vector<VerifierPrecomp> GetPrecomps() {
+  std::vector<VerifierPrecomp> precomps(2);
+  VerifierCtxObj verifier(EpidVerifierTest::kGrpXKey);
+  THROW_ON_EPIDERR(EpidVerifierWritePrecomp(verifier, &precomps[0]));
+  precomps[1] = EpidVerifierTest::kVerifierPrecompStr;
+  return precomps;
+}
+
+std::vector<uint8_t> WriteStore(std::vector<VerifierPrecomp> const& precomps) {
+  size_t size = 0;
+  THROW_ON_EPIDERR(EpidVerifierWritePrecompStore(
+      precomps.data(), precomps.size(), nullptr, &size));
+  std::vector<uint8_t> store(size);
+  THROW_ON_EPIDERR(EpidVerifierWritePrecompStore(
+      precomps.data(), precomps.size(), store.data(), &size));
+  return store;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// EpidVerifierWritePrecompStore Tests
+TEST_F(EpidVerifierTest, WritePrecompStoreFailsGivenNullPointer) {
+  VerifierPrecomp precomp = this->kVerifierPrecompStr;
+  std::vector<uint8_t> store(sizeof(VerifierPrecompStoreHeader) +
+                             sizeof(VerifierPrecomp));
+  size_t size = store.size();
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidVerifierWritePrecompStore(nullptr, 1, store.data(), &size));
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidVerifierWritePrecompStore(&precomp, 1, store.data(), nullptr));
+}
+TEST_F(EpidVerifierTest, WritePrecompStoreFailsGivenTooSmallBuffer) {
+  VerifierPrecomp precomp = this->kVerifierPrecompStr;
+  std::vector<uint8_t> store(sizeof(VerifierPrecompStoreHeader) +
+                             sizeof(VerifierPrecomp) - 1);
+  size_t size = store.size();
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidVerifierWritePrecompStore(&precomp, 1, store.data(), &size));
+}
+TEST_F(EpidVerifierTest, WritePrecompStoreFailsGivenDuplicateGroups) {
+  std::vector<VerifierPrecomp> precomps(2, this->kVerifierPrecompStr);
+  size_t size = 0;
+  THROW_ON_EPIDERR(EpidVerifierWritePrecompStore(
+      precomps.data(), precomps.size(), nullptr, &size));
+  std::vector<uint8_t> store(size);
+  EXPECT_EQ(kEpidDuplicateErr,
+            EpidVerifierWritePrecompStore(precomps.data(), precomps.size(),
+                                          store.data(), &size));
+}
+TEST_F(EpidVerifierTest, WritePrecompStoreReportsRequiredSize) {
+  std::vector<VerifierPrecomp> precomps = GetPrecomps();
+  size_t size = 0;
+  EXPECT_EQ(kEpidNoErr, EpidVerifierWritePrecompStore(
+                            precomps.data(), precomps.size(), nullptr, &size));
+  EXPECT_EQ(sizeof(VerifierPrecompStoreHeader) + 2 * sizeof(VerifierPrecomp),
+            size);
+}
+TEST_F(EpidVerifierTest, WritePrecompStoreSortsRecordsByGroupId) {
+  std::vector<VerifierPrecomp> precomps = GetPrecomps();
+  std::vector<uint8_t> store = WriteStore(precomps);
+  VerifierPrecomp const* records =
+      (VerifierPrecomp const*)(store.data() +
+                               sizeof(VerifierPrecompStoreHeader));
+  EXPECT_GT(0, memcmp(&records[0].gid, &records[1].gid, sizeof(GroupId)));
+}
+
+//////////////////////////////////////////////////////////////////////////
+// EpidVerifierFindPrecomp Tests
+TEST_F(EpidVerifierTest, FindPrecompFailsGivenNullPointer) {
+  std::vector<uint8_t> store = WriteStore(GetPrecomps());
+  VerifierPrecomp const* precomp = nullptr;
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidVerifierFindPrecomp(nullptr, store.size(),
+                                    &this->kGrpXKey.gid, &precomp));
+  EXPECT_EQ(kEpidBadArgErr, EpidVerifierFindPrecomp(
+                                store.data(), store.size(), nullptr, &precomp));
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidVerifierFindPrecomp(store.data(), store.size(),
+                                    &this->kGrpXKey.gid, nullptr));
+}
+TEST_F(EpidVerifierTest, FindPrecompFailsGivenBadMagic) {
+  std::vector<uint8_t> store = WriteStore(GetPrecomps());
+  VerifierPrecomp const* precomp = nullptr;
+  store[0] ^= 0xff;
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidVerifierFindPrecomp(store.data(), store.size(),
+                                    &this->kGrpXKey.gid, &precomp));
+}
+TEST_F(EpidVerifierTest, FindPrecompFailsGivenSizeNotMatchingCount) {
+  std::vector<uint8_t> store = WriteStore(GetPrecomps());
+  VerifierPrecomp const* precomp = nullptr;
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidVerifierFindPrecomp(store.data(), store.size() - 1,
+                                    &this->kGrpXKey.gid, &precomp));
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidVerifierFindPrecomp(store.data(), 1, &this->kGrpXKey.gid,
+                                    &precomp));
+}
+TEST_F(EpidVerifierTest, FindPrecompFindsEachGroupInStore) {
+  std::vector<VerifierPrecomp> precomps = GetPrecomps();
+  std::vector<uint8_t> store = WriteStore(precomps);
+  for (auto const& expected : precomps) {
+    VerifierPrecomp const* precomp = nullptr;
+    EXPECT_EQ(kEpidNoErr, EpidVerifierFindPrecomp(store.data(), store.size(),
+                                                  &expected.gid, &precomp));
+    ASSERT_NE(nullptr, precomp);
+    EXPECT_LE((void const*)store.data(), (void const*)precomp);
+    EXPECT_EQ(0, memcmp(&expected, precomp, sizeof(expected)));
+  }
+}
+TEST_F(EpidVerifierTest, FindPrecompReturnsNullForMissingGroup) {
+  std::vector<uint8_t> store = WriteStore(GetPrecomps());
+  VerifierPrecomp const* precomp = &this->kVerifierPrecompStr;
+  EXPECT_EQ(kEpidNoErr, EpidVerifierFindPrecomp(store.data(), store.size(),
+                                                &this->kGrp01Key.gid,
+                                                &precomp));
+  EXPECT_EQ(nullptr, precomp);
+}
+TEST_F(EpidVerifierTest, FindPrecompWorksGivenEmptyStore) {
+  std::vector<uint8_t> store = WriteStore(std::vector<VerifierPrecomp>());
+  VerifierPrecomp const* precomp = &this->kVerifierPrecompStr;
+  EXPECT_EQ(kEpidNoErr, EpidVerifierFindPrecomp(store.data(), store.size(),
+                                                &this->kGrpXKey.gid,
+                                                &precomp));
+  EXPECT_EQ(nullptr, precomp);
+}
+TEST_F(EpidVerifierTest, VerifierCreatedFromStoreAcceptsValidSig) {
+  auto& sig = this->kSigGrpXMember0Sha256Bsn0Msg0;
+  auto& msg = this->kMsg0;
+  auto& bsn = this->kBsn0;
+  std::vector<uint8_t> store = WriteStore(GetPrecomps());
+  VerifierPrecomp const* precomp = nullptr;
+  THROW_ON_EPIDERR(EpidVerifierFindPrecomp(store.data(), store.size(),
+                                           &this->kGrpXKey.gid, &precomp));
+  VerifierCtxObj verifier(this->kGrpXKey, *precomp);
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha256));
+  THROW_ON_EPIDERR(EpidVerifierSetBasename(verifier, bsn.data(), bsn.size()));
+  EXPECT_EQ(kEpidSigValid,
+            EpidVerify(verifier, (EpidSignature const*)sig.data(), sig.size(),
+                       msg.data(), msg.size()));
+}
+
+//////////////////////////////////////////////////////////////////////////
+// EpidRegistrySetPrecompStore Tests
+TEST_F(EpidVerifierTest, RegistrySetPrecompStoreFailsGivenBadArgs) {
+  std::vector<uint8_t> store = WriteStore(GetPrecomps());
+  VerifierRegistry* registry = nullptr;
+  THROW_ON_EPIDERR(EpidRegistryCreate(1, &registry));
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidRegistrySetPrecompStore(nullptr, store.data(), store.size()));
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidRegistrySetPrecompStore(registry, nullptr, store.size()));
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidRegistrySetPrecompStore(registry, store.data(), 1));
+  EpidRegistryDelete(&registry);
+}
+TEST_F(EpidVerifierTest, RegistryVerifyUsesPrecompStore) {
+  auto& sig = this->kSigGrpXMember0Sha256Bsn0Msg0;
+  auto& msg = this->kMsg0;
+  auto& bsn = this->kBsn0;
+  std::vector<uint8_t> store = WriteStore(GetPrecomps());
+  VerifierRegistry* registry = nullptr;
+  THROW_ON_EPIDERR(EpidRegistryCreate(1, &registry));
+  THROW_ON_EPIDERR(
+      EpidRegistrySetPrecompStore(registry, store.data(), store.size()));
+  THROW_ON_EPIDERR(EpidRegistrySetHashAlg(registry, kSha256));
+  THROW_ON_EPIDERR(EpidRegistrySetBasename(registry, bsn.data(), bsn.size()));
+  THROW_ON_EPIDERR(EpidRegistryAddGroup(registry, &this->kGrpXKey, nullptr));
+  EXPECT_EQ(kEpidSigValid,
+            EpidRegistryVerify(registry, &this->kGrpXKey.gid,
+                               (EpidSignature const*)sig.data(), sig.size(),
+                               msg.data(), msg.size()));
+  EpidRegistryDelete(&registry);
+}
+
+}  // namespace
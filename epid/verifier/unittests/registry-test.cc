@@ -0,0 +1,345 @@
+/*############################################################################
+  # Copyright 2017 Intel Corporation
+  #
+  # Licensed under the Apache License, Version 2.0 (the "License");
+  # you may not use this file except in compliance with the License.
+  # You may obtain a copy of the License at
+  #
+  #     http://www.apache.org/licenses/LICENSE-2.0
+  #
+  # Unless required by applicable law or agreed to in writing, software
+  # distributed under the License is distributed on an "AS IS" BASIS,
+  # WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  # See the License for the specific language governing permissions and
+  # limitations under the License.
+  ############################################################################*/
+
+/*!
+ * \file
+ * \brief VerifierRegistry unit tests.
+ */
+
+#include <vector>
+
+#include "epid/common-testhelper/epid_gtest-testhelper.h"
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "epid/verifier/api.h"
+}
+
+#include "epid/common-testhelper/errors-testhelper.h"
+#include "epid/verifier/unittests/verifier-testhelper.h"
+
+namespace {
+
+/// Registry set up to verify kSigGrpXMember0Sha256Bsn0Msg0
+class RegistryObj {
+ public:
+  explicit RegistryObj(size_t max_contexts) : registry_(nullptr) {
+    THROW_ON_EPIDERR(EpidRegistryCreate(max_contexts, &registry_));
+    THROW_ON_EPIDERR(EpidRegistrySetHashAlg(registry_, kSha256));
+    THROW_ON_EPIDERR(
+        EpidRegistrySetBasename(registry_, EpidVerifierTest::kBsn0.data(),
+                                EpidVerifierTest::kBsn0.size()));
+  }
+  ~RegistryObj() { EpidRegistryDelete(&registry_); }
+  operator VerifierRegistry*() { return registry_; }
+  VerifierRegistryStats stats() const {
+    VerifierRegistryStats stats = {0};
+    THROW_ON_EPIDERR(EpidRegistryGetStats(registry_, &stats));
+    return stats;
+  }
+
+ private:
+  RegistryObj(RegistryObj const&);
+  RegistryObj& operator=(RegistryObj const&);
+  VerifierRegistry* registry_;
+};
+
+EpidStatus VerifyGrpXSig(VerifierRegistry* registry,
+                         std::vector<uint8_t> const& sig =
+                             EpidVerifierTest::kSigGrpXMember0Sha256Bsn0Msg0) {
+  auto& msg = EpidVerifierTest::kMsg0;
+  return EpidRegistryVerify(registry, &EpidVerifierTest::kGrpXKey.gid,
+                            (EpidSignature const*)sig.data(), sig.size(),
+                            msg.data(), msg.size());
+}
+
+/// Uses group 01 of kPubKeyStr, making its context resident
+void UseGrp01(VerifierRegistry* registry) {
+  auto& sig = EpidVerifierTest::kSigGrp01Member0Sha256RandombaseTest0;
+  auto& msg = EpidVerifierTest::kTest0;
+  // the registry has a basename, so the random base signature is rejected
+  EpidRegistryVerify(registry, &EpidVerifierTest::kPubKeyStr.gid,
+                     (EpidSignature const*)sig.data(), sig.size(), msg.data(),
+                     msg.size());
+}
+
+//////////////////////////////////////////////////////////////////////////
+// EpidRegistryCreate Tests
+TEST_F(EpidVerifierTest, RegistryCreateFailsGivenNullPointer) {
+  EXPECT_EQ(kEpidBadArgErr, EpidRegistryCreate(1, nullptr));
+}
+TEST_F(EpidVerifierTest, RegistryCreateFailsGivenZeroMaxContexts) {
+  VerifierRegistry* registry = nullptr;
+  EXPECT_EQ(kEpidBadArgErr, EpidRegistryCreate(0, &registry));
+  EpidRegistryDelete(&registry);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// EpidRegistryDelete Tests
+TEST_F(EpidVerifierTest, RegistryDeleteWorksGivenNullPointer) {
+  EpidRegistryDelete(nullptr);
+  VerifierRegistry* registry = nullptr;
+  EpidRegistryDelete(&registry);
+}
+TEST_F(EpidVerifierTest, RegistryDeleteNullsPointer) {
+  VerifierRegistry* registry = nullptr;
+  THROW_ON_EPIDERR(EpidRegistryCreate(1, &registry));
+  THROW_ON_EPIDERR(EpidRegistryAddGroup(registry, &this->kGrpXKey, nullptr));
+  EpidRegistryDelete(&registry);
+  EXPECT_EQ(nullptr, registry);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// EpidRegistryAddGroup Tests
+TEST_F(EpidVerifierTest, RegistryAddGroupFailsGivenNullPointer) {
+  RegistryObj registry(1);
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidRegistryAddGroup(nullptr, &this->kGrpXKey, nullptr));
+  EXPECT_EQ(kEpidBadArgErr, EpidRegistryAddGroup(registry, nullptr, nullptr));
+}
+TEST_F(EpidVerifierTest, RegistryAddGroupFailsGivenPrecompOfOtherGroup) {
+  RegistryObj registry(1);
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidRegistryAddGroup(registry, &this->kGrpXKey,
+                                 &this->kVerifierPrecompStr));
+}
+TEST_F(EpidVerifierTest, RegistryAddGroupCountsEachGroupOnce) {
+  RegistryObj registry(1);
+  THROW_ON_EPIDERR(EpidRegistryAddGroup(registry, &this->kGrpXKey, nullptr));
+  THROW_ON_EPIDERR(EpidRegistryAddGroup(registry, &this->kGrpXKey, nullptr));
+  THROW_ON_EPIDERR(EpidRegistryAddGroup(registry, &this->kPubKeyStr,
+                                        &this->kVerifierPrecompStr));
+  EXPECT_EQ(2u, registry.stats().groups);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// EpidRegistryVerify Tests
+TEST_F(EpidVerifierTest, RegistryVerifyFailsGivenNullPointer) {
+  auto& sig = this->kSigGrpXMember0Sha256Bsn0Msg0;
+  auto& msg = this->kMsg0;
+  RegistryObj registry(1);
+  THROW_ON_EPIDERR(EpidRegistryAddGroup(registry, &this->kGrpXKey, nullptr));
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidRegistryVerify(nullptr, &this->kGrpXKey.gid,
+                               (EpidSignature const*)sig.data(), sig.size(),
+                               msg.data(), msg.size()));
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidRegistryVerify(registry, nullptr,
+                               (EpidSignature const*)sig.data(), sig.size(),
+                               msg.data(), msg.size()));
+}
+TEST_F(EpidVerifierTest, RegistryVerifyFailsGivenUnknownGroup) {
+  RegistryObj registry(1);
+  THROW_ON_EPIDERR(EpidRegistryAddGroup(registry, &this->kPubKeyStr,
+                                        &this->kVerifierPrecompStr));
+  EXPECT_EQ(kEpidBadArgErr, VerifyGrpXSig(registry));
+}
+TEST_F(EpidVerifierTest, RegistryVerifyAcceptsSigFromAddedGroup) {
+  RegistryObj registry(2);
+  THROW_ON_EPIDERR(EpidRegistryAddGroup(registry, &this->kPubKeyStr,
+                                        &this->kVerifierPrecompStr));
+  THROW_ON_EPIDERR(EpidRegistryAddGroup(registry, &this->kGrpXKey, nullptr));
+  EXPECT_EQ(kEpidSigValid, VerifyGrpXSig(registry));
+  EXPECT_EQ(kEpidSigValid, VerifyGrpXSig(registry));
+  VerifierRegistryStats stats = registry.stats();
+  EXPECT_EQ(1u, stats.misses);
+  EXPECT_EQ(1u, stats.hits);
+  EXPECT_EQ(0u, stats.evictions);
+  EXPECT_EQ(1u, stats.resident);
+}
+TEST_F(EpidVerifierTest, RegistryVerifyEvictsLeastRecentlyUsedContext) {
+  RegistryObj registry(1);
+  THROW_ON_EPIDERR(EpidRegistryAddGroup(registry, &this->kPubKeyStr,
+                                        &this->kVerifierPrecompStr));
+  THROW_ON_EPIDERR(EpidRegistryAddGroup(registry, &this->kGrpXKey, nullptr));
+  UseGrp01(registry);
+  EXPECT_EQ(kEpidSigValid, VerifyGrpXSig(registry));
+  VerifierRegistryStats stats = registry.stats();
+  EXPECT_EQ(2u, stats.misses);
+  EXPECT_EQ(0u, stats.hits);
+  EXPECT_EQ(1u, stats.evictions);
+  EXPECT_EQ(1u, stats.resident);
+  EXPECT_EQ(2u, stats.groups);
+}
+TEST_F(EpidVerifierTest, RegistryVerifyReappliesSigRlAfterEviction) {
+  auto& sig = this->kSigGrpXMember0Sha256Bsn0Msg0SingleEntrySigRl;
+  auto& sig_rl = this->kGrpXSigRlMember0Sha256Bsn0Msg0OnlyEntry;
+  RegistryObj registry(1);
+  THROW_ON_EPIDERR(EpidRegistryAddGroup(registry, &this->kGrpXKey, nullptr));
+  THROW_ON_EPIDERR(EpidRegistryAddGroup(registry, &this->kPubKeyStr,
+                                        &this->kVerifierPrecompStr));
+  THROW_ON_EPIDERR(EpidRegistrySetSigRl(
+      registry, (SigRl const*)sig_rl.data(), sig_rl.size()));
+  EXPECT_EQ(kEpidSigRevokedInSigRl, VerifyGrpXSig(registry, sig));
+  // make the other group resident to evict group X
+  UseGrp01(registry);
+  EXPECT_EQ(kEpidSigRevokedInSigRl, VerifyGrpXSig(registry, sig));
+  EXPECT_EQ(2u, registry.stats().evictions);
+}
+TEST_F(EpidVerifierTest, RegistryVerifyAppliesGroupRlToAllGroups) {
+  auto& grp_rl = this->kGrpRlRevokedGrpXOnlyEntry;
+  RegistryObj registry(1);
+  THROW_ON_EPIDERR(EpidRegistryAddGroup(registry, &this->kGrpXKey, nullptr));
+  EXPECT_EQ(kEpidSigValid, VerifyGrpXSig(registry));
+  THROW_ON_EPIDERR(EpidRegistrySetGroupRl(
+      registry, (GroupRl const*)grp_rl.data(), grp_rl.size()));
+  EXPECT_EQ(kEpidSigRevokedInGroupRl, VerifyGrpXSig(registry));
+}
+
+TEST_F(EpidVerifierTest, RegistryVerifyReappliesVerifierRlAfterEviction) {
+  auto& sig = this->kSigGrpXVerRevokedMember0Sha256Bsn0Msg0;
+  auto& ver_rl = this->kGrpXBsn0VerRlSingleEntry;
+  RegistryObj registry(1);
+  THROW_ON_EPIDERR(EpidRegistryAddGroup(registry, &this->kGrpXKey, nullptr));
+  THROW_ON_EPIDERR(EpidRegistryAddGroup(registry, &this->kPubKeyStr,
+                                        &this->kVerifierPrecompStr));
+  THROW_ON_EPIDERR(EpidRegistrySetVerifierRl(
+      registry, (VerifierRl const*)ver_rl.data(), ver_rl.size()));
+  EXPECT_EQ(kEpidSigRevokedInVerifierRl, VerifyGrpXSig(registry, sig));
+  UseGrp01(registry);
+  EXPECT_EQ(kEpidSigRevokedInVerifierRl, VerifyGrpXSig(registry, sig));
+  EXPECT_EQ(2u, registry.stats().evictions);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// EpidRegistrySetPrivRl Tests
+TEST_F(EpidVerifierTest, RegistrySetPrivRlDoesNotCreateContext) {
+  RegistryObj registry(1);
+  THROW_ON_EPIDERR(EpidRegistryAddGroup(registry, &this->kPubKeyStr,
+                                        &this->kVerifierPrecompStr));
+  THROW_ON_EPIDERR(EpidRegistrySetPrivRl(
+      registry, (PrivRl const*)this->kGrp01PrivRl.data(),
+      this->kGrp01PrivRl.size()));
+  VerifierRegistryStats stats = registry.stats();
+  EXPECT_EQ(0u, stats.misses);
+  EXPECT_EQ(0u, stats.resident);
+}
+TEST_F(EpidVerifierTest, RegistrySetPrivRlFailsGivenSameVersion) {
+  RegistryObj registry(1);
+  THROW_ON_EPIDERR(EpidRegistryAddGroup(registry, &this->kPubKeyStr,
+                                        &this->kVerifierPrecompStr));
+  THROW_ON_EPIDERR(EpidRegistrySetPrivRl(
+      registry, (PrivRl const*)this->kGrp01PrivRl.data(),
+      this->kGrp01PrivRl.size()));
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidRegistrySetPrivRl(registry,
+                                  (PrivRl const*)this->kGrp01PrivRl.data(),
+                                  this->kGrp01PrivRl.size()));
+}
+TEST_F(EpidVerifierTest, RegistrySetPrivRlFailsGivenBadSize) {
+  RegistryObj registry(1);
+  THROW_ON_EPIDERR(EpidRegistryAddGroup(registry, &this->kPubKeyStr,
+                                        &this->kVerifierPrecompStr));
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidRegistrySetPrivRl(registry,
+                                  (PrivRl const*)this->kGrp01PrivRl.data(),
+                                  this->kGrp01PrivRl.size() - 1));
+}
+
+//////////////////////////////////////////////////////////////////////////
+// EpidRegistrySetSigRl Tests
+TEST_F(EpidVerifierTest, RegistrySetSigRlDoesNotCreateContext) {
+  auto& sig_rl = this->kGrpXSigRlMember0Sha256Bsn0Msg0OnlyEntry;
+  RegistryObj registry(1);
+  THROW_ON_EPIDERR(EpidRegistryAddGroup(registry, &this->kGrpXKey, nullptr));
+  THROW_ON_EPIDERR(EpidRegistrySetSigRl(
+      registry, (SigRl const*)sig_rl.data(), sig_rl.size()));
+  VerifierRegistryStats stats = registry.stats();
+  EXPECT_EQ(0u, stats.misses);
+  EXPECT_EQ(0u, stats.resident);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// EpidRegistrySetVerifierRl Tests
+TEST_F(EpidVerifierTest, RegistrySetVerifierRlFailsGivenNullPointer) {
+  auto& ver_rl = this->kGrpXBsn0VerRlSingleEntry;
+  RegistryObj registry(1);
+  THROW_ON_EPIDERR(EpidRegistryAddGroup(registry, &this->kGrpXKey, nullptr));
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidRegistrySetVerifierRl(
+                nullptr, (VerifierRl const*)ver_rl.data(), ver_rl.size()));
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidRegistrySetVerifierRl(registry, nullptr, ver_rl.size()));
+}
+TEST_F(EpidVerifierTest, RegistrySetVerifierRlFailsGivenUnknownGroup) {
+  auto& ver_rl = this->kGrpXBsn0VerRlSingleEntry;
+  RegistryObj registry(1);
+  THROW_ON_EPIDERR(EpidRegistryAddGroup(registry, &this->kPubKeyStr,
+                                        &this->kVerifierPrecompStr));
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidRegistrySetVerifierRl(
+                registry, (VerifierRl const*)ver_rl.data(), ver_rl.size()));
+}
+TEST_F(EpidVerifierTest, RegistrySetVerifierRlFailsWithoutBasename) {
+  auto& ver_rl = this->kGrpXBsn0VerRlSingleEntry;
+  RegistryObj registry(1);
+  THROW_ON_EPIDERR(EpidRegistrySetBasename(registry, nullptr, 0));
+  THROW_ON_EPIDERR(EpidRegistryAddGroup(registry, &this->kGrpXKey, nullptr));
+  EXPECT_EQ(kEpidInconsistentBasenameSetErr,
+            EpidRegistrySetVerifierRl(
+                registry, (VerifierRl const*)ver_rl.data(), ver_rl.size()));
+}
+TEST_F(EpidVerifierTest, RegistrySetBasenameDropsVerifierRl) {
+  auto& sig = this->kSigGrpXVerRevokedMember0Sha256Bsn0Msg0;
+  auto& ver_rl = this->kGrpXBsn0VerRlSingleEntry;
+  RegistryObj registry(1);
+  THROW_ON_EPIDERR(EpidRegistryAddGroup(registry, &this->kGrpXKey, nullptr));
+  THROW_ON_EPIDERR(EpidRegistrySetVerifierRl(
+      registry, (VerifierRl const*)ver_rl.data(), ver_rl.size()));
+  THROW_ON_EPIDERR(EpidRegistrySetBasename(registry, this->kBsn0.data(),
+                                           this->kBsn0.size()));
+  EXPECT_EQ(kEpidSigValid, VerifyGrpXSig(registry, sig));
+}
+
+//////////////////////////////////////////////////////////////////////////
+// EpidRegistryBlacklistSig Tests
+TEST_F(EpidVerifierTest, RegistryBlacklistSigFailsGivenUnknownGroup) {
+  auto& sig = this->kSigGrpXMember0Sha256Bsn0Msg0;
+  auto& msg = this->kMsg0;
+  RegistryObj registry(1);
+  THROW_ON_EPIDERR(EpidRegistryAddGroup(registry, &this->kPubKeyStr,
+                                        &this->kVerifierPrecompStr));
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidRegistryBlacklistSig(registry, &this->kGrpXKey.gid,
+                                     (EpidSignature const*)sig.data(),
+                                     sig.size(), msg.data(), msg.size()));
+}
+TEST_F(EpidVerifierTest, RegistryBlacklistSigRevokesSigAfterEviction) {
+  auto& sig = this->kSigGrpXMember0Sha256Bsn0Msg0;
+  auto& msg = this->kMsg0;
+  RegistryObj registry(1);
+  THROW_ON_EPIDERR(EpidRegistryAddGroup(registry, &this->kGrpXKey, nullptr));
+  THROW_ON_EPIDERR(EpidRegistryAddGroup(registry, &this->kPubKeyStr,
+                                        &this->kVerifierPrecompStr));
+  THROW_ON_EPIDERR(EpidRegistryBlacklistSig(
+      registry, &this->kGrpXKey.gid, (EpidSignature const*)sig.data(),
+      sig.size(), msg.data(), msg.size()));
+  EXPECT_EQ(kEpidSigRevokedInVerifierRl, VerifyGrpXSig(registry));
+  UseGrp01(registry);
+  EXPECT_EQ(kEpidSigRevokedInVerifierRl, VerifyGrpXSig(registry));
+  EXPECT_EQ(2u, registry.stats().evictions);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// EpidRegistryGetStats Tests
+TEST_F(EpidVerifierTest, RegistryGetStatsFailsGivenNullPointer) {
+  VerifierRegistryStats stats;
+  RegistryObj registry(1);
+  EXPECT_EQ(kEpidBadArgErr, EpidRegistryGetStats(nullptr, &stats));
+  EXPECT_EQ(kEpidBadArgErr, EpidRegistryGetStats(registry, nullptr));
+}
+
+}  // namespace
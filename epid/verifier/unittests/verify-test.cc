@@ -19,11 +19,17 @@
  * \brief Verify unit tests.
  */
 
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <vector>
+
 #include "epid/common-testhelper/epid_gtest-testhelper.h"
 #include "gtest/gtest.h"
 
 extern "C" {
 #include "epid/common/src/endian_convert.h"
+#include "epid/common/src/memory.h"
 #include "epid/verifier/api.h"
 }
 
@@ -401,6 +407,26 @@ TEST_F(EpidVerifierTest, VerifyRejectsSigDifferingOnlyInHashAlg) {
 // Group Based Revocation List Reject
 //   4.1.2 step 3 - If GroupRL is provided
 
+TEST_F(EpidVerifierTest, VerifyAcceptsSigGivenSharedParams) {
+  auto& pub_key = this->kGrpXKey;
+  auto& msg = this->kMsg0;
+  auto& bsn = this->kBsn0;
+  auto& sig = this->kSigGrpXMember0Sha256Bsn0Msg0;
+  EpidSharedParams* params = nullptr;
+  VerifierCtx* ctx = nullptr;
+  THROW_ON_EPIDERR(EpidSharedParamsCreate(&params));
+  THROW_ON_EPIDERR(
+      EpidVerifierCreateWithParams(&pub_key, nullptr, params, &ctx));
+  EpidSharedParamsDelete(&params);
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(ctx, kSha256));
+  THROW_ON_EPIDERR(EpidVerifierSetBasename(ctx, bsn.data(), bsn.size()));
+
+  EXPECT_EQ(kEpidSigValid,
+            EpidVerify(ctx, (EpidSignature const*)sig.data(), sig.size(),
+                       msg.data(), msg.size()));
+  EpidVerifierDelete(&ctx);
+}
+
 TEST_F(EpidVerifierTest, VerifyRejectsFromGroupRlSingleEntry) {
   // * 4.1.2 step 3.a - The verifier verifies that gid does not match any entry
   //                    in GroupRL.
@@ -504,6 +530,31 @@ TEST_F(EpidVerifierTest, VerifyRejectsFromGroupRlLastEntry) {
                        msg.data(), msg.size()));
 }
 
+TEST_F(EpidVerifierTest, VerifyAcceptsSigAfterGroupRlUpdateDropsGroup) {
+  auto& pub_key = this->kGrpXKey;
+  auto& msg = this->kMsg0;
+  auto& bsn = this->kBsn0;
+  auto& grp_rl = this->kGrpRlRevokedGrpXOnlyEntry;
+  auto& sig = this->kSigGrpXMember0Sha256Bsn0Msg0;
+  // a newer list that revokes some other group instead
+  std::vector<uint8_t> new_grp_rl = grp_rl;
+  GroupRl* new_rl = reinterpret_cast<GroupRl*>(new_grp_rl.data());
+  new_rl->version.data[3]++;
+  new_rl->gid[0].data[0] ^= 0xff;
+
+  VerifierCtxObj verifier(pub_key);
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha256));
+  THROW_ON_EPIDERR(EpidVerifierSetBasename(verifier, bsn.data(), bsn.size()));
+  THROW_ON_EPIDERR(EpidVerifierSetGroupRl(
+      verifier, (GroupRl const*)grp_rl.data(), grp_rl.size()));
+  THROW_ON_EPIDERR(EpidVerifierSetGroupRl(
+      verifier, (GroupRl const*)new_grp_rl.data(), new_grp_rl.size()));
+
+  EXPECT_EQ(kEpidSigValid,
+            EpidVerify(verifier, (EpidSignature const*)sig.data(), sig.size(),
+                       msg.data(), msg.size()));
+}
+
 //   4.1.2 step 3.b - If gid matches an entry in GroupRL, aborts and returns 2.
 // This Step is an aggregate of the above steps
 
@@ -671,6 +722,62 @@ TEST_F(EpidVerifierTest, VerifyAcceptsSigFromEmptyPrivRlUsingIkgfData) {
                                    sig.size(), msg.data(), msg.size()));
 }
 
+TEST_F(EpidVerifierTest, VerifyAcceptsSigNotInPrivRlWithBasename) {
+  auto& pub_key = this->kGrpXKey;
+  auto& msg = this->kMsg0;
+  auto& bsn = this->kBsn0;
+  auto& priv_rl = this->kGrpXPrivRl;
+  auto& sig = this->kSigGrpXMember0Sha256Bsn0Msg0;
+
+  VerifierCtxObj verifier(pub_key);
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha256));
+  THROW_ON_EPIDERR(EpidVerifierSetBasename(verifier, bsn.data(), bsn.size()));
+  THROW_ON_EPIDERR(EpidVerifierSetPrivRl(
+      verifier, (PrivRl const*)priv_rl.data(), priv_rl.size()));
+
+  EXPECT_EQ(kEpidSigValid,
+            EpidVerify(verifier, (EpidSignature const*)sig.data(), sig.size(),
+                       msg.data(), msg.size()));
+}
+
+TEST_F(EpidVerifierTest, VerifyRejectsSigFromPrivRlSetBeforeBasename) {
+  auto& pub_key = this->kGrpXKey;
+  auto& msg = this->kMsg0;
+  auto& bsn = this->kBsn0;
+  auto& priv_rl = this->kGrpXPrivRl;
+  auto& sig = this->kSigGrpXRevokedPrivKey002Sha256Bsn0Msg0;
+
+  VerifierCtxObj verifier(pub_key);
+  THROW_ON_EPIDERR(EpidVerifierSetPrivRl(
+      verifier, (PrivRl const*)priv_rl.data(), priv_rl.size()));
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha256));
+  THROW_ON_EPIDERR(EpidVerifierSetBasename(verifier, bsn.data(), bsn.size()));
+
+  EXPECT_EQ(kEpidSigRevokedInPrivRl,
+            EpidVerify(verifier, (EpidSignature const*)sig.data(), sig.size(),
+                       msg.data(), msg.size()));
+}
+
+TEST_F(EpidVerifierTest, VerifyRejectsSigFromPrivRlAfterHashAlgChange) {
+  auto& pub_key = this->kGrpXKey;
+  auto& msg = this->kMsg0;
+  auto& bsn = this->kBsn0;
+  auto& priv_rl = this->kGrpXPrivRl;
+  auto& sig = this->kSigGrpXRevokedPrivKey001Sha256Bsn0Msg0;
+
+  VerifierCtxObj verifier(pub_key);
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha512));
+  THROW_ON_EPIDERR(EpidVerifierSetBasename(verifier, bsn.data(), bsn.size()));
+  THROW_ON_EPIDERR(EpidVerifierSetPrivRl(
+      verifier, (PrivRl const*)priv_rl.data(), priv_rl.size()));
+  // the basename hash, and so every B^f[i], changes with the hash algorithm
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha256));
+
+  EXPECT_EQ(kEpidSigRevokedInPrivRl,
+            EpidVerify(verifier, (EpidSignature const*)sig.data(), sig.size(),
+                       msg.data(), msg.size()));
+}
+
 //   4.1.2 step 4.c - If the above step fails, the verifier aborts and
 //                    output 3.
 // This Step is an aggregate of the above steps
@@ -1314,4 +1421,750 @@ TEST_F(EpidVerifierTest, VerifyAcceptsSigGivenMsgContainingAllPossibleBytes) {
                        msg.data(), msg.size()));
 }
 
+/////////////////////////////////////////////////////////////////////
+// EpidVerifyBatch
+
+TEST_F(EpidVerifierTest, VerifyBatchFailsGivenNullParameters) {
+  VerifierCtxObj verifier(this->kGrpXKey);
+  auto& sig = this->kSigGrpXMember0Sha256RandbaseMsg0;
+  auto& msg = this->kMsg0;
+  EpidSignature const* sigs[] = {(EpidSignature const*)sig.data()};
+  size_t sig_lens[] = {sig.size()};
+  void const* msgs[] = {msg.data()};
+  size_t msg_lens[] = {msg.size()};
+  EpidStatus results[1];
+
+  EXPECT_EQ(kEpidBadArgErr, EpidVerifyBatch(nullptr, sigs, sig_lens, msgs,
+                                            msg_lens, 1, results));
+  EXPECT_EQ(kEpidBadArgErr, EpidVerifyBatch(verifier, nullptr, sig_lens, msgs,
+                                            msg_lens, 1, results));
+  EXPECT_EQ(kEpidBadArgErr, EpidVerifyBatch(verifier, sigs, nullptr, msgs,
+                                            msg_lens, 1, results));
+  EXPECT_EQ(kEpidBadArgErr, EpidVerifyBatch(verifier, sigs, sig_lens, nullptr,
+                                            msg_lens, 1, results));
+  EXPECT_EQ(kEpidBadArgErr, EpidVerifyBatch(verifier, sigs, sig_lens, msgs,
+                                            nullptr, 1, results));
+  EXPECT_EQ(kEpidBadArgErr, EpidVerifyBatch(verifier, sigs, sig_lens, msgs,
+                                            msg_lens, 1, nullptr));
+}
+
+TEST_F(EpidVerifierTest, VerifyBatchSucceedsGivenEmptyBatch) {
+  VerifierCtxObj verifier(this->kGrpXKey);
+  EXPECT_EQ(kEpidNoErr, EpidVerifyBatch(verifier, nullptr, nullptr, nullptr,
+                                        nullptr, 0, nullptr));
+}
+
+TEST_F(EpidVerifierTest, VerifyBatchReportsEachResultIndividually) {
+  auto& pub_key = this->kGrpXKey;
+  auto& msg = this->kMsg0;
+  auto& grp_rl = this->kGrpRl;
+  auto& priv_rl = this->kGrpXPrivRl;
+  auto& sig_rl = this->kGrpXSigRl;
+  auto& good_sig = this->kSigGrpXMember0Sha256RandbaseMsg0;
+  auto bad_sig = good_sig;
+  ((EpidSignature*)bad_sig.data())->sigma0.sx.data.data[31]++;
+  auto& wrong_msg = this->kTest1;
+
+  VerifierCtxObj verifier(pub_key);
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha256));
+  THROW_ON_EPIDERR(EpidVerifierSetGroupRl(
+      verifier, (GroupRl const*)grp_rl.data(), grp_rl.size()));
+  THROW_ON_EPIDERR(EpidVerifierSetPrivRl(
+      verifier, (PrivRl const*)priv_rl.data(), priv_rl.size()));
+  THROW_ON_EPIDERR(EpidVerifierSetSigRl(verifier, (SigRl const*)sig_rl.data(),
+                                        sig_rl.size()));
+
+  EpidSignature const* sigs[] = {(EpidSignature const*)good_sig.data(),
+                                 (EpidSignature const*)bad_sig.data(),
+                                 (EpidSignature const*)good_sig.data(),
+                                 nullptr};
+  size_t sig_lens[] = {good_sig.size(), bad_sig.size(), good_sig.size(),
+                       good_sig.size()};
+  void const* msgs[] = {msg.data(), msg.data(), wrong_msg.data(), msg.data()};
+  size_t msg_lens[] = {msg.size(), msg.size(), wrong_msg.size(), msg.size()};
+  EpidStatus results[4] = {kEpidErr, kEpidErr, kEpidErr, kEpidErr};
+
+  EXPECT_EQ(kEpidNoErr, EpidVerifyBatch(verifier, sigs, sig_lens, msgs,
+                                        msg_lens, 4, results));
+  EXPECT_EQ(kEpidSigValid, results[0]);
+  EXPECT_EQ(kEpidSigInvalid, results[1]);
+  EXPECT_EQ(kEpidSigInvalid, results[2]);
+  EXPECT_EQ(kEpidBadArgErr, results[3]);
+}
+
+TEST_F(EpidVerifierTest, VerifyBatchMatchesVerifyForRevokedGroup) {
+  auto& pub_key = this->kGrpXKey;
+  auto& msg = this->kMsg0;
+  auto& grp_rl = this->kGrpRlRevokedGrpXOnlyEntry;
+  auto& sig = this->kSigGrpXMember0Sha256RandbaseMsg0;
+
+  VerifierCtxObj verifier(pub_key);
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha256));
+  THROW_ON_EPIDERR(EpidVerifierSetGroupRl(
+      verifier, (GroupRl const*)grp_rl.data(), grp_rl.size()));
+
+  EpidSignature const* sigs[] = {(EpidSignature const*)sig.data(),
+                                 (EpidSignature const*)sig.data()};
+  size_t sig_lens[] = {sig.size(), sig.size()};
+  void const* msgs[] = {msg.data(), msg.data()};
+  size_t msg_lens[] = {msg.size(), msg.size()};
+  EpidStatus results[2] = {kEpidErr, kEpidErr};
+
+  EXPECT_EQ(kEpidNoErr, EpidVerifyBatch(verifier, sigs, sig_lens, msgs,
+                                        msg_lens, 2, results));
+  EXPECT_EQ(kEpidSigRevokedInGroupRl, results[0]);
+  EXPECT_EQ(kEpidSigRevokedInGroupRl, results[1]);
+  EXPECT_EQ(kEpidSigRevokedInGroupRl,
+            EpidVerify(verifier, (EpidSignature const*)sig.data(), sig.size(),
+                       msg.data(), msg.size()));
+}
+
+/////////////////////////////////////////////////////////////////////
+// EpidVerifyWithWorkspace
+
+/// Deletes a verifier workspace when it goes out of scope
+class VerifierWorkspaceObj {
+ public:
+  VerifierWorkspaceObj() : workspace_(nullptr) {
+    THROW_ON_EPIDERR(EpidVerifierWorkspaceCreate(&workspace_));
+  }
+  ~VerifierWorkspaceObj() { EpidVerifierWorkspaceDelete(&workspace_); }
+  operator VerifierWorkspace*() { return workspace_; }
+
+ private:
+  VerifierWorkspaceObj(VerifierWorkspaceObj const&);
+  VerifierWorkspaceObj& operator=(VerifierWorkspaceObj const&);
+  VerifierWorkspace* workspace_;
+};
+
+TEST_F(EpidVerifierTest, VerifyWithWorkspaceFailsGivenNullWorkspace) {
+  auto& sig = this->kSigGrpXMember0Sha256RandbaseMsg0;
+  auto& msg = this->kMsg0;
+  VerifierCtxObj verifier(this->kGrpXKey);
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidVerifyWithWorkspace(verifier, nullptr,
+                                    (EpidSignature const*)sig.data(),
+                                    sig.size(), msg.data(), msg.size()));
+}
+
+TEST_F(EpidVerifierTest, VerifyWithWorkspaceFailsGivenNullContext) {
+  auto& sig = this->kSigGrpXMember0Sha256RandbaseMsg0;
+  auto& msg = this->kMsg0;
+  VerifierWorkspaceObj workspace;
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidVerifyWithWorkspace(nullptr, workspace,
+                                    (EpidSignature const*)sig.data(),
+                                    sig.size(), msg.data(), msg.size()));
+}
+
+TEST_F(EpidVerifierTest, VerifyWithWorkspaceMatchesVerify) {
+  auto& msg = this->kMsg0;
+  auto& bsn = this->kBsn0;
+  auto& sig_rl = this->kGrpXSigRlMember0Sha256Bsn0Msg0OnlyEntry;
+  auto& valid_sig = this->kSigGrpXMember0Sha256Bsn0Msg0;
+  auto& revoked_sig = this->kSigGrpXMember0Sha256Bsn0Msg0SingleEntrySigRl;
+
+  VerifierCtxObj verifier(this->kGrpXKey);
+  VerifierWorkspaceObj workspace;
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha256));
+  THROW_ON_EPIDERR(EpidVerifierSetBasename(verifier, bsn.data(), bsn.size()));
+  EXPECT_EQ(kEpidSigValid,
+            EpidVerifyWithWorkspace(verifier, workspace,
+                                    (EpidSignature const*)valid_sig.data(),
+                                    valid_sig.size(), msg.data(), msg.size()));
+  THROW_ON_EPIDERR(EpidVerifierSetSigRl(verifier, (SigRl const*)sig_rl.data(),
+                                        sig_rl.size()));
+  EXPECT_EQ(kEpidSigRevokedInSigRl,
+            EpidVerifyWithWorkspace(verifier, workspace,
+                                    (EpidSignature const*)revoked_sig.data(),
+                                    revoked_sig.size(), msg.data(),
+                                    msg.size()));
+  EXPECT_EQ(kEpidSigRevokedInSigRl,
+            EpidVerify(verifier, (EpidSignature const*)revoked_sig.data(),
+                       revoked_sig.size(), msg.data(), msg.size()));
+}
+
+TEST_F(EpidVerifierTest, VerifyWithWarmWorkspaceDoesNotAllocateGivenBasename) {
+  auto& msg = this->kMsg0;
+  auto& bsn = this->kBsn0;
+  auto& grp_rl = this->kGrpRl;
+  auto& priv_rl = this->kGrpXPrivRl;
+  auto& sig_rl = this->kGrpXSigRl;
+  auto& ver_rl = this->kGrpXBsn0Sha256VerRl;
+  auto& sig = this->kSigGrpXMember0Sha256Bsn0Msg0;
+
+  VerifierCtxObj verifier(this->kGrpXKey);
+  VerifierWorkspaceObj workspace;
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha256));
+  THROW_ON_EPIDERR(EpidVerifierSetBasename(verifier, bsn.data(), bsn.size()));
+  THROW_ON_EPIDERR(EpidVerifierSetGroupRl(
+      verifier, (GroupRl const*)grp_rl.data(), grp_rl.size()));
+  THROW_ON_EPIDERR(EpidVerifierSetPrivRl(
+      verifier, (PrivRl const*)priv_rl.data(), priv_rl.size()));
+  THROW_ON_EPIDERR(EpidVerifierSetSigRl(verifier, (SigRl const*)sig_rl.data(),
+                                        sig_rl.size()));
+  THROW_ON_EPIDERR(EpidVerifierSetVerifierRl(
+      verifier, (VerifierRl const*)ver_rl.data(), ver_rl.size()));
+  THROW_ON_EPIDERR(EpidVerifyWithWorkspace(verifier, workspace,
+                                           (EpidSignature const*)sig.data(),
+                                           sig.size(), msg.data(), msg.size()));
+  size_t alloc_count = EpidGetAllocCount();
+  EXPECT_EQ(kEpidSigValid,
+            EpidVerifyWithWorkspace(verifier, workspace,
+                                    (EpidSignature const*)sig.data(),
+                                    sig.size(), msg.data(), msg.size()));
+  EXPECT_EQ(alloc_count, EpidGetAllocCount());
+}
+
+TEST_F(EpidVerifierTest, VerifyWithWarmWorkspaceDoesNotAllocateGivenRandomBase) {
+  auto& msg = this->kMsg0;
+  auto& grp_rl = this->kGrpRl;
+  auto& priv_rl = this->kGrpXPrivRl;
+  auto& sig_rl = this->kGrpXSigRl;
+  auto& sig = this->kSigGrpXMember0Sha256RandbaseMsg0;
+
+  VerifierCtxObj verifier(this->kGrpXKey);
+  VerifierWorkspaceObj workspace;
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha256));
+  THROW_ON_EPIDERR(EpidVerifierSetGroupRl(
+      verifier, (GroupRl const*)grp_rl.data(), grp_rl.size()));
+  THROW_ON_EPIDERR(EpidVerifierSetPrivRl(
+      verifier, (PrivRl const*)priv_rl.data(), priv_rl.size()));
+  THROW_ON_EPIDERR(EpidVerifierSetSigRl(verifier, (SigRl const*)sig_rl.data(),
+                                        sig_rl.size()));
+  THROW_ON_EPIDERR(EpidVerifyWithWorkspace(verifier, workspace,
+                                           (EpidSignature const*)sig.data(),
+                                           sig.size(), msg.data(), msg.size()));
+  size_t alloc_count = EpidGetAllocCount();
+  EXPECT_EQ(kEpidSigValid,
+            EpidVerifyWithWorkspace(verifier, workspace,
+                                    (EpidSignature const*)sig.data(),
+                                    sig.size(), msg.data(), msg.size()));
+  EXPECT_EQ(alloc_count, EpidGetAllocCount());
+}
+
+/////////////////////////////////////////////////////////////////////
+// Concurrency
+
+TEST_F(EpidVerifierTest, VerifyCanRunConcurrentlyOnOneContext) {
+  auto& pub_key = this->kGrpXKey;
+  auto& msg = this->kMsg0;
+  auto& bsn = this->kBsn0;
+  auto& grp_rl = this->kGrpRl;
+  auto& priv_rl = this->kGrpXPrivRl;
+  auto& sig_rl = this->kGrpXSigRl;
+  auto& ver_rl = this->kGrpXBsn0Sha256VerRl;
+  auto& revoking_sig_rl = this->kGrpXSigRlMember0Sha256Bsn0Msg0FirstEntry;
+  auto& good_sig = this->kSigGrpXMember0Sha256Bsn0Msg0;
+  auto& priv_revoked_sig = this->kSigGrpXRevokedPrivKey000Sha256Bsn0Msg0;
+  auto& ver_revoked_sig = this->kSigGrpXVerRevokedMember1Sha256Bsn0Msg0;
+  auto bad_sig = good_sig;
+  ((EpidSignature*)bad_sig.data())->sigma0.sx.data.data[31]++;
+  const size_t kNumThreads = 8;
+  const size_t kNumIterations = 8;
+
+  // every list is set, so valid signatures run the SigRL proofs
+  VerifierCtxObj verifier(pub_key);
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha256));
+  THROW_ON_EPIDERR(EpidVerifierSetBasename(verifier, bsn.data(), bsn.size()));
+  THROW_ON_EPIDERR(EpidVerifierSetGroupRl(
+      verifier, (GroupRl const*)grp_rl.data(), grp_rl.size()));
+  THROW_ON_EPIDERR(EpidVerifierSetPrivRl(
+      verifier, (PrivRl const*)priv_rl.data(), priv_rl.size()));
+  THROW_ON_EPIDERR(EpidVerifierSetSigRl(verifier, (SigRl const*)sig_rl.data(),
+                                        sig_rl.size()));
+  THROW_ON_EPIDERR(EpidVerifierSetVerifierRl(
+      verifier, (VerifierRl const*)ver_rl.data(), ver_rl.size()));
+  // no signature is revoked in kGrpXSigRl, so SigRL revocation needs a
+  // second shared context
+  VerifierCtxObj sig_rl_verifier(pub_key);
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(sig_rl_verifier, kSha256));
+  THROW_ON_EPIDERR(
+      EpidVerifierSetBasename(sig_rl_verifier, bsn.data(), bsn.size()));
+  THROW_ON_EPIDERR(EpidVerifierSetSigRl(sig_rl_verifier,
+                                        (SigRl const*)revoking_sig_rl.data(),
+                                        revoking_sig_rl.size()));
+
+  struct Case {
+    VerifierCtx const* ctx;
+    std::vector<uint8_t> const* sig;
+    bool basic;
+    EpidStatus expected;
+  };
+  const std::vector<Case> cases = {
+      {verifier, &good_sig, false, kEpidSigValid},
+      {verifier, &good_sig, true, kEpidSigValid},
+      {verifier, &bad_sig, false, kEpidSigInvalid},
+      {verifier, &bad_sig, true, kEpidSigInvalid},
+      {verifier, &priv_revoked_sig, false, kEpidSigRevokedInPrivRl},
+      {verifier, &ver_revoked_sig, false, kEpidSigRevokedInVerifierRl},
+      {sig_rl_verifier, &good_sig, false, kEpidSigRevokedInSigRl},
+  };
+
+  // gtest assertions are not thread safe, results are checked after join
+  std::vector<EpidStatus> results(
+      kNumThreads * kNumIterations * cases.size(), kEpidErr);
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < kNumThreads; ++t) {
+    threads.emplace_back([&, t]() {
+      for (size_t i = 0; i < kNumIterations; ++i) {
+        // threads start at different cases so that all paths overlap
+        for (size_t n = 0; n < cases.size(); ++n) {
+          size_t c = (t + i + n) % cases.size();
+          EpidSignature const* sig =
+              (EpidSignature const*)cases[c].sig->data();
+          results[(t * kNumIterations + i) * cases.size() + c] =
+              cases[c].basic
+                  ? EpidVerifyBasicSig(cases[c].ctx, &sig->sigma0,
+                                       msg.data(), msg.size())
+                  : EpidVerify(cases[c].ctx, sig, cases[c].sig->size(),
+                               msg.data(), msg.size());
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (size_t t = 0; t < kNumThreads; ++t) {
+    for (size_t i = 0; i < kNumIterations; ++i) {
+      for (size_t c = 0; c < cases.size(); ++c) {
+        EXPECT_EQ(cases[c].expected,
+                  results[(t * kNumIterations + i) * cases.size() + c])
+            << "thread " << t << " iteration " << i << " case " << c;
+      }
+    }
+  }
+}
+
+/////////////////////////////////////////////////////////////////////
+// SigRL task runner
+
+/// Runs tasks on several threads and skips the rest after a failure
+EpidStatus ThreadedTaskRunner(EpidTask task, void* task_ctx, size_t num_tasks,
+                              void* user_data) {
+  size_t num_threads = *(size_t const*)user_data;
+  std::atomic<size_t> next_task(0);
+  std::atomic<int> result(kEpidNoErr);
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < num_threads; ++t) {
+    threads.emplace_back([&]() {
+      size_t i = 0;
+      while (kEpidNoErr == result && (i = next_task++) < num_tasks) {
+        EpidStatus sts = task(task_ctx, i);
+        if (kEpidNoErr != sts) {
+          int expected = kEpidNoErr;
+          result.compare_exchange_strong(expected, sts);
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  return (EpidStatus)result.load();
+}
+
+/// Fails without running any task
+EpidStatus FailingTaskRunner(EpidTask, void*, size_t, void*) {
+  return kEpidMemAllocErr;
+}
+
+TEST_F(EpidVerifierTest, VerifyWithSigRlRunnerAcceptsSigNotInSigRl) {
+  auto& pub_key = this->kGrpXKey;
+  auto& msg = this->kMsg0;
+  auto& sig_rl = this->kGrpXSigRl;
+  auto& sig = this->kSigGrpXMember0Sha256RandbaseMsg0;
+  size_t num_threads = 3;
+  VerifierCtxObj verifier(pub_key);
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha256));
+  THROW_ON_EPIDERR(EpidVerifierSetSigRl(verifier, (SigRl const*)sig_rl.data(),
+                                        sig_rl.size()));
+  THROW_ON_EPIDERR(
+      EpidVerifierSetSigRlRunner(verifier, ThreadedTaskRunner, &num_threads));
+
+  EXPECT_EQ(kEpidSigValid,
+            EpidVerify(verifier, (EpidSignature const*)sig.data(), sig.size(),
+                       msg.data(), msg.size()));
+}
+
+TEST_F(EpidVerifierTest, VerifyWithSigRlRunnerRejectsSigFromSigRlFirstEntry) {
+  auto& pub_key = this->kGrpXKey;
+  auto& msg = this->kMsg0;
+  auto& bsn = this->kBsn0;
+  auto& sig_rl = this->kGrpXSigRlMember0Sha256Bsn0Msg0FirstEntry;
+  auto& sig = this->kSigGrpXMember0Sha256Bsn0Msg0;
+  size_t num_threads = 3;
+  VerifierCtxObj verifier(pub_key);
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha256));
+  THROW_ON_EPIDERR(EpidVerifierSetBasename(verifier, bsn.data(), bsn.size()));
+  THROW_ON_EPIDERR(EpidVerifierSetSigRl(verifier, (SigRl const*)sig_rl.data(),
+                                        sig_rl.size()));
+  THROW_ON_EPIDERR(
+      EpidVerifierSetSigRlRunner(verifier, ThreadedTaskRunner, &num_threads));
+
+  EXPECT_EQ(kEpidSigRevokedInSigRl,
+            EpidVerify(verifier, (EpidSignature const*)sig.data(), sig.size(),
+                       msg.data(), msg.size()));
+}
+
+TEST_F(EpidVerifierTest, VerifyWithSigRlRunnerRejectsSigFromSigRlLastEntry) {
+  auto& pub_key = this->kGrpXKey;
+  auto& msg = this->kMsg0;
+  auto& bsn = this->kBsn0;
+  auto& sig_rl = this->kGrpXSigRlMember0Sha256Bsn0Msg0LastEntry;
+  auto& sig = this->kSigGrpXMember0Sha256Bsn0Msg0;
+  size_t num_threads = 3;
+  VerifierCtxObj verifier(pub_key);
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha256));
+  THROW_ON_EPIDERR(EpidVerifierSetBasename(verifier, bsn.data(), bsn.size()));
+  THROW_ON_EPIDERR(EpidVerifierSetSigRl(verifier, (SigRl const*)sig_rl.data(),
+                                        sig_rl.size()));
+  THROW_ON_EPIDERR(
+      EpidVerifierSetSigRlRunner(verifier, ThreadedTaskRunner, &num_threads));
+
+  EXPECT_EQ(kEpidSigRevokedInSigRl,
+            EpidVerify(verifier, (EpidSignature const*)sig.data(), sig.size(),
+                       msg.data(), msg.size()));
+}
+
+TEST_F(EpidVerifierTest, VerifyReturnsSigRlRunnerError) {
+  auto& pub_key = this->kGrpXKey;
+  auto& msg = this->kMsg0;
+  auto& sig_rl = this->kGrpXSigRl;
+  auto& sig = this->kSigGrpXMember0Sha256RandbaseMsg0;
+  VerifierCtxObj verifier(pub_key);
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha256));
+  THROW_ON_EPIDERR(EpidVerifierSetSigRl(verifier, (SigRl const*)sig_rl.data(),
+                                        sig_rl.size()));
+  THROW_ON_EPIDERR(
+      EpidVerifierSetSigRlRunner(verifier, FailingTaskRunner, nullptr));
+
+  EXPECT_EQ(kEpidMemAllocErr,
+            EpidVerify(verifier, (EpidSignature const*)sig.data(), sig.size(),
+                       msg.data(), msg.size()));
+}
+
+/////////////////////////////////////////////////////////////////////
+// Random base PrivRL scan
+
+/// Returns priv_rl with num_padding unrelated entries in front of its own
+std::vector<uint8_t> PadPrivRl(std::vector<uint8_t> const& priv_rl,
+                               uint32_t num_padding) {
+  PrivRl const* rl = reinterpret_cast<PrivRl const*>(priv_rl.data());
+  size_t const header_size = sizeof(PrivRl) - sizeof(rl->f);
+  uint32_t n1 = ntohl(rl->n1);
+  std::vector<uint8_t> padded(priv_rl.begin(),
+                              priv_rl.begin() + header_size);
+  for (uint32_t i = 0; i < num_padding; ++i) {
+    FpElemStr f = {0};
+    f.data.data[sizeof(f) - 1] = (uint8_t)(i + 1);
+    f.data.data[sizeof(f) - 2] = (uint8_t)((i + 1) >> 8);
+    padded.insert(padded.end(), (uint8_t*)&f, (uint8_t*)&f + sizeof(f));
+  }
+  padded.insert(padded.end(), priv_rl.begin() + header_size, priv_rl.end());
+  PrivRl* padded_rl = reinterpret_cast<PrivRl*>(padded.data());
+  padded_rl->n1.data[0] = (uint8_t)((n1 + num_padding) >> 24);
+  padded_rl->n1.data[1] = (uint8_t)((n1 + num_padding) >> 16);
+  padded_rl->n1.data[2] = (uint8_t)((n1 + num_padding) >> 8);
+  padded_rl->n1.data[3] = (uint8_t)(n1 + num_padding);
+  return padded;
+}
+
+TEST_F(EpidVerifierTest, VerifyRejectsSigFromPrivRlGivenRandomBaseVerifier) {
+  // without a basename B is only known once the signature is checked
+  auto& pub_key = this->kGrpXKey;
+  auto& msg = this->kMsg0;
+  auto& priv_rl = this->kGrpXPrivRl;
+  auto& sig = this->kSigGrpXRevokedPrivKey001Sha256Bsn0Msg0;
+  VerifierCtxObj verifier(pub_key);
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha256));
+  THROW_ON_EPIDERR(EpidVerifierSetPrivRl(
+      verifier, (PrivRl const*)priv_rl.data(), priv_rl.size()));
+
+  EXPECT_EQ(kEpidSigRevokedInPrivRl,
+            EpidVerify(verifier, (EpidSignature const*)sig.data(), sig.size(),
+                       msg.data(), msg.size()));
+}
+
+TEST_F(EpidVerifierTest, VerifyRejectsSigFromLargePrivRlGivenRandomBase) {
+  auto& pub_key = this->kGrpXKey;
+  auto& msg = this->kMsg0;
+  auto priv_rl = PadPrivRl(this->kGrpXPrivRl, 100);
+  auto& sig = this->kSigGrpXRevokedPrivKey002Sha256Bsn0Msg0;
+  VerifierCtxObj verifier(pub_key);
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha256));
+  THROW_ON_EPIDERR(EpidVerifierSetPrivRl(
+      verifier, (PrivRl const*)priv_rl.data(), priv_rl.size()));
+
+  EXPECT_EQ(kEpidSigRevokedInPrivRl,
+            EpidVerify(verifier, (EpidSignature const*)sig.data(), sig.size(),
+                       msg.data(), msg.size()));
+}
+
+TEST_F(EpidVerifierTest, VerifyAcceptsSigNotInLargePrivRlGivenRandomBase) {
+  auto& pub_key = this->kGrpXKey;
+  auto& msg = this->kMsg0;
+  auto priv_rl = PadPrivRl(this->kGrpXPrivRl, 100);
+  auto& sig = this->kSigGrpXMember0Sha256RandbaseMsg0;
+  VerifierCtxObj verifier(pub_key);
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha256));
+  THROW_ON_EPIDERR(EpidVerifierSetPrivRl(
+      verifier, (PrivRl const*)priv_rl.data(), priv_rl.size()));
+
+  EXPECT_EQ(kEpidSigValid,
+            EpidVerify(verifier, (EpidSignature const*)sig.data(), sig.size(),
+                       msg.data(), msg.size()));
+}
+
+TEST_F(EpidVerifierTest, VerifyWithPrivRlRunnerAcceptsSigNotInPrivRl) {
+  auto& pub_key = this->kGrpXKey;
+  auto& msg = this->kMsg0;
+  auto priv_rl = PadPrivRl(this->kGrpXPrivRl, 200);
+  auto& sig = this->kSigGrpXMember0Sha256RandbaseMsg0;
+  size_t num_threads = 3;
+  VerifierCtxObj verifier(pub_key);
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha256));
+  THROW_ON_EPIDERR(EpidVerifierSetPrivRl(
+      verifier, (PrivRl const*)priv_rl.data(), priv_rl.size()));
+  THROW_ON_EPIDERR(
+      EpidVerifierSetPrivRlRunner(verifier, ThreadedTaskRunner, &num_threads));
+
+  EXPECT_EQ(kEpidSigValid,
+            EpidVerify(verifier, (EpidSignature const*)sig.data(), sig.size(),
+                       msg.data(), msg.size()));
+}
+
+TEST_F(EpidVerifierTest, VerifyWithPrivRlRunnerRejectsSigFromPrivRlLastEntry) {
+  auto& pub_key = this->kGrpXKey;
+  auto& msg = this->kMsg0;
+  auto priv_rl = PadPrivRl(this->kGrpXPrivRl, 200);
+  auto& sig = this->kSigGrpXRevokedPrivKey002Sha256Bsn0Msg0;
+  size_t num_threads = 3;
+  VerifierCtxObj verifier(pub_key);
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha256));
+  THROW_ON_EPIDERR(EpidVerifierSetPrivRl(
+      verifier, (PrivRl const*)priv_rl.data(), priv_rl.size()));
+  THROW_ON_EPIDERR(
+      EpidVerifierSetPrivRlRunner(verifier, ThreadedTaskRunner, &num_threads));
+
+  EXPECT_EQ(kEpidSigRevokedInPrivRl,
+            EpidVerify(verifier, (EpidSignature const*)sig.data(), sig.size(),
+                       msg.data(), msg.size()));
+}
+
+TEST_F(EpidVerifierTest, VerifyReturnsPrivRlRunnerError) {
+  auto& pub_key = this->kGrpXKey;
+  auto& msg = this->kMsg0;
+  auto priv_rl = PadPrivRl(this->kGrpXPrivRl, 200);
+  auto& sig = this->kSigGrpXMember0Sha256RandbaseMsg0;
+  VerifierCtxObj verifier(pub_key);
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha256));
+  THROW_ON_EPIDERR(EpidVerifierSetPrivRl(
+      verifier, (PrivRl const*)priv_rl.data(), priv_rl.size()));
+  THROW_ON_EPIDERR(
+      EpidVerifierSetPrivRlRunner(verifier, FailingTaskRunner, nullptr));
+
+  EXPECT_EQ(kEpidMemAllocErr,
+            EpidVerify(verifier, (EpidSignature const*)sig.data(), sig.size(),
+                       msg.data(), msg.size()));
+}
+
+TEST_F(EpidVerifierTest, VerifyDoesNotUsePrivRlRunnerGivenBasename) {
+  auto& pub_key = this->kGrpXKey;
+  auto& msg = this->kMsg0;
+  auto& bsn = this->kBsn0;
+  auto priv_rl = PadPrivRl(this->kGrpXPrivRl, 200);
+  auto& sig = this->kSigGrpXRevokedPrivKey000Sha256Bsn0Msg0;
+  VerifierCtxObj verifier(pub_key);
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha256));
+  THROW_ON_EPIDERR(EpidVerifierSetBasename(verifier, bsn.data(), bsn.size()));
+  THROW_ON_EPIDERR(EpidVerifierSetPrivRl(
+      verifier, (PrivRl const*)priv_rl.data(), priv_rl.size()));
+  THROW_ON_EPIDERR(
+      EpidVerifierSetPrivRlRunner(verifier, FailingTaskRunner, nullptr));
+
+  EXPECT_EQ(kEpidSigRevokedInPrivRl,
+            EpidVerify(verifier, (EpidSignature const*)sig.data(), sig.size(),
+                       msg.data(), msg.size()));
+}
+
+/////////////////////////////////////////////////////////////////////
+// EpidVerifyFromReader
+
+/// Reads a message held in a std::vector
+int __STDCALL ReadMsgFromVector(void* buf, size_t len, size_t offset,
+                                void* user_data) {
+  auto const* msg = static_cast<std::vector<uint8_t> const*>(user_data);
+  if (offset > msg->size() || len > msg->size() - offset) {
+    return -1;
+  }
+  memcpy(buf, msg->data() + offset, len);
+  return 0;
+}
+
+/// Fails every read
+int __STDCALL FailingMsgReader(void*, size_t, size_t, void*) { return -1; }
+
+/// Message that can be read a limited number of times
+struct LimitedMsg {
+  std::vector<uint8_t> msg;  ///< the message
+  size_t passes_left;        ///< number of reads from the start to allow
+};
+
+/// Reads a LimitedMsg, failing once its passes are used up
+int __STDCALL ReadLimitedMsg(void* buf, size_t len, size_t offset,
+                             void* user_data) {
+  auto* limited = static_cast<LimitedMsg*>(user_data);
+  if (0 == offset) {
+    if (0 == limited->passes_left) {
+      return -1;
+    }
+    limited->passes_left--;
+  }
+  return ReadMsgFromVector(buf, len, offset, &limited->msg);
+}
+
+TEST_F(EpidVerifierTest, VerifyFromReaderFailsGivenNullParameters) {
+  VerifierCtxObj verifier(this->kGrp01Key);
+  auto& sig = this->kSigGrp01Member0Sha256RandombaseTest0;
+  auto msg = this->kTest0;
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidVerifyFromReader(nullptr, (EpidSignature const*)sig.data(),
+                                 sig.size(), ReadMsgFromVector, &msg,
+                                 msg.size()));
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidVerifyFromReader(verifier, nullptr, sig.size(),
+                                 ReadMsgFromVector, &msg, msg.size()));
+  EXPECT_EQ(kEpidBadArgErr,
+            EpidVerifyFromReader(verifier, (EpidSignature const*)sig.data(),
+                                 sig.size(), nullptr, &msg, msg.size()));
+}
+
+TEST_F(EpidVerifierTest, VerifyFromReaderAcceptsSigWithRandomBaseNameAllRl) {
+  auto& pub_key = this->kGrpXKey;
+  auto msg = this->kMsg0;
+  auto& grp_rl = this->kGrpRl;
+  auto& priv_rl = this->kGrpXPrivRl;
+  auto& sig_rl = this->kGrpXSigRl;
+  auto& sig = this->kSigGrpXMember0Sha512256RandbaseMsg0;
+
+  VerifierCtxObj verifier(pub_key);
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha512_256));
+  THROW_ON_EPIDERR(EpidVerifierSetGroupRl(
+      verifier, (GroupRl const*)grp_rl.data(), grp_rl.size()));
+  THROW_ON_EPIDERR(EpidVerifierSetPrivRl(
+      verifier, (PrivRl const*)priv_rl.data(), priv_rl.size()));
+  THROW_ON_EPIDERR(EpidVerifierSetSigRl(verifier, (SigRl const*)sig_rl.data(),
+                                        sig_rl.size()));
+
+  EXPECT_EQ(kEpidSigValid,
+            EpidVerifyFromReader(verifier, (EpidSignature const*)sig.data(),
+                                 sig.size(), ReadMsgFromVector, &msg,
+                                 msg.size()));
+}
+
+TEST_F(EpidVerifierTest, VerifyFromReaderRejectsSigDifferingOnlyInMsg) {
+  VerifierCtxObj verifier(this->kGrp01Key);
+  auto& sig = this->kSigGrp01Member0Sha256RandombaseTest0;
+  auto msg = this->kTest0;
+  msg[0]++;
+  EXPECT_EQ(kEpidSigInvalid,
+            EpidVerifyFromReader(verifier, (EpidSignature const*)sig.data(),
+                                 sig.size(), ReadMsgFromVector, &msg,
+                                 msg.size()));
+}
+
+TEST_F(EpidVerifierTest, VerifyFromReaderWithSigRlRunnerAcceptsSigNotInSigRl) {
+  auto& pub_key = this->kGrpXKey;
+  auto msg = this->kMsg0;
+  auto& sig_rl = this->kGrpXSigRl;
+  auto& sig = this->kSigGrpXMember0Sha256RandbaseMsg0;
+  size_t num_threads = 3;
+  VerifierCtxObj verifier(pub_key);
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha256));
+  THROW_ON_EPIDERR(EpidVerifierSetSigRl(verifier, (SigRl const*)sig_rl.data(),
+                                        sig_rl.size()));
+  THROW_ON_EPIDERR(
+      EpidVerifierSetSigRlRunner(verifier, ThreadedTaskRunner, &num_threads));
+
+  EXPECT_EQ(kEpidSigValid,
+            EpidVerifyFromReader(verifier, (EpidSignature const*)sig.data(),
+                                 sig.size(), ReadMsgFromVector, &msg,
+                                 msg.size()));
+}
+
+TEST_F(EpidVerifierTest, VerifyFromReaderReturnsReaderError) {
+  auto& pub_key = this->kGrpXKey;
+  auto& msg = this->kMsg0;
+  auto& sig = this->kSigGrpXMember0Sha256RandbaseMsg0;
+  VerifierCtxObj verifier(pub_key);
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha256));
+  EXPECT_EQ(kEpidErr,
+            EpidVerifyFromReader(verifier, (EpidSignature const*)sig.data(),
+                                 sig.size(), FailingMsgReader, nullptr,
+                                 msg.size()));
+}
+
+TEST_F(EpidVerifierTest, VerifyFromReaderReturnsReaderErrorInNrProof) {
+  auto& pub_key = this->kGrpXKey;
+  auto& sig_rl = this->kGrpXSigRl;
+  auto& sig = this->kSigGrpXMember0Sha256RandbaseMsg0;
+  // the basic signature reads the message, the first proof does not
+  LimitedMsg limited = {this->kMsg0, 1};
+  VerifierCtxObj verifier(pub_key);
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha256));
+  THROW_ON_EPIDERR(EpidVerifierSetSigRl(verifier, (SigRl const*)sig_rl.data(),
+                                        sig_rl.size()));
+  EXPECT_EQ(kEpidErr,
+            EpidVerifyFromReader(verifier, (EpidSignature const*)sig.data(),
+                                 sig.size(), ReadLimitedMsg, &limited,
+                                 limited.msg.size()));
+}
+
+TEST_F(EpidVerifierTest, VerifyFromReaderRejectsSigFromSigRlLikeVerify) {
+  auto& pub_key = this->kGrpXKey;
+  auto msg = this->kMsg0;
+  auto& bsn = this->kBsn0;
+  auto& sig_rl = this->kGrpXSigRlMember0Sha256Bsn0Msg0FirstEntry;
+  auto& sig = this->kSigGrpXMember0Sha256Bsn0Msg0;
+  VerifierCtxObj verifier(pub_key);
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha256));
+  THROW_ON_EPIDERR(EpidVerifierSetBasename(verifier, bsn.data(), bsn.size()));
+  THROW_ON_EPIDERR(EpidVerifierSetSigRl(verifier, (SigRl const*)sig_rl.data(),
+                                        sig_rl.size()));
+  EXPECT_EQ(kEpidSigRevokedInSigRl,
+            EpidVerify(verifier, (EpidSignature const*)sig.data(), sig.size(),
+                       msg.data(), msg.size()));
+  EXPECT_EQ(kEpidSigRevokedInSigRl,
+            EpidVerifyFromReader(verifier, (EpidSignature const*)sig.data(),
+                                 sig.size(), ReadMsgFromVector, &msg,
+                                 msg.size()));
+}
+
+TEST_F(EpidVerifierTest,
+       VerifyFromReaderWithSigRlRunnerRejectsSigFromSigRlLikeVerify) {
+  auto& pub_key = this->kGrpXKey;
+  auto msg = this->kMsg0;
+  auto& bsn = this->kBsn0;
+  auto& sig_rl = this->kGrpXSigRlMember0Sha256Bsn0Msg0FirstEntry;
+  auto& sig = this->kSigGrpXMember0Sha256Bsn0Msg0;
+  size_t num_threads = 3;
+  VerifierCtxObj verifier(pub_key);
+  THROW_ON_EPIDERR(EpidVerifierSetHashAlg(verifier, kSha256));
+  THROW_ON_EPIDERR(EpidVerifierSetBasename(verifier, bsn.data(), bsn.size()));
+  THROW_ON_EPIDERR(EpidVerifierSetSigRl(verifier, (SigRl const*)sig_rl.data(),
+                                        sig_rl.size()));
+  THROW_ON_EPIDERR(
+      EpidVerifierSetSigRlRunner(verifier, ThreadedTaskRunner, &num_threads));
+  EXPECT_EQ(kEpidSigRevokedInSigRl,
+            EpidVerify(verifier, (EpidSignature const*)sig.data(), sig.size(),
+                       msg.data(), msg.size()));
+  EXPECT_EQ(kEpidSigRevokedInSigRl,
+            EpidVerifyFromReader(verifier, (EpidSignature const*)sig.data(),
+                                 sig.size(), ReadMsgFromVector, &msg,
+                                 msg.size()));
+}
+
 }  // namespace
@@ -1101,6 +1101,11 @@ IPPAPI(IppStatus, ippsGFpMul, (const IppsGFpElement* pA, const IppsGFpElement* p
 IPPAPI(IppStatus, ippsGFpExp, (const IppsGFpElement* pA, const IppsBigNumState* pE, IppsGFpElement* pR, IppsGFpState* pGFp, Ipp8u* pScratchBuffer))
 IPPAPI(IppStatus, ippsGFpMultiExp,(const IppsGFpElement* const ppElmA[], const IppsBigNumState* const ppE[], int nItems, IppsGFpElement* pR, IppsGFpState* pGFp, Ipp8u* pScratchBuffer))
 
+/* exponentiation of elements of the cyclotomic subgroup of GF(p^12) by comb tables */
+IPPAPI(IppStatus, ippsGFpxCyclotomicCombTableGetSize,(const IppsGFpState* pGFp, int* pSize))
+IPPAPI(IppStatus, ippsGFpxCyclotomicCombTableInit,(const IppsGFpElement* pA, int expBits, Ipp8u* pTable, IppsGFpState* pGFp))
+IPPAPI(IppStatus, ippsGFpxCyclotomicMultiExpComb,(const Ipp8u* const ppTable[], const IppsBigNumState* const ppE[], int count, IppsGFpElement* pR, IppsGFpState* pGFp))
+
 IPPAPI(IppStatus, ippsGFpAdd_PE,(const IppsGFpElement* pA, const IppsGFpElement* pParentB, IppsGFpElement* pR, IppsGFpState* pGFp))
 IPPAPI(IppStatus, ippsGFpSub_PE,(const IppsGFpElement* pA, const IppsGFpElement* pParentB, IppsGFpElement* pR, IppsGFpState* pGFp))
 IPPAPI(IppStatus, ippsGFpMul_PE,(const IppsGFpElement* pA, const IppsGFpElement* pParentB, IppsGFpElement* pR, IppsGFpState* pGFp))
@@ -1161,6 +1166,7 @@ IPPAPI(IppStatus, ippsGFpECGetPoint,(const IppsGFpECPoint* pPoint, IppsGFpElemen
 IPPAPI(IppStatus, ippsGFpECGetPointRegular,(const IppsGFpECPoint* pPoint, IppsBigNumState* pX, IppsBigNumState* pY, IppsGFpECState* pEC))
 IPPAPI(IppStatus, ippsGFpECSetPointOctString,(const Ipp8u* pStr, int strLen, IppsGFpECPoint* pPoint, IppsGFpECState* pEC))
 IPPAPI(IppStatus, ippsGFpECGetPointOctString,(const IppsGFpECPoint* pPoint, Ipp8u* pStr, int strLen, IppsGFpECState* pEC))
+IPPAPI(IppStatus, ippsGFpECGetPoints,(const IppsGFpECPoint* const ppPoint[], IppsGFpElement* const ppX[], IppsGFpElement* const ppY[], int count, IppsGFpECState* pEC))
 
 IPPAPI(IppStatus, ippsGFpECTstPoint,(const IppsGFpECPoint* pP, IppECResult* pResult, IppsGFpECState* pEC))
 IPPAPI(IppStatus, ippsGFpECTstPointInSubgroup,(const IppsGFpECPoint* pP, IppECResult* pResult, IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
@@ -1170,6 +1176,28 @@ IPPAPI(IppStatus, ippsGFpECNegPoint,(const IppsGFpECPoint* pP, IppsGFpECPoint* p
 IPPAPI(IppStatus, ippsGFpECAddPoint,(const IppsGFpECPoint* pP, const IppsGFpECPoint* pQ, IppsGFpECPoint* pR, IppsGFpECState* pEC))
 IPPAPI(IppStatus, ippsGFpECMulPoint,(const IppsGFpECPoint* pP, const IppsBigNumState* pN, IppsGFpECPoint* pR, IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
 
+/* fixed point multiplication */
+IPPAPI(IppStatus, ippsGFpECPointTableGetSize,(const IppsGFpECState* pEC, int* pSize))
+IPPAPI(IppStatus, ippsGFpECPointTableInit,(const IppsGFpECPoint* pP, Ipp8u* pTable, IppsGFpECState* pEC))
+IPPAPI(IppStatus, ippsGFpECMulPointTable,(const Ipp8u* pTable, const IppsBigNumState* pN, IppsGFpECPoint* pR, IppsGFpECState* pEC))
+
+/* multi-point multiplication */
+IPPAPI(IppStatus, ippsGFpECMultiMulPointGetSize,(int count, const IppsGFpECState* pEC, int* pSize))
+IPPAPI(IppStatus, ippsGFpECMultiMulPoint,(const IppsGFpECPoint* const ppP[], const IppsBigNumState* const ppN[], int count, IppsGFpECPoint* pR, IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
+
+/* multiplication with the GLV endomorphism */
+IPPAPI(IppStatus, ippsGFpECGLVGetSize,(const IppsGFpECState* pEC, int* pSize))
+IPPAPI(IppStatus, ippsGFpECGLVInit,(const IppsGFpElement* pBeta, const IppsBigNumState* pLambda, Ipp8u* pGLV, IppsGFpECState* pEC))
+IPPAPI(IppStatus, ippsGFpECMulPointGLV,(const IppsGFpECPoint* pP, const IppsBigNumState* pN, const Ipp8u* pGLV, IppsGFpECPoint* pR, IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
+IPPAPI(IppStatus, ippsGFpECMultiMulPointGLVGetSize,(int count, const Ipp8u* pGLV, const IppsGFpECState* pEC, int* pSize))
+IPPAPI(IppStatus, ippsGFpECMultiMulPointGLV,(const IppsGFpECPoint* const ppP[], const IppsBigNumState* const ppN[], int count, const Ipp8u* pGLV, IppsGFpECPoint* pR, IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
+
+/* multiplication and subgroup test with the GLS endomorphism */
+IPPAPI(IppStatus, ippsGFpECGLSGetSize,(const IppsGFpECState* pEC, int* pSize))
+IPPAPI(IppStatus, ippsGFpECGLSInit,(const IppsGFpElement* pFrobX, const IppsGFpElement* pFrobY, const IppsBigNumState* pT, Ipp8u* pGLS, IppsGFpECState* pEC))
+IPPAPI(IppStatus, ippsGFpECMulPointGLS,(const IppsGFpECPoint* pP, const IppsBigNumState* pN, const Ipp8u* pGLS, IppsGFpECPoint* pR, IppsGFpECState* pEC, Ipp8u* pScratchBuffer))
+IPPAPI(IppStatus, ippsGFpECTstPointInSubgroupGLS,(const IppsGFpECPoint* pP, IppECResult* pResult, const Ipp8u* pGLS, IppsGFpECState* pEC))
+
 /* keys */
 IPPAPI(IppStatus, ippsGFpECPrivateKey,(IppsBigNumState* pPrivate, IppsGFpECState* pEC,
                                        IppBitSupplier rndFunc, void* pRndParam))
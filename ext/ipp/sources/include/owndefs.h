@@ -66,6 +66,14 @@
   #define __INLINE static
 #endif
 
+#if defined(_MSC_VER) || (defined(__INTEL_COMPILER) && defined(_WIN32))
+  #define __THREAD_LOCAL __declspec(thread)
+#elif defined( __GNUC__ ) || defined(__INTEL_COMPILER)
+  #define __THREAD_LOCAL __thread
+#else
+  #error Intel, MS or GNU C compiler required
+#endif
+
 #if defined(__INTEL_COMPILER)
  #define __RESTRICT restrict
 #elif !defined( __RESTRICT )
@@ -373,7 +381,9 @@ typedef enum {
     idCtxHash,
     idCtxSM3,
     idCtxAESXTS,
-    idxCtxECES_SM2
+    idxCtxECES_SM2,
+    idCtxGFPECGLV,
+    idCtxGFPECGLS
 } IppCtxId;
 
 
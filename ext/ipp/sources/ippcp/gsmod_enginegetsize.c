@@ -75,17 +75,16 @@
 IppStatus gsModEngineGetSize(int modulusBitSize, int numpe, int* pSize)
 {
    int modLen  = BITS_BNU_CHUNK(modulusBitSize);
-   int pelmLen = BITS_BNU_CHUNK(modulusBitSize);
 
    IPP_BADARG_RET(modulusBitSize<1, ippStsLengthErr);
    IPP_BADARG_RET(numpe<MOD_ENGINE_MIN_POOL_SIZE, ippStsLengthErr);
 
    /* allocates mimimal necessary to Montgomery based methods */
+   /* (temporaries come from the thread pool) */
    *pSize = sizeof(gsModEngine)
            + modLen*sizeof(BNU_CHUNK_T)         /* modulus  */
            + modLen*sizeof(BNU_CHUNK_T)         /* mont_R   */
-           + modLen*sizeof(BNU_CHUNK_T)         /* mont_R^2 */
-           + pelmLen*sizeof(BNU_CHUNK_T)*numpe; /* buffers  */
+           + modLen*sizeof(BNU_CHUNK_T);        /* mont_R^2 */
 
    return ippStsNoErr;
 }
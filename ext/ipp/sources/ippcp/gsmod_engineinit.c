@@ -102,9 +102,7 @@ IppStatus gsModEngineInit(gsModEngine* pME, const Ipp32u* pModulus, int modulusB
       MOD_MODULUS(pME)  = (BNU_CHUNK_T*)(ptr += sizeof(gsModEngine));
       MOD_MNT_R(pME)    = (BNU_CHUNK_T*)(ptr += modLen*sizeof(BNU_CHUNK_T));
       MOD_MNT_R2(pME)   = (BNU_CHUNK_T*)(ptr += modLen*sizeof(BNU_CHUNK_T));
-      MOD_POOL_BUF(pME) = (BNU_CHUNK_T*)(ptr += modLen*sizeof(BNU_CHUNK_T));
       MOD_MAXPOOL(pME)  = numpe;
-      MOD_USEDPOOL(pME) = 0;
 
       if (pModulus) {
          /* store modulus */
@@ -44,6 +44,7 @@
 //     Cryptography Primitive. Modular Arithmetic Engine. General Functionality
 // 
 //  Contents:
+//        gsThreadPool
 //        gsModGetPool()
 //
 */
@@ -54,10 +55,28 @@
 #include "pcpbnuarith.h"
 #include "gsmodstuff.h"
 #include "pcptool.h"
+#include "pcpgfpecstuff.h"
+#include "pcpmontgomery.h"
+
+/* temporary BNU of the calling thread */
+__THREAD_LOCAL BNU_CHUNK_T gsThreadPool[GS_THREAD_POOL_LEN];
+__THREAD_LOCAL int gsThreadPoolUsed = 0;
+
+/* an EC over the largest GF(p) and a Montgomery engine of the largest BN
+   need no check at init, so they must fit the thread pool */
+#define GS_GFPEC_POOL_NEED \
+   (GFP_POOL_SIZE*BITS_BNU_CHUNK(GFP_MAX_BITSIZE+BITSIZE(BNU_CHUNK_T)) \
+   +EC_POOL_SIZE*3*BITS_BNU_CHUNK(GFP_MAX_BITSIZE) \
+   +MONT_DEFAULT_POOL_LENGTH*BITS_BNU_CHUNK(GFP_MAX_BITSIZE+1))
+#define GS_MONT_POOL_NEED \
+   (MONT_DEFAULT_POOL_LENGTH*BITS_BNU_CHUNK(BN_MAXBITSIZE))
+
+typedef char gsThreadPoolFitsGFpEC[(GS_GFPEC_POOL_NEED<=GS_THREAD_POOL_LEN)? 1 : -1];
+typedef char gsThreadPoolFitsMont[(GS_MONT_POOL_NEED<=GS_THREAD_POOL_LEN)? 1 : -1];
 
 BNU_CHUNK_T*   gsModGetPool(gsModEngine* pME)
 {
    BNU_CHUNK_T*
-   pPool = (pME->poolLenUsed >= pME->poolLen)? NULL : MOD_BUFFER(pME, pME->poolLenUsed);
+   pPool = (MOD_PELEN(pME) > GS_THREAD_POOL_LEN - gsThreadPoolUsed)? NULL : gsThreadPool + gsThreadPoolUsed;
    return pPool;
 }
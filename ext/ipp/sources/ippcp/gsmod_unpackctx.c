@@ -69,5 +69,4 @@ void gsUnpackModEngineCtx(const Ipp8u* pBuffer, gsModEngine* pCtx)
    MOD_MODULUS(pCtx)  = (BNU_CHUNK_T*)((Ipp8u*)pCtx + IPP_UINT_PTR(MOD_MODULUS(pAlignedBuffer)));
    MOD_MNT_R(pCtx)    = (BNU_CHUNK_T*)((Ipp8u*)pCtx + IPP_UINT_PTR(MOD_MNT_R(pAlignedBuffer)));
    MOD_MNT_R2(pCtx)   = (BNU_CHUNK_T*)((Ipp8u*)pCtx + IPP_UINT_PTR(MOD_MNT_R2(pAlignedBuffer)));
-   MOD_POOL_BUF(pCtx) = MOD_MNT_R2(pCtx) + modSize;
 }
@@ -67,9 +67,7 @@ typedef struct _gsModEngine
    BNU_CHUNK_T*         pMontR2;       /* mont_enc(1)^2                    */
    BNU_CHUNK_T*         pHalfModulus;  /* modulus/2                        */
    BNU_CHUNK_T*         pQnr;          /* quadratic non-residue            */
-   int                  poolLenUsed;   /* number of reserved temporary BNU */
    int                  poolLen;       /* max number of temporary BNU      */
-   BNU_CHUNK_T*         pBuffer;       /* buffer of modLen*nBuffers length */
 } gsModEngine;
 
 /* accessory macros */
@@ -86,11 +84,7 @@ typedef struct _gsModEngine
 #define MOD_MNT_R2(eng)      ((eng)->pMontR2)
 #define MOD_HMODULUS(eng)    ((eng)->pHalfModulus)
 #define MOD_QNR(eng)         ((eng)->pQnr)
-#define MOD_POOL_BUF(eng)    ((eng)->pBuffer)
 #define MOD_MAXPOOL(eng)     ((eng)->poolLen)
-#define MOD_USEDPOOL(eng)    ((eng)->poolLenUsed)
-
-#define MOD_BUFFER(eng,n)    ((eng)->pBuffer+(MOD_PELEN(eng))*(n))
 
 #define MOD_ENGINE_ALIGNMENT ((int)sizeof(void*))
 
@@ -107,6 +101,92 @@ IppStatus gsModEngineInit(gsModEngine* pME, const Ipp32u* pModulus, int modulusB
 BNU_CHUNK_T gsMontFactor(BNU_CHUNK_T m0);
 
 
+/*
+// thread pool management methods
+//
+// Temporary BNU of every engine and EC are taken from one stack local
+// to the calling thread, so the same engine may be used by several
+// threads at a time. Pools must be released in the reverse order of
+// allocation.
+//
+// Nested tower field and EC operations all draw on this stack. An
+// operation never holds more than MOD_MAXPOOL elements of an engine at
+// a time, so a field takes at most gsModPoolNeed() of the stack. The
+// largest prime fields, curves and Montgomery engines fit by a static
+// assertion; towers and curves over them are refused at init
+// (ippStsNoMemErr) if they would not fit. A NULL pool is unreachable.
+*/
+#define GS_THREAD_POOL_LEN (4096)  /* length of thread pool (BNU_CHUNK_T) */
+
+#define gsThreadPool     OWNAPI(gsThreadPool)
+#define gsThreadPoolUsed OWNAPI(gsThreadPoolUsed)
+extern __THREAD_LOCAL BNU_CHUNK_T gsThreadPool[GS_THREAD_POOL_LEN];
+extern __THREAD_LOCAL int gsThreadPoolUsed;
+
+/*F*
+// Name: gsModPoolNeed
+//
+// Purpose: Thread pool taken by an engine and its ground engines.
+//
+// Returns:
+//    max length of thread pool (BNU_CHUNK_T) in use at a time
+//
+// Parameters:
+//    pME       ModEngine
+*F*/
+
+__INLINE int gsModPoolNeed(const gsModEngine* pME)
+{
+   int need = 0;
+   for(; pME; pME = MOD_PARENT(pME))
+      need += MOD_MAXPOOL(pME)*MOD_PELEN(pME);
+   return need;
+}
+
+/*F*
+// Name: gsThreadPoolAlloc
+//
+// Purpose: Allocation of thread pool.
+//
+// Returns:
+//    pointer to allocate Pool
+//    NULL if the thread pool is exhausted
+//
+// Parameters:
+//    len       Required pool length (BNU_CHUNK_T)
+*F*/
+
+__INLINE BNU_CHUNK_T* gsThreadPoolAlloc(int len)
+{
+   BNU_CHUNK_T* pPool;
+
+   if(len > GS_THREAD_POOL_LEN - gsThreadPoolUsed)
+      return NULL;
+
+   pPool = gsThreadPool + gsThreadPoolUsed;
+   gsThreadPoolUsed += len;
+   return pPool;
+}
+
+/*F*
+// Name: gsThreadPoolFree
+//
+// Purpose: Delete thread pool.
+//
+// Returns:
+//    nothing
+//
+// Parameters:
+//    len       Required pool length (BNU_CHUNK_T)
+*F*/
+
+__INLINE void gsThreadPoolFree(int len)
+{
+   if(gsThreadPoolUsed < len)
+      len = gsThreadPoolUsed;
+   gsThreadPoolUsed -= len;
+}
+
 /*
 // pool management methods
 */
@@ -127,14 +207,9 @@ BNU_CHUNK_T gsMontFactor(BNU_CHUNK_T m0);
 
 __INLINE BNU_CHUNK_T* gsModPoolAlloc(gsModEngine* pME, int poolReq)
 {
-   BNU_CHUNK_T* pPool = MOD_BUFFER(pME, pME->poolLenUsed);
-
-   if(pME->poolLenUsed + poolReq > pME->poolLen)
-      pPool = NULL;
-   else
-      pME->poolLenUsed += poolReq;
-
-   return pPool;
+   if(poolReq > pME->poolLen)
+      return NULL;
+   return gsThreadPoolAlloc(poolReq*MOD_PELEN(pME));
 }
 
 /*F*
@@ -152,9 +227,7 @@ __INLINE BNU_CHUNK_T* gsModPoolAlloc(gsModEngine* pME, int poolReq)
 
 __INLINE void gsModPoolFree(gsModEngine* pME, int poolReq)
 {
-   if(pME->poolLenUsed < poolReq)
-      poolReq = pME->poolLenUsed;
-   pME->poolLenUsed -= poolReq;
+   gsThreadPoolFree(poolReq*MOD_PELEN(pME));
 }
 
 /* return pointer to the top pool buffer */
@@ -479,6 +479,9 @@
 #define ippsGFpMul                   OWNAPI(ippsGFpMul)
 #define ippsGFpExp                   OWNAPI(ippsGFpExp)
 #define ippsGFpMultiExp              OWNAPI(ippsGFpMultiExp)
+#define ippsGFpxCyclotomicCombTableGetSize OWNAPI(ippsGFpxCyclotomicCombTableGetSize)
+#define ippsGFpxCyclotomicCombTableInit OWNAPI(ippsGFpxCyclotomicCombTableInit)
+#define ippsGFpxCyclotomicMultiExpComb OWNAPI(ippsGFpxCyclotomicMultiExpComb)
 #define ippsGFpAdd_PE                OWNAPI(ippsGFpAdd_PE)
 #define ippsGFpSub_PE                OWNAPI(ippsGFpSub_PE)
 #define ippsGFpMul_PE                OWNAPI(ippsGFpMul_PE)
@@ -518,6 +521,7 @@
 #define ippsGFpECGetPointRegular     OWNAPI(ippsGFpECGetPointRegular)
 #define ippsGFpECSetPointOctString   OWNAPI(ippsGFpECSetPointOctString)
 #define ippsGFpECGetPointOctString   OWNAPI(ippsGFpECGetPointOctString)
+#define ippsGFpECGetPoints           OWNAPI(ippsGFpECGetPoints)
 #define ippsGFpECTstPoint            OWNAPI(ippsGFpECTstPoint)
 #define ippsGFpECTstPointInSubgroup  OWNAPI(ippsGFpECTstPointInSubgroup)
 #define ippsGFpECCpyPoint            OWNAPI(ippsGFpECCpyPoint)
@@ -525,6 +529,20 @@
 #define ippsGFpECNegPoint            OWNAPI(ippsGFpECNegPoint)
 #define ippsGFpECAddPoint            OWNAPI(ippsGFpECAddPoint)
 #define ippsGFpECMulPoint            OWNAPI(ippsGFpECMulPoint)
+#define ippsGFpECPointTableGetSize   OWNAPI(ippsGFpECPointTableGetSize)
+#define ippsGFpECPointTableInit      OWNAPI(ippsGFpECPointTableInit)
+#define ippsGFpECMulPointTable       OWNAPI(ippsGFpECMulPointTable)
+#define ippsGFpECMultiMulPointGetSize OWNAPI(ippsGFpECMultiMulPointGetSize)
+#define ippsGFpECMultiMulPoint       OWNAPI(ippsGFpECMultiMulPoint)
+#define ippsGFpECGLVGetSize          OWNAPI(ippsGFpECGLVGetSize)
+#define ippsGFpECGLVInit             OWNAPI(ippsGFpECGLVInit)
+#define ippsGFpECMulPointGLV         OWNAPI(ippsGFpECMulPointGLV)
+#define ippsGFpECMultiMulPointGLVGetSize OWNAPI(ippsGFpECMultiMulPointGLVGetSize)
+#define ippsGFpECMultiMulPointGLV    OWNAPI(ippsGFpECMultiMulPointGLV)
+#define ippsGFpECGLSGetSize          OWNAPI(ippsGFpECGLSGetSize)
+#define ippsGFpECGLSInit             OWNAPI(ippsGFpECGLSInit)
+#define ippsGFpECMulPointGLS         OWNAPI(ippsGFpECMulPointGLS)
+#define ippsGFpECTstPointInSubgroupGLS OWNAPI(ippsGFpECTstPointInSubgroupGLS)
 #define ippsGFpECPrivateKey          OWNAPI(ippsGFpECPrivateKey)
 #define ippsGFpECPublicKey           OWNAPI(ippsGFpECPublicKey)
 #define ippsGFpECTstKeyPair          OWNAPI(ippsGFpECTstKeyPair)
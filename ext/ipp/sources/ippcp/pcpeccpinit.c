@@ -82,8 +82,7 @@ IPPFUN(IppStatus, ippsECCPInit, (int feBitSize, IppsECCPState* pEC))
 
    {
       /* size of GF context */
-      //int gfCtxSize = cpGFpGetSize(feBitSize);
-      int gfCtxSize = cpGFpGetSize(feBitSize, feBitSize+BITSIZE(BNU_CHUNK_T), GFP_POOL_SIZE);
+      int gfCtxSize = cpGFpGetSize(feBitSize);
       /* size of EC context */
       int ecCtxSize = cpGFpECGetSize(1, feBitSize);
 
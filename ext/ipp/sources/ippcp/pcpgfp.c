@@ -59,20 +59,18 @@
 /*
 // size of GFp engine context (Montgomery)
 */
-int cpGFpGetSize(int feBitSize, int peBitSize, int numpe)
+int cpGFpGetSize(int feBitSize)
 {
    int ctxSize = 0;
    int elemLen = BITS_BNU_CHUNK(feBitSize);
-   int pelmLen = BITS_BNU_CHUNK(peBitSize);
-   
-   /* size of GFp engine */
+
+   /* size of GFp engine (temporaries come from the thread pool) */
    ctxSize = sizeof(gsModEngine)
             + elemLen*sizeof(BNU_CHUNK_T)    /* modulus  */
             + elemLen*sizeof(BNU_CHUNK_T)    /* mont_R   */
             + elemLen*sizeof(BNU_CHUNK_T)    /* mont_R^2 */
             + elemLen*sizeof(BNU_CHUNK_T)    /* half of modulus */
-            + elemLen*sizeof(BNU_CHUNK_T)    /* quadratic non-residue */
-            + pelmLen*sizeof(BNU_CHUNK_T)*numpe; /* pool */
+            + elemLen*sizeof(BNU_CHUNK_T);   /* quadratic non-residue */
 
    ctxSize += sizeof(IppsGFpState);   /* size of IppsGFPState */
    return ctxSize;
@@ -104,9 +102,7 @@ static void cpGFEInit(gsModEngine* pGFE, int modulusBitSize, int peBitSize, int
    GFP_MNT_RR(pGFE)    = (BNU_CHUNK_T*)(ptr);   ptr += modLen*sizeof(BNU_CHUNK_T);
    GFP_HMODULUS(pGFE)  = (BNU_CHUNK_T*)(ptr);   ptr += modLen*sizeof(BNU_CHUNK_T);
    GFP_QNR(pGFE)       = (BNU_CHUNK_T*)(ptr);   ptr += modLen*sizeof(BNU_CHUNK_T);
-   GFP_POOL(pGFE)      = (BNU_CHUNK_T*)(ptr);/* ptr += modLen*sizeof(BNU_CHUNK_T);*/
    GFP_MAXPOOL(pGFE)   = numpe;
-   GFP_USEDPOOL(pGFE)  = 0;
 
    cpGFpElementPadd(GFP_MODULUS(pGFE), modLen, 0);
    cpGFpElementPadd(GFP_MNT_R(pGFE), modLen, 0);
@@ -78,7 +78,7 @@ int cpGFpECGetSize(int basicDeg, int basicElmBitSize)
                +2*elemLen*3*sizeof(BNU_CHUNK_T)    /* regular and ephemeral public  keys */
                +2*maxOrderLen*sizeof(BNU_CHUNK_T)  /* regular and ephemeral private keys */
                #endif
-               +elemLen*sizeof(BNU_CHUNK_T)*3*EC_POOL_SIZE;
+               ; /* points are taken from the thread pool */
    }
    return ctxSize;
 }
@@ -98,7 +98,7 @@ void gfec_point_add(BNU_CHUNK_T* pRdata, const BNU_CHUNK_T* pPdata, const BNU_CH
    BNU_CHUNK_T inftyQ = GFPE_IS_ZERO_CT(pz2, elemLen);
 
    /* get temporary from top of EC point pool */
-   BNU_CHUNK_T* U1 = pEC->pPool;
+   BNU_CHUNK_T* U1 = cpEcGFpGetPool(3, pEC);
    BNU_CHUNK_T* U2 = U1 + elemLen;
    BNU_CHUNK_T* S1 = U2 + elemLen;
    BNU_CHUNK_T* S2 = S1 + elemLen;
@@ -128,7 +128,9 @@ void gfec_point_add(BNU_CHUNK_T* pRdata, const BNU_CHUNK_T* pPdata, const BNU_CH
       BNU_CHUNK_T mask_zeroH = GFPE_IS_ZERO_CT(H, elemLen);
       BNU_CHUNK_T mask = mask_zeroH & ~inftyP & ~inftyQ;
       if(mask) {
-         if( GFPE_IS_ZERO_CT(R, elemLen) )
+         BNU_CHUNK_T zeroR = GFPE_IS_ZERO_CT(R, elemLen);
+         cpEcGFpReleasePool(3, pEC);
+         if( zeroR )
             gfec_point_double(pRdata, pPdata, pEC);
          else
             cpGFpElementPadd(pRdata, 3*elemLen, 0);
@@ -156,6 +158,8 @@ void gfec_point_add(BNU_CHUNK_T* pRdata, const BNU_CHUNK_T* pPdata, const BNU_CH
    cpMaskedReplace_ct(pRx, px1, elemLen*3, inftyQ);
 
    cpGFpElementCopy(pRdata, pRx, 3*elemLen);
+
+   cpEcGFpReleasePool(3, pEC);
 }
 #endif
 
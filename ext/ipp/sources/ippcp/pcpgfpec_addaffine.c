@@ -85,7 +85,7 @@ void gfec_affine_point_add(BNU_CHUNK_T* pRdata, const BNU_CHUNK_T* pPdata, const
    BNU_CHUNK_T inftyA = GFPE_IS_ZERO_CT(ax, elemLen) & GFPE_IS_ZERO_CT(ay, elemLen);
 
    /* get temporary from top of EC point pool */
-   BNU_CHUNK_T* U2 = pEC->pPool;
+   BNU_CHUNK_T* U2 = cpEcGFpGetPool(3, pEC);
    BNU_CHUNK_T* S2 = U2 + elemLen;
    BNU_CHUNK_T* H  = S2 + elemLen;
    BNU_CHUNK_T* R  = H  + elemLen;
@@ -128,6 +128,8 @@ void gfec_affine_point_add(BNU_CHUNK_T* pRdata, const BNU_CHUNK_T* pPdata, const
    cpMaskedReplace_ct(pRx, px, elemLen*3, inftyA);
 
    cpGFpElementCopy(pRdata, pRx, 3*elemLen);
+
+   cpEcGFpReleasePool(3, pEC);
 }
 #endif
 
@@ -67,7 +67,7 @@ IppsGFpECPoint* gfec_BasePointProduct(IppsGFpECPoint* pR,
       gsModEngine* pGForder = ECP_MONT_R(pEC);
       int orderBits = MOD_BITSIZE(pGForder);
       int orderLen  = MOD_LEN(pGForder);
-      BNU_CHUNK_T* tmpScalarG = cpGFpGetPool(2, pGForder);
+      BNU_CHUNK_T* tmpScalarG = cpGFpGetPool(3, pGForder); /* 2 scalars of orderLen+1 */
       BNU_CHUNK_T* tmpScalarP = tmpScalarG+orderLen+1;
 
       cpGFpElementCopyPadd(tmpScalarG, orderLen+1, pScalarG,scalarGlen);
@@ -92,7 +92,7 @@ IppsGFpECPoint* gfec_BasePointProduct(IppsGFpECPoint* pR,
                          pEC, pScratchBuffer);
       }
 
-      cpGFpReleasePool(2, pGForder);
+      cpGFpReleasePool(3, pGForder);
    }
 
    ECP_POINT_FLAGS(pR) = gfec_IsPointAtInfinity(pR)? 0 : ECP_FINITE_POINT;
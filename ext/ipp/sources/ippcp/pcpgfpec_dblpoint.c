@@ -92,7 +92,7 @@ void gfec_point_double(BNU_CHUNK_T* pRdata, const BNU_CHUNK_T* pPdata, IppsGFpEC
    BNU_CHUNK_T* rZ = pRdata+2*elemLen;
 
    /* get temporary from top of EC point pool */
-   BNU_CHUNK_T* U = pEC->pPool;
+   BNU_CHUNK_T* U = cpEcGFpGetPool(1, pEC);
    BNU_CHUNK_T* M = U+elemLen;
    BNU_CHUNK_T* S = M+elemLen;
 
@@ -130,5 +130,7 @@ void gfec_point_double(BNU_CHUNK_T* pRdata, const BNU_CHUNK_T* pPdata, IppsGFpEC
    sub(S, S, rX, pGFE);          /* S = 4*X*Y^2-Xres */
    mul(S, S, M, pGFE);           /* S = M*(4*X*Y^2-Xres) */
    sub(rY, S, rY, pGFE);         /* Yres = M*(4*X*Y^2-Xres) -8*Y^4 */
+
+   cpEcGFpReleasePool(1, pEC);
 }
 #endif
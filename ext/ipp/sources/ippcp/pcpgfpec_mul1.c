@@ -63,7 +63,7 @@ IppsGFpECPoint* gfec_MulPoint(IppsGFpECPoint* pR,
    {
       gsModEngine* pGForder = ECP_MONT_R(pEC);
 
-      BNU_CHUNK_T* pTmpScalar = cpGFpGetPool(1, pGForder); /* length of scalar does not exceed length of order */
+      BNU_CHUNK_T* pTmpScalar = cpGFpGetPool(2, pGForder); /* length of scalar does not exceed length of order, +1 extra chunk */
       int orderBits = MOD_BITSIZE(pGForder);
       int orderLen  = MOD_LEN(pGForder);
       cpGFpElementCopyPadd(pTmpScalar,orderLen+1, pScalar,scalarLen);
@@ -71,7 +71,7 @@ IppsGFpECPoint* gfec_MulPoint(IppsGFpECPoint* pR,
       gfec_point_mul(ECP_POINT_X(pR), ECP_POINT_X(pP),
                   (Ipp8u*)pTmpScalar, orderBits,
                   pEC, pScratchBuffer);
-      cpGFpReleasePool(1, pGForder);
+      cpGFpReleasePool(2, pGForder);
 
       ECP_POINT_FLAGS(pR) = gfec_IsPointAtInfinity(pR)? 0 : ECP_FINITE_POINT;
       return pR;
@@ -0,0 +1,193 @@
+/*******************************************************************************
+* Copyright 2010-2018 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Intel(R) Integrated Performance Primitives. Cryptography Primitives.
+//     EC over GF(p) Operations
+//
+//     Context:
+//        ippsGFpECGetPoints()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpgfpecstuff.h"
+
+/* point is finite and its Z coordinate is not 1 */
+__INLINE int cpIsProjectivePoint(const IppsGFpECPoint* pPoint)
+{
+   return IS_ECP_FINITE_POINT(pPoint) && !IS_ECP_AFFINE_POINT(pPoint);
+}
+
+/*F*
+// Name: ippsGFpECGetPoints
+//
+// Purpose: Retrieves coordinates of several points on an elliptic curve
+//          with a single inversion
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr               ppPoint == NULL
+//                                   ppX == NULL
+//                                   ppY == NULL
+//                                   pEC == NULL
+//                                   ppPoint[i] == NULL
+//                                   ppX[i] == NULL
+//                                   ppY[i] == NULL
+//
+//    ippStsContextMatchErr          invalid pEC->idCtx
+//                                   invalid ppPoint[i]->idCtx
+//                                   invalid ppX[i]->idCtx
+//                                   invalid ppY[i]->idCtx
+//
+//    ippStsOutOfRangeErr            ECP_POINT_FELEN(ppPoint[i])!=GFP_FELEN()
+//                                   GFPE_ROOM(ppX[i])!=GFP_FELEN()
+//                                   GFPE_ROOM(ppY[i])!=GFP_FELEN()
+//
+//    ippStsSizeErr                  count < 1
+//
+//    ippStsNoErr                    no error
+//
+// Parameters:
+//    ppPoint     Pointer to the array of IppsGFpECPoint contexts
+//    ppX, ppY    Pointers to the arrays of X and Y coordinates of the points
+//    count       Number of points
+//    pEC         Pointer to the context of the elliptic curve
+//
+// Note:
+//    Same as ippsGFpECGetPoint() on each point, (X,Y) == (0,0) for a point
+//    at infinity, but the inversions of the Z coordinates are shared
+//    (Montgomery's trick): 1 inversion and 3*(count-1) multiplications
+//    instead of count inversions.
+//    All of ppX[] and ppY[] must be distinct elements.
+//
+*F*/
+
+IPPFUN(IppStatus, ippsGFpECGetPoints,(const IppsGFpECPoint* const ppPoint[],
+                                            IppsGFpElement* const ppX[], IppsGFpElement* const ppY[],
+                                            int count,
+                                            IppsGFpECState* pEC))
+{
+   IPP_BAD_PTR4_RET(ppPoint, ppX, ppY, pEC);
+   pEC = (IppsGFpECState*)( IPP_ALIGNED_PTR(pEC, ECGFP_ALIGNMENT) );
+   IPP_BADARG_RET( !ECP_TEST_ID(pEC), ippStsContextMatchErr );
+   IPP_BADARG_RET( count<1, ippStsSizeErr );
+
+   {
+      gsModEngine* pGFE = GFP_PMA(ECP_GFP(pEC));
+      int elemLen = GFP_FELEN(pGFE);
+      int i;
+
+      for(i=0; i<count; i++) {
+         IPP_BAD_PTR3_RET(ppPoint[i], ppX[i], ppY[i]);
+         IPP_BADARG_RET( !ECP_POINT_TEST_ID(ppPoint[i]), ippStsContextMatchErr );
+         IPP_BADARG_RET( !GFPE_TEST_ID(ppX[i]), ippStsContextMatchErr );
+         IPP_BADARG_RET( !GFPE_TEST_ID(ppY[i]), ippStsContextMatchErr );
+         IPP_BADARG_RET( ECP_POINT_FELEN(ppPoint[i])!=elemLen, ippStsOutOfRangeErr);
+         IPP_BADARG_RET( GFPE_ROOM(ppX[i])!=elemLen, ippStsOutOfRangeErr);
+         IPP_BADARG_RET( GFPE_ROOM(ppY[i])!=elemLen, ippStsOutOfRangeErr);
+      }
+
+      {
+         mod_mul mulF = GFP_METHOD(pGFE)->mul;
+         mod_sqr sqrF = GFP_METHOD(pGFE)->sqr;
+
+         BNU_CHUNK_T* pAcc  = cpGFpGetPool(1, pGFE);
+         BNU_CHUNK_T* pZinv = cpGFpGetPool(1, pGFE);
+         BNU_CHUNK_T* pT    = cpGFpGetPool(1, pGFE);
+
+         /* X[i] = product of the Z coordinates of the projective points up to i */
+         int last = -1;
+         for(i=0; i<count; i++) {
+            if(cpIsProjectivePoint(ppPoint[i])) {
+               if(last<0)
+                  cpGFpElementCopy(GFPE_DATA(ppX[i]), ECP_POINT_Z(ppPoint[i]), elemLen);
+               else
+                  mulF(GFPE_DATA(ppX[i]), GFPE_DATA(ppX[last]), ECP_POINT_Z(ppPoint[i]), pGFE);
+               last = i;
+            }
+         }
+
+         if(last>=0) {
+            /* Acc = 1/(product of all Z) */
+            cpGFpxInv(pAcc, GFPE_DATA(ppX[last]), pGFE);
+
+            for(i=last; i>=0; ) {
+               /* previous projective point */
+               int prev = i-1;
+               while(prev>=0 && !cpIsProjectivePoint(ppPoint[prev]))
+                  prev--;
+
+               /* Zinv = 1/Z[i], Acc = 1/(product of Z up to prev) */
+               if(prev>=0) {
+                  mulF(pZinv, pAcc, GFPE_DATA(ppX[prev]), pGFE);
+                  mulF(pAcc, pAcc, ECP_POINT_Z(ppPoint[i]), pGFE);
+               }
+               else
+                  cpGFpElementCopy(pZinv, pAcc, elemLen);
+
+               /* X = X/Z^2, Y = Y/Z^3 */
+               sqrF(pT, pZinv, pGFE);
+               mulF(GFPE_DATA(ppX[i]), ECP_POINT_X(ppPoint[i]), pT, pGFE);
+               mulF(pT, pZinv, pT, pGFE);
+               mulF(GFPE_DATA(ppY[i]), ECP_POINT_Y(ppPoint[i]), pT, pGFE);
+
+               i = prev;
+            }
+         }
+
+         cpGFpReleasePool(3, pGFE);
+
+         for(i=0; i<count; i++) {
+            if(!IS_ECP_FINITE_POINT(ppPoint[i])) {
+               cpGFpElementPadd(GFPE_DATA(ppX[i]), elemLen, 0);
+               cpGFpElementPadd(GFPE_DATA(ppY[i]), elemLen, 0);
+            }
+            else if(IS_ECP_AFFINE_POINT(ppPoint[i])) {
+               cpGFpElementCopy(GFPE_DATA(ppX[i]), ECP_POINT_X(ppPoint[i]), elemLen);
+               cpGFpElementCopy(GFPE_DATA(ppY[i]), ECP_POINT_Y(ppPoint[i]), elemLen);
+            }
+         }
+      }
+      return ippStsNoErr;
+   }
+}
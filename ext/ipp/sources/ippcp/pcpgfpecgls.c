@@ -0,0 +1,740 @@
+/*******************************************************************************
+* Copyright 2010-2018 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+/*
+//
+//  Purpose:
+//     Intel(R) Integrated Performance Primitives. Cryptography Primitives.
+//     EC over GF(p^2) Operations
+//
+//     Context:
+//        ippsGFpECGLSGetSize()
+//        ippsGFpECGLSInit()
+//        ippsGFpECMulPointGLS()
+//        ippsGFpECTstPointInSubgroupGLS()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpgfpecstuff.h"
+#include "gsscramble.h"
+#include "pcpmask_ct.h"
+#include "pcptool.h"
+
+/* R = |A| of len chunks in two's complement, returns the mask of A<0 */
+static BNU_CHUNK_T cpGLSAbs(BNU_CHUNK_T* pR, const BNU_CHUNK_T* pA, int len)
+{
+   BNU_CHUNK_T neg = (BNU_CHUNK_T)0 - (pA[len-1]>>(BNU_CHUNK_BITS-1));
+   BNU_CHUNK_T carry = neg & 1;
+   int i;
+   for(i=0; i<len; i++) {
+      BNU_CHUNK_T a = (pA[i] ^ neg) + carry;
+      carry = cpIsZero_ct(a) & carry;
+      pR[i] = a;
+   }
+   return neg;
+}
+
+/* R = sum of c[i]*t^i, i=0..deg, in two's complement of len chunks */
+static void cpGLSPoly(BNU_CHUNK_T* pR, const int* pCoeff, int deg, const BNU_CHUNK_T* pT, int len)
+{
+   BNU_CHUNK_T power[GLS_MAX_LEN];
+   BNU_CHUNK_T x[2*GLS_MAX_LEN];
+   int i;
+
+   cpGFpElementPadd(pR, len, 0);
+   cpGFpElementPadd(power, len, 0);
+   power[0] = 1;
+   for(i=0; i<=deg; i++) {
+      BNU_CHUNK_T c = (BNU_CHUNK_T)(pCoeff[i]<0? -pCoeff[i] : pCoeff[i]);
+      cpMul_BNU_school(x, power, len, &c, 1);
+      if(pCoeff[i]<0)
+         cpSub_BNU(pR, pR, x, len);
+      else
+         cpAdd_BNU(pR, pR, x, len);
+
+      cpMul_BNU_school(x, power, len, pT, len);
+      cpGFpElementCopy(power, x, len);
+   }
+}
+
+/* G = round(B*2^m/n), m = BNU_CHUNK_BITS*(len+1) */
+static void cpGLSRound(BNU_CHUNK_T* pG, const BNU_CHUNK_T* pB, const BNU_CHUNK_T* pOrder, int len)
+{
+   BNU_CHUNK_T x[2*GLS_MAX_LEN+2];
+   BNU_CHUNK_T q[2*GLS_MAX_LEN+2];
+   BNU_CHUNK_T n[GLS_MAX_LEN];
+   int nsQ;
+
+   cpLSR_BNU(x, pOrder, len, 1);
+   x[len] = 0;
+   cpGFpElementCopy(x+len+1, pB, len);
+   cpGFpElementCopy(n, pOrder, len);
+   cpGFpElementPadd(q, 2*len+2, 0);
+   cpDiv_BNU(q, &nsQ, x, 2*len+1, n, len);
+   cpGFpElementCopy(pG, q, len+1);
+}
+
+/* R = [K]*P, K is public, R and P do not overlap */
+static void cpGLSMulPublic(BNU_CHUNK_T* pRdata, const BNU_CHUNK_T* pPdata,
+                     const BNU_CHUNK_T* pK, int len, IppsGFpECState* pEC)
+{
+   int bit;
+   cpGFpElementPadd(pRdata, ECP_POINTLEN(pEC), 0);
+   for(bit=BITSIZE_BNU(pK, cpFix_BNU(pK, len))-1; bit>=0; bit--) {
+      gfec_point_double(pRdata, pRdata, pEC);
+      if(TST_BIT(pK, bit))
+         gfec_point_add(pRdata, pRdata, pPdata, pEC);
+   }
+}
+
+/* P = Q, the data of the points are not modified */
+static int cpGLSIsEqual(BNU_CHUNK_T* pPdata, BNU_CHUNK_T* pQdata, IppsGFpECState* pEC)
+{
+   IppsGFpECPoint P, Q;
+   cpEcGFpInitPoint(&P, pPdata, 0, pEC);
+   ECP_POINT_FLAGS(&P) = gfec_IsPointAtInfinity(&P)? 0 : ECP_FINITE_POINT;
+   cpEcGFpInitPoint(&Q, pQdata, 0, pEC);
+   ECP_POINT_FLAGS(&Q) = gfec_IsPointAtInfinity(&Q)? 0 : ECP_FINITE_POINT;
+   return gfec_ComparePoint(&P, &Q, pEC);
+}
+
+/* psi(G) = [lambda]*G */
+static int cpGLSIsEigenvalue(const BNU_CHUNK_T* pLambda, int len, const cpGFpECGLS* pGLS, IppsGFpECState* pEC)
+{
+   int pointLen = ECP_POINTLEN(pEC);
+   BNU_CHUNK_T* pTdata = cpEcGFpGetPool(2, pEC);
+   BNU_CHUNK_T* pHdata = pTdata+pointLen;
+   int isEqual;
+
+   cpGLSMulPublic(pTdata, ECP_G(pEC), pLambda, len, pEC);
+   gfec_GLSMap(pHdata, ECP_G(pEC), pGLS, pEC);
+   isEqual = cpGLSIsEqual(pTdata, pHdata, pEC);
+
+   cpEcGFpReleasePool(2, pEC);
+   return isEqual;
+}
+
+/*
+// [t+1]*P + psi([t]*P) + psi^2([t]*P) = psi^3([2t]*P) holds on the points
+// of the order n, which are the only points of the twist it holds on.
+// The test is on public points.
+*/
+static int cpGLSIsInSubgroup(const BNU_CHUNK_T* pPdata, const cpGFpECGLS* pGLS, IppsGFpECState* pEC)
+{
+   gsModEngine* pGFE = GFP_PMA(ECP_GFP(pEC));
+   int elemLen = GFP_FELEN(pGFE);
+   int pointLen = ECP_POINTLEN(pEC);
+   BNU_CHUNK_T* pTdata = cpEcGFpGetPool(3, pEC);
+   BNU_CHUNK_T* pLdata = pTdata+pointLen;
+   BNU_CHUNK_T* pHdata = pLdata+pointLen;
+   int isEqual;
+
+   /* T = [t]*P */
+   cpGLSMulPublic(pTdata, pPdata, GLS_T(pGLS), GLS_ORDERLEN(pGLS), pEC);
+   if(GLS_TNEG(pGLS))
+      GFP_METHOD(pGFE)->neg(pTdata+elemLen, pTdata+elemLen, pGFE);
+
+   /* L = [t+1]*P + psi([t]*P) + psi^2([t]*P) */
+   gfec_point_add(pLdata, pTdata, pPdata, pEC);
+   gfec_GLSMap(pHdata, pTdata, pGLS, pEC);
+   gfec_point_add(pLdata, pLdata, pHdata, pEC);
+   gfec_GLSMap(pHdata, pHdata, pGLS, pEC);
+   gfec_point_add(pLdata, pLdata, pHdata, pEC);
+
+   /* T = psi^3([2t]*P) */
+   gfec_point_double(pTdata, pTdata, pEC);
+   gfec_GLSMap(pTdata, pTdata, pGLS, pEC);
+   gfec_GLSMap(pTdata, pTdata, pGLS, pEC);
+   gfec_GLSMap(pTdata, pTdata, pGLS, pEC);
+
+   isEqual = cpGLSIsEqual(pLdata, pTdata, pEC);
+
+   cpEcGFpReleasePool(3, pEC);
+   return isEqual;
+}
+
+/*
+// K = N mod n. Scalars no longer than n are below 2n when the top bit
+// of n is set and are reduced by a masked subtraction.
+*/
+static void cpGLSReduce(BNU_CHUNK_T* pK, const BNU_CHUNK_T* pN, int nsN, const cpGFpECGLS* pGLS)
+{
+   int len = GLS_ORDERLEN(pGLS);
+   const BNU_CHUNK_T* pOrder = GLS_ORDER(pGLS);
+
+   if(nsN<=len && (pOrder[len-1]>>(BNU_CHUNK_BITS-1))) {
+      BNU_CHUNK_T t[GLS_MAX_LEN];
+      BNU_CHUNK_T borrow;
+      cpGFpElementCopyPadd(pK, len, pN, nsN);
+      borrow = cpSub_BNU(t, pK, pOrder, len);
+      cpMaskedReplace_ct(pK, t, len, cpIsZero_ct(borrow));
+      PurgeBlock(t, sizeof(t));
+   }
+   else {
+      BNU_CHUNK_T x[2*GLS_MAX_LEN+1];
+      BNU_CHUNK_T n[GLS_MAX_LEN];
+      int nsX;
+      cpGFpElementCopy(x, pN, nsN);
+      cpGFpElementCopy(n, pOrder, len);
+      nsX = cpMod_BNU(x, nsN, n, len);
+      cpGFpElementCopyPadd(pK, len, x, nsX);
+      PurgeBlock(x, sizeof(x));
+   }
+}
+
+/*
+// Splits K (orderLen chunks) into the quarters K0..K3 (orderLen+1 chunks
+// each, one after the other) of at most quarterBits bits: with
+// c[j] = round(K*alpha[j]/n), where alpha*B = (n,0,0,0),
+//    K[i] = (i==0? K : 0) - sum of c[j]*b[j][i]
+// pNeg[i] is the mask of the sign of K[i].
+// The operations do not depend on the value of K.
+*/
+static void cpGLSSplit(BNU_CHUNK_T* pQuarters, BNU_CHUNK_T* pNeg,
+                 const BNU_CHUNK_T* pK, const cpGFpECGLS* pGLS)
+{
+   int len = GLS_ORDERLEN(pGLS);
+   int qLen = len+1;
+   BNU_CHUNK_T c[4][GLS_MAX_LEN];
+   BNU_CHUNK_T t[2*GLS_MAX_LEN];
+   int i, j;
+
+   /* |c[j]| = (K*g[j])>>m, m = BNU_CHUNK_BITS*(len+1) */
+   for(j=0; j<4; j++) {
+      cpMul_BNU_school(t, pK, len, GLS_G(pGLS,j), len+1);
+      cpGFpElementCopy(c[j], t+len+1, len);
+   }
+
+   /* K[i] in two's complement of qLen chunks, |K[i]| is much below 2^(m-1) */
+   for(i=0; i<4; i++) {
+      BNU_CHUNK_T* pKi = pQuarters+qLen*i;
+      if(0==i)
+         cpGFpElementCopyPadd(pKi, qLen, pK, len);
+      else
+         cpGFpElementPadd(pKi, qLen, 0);
+
+      for(j=0; j<4; j++) {
+         cpMul_BNU_school(t, c[j], len, GLS_B(pGLS,j,i), len);
+         /* the signs are public */
+         if(GLS_GNEG(pGLS,j) ^ GLS_BNEG(pGLS,j,i))
+            cpAdd_BNU(pKi, pKi, t, qLen);
+         else
+            cpSub_BNU(pKi, pKi, t, qLen);
+      }
+      pNeg[i] = cpGLSAbs(pKi, pKi, qLen);
+   }
+
+   PurgeBlock(c, sizeof(c));
+   PurgeBlock(t, sizeof(t));
+}
+
+/* entries of the basis and of alpha as c0 + c1*t + c2*t^2 + c3*t^3 */
+static const int glsBasis[4][4][2] = {
+   {{ 1, 2}, { 0, 0}, { 0, 2}, { 1, 0}},
+   {{-1,-2}, { 0, 1}, { 1, 1}, { 0, 1}},
+   {{ 0, 1}, { 0,-1}, { 0, 1}, { 1, 2}},
+   {{ 0,-2}, {-1,-1}, { 0, 1}, { 0,-1}}
+};
+static const int glsAlpha[4][4] = {
+   { 1, 4, 6, 6},
+   { 0,-1,-6,-6},
+   {-1,-2, 0, 0},
+   { 0, 1, 0,-6}
+};
+/* n = 36t^4 + 36t^3 + 18t^2 + 6t + 1, q = 36t^4 + 36t^3 + 24t^2 + 6t + 1 */
+static const int glsOrder[5] = {1, 6, 18, 36, 36};
+static const int glsPrime[5] = {1, 6, 24, 36, 36};
+static const int glsLambda[3] = {0, 0, 6};
+
+/* bitsize of A */
+static int cpGLSBits(const BNU_CHUNK_T* pA, int len)
+{
+   return BITSIZE_BNU(pA, cpFix_BNU(pA, len));
+}
+
+/*F*
+// Name: ippsGFpECGLSGetSize
+//
+// Purpose: Gets the size of the GLS context of an elliptic curve
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr               pEC == NULL
+//                                   pSize == NULL
+//
+//    ippStsContextMatchErr          invalid pEC->idCtx
+//                                   pEC->subgroup == NULL
+//
+//    ippStsNoErr                    no error
+//
+// Parameters:
+//    pEC             Pointer to the context of the elliptic curve
+//    pSize           Pointer to the size of the context in bytes
+//
+*F*/
+
+IPPFUN(IppStatus, ippsGFpECGLSGetSize,(const IppsGFpECState* pEC, int* pSize))
+{
+   IPP_BAD_PTR2_RET(pEC, pSize);
+   pEC = (IppsGFpECState*)( IPP_ALIGNED_PTR(pEC, ECGFP_ALIGNMENT) );
+   IPP_BADARG_RET( !ECP_TEST_ID(pEC), ippStsContextMatchErr );
+   IPP_BADARG_RET(!ECP_SUBGROUP(pEC), ippStsContextMatchErr);
+
+   {
+      int elemLen = GFP_FELEN(GFP_PMA(ECP_GFP(pEC)));
+      /* n divides the order of the curve */
+      int orderLen = MOD_LEN(ECP_MONT_R(pEC));
+
+      *pSize = (int)sizeof(cpGFpECGLS)
+             + (2*elemLen + 18*orderLen + 4*(orderLen+1))*(int)sizeof(BNU_CHUNK_T)
+             + CACHE_LINE_SIZE;
+      return ippStsNoErr;
+   }
+}
+
+/*F*
+// Name: ippsGFpECGLSInit
+//
+// Purpose: Sets up the GLS endomorphism of the twist of a BN curve
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr               pFrobX == NULL
+//                                   pFrobY == NULL
+//                                   pT == NULL
+//                                   pGLS == NULL
+//                                   pEC == NULL
+//
+//    ippStsContextMatchErr          invalid pEC->idCtx
+//                                   pEC->subgroup == NULL
+//                                   invalid pFrobX->idCtx
+//                                   invalid pFrobY->idCtx
+//                                   invalid pT->idCtx
+//
+//    ippStsOutOfRangeErr            GFPE_ROOM(pFrobX)!=GFP_FELEN()
+//                                   GFPE_ROOM(pFrobY)!=GFP_FELEN()
+//
+//    ippStsBadArgErr                the curve is not over GF(p^2)
+//                                   pT is zero or too large
+//                                   p != q(pT)
+//                                   the cofactor of the curve is not 2p-n(pT)
+//                                   the order of the curve is not n(pT)*cofactor
+//                                   psi(G) != [6*pT^2]*G
+//
+//    ippStsNoErr                    no error
+//
+// Parameters:
+//    pFrobX          Pointer to the x coefficient of psi
+//    pFrobY          Pointer to the y coefficient of psi
+//    pT              Pointer to the parameter of the BN curve
+//    pGLS            Pointer to the context of ippsGFpECGLSGetSize() bytes
+//    pEC             Pointer to the context of the elliptic curve
+//
+//  Note:
+//    the curve is the sextic twist over GF(p^2) of the BN curve of
+//    parameter t with p = q(t) and the subgroup of the order n(t).
+//    The map psi(x,y) = (conj(x)*fx, conj(y)*fy) untwists, applies the
+//    Frobenius map and twists back, and multiplies the points of the
+//    order n by lambda = 6*t^2. The context holds a basis of the lattice
+//    of (x0,x1,x2,x3) with x0+x1*lambda+x2*lambda^2+x3*lambda^3 = 0 (mod n)
+//    with entries of the size of t, which splits the scalars of
+//    ippsGFpECMulPointGLS in quarters of quarter the bitsize.
+//
+*F*/
+
+IPPFUN(IppStatus, ippsGFpECGLSInit,(const IppsGFpElement* pFrobX, const IppsGFpElement* pFrobY,
+                                    const IppsBigNumState* pT,
+                                    Ipp8u* pGLSbuf, IppsGFpECState* pEC))
+{
+   IPP_BAD_PTR4_RET(pFrobX, pFrobY, pT, pGLSbuf);
+   IPP_BAD_PTR1_RET(pEC);
+   pEC = (IppsGFpECState*)( IPP_ALIGNED_PTR(pEC, ECGFP_ALIGNMENT) );
+   IPP_BADARG_RET( !ECP_TEST_ID(pEC), ippStsContextMatchErr );
+   IPP_BADARG_RET(!ECP_SUBGROUP(pEC), ippStsContextMatchErr);
+
+   IPP_BADARG_RET( !GFPE_TEST_ID(pFrobX), ippStsContextMatchErr );
+   IPP_BADARG_RET( !GFPE_TEST_ID(pFrobY), ippStsContextMatchErr );
+   IPP_BADARG_RET( GFPE_ROOM(pFrobX)!=GFP_FELEN(GFP_PMA(ECP_GFP(pEC))), ippStsOutOfRangeErr);
+   IPP_BADARG_RET( GFPE_ROOM(pFrobY)!=GFP_FELEN(GFP_PMA(ECP_GFP(pEC))), ippStsOutOfRangeErr);
+
+   pT = (IppsBigNumState*)( IPP_ALIGNED_PTR(pT, BN_ALIGNMENT) );
+   IPP_BADARG_RET(!BN_VALID_ID(pT), ippStsContextMatchErr );
+
+   {
+      gsModEngine* pGFE = GFP_PMA(ECP_GFP(pEC));
+      gsModEngine* pGroundGFE = GFP_PARENT(pGFE);
+      int elemLen = GFP_FELEN(pGFE);
+      gsModEngine* pGForder = ECP_MONT_R(pEC);
+      cpGFpECGLS* pGLS = GLS_CTX(pGLSbuf);
+      const int len = GLS_MAX_LEN;
+      BNU_CHUNK_T t[GLS_MAX_LEN];
+      BNU_CHUNK_T n[GLS_MAX_LEN];
+      BNU_CHUNK_T x[GLS_MAX_LEN];
+      BNU_CHUNK_T h[GLS_MAX_LEN];
+      BNU_CHUNK_T s[4][GLS_MAX_LEN];
+      BNU_CHUNK_T nh[2*GLS_MAX_LEN];
+      int orderLen, nsN, nsH, quarterBits, i, j;
+
+      IPP_BADARG_RET( GFP_IS_BASIC(pGFE) || 2!=GFP_EXTDEGREE(pGFE) || !GFP_IS_BASIC(pGroundGFE), ippStsBadArgErr );
+      IPP_BADARG_RET( cpEqu_BNU_CHUNK(BN_NUMBER(pT), BN_SIZE(pT), 0), ippStsBadArgErr );
+      IPP_BADARG_RET( 4*cpGLSBits(BN_NUMBER(pT), BN_SIZE(pT))+8 > GFP_MAX_BITSIZE, ippStsBadArgErr );
+
+      /* t in two's complement */
+      cpGFpElementCopyPadd(t, len, BN_NUMBER(pT), BN_SIZE(pT));
+      if(BN_NEGATIVE(pT)) {
+         cpGFpElementPadd(x, len, 0);
+         cpSub_BNU(t, x, t, len);
+      }
+
+      /* p = q(t) */
+      cpGLSPoly(x, glsPrime, 4, t, len);
+      IPP_BADARG_RET( 0!=cpCmp_BNU(x, cpFix_BNU(x, len),
+                                   GFP_MODULUS(pGroundGFE), cpFix_BNU(GFP_MODULUS(pGroundGFE), GFP_FELEN(pGroundGFE))),
+                      ippStsBadArgErr );
+
+      /* cofactor = 2p - n(t), order = n(t)*cofactor */
+      cpGLSPoly(n, glsOrder, 4, t, len);
+      cpAdd_BNU(h, x, x, len);
+      cpSub_BNU(h, h, n, len);
+      nsN = cpFix_BNU(n, len);
+      nsH = cpFix_BNU(h, len);
+      IPP_BADARG_RET( 0!=cpCmp_BNU(h, nsH, ECP_COFACTOR(pEC), cpFix_BNU(ECP_COFACTOR(pEC), elemLen)), ippStsBadArgErr );
+      cpMul_BNU_school(nh, n, nsN, h, nsH);
+      IPP_BADARG_RET( 0!=cpCmp_BNU(nh, cpFix_BNU(nh, nsN+nsH),
+                                   MOD_MODULUS(pGForder), cpFix_BNU(MOD_MODULUS(pGForder), MOD_LEN(pGForder))),
+                      ippStsBadArgErr );
+
+      orderLen = nsN;
+      GLS_ID(pGLS) = idCtxUnknown;
+      GLS_ELEMLEN(pGLS) = elemLen;
+      GLS_ORDERLEN(pGLS) = orderLen;
+      GLS_TNEG(pGLS) = BN_NEGATIVE(pT);
+      cpGFpElementCopy(GLS_FX(pGLS), GFPE_DATA(pFrobX), elemLen);
+      cpGFpElementCopy(GLS_FY(pGLS), GFPE_DATA(pFrobY), elemLen);
+      cpGFpElementCopy(GLS_ORDER(pGLS), n, orderLen);
+      cpGFpElementCopyPadd(GLS_T(pGLS), orderLen, BN_NUMBER(pT), BN_SIZE(pT));
+
+      /* psi(G) = [6t^2]*G */
+      cpGLSPoly(x, glsLambda, 2, t, len);
+      IPP_BADARG_RET( !cpGLSIsEigenvalue(x, len, pGLS, pEC), ippStsBadArgErr );
+
+      /* the basis, and the sums of the columns of |basis| */
+      for(i=0; i<4; i++)
+         cpGFpElementPadd(s[i], len, 0);
+      for(j=0; j<4; j++) {
+         for(i=0; i<4; i++) {
+            cpGLSPoly(x, glsBasis[j][i], 1, t, len);
+            GLS_BNEG(pGLS,j,i) = (0!=cpGLSAbs(x, x, len));
+            cpGFpElementCopy(GLS_B(pGLS,j,i), x, orderLen);
+            cpAdd_BNU(s[i], s[i], x, len);
+         }
+      }
+
+      /* g[j] = round(|alpha[j]|*2^m/n) */
+      for(j=0; j<4; j++) {
+         cpGLSPoly(x, glsAlpha[j], 3, t, len);
+         GLS_GNEG(pGLS,j) = (0!=cpGLSAbs(x, x, len));
+         cpGLSRound(GLS_G(pGLS,j), x, n, orderLen);
+      }
+
+      /* |K[i]| < 1.5*sum of |b[j][i]| */
+      quarterBits = 0;
+      for(i=0; i<4; i++) {
+         int bits = cpGLSBits(s[i], len);
+         if(quarterBits < bits)
+            quarterBits = bits;
+      }
+      GLS_QUARTERBITS(pGLS) = quarterBits+1;
+
+      GLS_ID(pGLS) = idCtxGFPECGLS;
+      return ippStsNoErr;
+   }
+}
+
+/* R = sum of [(-1)^neg[i]*K[i]]*psi^i(P), sscm */
+static void cpGLSMulPoint(BNU_CHUNK_T* pRdata, const BNU_CHUNK_T* pPdata,
+                    const BNU_CHUNK_T* pQuarters, const BNU_CHUNK_T* pNeg,
+                    const cpGFpECGLS* pGLS, IppsGFpECState* pEC, Ipp8u* pScratchBuffer)
+{
+   int pointLen = ECP_POINTLEN(pEC);
+
+   /* optimal size of window */
+   const int window_size = 5;
+   /* number of table entries */
+   const int tableLen = 1<<(window_size-1);
+
+   /* aligned pre-computed tables of P, psi(P), psi^2(P) and psi^3(P) */
+   BNU_CHUNK_T* pTable[4];
+
+   gsModEngine* pGFE = GFP_PMA(ECP_GFP(pEC));
+   int elemLen = GFP_FELEN(pGFE);
+   mod_neg negF = GFP_METHOD(pGFE)->neg;
+
+   BNU_CHUNK_T* pHy = cpGFpGetPool(1, pGFE);
+   BNU_CHUNK_T* pTdata = cpEcGFpGetPool(1, pEC); /* points from the pool */
+   BNU_CHUNK_T* pHdata = cpEcGFpGetPool(1, pEC);
+
+   const Ipp8u* pScalar[4];
+   int mask = (1<<(window_size+1)) -1;
+   int top = GLS_QUARTERBITS(pGLS)-(GLS_QUARTERBITS(pGLS)%window_size);
+   int bit, n, i;
+
+   pTable[0] = (BNU_CHUNK_T*)IPP_ALIGNED_PTR(pScratchBuffer, CACHE_LINE_SIZE);
+   for(i=0; i<4; i++) {
+      if(i)
+         pTable[i] = pTable[i-1]+pointLen*tableLen;
+      pScalar[i] = (const Ipp8u*)(pQuarters+(GLS_ORDERLEN(pGLS)+1)*i);
+   }
+
+   /* [k]*psi(P) = psi([k]*P), the indices are public */
+   setupTable(pTable[0], pPdata, pEC);
+   for(i=1; i<4; i++) {
+      for(n=0; n<tableLen; n++) {
+         gsScrambleGet(pHdata, pointLen, pTable[i-1], n, window_size-1);
+         gfec_GLSMap(pTdata, pHdata, pGLS, pEC);
+         gsScramblePut(pTable[i], n, pTdata, pointLen, window_size-1);
+      }
+   }
+
+   /* R = point at infinity */
+   cpGFpElementPadd(pTdata, pointLen, 0);
+
+   for(bit=top; bit>=0; bit-=window_size) {
+      if(bit<top) {
+         gfec_point_double(pTdata, pTdata, pEC);
+         gfec_point_double(pTdata, pTdata, pEC);
+         gfec_point_double(pTdata, pTdata, pEC);
+         gfec_point_double(pTdata, pTdata, pEC);
+         gfec_point_double(pTdata, pTdata, pEC);
+      }
+
+      for(i=0; i<4; i++) {
+         int wvalue;
+         Ipp8u digit, sign;
+         if(bit) {
+            wvalue = *((Ipp16u*)&pScalar[i][(bit-1)/8]);
+            wvalue = (wvalue>> ((bit-1)%8)) & mask;
+         }
+         else {
+            wvalue = *((Ipp16u*)&pScalar[i][0]);
+            wvalue = (wvalue << 1) & mask;
+         }
+         booth_recode(&sign, &digit, (Ipp8u)wvalue, window_size);
+         gsScrambleGet_sscm(pHdata, pointLen, pTable[i], digit-1, window_size-1);
+
+         /* the sign of the digit and the sign of the quarter */
+         negF(pHy, pHdata+elemLen, pGFE);
+         cpMaskedReplace_ct(pHdata+elemLen, pHy, elemLen, ~cpIsZero_ct(sign) ^ pNeg[i]);
+         gfec_point_add(pTdata, pTdata, pHdata, pEC);
+      }
+   }
+
+   cpGFpElementCopy(pRdata, pTdata, pointLen);
+
+   cpEcGFpReleasePool(2, pEC);
+   cpGFpReleasePool(1, pGFE);
+}
+
+/*F*
+// Name: ippsGFpECMulPointGLS
+//
+// Purpose: Multiplies a point of the subgroup of a twist of a BN curve
+//          by a scalar with the GLS endomorphism
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr               pP == NULL
+//                                   pN == NULL
+//                                   pGLS == NULL
+//                                   pR == NULL
+//                                   pEC == NULL
+//                                   pScratchBuffer == NULL
+//
+//    ippStsContextMatchErr          invalid pEC->idCtx
+//                                   pEC->subgroup == NULL
+//                                   invalid pP->idCtx
+//                                   invalid pN->idCtx
+//                                   invalid pR->idCtx
+//                                   pGLS is not set up for pEC
+//
+//    ippStsOutOfRangeErr            ECP_POINT_FELEN(pP)!=GFP_FELEN()
+//                                   ECP_POINT_FELEN(pR)!=GFP_FELEN()
+//
+//    ippStsBadArgErr                pN is negative
+//                                   pN > MOD_MODULUS(ECP_MONT_R(pEC))
+//
+//    ippStsNoErr                    no error
+//
+// Parameters:
+//    pP              Pointer to the context of the given point on the elliptic curve
+//    pN              Pointer to the Big Number context storing the scalar value
+//    pGLS            Pointer to the context of ippsGFpECGLSInit()
+//    pR              Pointer to the context of the resulting elliptic curve point
+//    pEC             Pointer to the context of the elliptic curve
+//    pScratchBuffer  Pointer to a buffer of ippsGFpECScratchBufferSize(4) bytes
+//
+//  Note:
+//    the scalar is reduced modulo the order n of the subgroup, split in
+//    four quarters, and the quarters of P, psi(P), psi^2(P) and psi^3(P)
+//    are multiplied with shared doublings. The result is [pN]*P only for
+//    points P of the order n.
+//    Like ippsGFpECMulPoint, the operations and the memory access
+//    pattern do not depend on the value of the scalar.
+//
+*F*/
+
+IPPFUN(IppStatus, ippsGFpECMulPointGLS,(const IppsGFpECPoint* pP,
+                                        const IppsBigNumState* pN,
+                                        const Ipp8u* pGLSbuf,
+                                        IppsGFpECPoint* pR,
+                                        IppsGFpECState* pEC,
+                                        Ipp8u* pScratchBuffer))
+{
+   IPP_BAD_PTR4_RET(pP, pR, pEC, pScratchBuffer);
+   IPP_BAD_PTR2_RET(pN, pGLSbuf);
+   pEC = (IppsGFpECState*)( IPP_ALIGNED_PTR(pEC, ECGFP_ALIGNMENT) );
+   IPP_BADARG_RET( !ECP_TEST_ID(pEC), ippStsContextMatchErr );
+   IPP_BADARG_RET(!ECP_SUBGROUP(pEC), ippStsContextMatchErr);
+
+   IPP_BADARG_RET( !ECP_POINT_TEST_ID(pP), ippStsContextMatchErr );
+   IPP_BADARG_RET( !ECP_POINT_TEST_ID(pR), ippStsContextMatchErr );
+
+   IPP_BADARG_RET( ECP_POINT_FELEN(pP)!=GFP_FELEN(GFP_PMA(ECP_GFP(pEC))), ippStsOutOfRangeErr);
+   IPP_BADARG_RET( ECP_POINT_FELEN(pR)!=GFP_FELEN(GFP_PMA(ECP_GFP(pEC))), ippStsOutOfRangeErr);
+
+   pN = (IppsBigNumState*)( IPP_ALIGNED_PTR(pN, BN_ALIGNMENT) );
+   IPP_BADARG_RET(!BN_VALID_ID(pN), ippStsContextMatchErr );
+   IPP_BADARG_RET( BN_NEGATIVE(pN), ippStsBadArgErr );
+
+   {
+      const cpGFpECGLS* pGLS = GLS_CTX(pGLSbuf);
+      gsModEngine* pGForder = ECP_MONT_R(pEC);
+      int orderLen = MOD_LEN(pGForder);
+      BNU_CHUNK_T* pScalar = BN_NUMBER(pN);
+      int scalarLen = BN_SIZE(pN);
+
+      IPP_BADARG_RET( !gfec_GLSMatch(pGLS, pEC), ippStsContextMatchErr );
+      IPP_BADARG_RET(0<cpCmp_BNU(pScalar, scalarLen, MOD_MODULUS(pGForder), orderLen), ippStsBadArgErr);
+
+      {
+         BNU_CHUNK_T k[GLS_MAX_LEN];
+         BNU_CHUNK_T quarters[4*GLS_MAX_LEN];
+         BNU_CHUNK_T neg[4];
+         BNU_CHUNK_T* pRdata = cpEcGFpGetPool(1, pEC);
+
+         FIX_BNU(pScalar, scalarLen);
+         cpGLSReduce(k, pScalar, scalarLen, pGLS);
+         cpGLSSplit(quarters, neg, k, pGLS);
+
+         cpGLSMulPoint(pRdata, ECP_POINT_X(pP), quarters, neg, pGLS, pEC, pScratchBuffer);
+         cpGFpElementCopy(ECP_POINT_X(pR), pRdata, ECP_POINTLEN(pEC));
+         ECP_POINT_FLAGS(pR) = gfec_IsPointAtInfinity(pR)? 0 : ECP_FINITE_POINT;
+
+         cpEcGFpReleasePool(1, pEC);
+         PurgeBlock(k, sizeof(k));
+         PurgeBlock(quarters, sizeof(quarters));
+         PurgeBlock(neg, sizeof(neg));
+      }
+      return ippStsNoErr;
+   }
+}
+
+/*F*
+// Name: ippsGFpECTstPointInSubgroupGLS
+//
+// Purpose: Checks if a point belongs to the subgroup of a twist of
+//          a BN curve with the GLS endomorphism
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr               pP == NULL
+//                                   pResult == NULL
+//                                   pGLS == NULL
+//                                   pEC == NULL
+//
+//    ippStsContextMatchErr          invalid pEC->idCtx
+//                                   pEC->subgroup == NULL
+//                                   invalid pP->idCtx
+//                                   pGLS is not set up for pEC
+//
+//    ippStsOutOfRangeErr            ECP_POINT_FELEN(pP)!=GFP_FELEN()
+//
+//    ippStsNoErr                    no error
+//
+// Parameters:
+//    pP              Pointer to the context of the given point on the elliptic curve
+//    pResult         Pointer to the result of the check
+//    pGLS            Pointer to the context of ippsGFpECGLSInit()
+//    pEC             Pointer to the context of the elliptic curve
+//
+//  Note:
+//    *pResult is ippECPointIsAtInfinite, ippECPointIsNotValid or
+//    ippECPointOutOfGroup if the point is not a finite point of the
+//    order n, ippECValid otherwise.
+//    Instead of the multiplication by n of ippsGFpECTstPointInSubgroup
+//    the test [t+1]*P + psi([t]*P) + psi^2([t]*P) = psi^3([2t]*P) takes
+//    a multiplication by t only. The point is public.
+//
+*F*/
+
+IPPFUN(IppStatus, ippsGFpECTstPointInSubgroupGLS,(const IppsGFpECPoint* pP,
+                                                  IppECResult* pResult,
+                                                  const Ipp8u* pGLSbuf,
+                                                  IppsGFpECState* pEC))
+{
+   IPP_BAD_PTR4_RET(pP, pResult, pGLSbuf, pEC);
+   pEC = (IppsGFpECState*)( IPP_ALIGNED_PTR(pEC, ECGFP_ALIGNMENT) );
+   IPP_BADARG_RET( !ECP_TEST_ID(pEC), ippStsContextMatchErr );
+   IPP_BADARG_RET(!ECP_SUBGROUP(pEC), ippStsContextMatchErr);
+
+   IPP_BADARG_RET( !ECP_POINT_TEST_ID(pP), ippStsContextMatchErr );
+   IPP_BADARG_RET( ECP_POINT_FELEN(pP)!=GFP_FELEN(GFP_PMA(ECP_GFP(pEC))), ippStsOutOfRangeErr);
+
+   {
+      const cpGFpECGLS* pGLS = GLS_CTX(pGLSbuf);
+      IppStatus sts;
+
+      IPP_BADARG_RET( !gfec_GLSMatch(pGLS, pEC), ippStsContextMatchErr );
+
+      sts = ippsGFpECTstPoint(pP, pResult, pEC);
+      if(ippStsNoErr==sts && ippECValid==*pResult) {
+         if(!cpGLSIsInSubgroup(ECP_POINT_X(pP), pGLS, pEC))
+            *pResult = ippECPointOutOfGroup;
+      }
+      return sts;
+   }
+}
@@ -0,0 +1,592 @@
+/*******************************************************************************
+* Copyright 2010-2018 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+/*
+//
+//  Purpose:
+//     Intel(R) Integrated Performance Primitives. Cryptography Primitives.
+//     EC over GF(p) Operations
+//
+//     Context:
+//        gfec_GLVSplit()
+//        ippsGFpECGLVGetSize()
+//        ippsGFpECGLVInit()
+//        ippsGFpECMulPointGLV()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpgfpecstuff.h"
+#include "gsscramble.h"
+#include "pcpmask_ct.h"
+#include "pcptool.h"
+
+/*
+// R = |A-B| truncated to rLen chunks, returns the mask of A<B.
+// A is destroyed.
+*/
+static BNU_CHUNK_T cpGLVSubAbs(BNU_CHUNK_T* pR, BNU_CHUNK_T* pA, const BNU_CHUNK_T* pB, int len, int rLen)
+{
+   BNU_CHUNK_T neg = (BNU_CHUNK_T)0 - cpSub_BNU(pA, pA, pB, len);
+   BNU_CHUNK_T carry = neg & 1;
+   int i;
+   for(i=0; i<rLen; i++) {
+      BNU_CHUNK_T a = (pA[i] ^ neg) + carry;
+      carry = cpIsZero_ct(a) & carry;
+      pR[i] = a;
+   }
+   return neg;
+}
+
+/*
+// Splits K (orderLen chunks) into the halves K1 and K2 (orderLen+1 chunks)
+// of at most halfBits bits: with c1 = round(K*b2/n) and c2 = round(K*b1/n)
+//    K1 = K - c1*a1 - c2*a2
+//    K2 = c1*b1 - c2*b2
+// pNeg[0] and pNeg[1] are the masks of the signs of K1 and K2.
+// The operations do not depend on the value of K.
+*/
+void gfec_GLVSplit(BNU_CHUNK_T* pK1, BNU_CHUNK_T* pK2, BNU_CHUNK_T* pNeg,
+             const BNU_CHUNK_T* pK, const cpGFpECGLV* pGLV)
+{
+   int len = GLV_ORDERLEN(pGLV);
+   BNU_CHUNK_T c1[GLV_MAX_LEN];
+   BNU_CHUNK_T c2[GLV_MAX_LEN];
+   BNU_CHUNK_T t1[2*GLV_MAX_LEN];
+   BNU_CHUNK_T t2[2*GLV_MAX_LEN];
+
+   /* c = (K*g)>>m, m = BNU_CHUNK_BITS*(len+1) */
+   cpMul_BNU_school(t1, pK, len, GLV_G1(pGLV), len+1);
+   cpGFpElementCopy(c1, t1+len+1, len);
+   cpMul_BNU_school(t1, pK, len, GLV_G2(pGLV), len+1);
+   cpGFpElementCopy(c2, t1+len+1, len);
+
+   /* K1 = K - (c1*a1 + c2*a2) */
+   cpMul_BNU_school(t1, c1, len, GLV_A1(pGLV), len);
+   cpMul_BNU_school(t2, c2, len, GLV_A2(pGLV), len);
+   cpAdd_BNU(t1, t1, t2, 2*len);
+   cpGFpElementCopyPadd(t2, 2*len, pK, len);
+   pNeg[0] = cpGLVSubAbs(pK1, t2, t1, 2*len, len+1);
+
+   /* K2 = c1*b1 - c2*b2 */
+   cpMul_BNU_school(t1, c1, len, GLV_B1(pGLV), len);
+   cpMul_BNU_school(t2, c2, len, GLV_B2(pGLV), len);
+   pNeg[1] = cpGLVSubAbs(pK2, t1, t2, 2*len, len+1);
+
+   PurgeBlock(c1, sizeof(c1));
+   PurgeBlock(c2, sizeof(c2));
+   PurgeBlock(t1, sizeof(t1));
+   PurgeBlock(t2, sizeof(t2));
+}
+
+/* lambda^2 + lambda + 1 = 0 (mod n) */
+static int cpGLVIsCubeRoot(const BNU_CHUNK_T* pLambda, const BNU_CHUNK_T* pOrder, int len)
+{
+   BNU_CHUNK_T lambda1[GLV_MAX_LEN+1];
+   BNU_CHUNK_T n[GLV_MAX_LEN];
+   BNU_CHUNK_T t[2*GLV_MAX_LEN+2];
+   int nsT;
+
+   lambda1[len] = cpInc_BNU(lambda1, pLambda, len, 1);
+   cpMul_BNU_school(t, pLambda, len, lambda1, len+1);
+   cpInc_BNU(t, t, 2*len+1, 1);
+
+   cpGFpElementCopy(n, pOrder, len);
+   nsT = cpMod_BNU(t, 2*len+1, n, len);
+   return cpEqu_BNU_CHUNK(t, nsT, 0);
+}
+
+/* phi(G) = [lambda]*G */
+static int cpGLVIsEigenvalue(const BNU_CHUNK_T* pLambda, int len, const cpGFpECGLV* pGLV, IppsGFpECState* pEC)
+{
+   int pointLen = ECP_POINTLEN(pEC);
+   BNU_CHUNK_T* pTdata = cpEcGFpGetPool(2, pEC);
+   BNU_CHUNK_T* pHdata = pTdata+pointLen;
+   IppsGFpECPoint T, H;
+   int bit, isEqual;
+
+   /* T = [lambda]*G, lambda is public */
+   cpGFpElementPadd(pTdata, pointLen, 0);
+   for(bit=BITSIZE_BNU(pLambda, cpFix_BNU(pLambda, len))-1; bit>=0; bit--) {
+      gfec_point_double(pTdata, pTdata, pEC);
+      if(TST_BIT(pLambda, bit))
+         gfec_point_add(pTdata, pTdata, ECP_G(pEC), pEC);
+   }
+   cpEcGFpInitPoint(&T, pTdata, 0, pEC);
+   ECP_POINT_FLAGS(&T) = gfec_IsPointAtInfinity(&T)? 0 : ECP_FINITE_POINT;
+
+   /* H = phi(G) */
+   gfec_GLVMap(pHdata, ECP_G(pEC), pGLV, pEC);
+   cpEcGFpInitPoint(&H, pHdata, ECP_FINITE_POINT, pEC);
+
+   isEqual = gfec_ComparePoint(&T, &H, pEC);
+
+   cpEcGFpReleasePool(2, pEC);
+   return isEqual;
+}
+
+/* R2 = R0 - q*R1, T2 = T0 + q*T1, q = floor(R0/R1) */
+static void cpGLVEuclidStep(BNU_CHUNK_T* pR2, BNU_CHUNK_T* pT2,
+                      const BNU_CHUNK_T* pR0, const BNU_CHUNK_T* pR1,
+                      const BNU_CHUNK_T* pT0, const BNU_CHUNK_T* pT1, int len)
+{
+   BNU_CHUNK_T x[GLV_MAX_LEN+1];
+   BNU_CHUNK_T y[GLV_MAX_LEN];
+   BNU_CHUNK_T q[GLV_MAX_LEN+1];
+   BNU_CHUNK_T t[2*GLV_MAX_LEN];
+   int nsQ, nsR;
+
+   cpGFpElementCopyPadd(x, len+1, pR0, len);
+   cpGFpElementCopy(y, pR1, len);
+   cpGFpElementPadd(q, len+1, 0);
+   nsR = cpDiv_BNU(q, &nsQ, x, len, y, len);
+   cpGFpElementCopyPadd(pR2, len, x, nsR);
+
+   cpMul_BNU_school(t, q, len, pT1, len);
+   cpAdd_BNU(pT2, pT0, t, len);
+}
+
+/* A^2 + B^2 */
+static void cpGLVNorm(BNU_CHUNK_T* pR, const BNU_CHUNK_T* pA, const BNU_CHUNK_T* pB, int len)
+{
+   BNU_CHUNK_T t[2*GLV_MAX_LEN];
+   cpMul_BNU_school(pR, pA, len, pA, len);
+   cpMul_BNU_school(t, pB, len, pB, len);
+   pR[2*len] = cpAdd_BNU(pR, pR, t, 2*len);
+}
+
+/* G = round(B*2^m/n), m = BNU_CHUNK_BITS*(len+1) */
+static void cpGLVRound(BNU_CHUNK_T* pG, const BNU_CHUNK_T* pB, const BNU_CHUNK_T* pOrder, int len)
+{
+   BNU_CHUNK_T x[2*GLV_MAX_LEN+2];
+   BNU_CHUNK_T q[2*GLV_MAX_LEN+2];
+   BNU_CHUNK_T n[GLV_MAX_LEN];
+   int nsQ;
+
+   cpLSR_BNU(x, pOrder, len, 1);
+   x[len] = 0;
+   cpGFpElementCopy(x+len+1, pB, len);
+   cpGFpElementCopy(n, pOrder, len);
+   cpGFpElementPadd(q, 2*len+2, 0);
+   cpDiv_BNU(q, &nsQ, x, 2*len+1, n, len);
+   cpGFpElementCopy(pG, q, len+1);
+}
+
+/* bitsize of A+B */
+static int cpGLVSumBits(const BNU_CHUNK_T* pA, const BNU_CHUNK_T* pB, int len)
+{
+   BNU_CHUNK_T s[GLV_MAX_LEN+1];
+   s[len] = cpAdd_BNU(s, pA, pB, len);
+   return BITSIZE_BNU(s, cpFix_BNU(s, len+1));
+}
+
+/*
+// Extended Euclidean algorithm on n and lambda: the remainders r(i) and
+// the cofactors t(i) satisfy r(i) = t(i)*lambda (mod n), so (r(i),-t(i))
+// are vectors of the lattice. The signs of t(i) alternate, (-1)^(i+1),
+// and only |t(i)| is kept. With r(l+1) the first remainder below sqrt(n)
+// the basis is v1 = (r(l+1),-t(l+1)) and the shorter of (r(l),-t(l)) and
+// (r(l+2),-t(l+2)).
+*/
+static void cpGLVBasis(cpGFpECGLV* pGLV, const BNU_CHUNK_T* pOrder, const BNU_CHUNK_T* pLambda)
+{
+   int len = GLV_ORDERLEN(pGLV);
+   BNU_CHUNK_T r0[GLV_MAX_LEN], r1[GLV_MAX_LEN], r2[GLV_MAX_LEN];
+   BNU_CHUNK_T t0[GLV_MAX_LEN], t1[GLV_MAX_LEN], t2[GLV_MAX_LEN];
+   BNU_CHUNK_T s0[2*GLV_MAX_LEN+1], s2[2*GLV_MAX_LEN+1];
+   const BNU_CHUNK_T *pA1, *pB1, *pA2, *pB2;
+   int nsOrder = cpFix_BNU(pOrder, len);
+   int i = 1;
+   int halfBits;
+
+   cpGFpElementCopy(r0, pOrder, len);
+   cpGFpElementCopy(r1, pLambda, len);
+   cpGFpElementPadd(t0, len, 0);
+   cpGFpElementPadd(t1, len, 0);
+   t1[0] = 1;
+
+   for(;;) {
+      cpMul_BNU_school(s0, r1, len, r1, len);
+      if(0>cpCmp_BNU(s0, cpFix_BNU(s0, 2*len), pOrder, nsOrder))
+         break;
+      cpGLVEuclidStep(r2, t2, r0, r1, t0, t1, len);
+      cpGFpElementCopy(r0, r1, len);
+      cpGFpElementCopy(r1, r2, len);
+      cpGFpElementCopy(t0, t1, len);
+      cpGFpElementCopy(t1, t2, len);
+      i++;
+   }
+   cpGLVEuclidStep(r2, t2, r0, r1, t0, t1, len);
+
+   /* (r0,-t0) or (r2,-t2), the sign of -t of both is opposite to v1 */
+   cpGLVNorm(s0, r0, t0, len);
+   cpGLVNorm(s2, r2, t2, len);
+   if(0<cpCmp_BNU(s0, cpFix_BNU(s0, 2*len+1), s2, cpFix_BNU(s2, 2*len+1))) {
+      cpGFpElementCopy(r0, r2, len);
+      cpGFpElementCopy(t0, t2, len);
+   }
+
+   /* order the basis as (a1,-b1), (a2,b2) with b1, b2 >= 0 */
+   if(i&1) {
+      pA1 = r1; pB1 = t1;
+      pA2 = r0; pB2 = t0;
+   }
+   else {
+      pA1 = r0; pB1 = t0;
+      pA2 = r1; pB2 = t1;
+   }
+   cpGFpElementCopy(GLV_A1(pGLV), pA1, len);
+   cpGFpElementCopy(GLV_A2(pGLV), pA2, len);
+   cpGFpElementCopy(GLV_B1(pGLV), pB1, len);
+   cpGFpElementCopy(GLV_B2(pGLV), pB2, len);
+   cpGLVRound(GLV_G1(pGLV), pB2, pOrder, len);
+   cpGLVRound(GLV_G2(pGLV), pB1, pOrder, len);
+
+   /* |K1| < (a1+a2)*(1+e), |K2| < (b1+b2)*(1+e) */
+   halfBits = cpGLVSumBits(pA1, pA2, len);
+   if(halfBits < cpGLVSumBits(pB1, pB2, len))
+      halfBits = cpGLVSumBits(pB1, pB2, len);
+   GLV_HALFBITS(pGLV) = halfBits+1;
+}
+
+/*F*
+// Name: ippsGFpECGLVGetSize
+//
+// Purpose: Gets the size of the GLV context of an elliptic curve
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr               pEC == NULL
+//                                   pSize == NULL
+//
+//    ippStsContextMatchErr          invalid pEC->idCtx
+//                                   pEC->subgroup == NULL
+//
+//    ippStsNoErr                    no error
+//
+// Parameters:
+//    pEC             Pointer to the context of the elliptic curve
+//    pSize           Pointer to the size of the context in bytes
+//
+*F*/
+
+IPPFUN(IppStatus, ippsGFpECGLVGetSize,(const IppsGFpECState* pEC, int* pSize))
+{
+   IPP_BAD_PTR2_RET(pEC, pSize);
+   pEC = (IppsGFpECState*)( IPP_ALIGNED_PTR(pEC, ECGFP_ALIGNMENT) );
+   IPP_BADARG_RET( !ECP_TEST_ID(pEC), ippStsContextMatchErr );
+   IPP_BADARG_RET(!ECP_SUBGROUP(pEC), ippStsContextMatchErr);
+
+   {
+      int elemLen = GFP_FELEN(GFP_PMA(ECP_GFP(pEC)));
+      int orderLen = MOD_LEN(ECP_MONT_R(pEC));
+
+      *pSize = (int)sizeof(cpGFpECGLV)
+             + (elemLen + 4*orderLen + 2*(orderLen+1))*(int)sizeof(BNU_CHUNK_T)
+             + CACHE_LINE_SIZE;
+      return ippStsNoErr;
+   }
+}
+
+/*F*
+// Name: ippsGFpECGLVInit
+//
+// Purpose: Sets up the GLV endomorphism of an elliptic curve
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr               pBeta == NULL
+//                                   pLambda == NULL
+//                                   pGLV == NULL
+//                                   pEC == NULL
+//
+//    ippStsContextMatchErr          invalid pEC->idCtx
+//                                   pEC->subgroup == NULL
+//                                   invalid pBeta->idCtx
+//                                   invalid pLambda->idCtx
+//
+//    ippStsOutOfRangeErr            GFPE_ROOM(pBeta)!=GFP_FELEN()
+//
+//    ippStsBadArgErr                the curve is not over GF(p)
+//                                   the cofactor of the curve is not 1
+//                                   pLambda is negative or not less than the order
+//                                   pLambda^2 + pLambda + 1 != 0 (mod order)
+//                                   (pBeta*Gx,Gy) != [pLambda]*G
+//
+//    ippStsNoErr                    no error
+//
+// Parameters:
+//    pBeta           Pointer to a cube root of unity of GF(p)
+//    pLambda         Pointer to the matching cube root of unity modulo the order
+//    pGLV            Pointer to the context of ippsGFpECGLVGetSize() bytes
+//    pEC             Pointer to the context of the elliptic curve
+//
+//  Note:
+//    on curves y^2 = x^3 + b the map (x,y) -> (beta*x,y) multiplies
+//    the points of prime order by lambda. The context holds a short basis
+//    of the lattice of (x,y) with x+y*lambda = 0 (mod order), which splits
+//    the scalars of ippsGFpECMulPointGLV in halves of half the bitsize.
+//
+*F*/
+
+IPPFUN(IppStatus, ippsGFpECGLVInit,(const IppsGFpElement* pBeta, const IppsBigNumState* pLambda,
+                                    Ipp8u* pGLVbuf, IppsGFpECState* pEC))
+{
+   IPP_BAD_PTR4_RET(pBeta, pLambda, pGLVbuf, pEC);
+   pEC = (IppsGFpECState*)( IPP_ALIGNED_PTR(pEC, ECGFP_ALIGNMENT) );
+   IPP_BADARG_RET( !ECP_TEST_ID(pEC), ippStsContextMatchErr );
+   IPP_BADARG_RET(!ECP_SUBGROUP(pEC), ippStsContextMatchErr);
+
+   IPP_BADARG_RET( !GFPE_TEST_ID(pBeta), ippStsContextMatchErr );
+   IPP_BADARG_RET( GFPE_ROOM(pBeta)!=GFP_FELEN(GFP_PMA(ECP_GFP(pEC))), ippStsOutOfRangeErr);
+
+   pLambda = (IppsBigNumState*)( IPP_ALIGNED_PTR(pLambda, BN_ALIGNMENT) );
+   IPP_BADARG_RET(!BN_VALID_ID(pLambda), ippStsContextMatchErr );
+
+   {
+      gsModEngine* pGFE = GFP_PMA(ECP_GFP(pEC));
+      int elemLen = GFP_FELEN(pGFE);
+      gsModEngine* pGForder = ECP_MONT_R(pEC);
+      int orderLen = MOD_LEN(pGForder);
+      BNU_CHUNK_T* pOrder = MOD_MODULUS(pGForder);
+      cpGFpECGLV* pGLV = GLV_CTX(pGLVbuf);
+      BNU_CHUNK_T lambda[GLV_MAX_LEN];
+
+      IPP_BADARG_RET( !GFP_IS_BASIC(pGFE), ippStsBadArgErr );
+      IPP_BADARG_RET( !cpEqu_BNU_CHUNK(ECP_COFACTOR(pEC), elemLen, 1), ippStsBadArgErr );
+      IPP_BADARG_RET( BN_NEGATIVE(pLambda), ippStsBadArgErr );
+      IPP_BADARG_RET(0<=cpCmp_BNU(BN_NUMBER(pLambda), BN_SIZE(pLambda), pOrder, orderLen), ippStsBadArgErr);
+
+      cpGFpElementCopyPadd(lambda, orderLen, BN_NUMBER(pLambda), BN_SIZE(pLambda));
+      IPP_BADARG_RET( !cpGLVIsCubeRoot(lambda, pOrder, orderLen), ippStsBadArgErr );
+
+      GLV_ID(pGLV) = idCtxUnknown;
+      GLV_ELEMLEN(pGLV) = elemLen;
+      GLV_ORDERLEN(pGLV) = orderLen;
+      cpGFpElementCopy(GLV_BETA(pGLV), GFPE_DATA(pBeta), elemLen);
+      IPP_BADARG_RET( !cpGLVIsEigenvalue(lambda, orderLen, pGLV, pEC), ippStsBadArgErr );
+
+      cpGLVBasis(pGLV, pOrder, lambda);
+      GLV_ID(pGLV) = idCtxGFPECGLV;
+      return ippStsNoErr;
+   }
+}
+
+/* R = [(-1)^neg1*K1]*P + [(-1)^neg2*K2]*phi(P), sscm */
+static void cpGLVMulPoint(BNU_CHUNK_T* pRdata, const BNU_CHUNK_T* pPdata,
+                    const BNU_CHUNK_T* pK1, const BNU_CHUNK_T* pK2, const BNU_CHUNK_T* pNeg,
+                    const cpGFpECGLV* pGLV, IppsGFpECState* pEC, Ipp8u* pScratchBuffer)
+{
+   int pointLen = ECP_POINTLEN(pEC);
+
+   /* optimal size of window */
+   const int window_size = 5;
+   /* number of table entries */
+   const int tableLen = 1<<(window_size-1);
+
+   /* aligned pre-computed tables of P and phi(P) */
+   BNU_CHUNK_T* pTable[2];
+
+   gsModEngine* pGFE = GFP_PMA(ECP_GFP(pEC));
+   int elemLen = GFP_FELEN(pGFE);
+   mod_neg negF = GFP_METHOD(pGFE)->neg;
+
+   BNU_CHUNK_T* pHy = cpGFpGetPool(1, pGFE);
+   BNU_CHUNK_T* pTdata = cpEcGFpGetPool(1, pEC); /* points from the pool */
+   BNU_CHUNK_T* pHdata = cpEcGFpGetPool(1, pEC);
+
+   const Ipp8u* pScalar[2];
+   int mask = (1<<(window_size+1)) -1;
+   int top = GLV_HALFBITS(pGLV)-(GLV_HALFBITS(pGLV)%window_size);
+   int bit, n;
+
+   pTable[0] = (BNU_CHUNK_T*)IPP_ALIGNED_PTR(pScratchBuffer, CACHE_LINE_SIZE);
+   pTable[1] = pTable[0]+pointLen*tableLen;
+   pScalar[0] = (const Ipp8u*)pK1;
+   pScalar[1] = (const Ipp8u*)pK2;
+
+   /* [k]*phi(P) = phi([k]*P), the indices are public */
+   setupTable(pTable[0], pPdata, pEC);
+   for(n=0; n<tableLen; n++) {
+      gsScrambleGet(pHdata, pointLen, pTable[0], n, window_size-1);
+      gfec_GLVMap(pTdata, pHdata, pGLV, pEC);
+      gsScramblePut(pTable[1], n, pTdata, pointLen, window_size-1);
+   }
+
+   /* R = point at infinity */
+   cpGFpElementPadd(pTdata, pointLen, 0);
+
+   for(bit=top; bit>=0; bit-=window_size) {
+      int i;
+      if(bit<top) {
+         gfec_point_double(pTdata, pTdata, pEC);
+         gfec_point_double(pTdata, pTdata, pEC);
+         gfec_point_double(pTdata, pTdata, pEC);
+         gfec_point_double(pTdata, pTdata, pEC);
+         gfec_point_double(pTdata, pTdata, pEC);
+      }
+
+      for(i=0; i<2; i++) {
+         int wvalue;
+         Ipp8u digit, sign;
+         if(bit) {
+            wvalue = *((Ipp16u*)&pScalar[i][(bit-1)/8]);
+            wvalue = (wvalue>> ((bit-1)%8)) & mask;
+         }
+         else {
+            wvalue = *((Ipp16u*)&pScalar[i][0]);
+            wvalue = (wvalue << 1) & mask;
+         }
+         booth_recode(&sign, &digit, (Ipp8u)wvalue, window_size);
+         gsScrambleGet_sscm(pHdata, pointLen, pTable[i], digit-1, window_size-1);
+
+         /* the sign of the digit and the sign of the half */
+         negF(pHy, pHdata+elemLen, pGFE);
+         cpMaskedReplace_ct(pHdata+elemLen, pHy, elemLen, ~cpIsZero_ct(sign) ^ pNeg[i]);
+         gfec_point_add(pTdata, pTdata, pHdata, pEC);
+      }
+   }
+
+   cpGFpElementCopy(pRdata, pTdata, pointLen);
+
+   cpEcGFpReleasePool(2, pEC);
+   cpGFpReleasePool(1, pGFE);
+}
+
+/*F*
+// Name: ippsGFpECMulPointGLV
+//
+// Purpose: Multiplies a point on an elliptic curve by a scalar
+//          with the GLV endomorphism
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr               pP == NULL
+//                                   pN == NULL
+//                                   pGLV == NULL
+//                                   pR == NULL
+//                                   pEC == NULL
+//                                   pScratchBuffer == NULL
+//
+//    ippStsContextMatchErr          invalid pEC->idCtx
+//                                   pEC->subgroup == NULL
+//                                   invalid pP->idCtx
+//                                   invalid pN->idCtx
+//                                   invalid pR->idCtx
+//                                   pGLV is not set up for pEC
+//
+//    ippStsOutOfRangeErr            ECP_POINT_FELEN(pP)!=GFP_FELEN()
+//                                   ECP_POINT_FELEN(pR)!=GFP_FELEN()
+//
+//    ippStsBadArgErr                pN is negative
+//                                   pN > MOD_MODULUS(ECP_MONT_R(pEC))
+//
+//    ippStsNoErr                    no error
+//
+// Parameters:
+//    pP              Pointer to the context of the given point on the elliptic curve
+//    pN              Pointer to the Big Number context storing the scalar value
+//    pGLV            Pointer to the context of ippsGFpECGLVInit()
+//    pR              Pointer to the context of the resulting elliptic curve point
+//    pEC             Pointer to the context of the elliptic curve
+//    pScratchBuffer  Pointer to a buffer of ippsGFpECScratchBufferSize(2) bytes
+//
+//  Note:
+//    the scalar is split in two halves of half the bitsize and the
+//    halves of P and phi(P) are multiplied with shared doublings.
+//    Like ippsGFpECMulPoint, the operations and the memory access
+//    pattern do not depend on the value of the scalar.
+//
+*F*/
+
+IPPFUN(IppStatus, ippsGFpECMulPointGLV,(const IppsGFpECPoint* pP,
+                                        const IppsBigNumState* pN,
+                                        const Ipp8u* pGLVbuf,
+                                        IppsGFpECPoint* pR,
+                                        IppsGFpECState* pEC,
+                                        Ipp8u* pScratchBuffer))
+{
+   IPP_BAD_PTR4_RET(pP, pR, pEC, pScratchBuffer);
+   IPP_BAD_PTR2_RET(pN, pGLVbuf);
+   pEC = (IppsGFpECState*)( IPP_ALIGNED_PTR(pEC, ECGFP_ALIGNMENT) );
+   IPP_BADARG_RET( !ECP_TEST_ID(pEC), ippStsContextMatchErr );
+   IPP_BADARG_RET(!ECP_SUBGROUP(pEC), ippStsContextMatchErr);
+
+   IPP_BADARG_RET( !ECP_POINT_TEST_ID(pP), ippStsContextMatchErr );
+   IPP_BADARG_RET( !ECP_POINT_TEST_ID(pR), ippStsContextMatchErr );
+
+   IPP_BADARG_RET( ECP_POINT_FELEN(pP)!=GFP_FELEN(GFP_PMA(ECP_GFP(pEC))), ippStsOutOfRangeErr);
+   IPP_BADARG_RET( ECP_POINT_FELEN(pR)!=GFP_FELEN(GFP_PMA(ECP_GFP(pEC))), ippStsOutOfRangeErr);
+
+   pN = (IppsBigNumState*)( IPP_ALIGNED_PTR(pN, BN_ALIGNMENT) );
+   IPP_BADARG_RET(!BN_VALID_ID(pN), ippStsContextMatchErr );
+   IPP_BADARG_RET( BN_NEGATIVE(pN), ippStsBadArgErr );
+
+   {
+      const cpGFpECGLV* pGLV = GLV_CTX(pGLVbuf);
+      gsModEngine* pGForder = ECP_MONT_R(pEC);
+      int orderLen = MOD_LEN(pGForder);
+      BNU_CHUNK_T* pScalar = BN_NUMBER(pN);
+      int scalarLen = BN_SIZE(pN);
+
+      IPP_BADARG_RET( !gfec_GLVMatch(pGLV, pEC), ippStsContextMatchErr );
+      IPP_BADARG_RET(0<cpCmp_BNU(pScalar, scalarLen, MOD_MODULUS(pGForder), orderLen), ippStsBadArgErr);
+
+      {
+         BNU_CHUNK_T k[GLV_MAX_LEN];
+         BNU_CHUNK_T k1[GLV_MAX_LEN];
+         BNU_CHUNK_T k2[GLV_MAX_LEN];
+         BNU_CHUNK_T neg[2];
+         BNU_CHUNK_T* pRdata = cpEcGFpGetPool(1, pEC);
+
+         FIX_BNU(pScalar, scalarLen);
+         cpGFpElementCopyPadd(k, orderLen, pScalar, scalarLen);
+         gfec_GLVSplit(k1, k2, neg, k, pGLV);
+
+         cpGLVMulPoint(pRdata, ECP_POINT_X(pP), k1, k2, neg, pGLV, pEC, pScratchBuffer);
+         cpGFpElementCopy(ECP_POINT_X(pR), pRdata, ECP_POINTLEN(pEC));
+         ECP_POINT_FLAGS(pR) = gfec_IsPointAtInfinity(pR)? 0 : ECP_FINITE_POINT;
+
+         cpEcGFpReleasePool(1, pEC);
+         PurgeBlock(k, sizeof(k));
+         PurgeBlock(k1, sizeof(k1));
+         PurgeBlock(k2, sizeof(k2));
+         PurgeBlock(neg, sizeof(neg));
+      }
+      return ippStsNoErr;
+   }
+}
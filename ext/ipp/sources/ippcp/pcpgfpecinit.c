@@ -69,6 +69,8 @@
 //    ippStsOutOfRangeErr           GFPE_ROOM(pA)!=GFP_FELEN(pGFE)
 //                                  GFPE_ROOM(pB)!=GFP_FELEN(pGFE)
 //
+//    ippStsNoMemErr                temporaries of the EC exceed the thread pool
+//
 //    ippStsNoErr                   no error
 //
 // Parameters:
@@ -104,6 +106,10 @@ IPPFUN(IppStatus, ippsGFpECInit,(const IppsGFpState* pGFp,
       int modEngineCtxSize;
       gsModEngineGetSize(maxOrderBits, MONT_DEFAULT_POOL_LENGTH, &modEngineCtxSize);
 
+      /* test if nested temporaries of the EC, its field and order fit the thread pool */
+      IPP_BADARG_RET(gsModPoolNeed(pGFE) +EC_POOL_SIZE*3*elemLen
+                     +MONT_DEFAULT_POOL_LENGTH*BITS_BNU_CHUNK(maxOrderBits) > GS_THREAD_POOL_LEN, ippStsNoMemErr);
+
       ECP_ID(pEC) = idCtxGFPEC;
       ECP_GFP(pEC) = (IppsGFpState*)(IPP_ALIGNED_PTR(pGFp, GFP_ALIGNMENT));
       ECP_SUBGROUP(pEC) = 0;
@@ -125,7 +131,6 @@ IPPFUN(IppStatus, ippsGFpECInit,(const IppsGFpState* pGFp,
       ECP_PRIVAT_E(pEC) = (BNU_CHUNK_T*)(ptr); ptr += maxOrdLen*sizeof(BNU_CHUNK_T);
       ECP_SBUFFER(pEC) = (BNU_CHUNK_T*)0;
       #endif
-      ECP_POOL(pEC) = (BNU_CHUNK_T*)(ptr);  //ptr += ECP_POINTLEN(pEC)*sizeof(BNU_CHUNK_T)*EC_POOL_SIZE;
 
       cpGFpElementPadd(ECP_A(pEC), elemLen, 0);
       cpGFpElementPadd(ECP_B(pEC), elemLen, 0);
@@ -135,8 +140,6 @@ IPPFUN(IppStatus, ippsGFpECInit,(const IppsGFpState* pGFp,
 
       cpGFpElementPadd(ECP_COFACTOR(pEC), elemLen, 0);
 
-      cpGFpElementPadd(ECP_POOL(pEC), elemLen*3*EC_POOL_SIZE, 0);
-
       /* set up EC if possible */
       if(pA && pB)
          return ippsGFpECSet(pA,pB, pEC);
@@ -0,0 +1,286 @@
+/*******************************************************************************
+* Copyright 2010-2018 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Intel(R) Integrated Performance Primitives. Cryptography Primitives.
+//     EC over GF(p) Operations
+//
+//     Context:
+//        ippsGFpECPointTableGetSize()
+//        ippsGFpECPointTableInit()
+//        ippsGFpECMulPointTable()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpgfpecstuff.h"
+
+/* size of window of the pre-computed table */
+#define TBL_WINDOW_SIZE (5)
+
+/* number of points per table slot */
+#define TBL_SLOT_POINTS (1<<(TBL_WINDOW_SIZE-1))
+
+/* number of table slots (windows of the scalar) */
+__INLINE int cpEcTblSlots(IppsGFpECState* pEC)
+{
+   return MOD_BITSIZE(ECP_MONT_R(pEC))/TBL_WINDOW_SIZE + 1;
+}
+
+/*F*
+// Name: ippsGFpECPointTableGetSize
+//
+// Purpose: Gets the size of the pre-computed table of a point
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr               pEC == NULL
+//                                   pSize == NULL
+//
+//    ippStsContextMatchErr          invalid pEC->idCtx
+//                                   pEC->subgroup == NULL
+//
+//    ippStsNoErr                    no error
+//
+// Parameters:
+//    pEC             Pointer to the context of the elliptic curve
+//    pSize           Pointer to the size of the table in bytes
+//
+*F*/
+
+IPPFUN(IppStatus, ippsGFpECPointTableGetSize,(const IppsGFpECState* pEC, int* pSize))
+{
+   IPP_BAD_PTR2_RET(pEC, pSize);
+   pEC = (IppsGFpECState*)( IPP_ALIGNED_PTR(pEC, ECGFP_ALIGNMENT) );
+   IPP_BADARG_RET( !ECP_TEST_ID(pEC), ippStsContextMatchErr );
+   IPP_BADARG_RET(!ECP_SUBGROUP(pEC), ippStsContextMatchErr);
+
+   {
+      int nPoints = cpEcTblSlots((IppsGFpECState*)pEC) * TBL_SLOT_POINTS;
+      int pointDataSize = ECP_POINTLEN(pEC)*sizeof(BNU_CHUNK_T);
+
+      *pSize = nPoints*pointDataSize + CACHE_LINE_SIZE;
+      return ippStsNoErr;
+   }
+}
+
+/*F*
+// Name: ippsGFpECPointTableInit
+//
+// Purpose: Pre-computes multiples of a point for ippsGFpECMulPointTable
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr               pP == NULL
+//                                   pTable == NULL
+//                                   pEC == NULL
+//
+//    ippStsContextMatchErr          invalid pEC->idCtx
+//                                   pEC->subgroup == NULL
+//                                   invalid pP->idCtx
+//
+//    ippStsOutOfRangeErr            ECP_POINT_FELEN(pP)!=GFP_FELEN()
+//
+//    ippStsNoErr                    no error
+//
+// Parameters:
+//    pP              Pointer to the context of the given point on the elliptic curve
+//    pTable          Pointer to the table of ippsGFpECPointTableGetSize() bytes
+//    pEC             Pointer to the context of the elliptic curve
+//
+//  Note:
+//    slot n of the table holds [k*2^(w*n)]*P, k = 1,...,2^(w-1)
+//
+*F*/
+
+IPPFUN(IppStatus, ippsGFpECPointTableInit,(const IppsGFpECPoint* pP, Ipp8u* pTable, IppsGFpECState* pEC))
+{
+   IPP_BAD_PTR3_RET(pP, pTable, pEC);
+   pEC = (IppsGFpECState*)( IPP_ALIGNED_PTR(pEC, ECGFP_ALIGNMENT) );
+   IPP_BADARG_RET( !ECP_TEST_ID(pEC), ippStsContextMatchErr );
+   IPP_BADARG_RET(!ECP_SUBGROUP(pEC), ippStsContextMatchErr);
+
+   IPP_BADARG_RET( !ECP_POINT_TEST_ID(pP), ippStsContextMatchErr );
+   IPP_BADARG_RET( ECP_POINT_FELEN(pP)!=GFP_FELEN(GFP_PMA(ECP_GFP(pEC))), ippStsOutOfRangeErr);
+
+   {
+      int pointLen = ECP_POINTLEN(pEC);
+      int nSlots = cpEcTblSlots(pEC);
+      BNU_CHUNK_T* pTbl = (BNU_CHUNK_T*)IPP_ALIGNED_PTR(pTable, CACHE_LINE_SIZE);
+      int n, k;
+
+      for(n=0; n<nSlots; n++, pTbl+=TBL_SLOT_POINTS*pointLen) {
+         /* [1]*P_n, where P_0 = P and P_n = [2^w]*P_(n-1) */
+         if(0==n)
+            cpGFpElementCopy(pTbl, ECP_POINT_X(pP), pointLen);
+         else
+            gfec_point_double(pTbl, pTbl-pointLen, pEC);
+
+         /* [2]*P_n */
+         gfec_point_double(pTbl+pointLen, pTbl, pEC);
+
+         /* [k]*P_n = [k-1]*P_n + P_n */
+         for(k=2; k<TBL_SLOT_POINTS; k++)
+            gfec_point_add(pTbl+k*pointLen, pTbl+(k-1)*pointLen, pTbl, pEC);
+      }
+
+      return ippStsNoErr;
+   }
+}
+
+/*F*
+// Name: ippsGFpECMulPointTable
+//
+// Purpose: Multiplies a point given by its pre-computed table by a scalar
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr               pTable == NULL
+//                                   pN == NULL
+//                                   pR == NULL
+//                                   pEC == NULL
+//
+//    ippStsContextMatchErr          invalid pEC->idCtx
+//                                   pEC->subgroup == NULL
+//                                   invalid pN->idCtx
+//                                   invalid pR->idCtx
+//
+//    ippStsOutOfRangeErr            ECP_POINT_FELEN(pR)!=GFP_FELEN()
+//
+//    ippStsBadArgErr                pN is negative
+//                                   pN > MOD_MODULUS(ECP_MONT_R(pEC))
+//
+//    ippStsNoErr                    no error
+//
+// Parameters:
+//    pTable          Pointer to the table set up by ippsGFpECPointTableInit()
+//    pN              Pointer to the Big Number context storing the scalar value
+//    pR              Pointer to the context of the resulting elliptic curve point
+//    pEC             Pointer to the context of the elliptic curve
+//
+//  Note:
+//    computes [N]*P, 0 < N < order, without doublings.
+//    The table lookup depends on the value of N, so the function
+//    must not be used with secret scalars.
+//
+*F*/
+
+IPPFUN(IppStatus, ippsGFpECMulPointTable,(const Ipp8u* pTable,
+                                          const IppsBigNumState* pN,
+                                          IppsGFpECPoint* pR,
+                                          IppsGFpECState* pEC))
+{
+   IPP_BAD_PTR3_RET(pTable, pR, pEC);
+   pEC = (IppsGFpECState*)( IPP_ALIGNED_PTR(pEC, ECGFP_ALIGNMENT) );
+   IPP_BADARG_RET( !ECP_TEST_ID(pEC), ippStsContextMatchErr );
+   IPP_BADARG_RET(!ECP_SUBGROUP(pEC), ippStsContextMatchErr);
+
+   IPP_BADARG_RET( !ECP_POINT_TEST_ID(pR), ippStsContextMatchErr );
+   IPP_BADARG_RET( ECP_POINT_FELEN(pR)!=GFP_FELEN(GFP_PMA(ECP_GFP(pEC))), ippStsOutOfRangeErr);
+
+   IPP_BAD_PTR1_RET(pN);
+   pN = (IppsBigNumState*)( IPP_ALIGNED_PTR(pN, BN_ALIGNMENT) );
+   IPP_BADARG_RET(!BN_VALID_ID(pN), ippStsContextMatchErr );
+   IPP_BADARG_RET( BN_NEGATIVE(pN), ippStsBadArgErr );
+
+   {
+      gsModEngine* pGForder = ECP_MONT_R(pEC);
+      BNU_CHUNK_T* pScalar = BN_NUMBER(pN);
+      int scalarLen = BN_SIZE(pN);
+      IPP_BADARG_RET(0<cpCmp_BNU(pScalar, scalarLen, MOD_MODULUS(pGForder), MOD_LEN(pGForder)), ippStsBadArgErr);
+
+      FIX_BNU(pScalar, scalarLen);
+      {
+         IppsGFpState* pGF = ECP_GFP(pEC);
+         gsModEngine* pGFE = GFP_PMA(pGF);
+         int elemLen = GFP_FELEN(pGFE);
+         int pointLen = ECP_POINTLEN(pEC);
+         mod_neg negF = GFP_METHOD(pGFE)->neg;
+
+         int orderBits = MOD_BITSIZE(pGForder);
+         int orderLen  = MOD_LEN(pGForder);
+
+         const BNU_CHUNK_T* pTbl = (const BNU_CHUNK_T*)IPP_ALIGNED_PTR(pTable, CACHE_LINE_SIZE);
+
+         BNU_CHUNK_T* pTmpScalar = cpGFpGetPool(2, pGForder); /* length of scalar does not exceed length of order, +1 extra chunk */
+         BNU_CHUNK_T* pTdata = cpEcGFpGetPool(1, pEC); /* points from the pool */
+         BNU_CHUNK_T* pRdata = cpEcGFpGetPool(1, pEC);
+
+         const Ipp8u* pScalar8 = (const Ipp8u*)pTmpScalar;
+         int mask = (1<<(TBL_WINDOW_SIZE+1)) -1;
+         int bit;
+
+         cpGFpElementCopyPadd(pTmpScalar, orderLen+1, pScalar, scalarLen);
+
+         /* R = point at infinity */
+         cpGFpElementPadd(pRdata, pointLen, 0);
+
+         for(bit=0; bit<=orderBits; bit+=TBL_WINDOW_SIZE, pTbl+=TBL_SLOT_POINTS*pointLen) {
+            int wvalue;
+            Ipp8u digit, sign;
+
+            if(0==bit) {
+               wvalue = *((Ipp16u*)&pScalar8[0]);
+               wvalue = (wvalue << 1) & mask;
+            }
+            else {
+               wvalue = *((Ipp16u*)&pScalar8[(bit-1)/8]);
+               wvalue = (wvalue>> ((bit-1)%8)) & mask;
+            }
+            booth_recode(&sign, &digit, (Ipp8u)wvalue, TBL_WINDOW_SIZE);
+
+            if(digit) {
+               const BNU_CHUNK_T* pPdata = pTbl+(digit-1)*pointLen;
+               cpGFpElementCopy(pTdata, pPdata, pointLen);
+               if(sign)
+                  negF(pTdata+elemLen, pPdata+elemLen, pGFE);
+               gfec_point_add(pRdata, pRdata, pTdata, pEC);
+            }
+         }
+
+         cpGFpElementCopy(ECP_POINT_X(pR), pRdata, pointLen);
+         ECP_POINT_FLAGS(pR) = gfec_IsPointAtInfinity(pR)? 0 : ECP_FINITE_POINT;
+
+         cpEcGFpReleasePool(2, pEC);
+         cpGFpReleasePool(2, pGForder);
+         return ippStsNoErr;
+      }
+   }
+}
@@ -0,0 +1,682 @@
+/*******************************************************************************
+* Copyright 2010-2018 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+/*
+//
+//  Purpose:
+//     Intel(R) Integrated Performance Primitives. Cryptography Primitives.
+//     EC over GF(p) Operations
+//
+//     Context:
+//        ippsGFpECMultiMulPointGetSize()
+//        ippsGFpECMultiMulPoint()
+//        ippsGFpECMultiMulPointGLVGetSize()
+//        ippsGFpECMultiMulPointGLV()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpgfpecstuff.h"
+
+/* max number of points of ippsGFpECMultiMulPoint */
+#define MULTI_MUL_MAX_COUNT   (1<<16)
+
+/* width of the wNAF digits of the interleaved (Straus) method */
+#define WNAF_WIDTH            (5)
+/* odd multiples [1]*P, [3]*P, ..., [2^(w-1)-1]*P pre-computed per point */
+#define WNAF_TBL_POINTS       (1<<(WNAF_WIDTH-2))
+
+/* max window size of the bucket (Pippenger) method */
+#define BUCKET_MAX_WINDOW     (16)
+
+/*
+// Selects the method of ippsGFpECMultiMulPoint by the number of point
+// additions each needs: returns 0 for the interleaved method or the
+// window size of the bucket method. Both use about the same number of
+// doublings.
+*/
+static int cpMultiMulWindow(int count, int bits)
+{
+   int bestCost = count*(WNAF_TBL_POINTS + bits/(WNAF_WIDTH+1));
+   int bestWindow = 0;
+   int c;
+   for(c=2; c<=BUCKET_MAX_WINDOW; c++) {
+      int cost = (bits/c+1)*(count + (1<<c));
+      if(cost<bestCost) {
+         bestCost = cost;
+         bestWindow = c;
+      }
+   }
+   return bestWindow;
+}
+
+/* number of digits per scalar */
+__INLINE int cpMultiMulDigits(int bits, int window)
+{
+   return window? bits/window+1 : bits+1;
+}
+
+/*
+// Size of the scratch buffer in bytes. The buffer holds the tables or
+// the buckets, the images phi(P) of the points with the GLV method, the
+// scalars, the pointers to the points of the terms, the digits and the
+// signs of the terms.
+*/
+static int cpMultiMulBufferSize(int count, int glv, int bits, const IppsGFpECState* pEC)
+{
+   int nTerms = glv? 2*count : count;
+   int scalarLen = MOD_LEN(ECP_MONT_R(pEC))+1;
+   int pointDataSize = ECP_POINTLEN(pEC)*(int)sizeof(BNU_CHUNK_T);
+   int window = cpMultiMulWindow(nTerms, bits);
+   int nDigits = cpMultiMulDigits(bits, window);
+
+   int nPoints = window? (1<<(window-1)) : nTerms*WNAF_TBL_POINTS;
+   int digitSize = window? (int)sizeof(Ipp16s) : (int)sizeof(Ipp8s);
+
+   return nPoints*pointDataSize
+        + (glv? count*pointDataSize : 0)
+        + nTerms*scalarLen*(int)sizeof(BNU_CHUNK_T)
+        + nTerms*(int)sizeof(BNU_CHUNK_T*)
+        + nTerms*nDigits*digitSize
+        + nTerms
+        + CACHE_LINE_SIZE;
+}
+
+/* layout of the scratch buffer */
+typedef struct _cpMultiMulBuffer {
+   BNU_CHUNK_T*  pTbl;     /* tables or buckets */
+   BNU_CHUNK_T*  pPhi;     /* phi(P) of the GLV method */
+   BNU_CHUNK_T*  pScalars; /* scalars of the terms */
+   const BNU_CHUNK_T** ppPdata; /* points of the terms */
+   void*         pDigits;  /* digits of the scalars */
+   Ipp8u*        pNeg;     /* the terms are negated */
+} cpMultiMulBuffer;
+
+static void cpMultiMulSetBuffer(cpMultiMulBuffer* pBuf, Ipp8u* pScratchBuffer,
+                                int count, int glv, int bits, const IppsGFpECState* pEC)
+{
+   int nTerms = glv? 2*count : count;
+   int scalarLen = MOD_LEN(ECP_MONT_R(pEC))+1;
+   int pointLen = ECP_POINTLEN(pEC);
+   int window = cpMultiMulWindow(nTerms, bits);
+   int nDigits = cpMultiMulDigits(bits, window);
+   int nPoints = window? (1<<(window-1)) : nTerms*WNAF_TBL_POINTS;
+   int digitSize = window? (int)sizeof(Ipp16s) : (int)sizeof(Ipp8s);
+
+   pBuf->pTbl = (BNU_CHUNK_T*)IPP_ALIGNED_PTR(pScratchBuffer, CACHE_LINE_SIZE);
+   pBuf->pPhi = pBuf->pTbl + nPoints*pointLen;
+   pBuf->pScalars = pBuf->pPhi + (glv? count*pointLen : 0);
+   pBuf->ppPdata = (const BNU_CHUNK_T**)(pBuf->pScalars + nTerms*scalarLen);
+   pBuf->pDigits = (void*)(pBuf->ppPdata + nTerms);
+   pBuf->pNeg = (Ipp8u*)pBuf->pDigits + nTerms*nDigits*digitSize;
+}
+
+/* extracts width bits of the scalar, starting with bit pos */
+__INLINE int cpScalarWindow(const BNU_CHUNK_T* pScalar, int pos, int width)
+{
+   int idx = pos/BNU_CHUNK_BITS;
+   int shift = pos%BNU_CHUNK_BITS;
+   BNU_CHUNK_T w = pScalar[idx]>>shift;
+   if(shift && (shift+width)>BNU_CHUNK_BITS)
+      w |= pScalar[idx+1]<<(BNU_CHUNK_BITS-shift);
+   return (int)(w & (((BNU_CHUNK_T)1<<width)-1));
+}
+
+/* adds 2^pos to the scalar */
+static void cpScalarAddBit(BNU_CHUNK_T* pScalar, int len, int pos)
+{
+   int idx = pos/BNU_CHUNK_BITS;
+   BNU_CHUNK_T bit = (BNU_CHUNK_T)1<<(pos%BNU_CHUNK_BITS);
+   for(; idx<len; idx++) {
+      pScalar[idx] += bit;
+      if(pScalar[idx]>=bit)
+         break;
+      bit = 1;
+   }
+}
+
+/*
+// Recodes the scalar into width-w NAF digits: every non-zero digit is
+// odd, less than 2^(w-1) in absolute value and followed by at least w-1
+// zero digits. The scalar is destroyed.
+*/
+static void cpScalarToWNaf(Ipp8s* pNaf, int nDigits, BNU_CHUNK_T* pScalar, int len)
+{
+   int pos;
+   for(pos=0; pos<nDigits; pos++)
+      pNaf[pos] = 0;
+
+   for(pos=0; pos<nDigits; ) {
+      int d;
+      if(0==cpScalarWindow(pScalar, pos, 1)) {
+         pos++;
+         continue;
+      }
+      d = cpScalarWindow(pScalar, pos, WNAF_WIDTH);
+      if(d>=(1<<(WNAF_WIDTH-1))) {
+         d -= 1<<WNAF_WIDTH;
+         cpScalarAddBit(pScalar, len, pos+WNAF_WIDTH);
+      }
+      pNaf[pos] = (Ipp8s)d;
+      pos += WNAF_WIDTH;
+   }
+}
+
+/*
+// Recodes the scalar into signed base 2^c digits, each in the range
+// [-2^(c-1), 2^(c-1)].
+*/
+static void cpScalarToSignedWindows(Ipp16s* pDigits, int nDigits, const BNU_CHUNK_T* pScalar, int window)
+{
+   int carry = 0;
+   int k;
+   for(k=0; k<nDigits; k++) {
+      int d = cpScalarWindow(pScalar, k*window, window) + carry;
+      carry = 0;
+      if(d>(1<<(window-1))) {
+         d -= 1<<window;
+         carry = 1;
+      }
+      pDigits[k] = (Ipp16s)d;
+   }
+}
+
+/* R += sign(d)*P */
+static void cpAddSignedPoint(BNU_CHUNK_T* pRdata, const BNU_CHUNK_T* pPdata, int negative,
+                             BNU_CHUNK_T* pTmpdata, IppsGFpECState* pEC)
+{
+   if(negative) {
+      gsModEngine* pGFE = GFP_PMA(ECP_GFP(pEC));
+      int elemLen = GFP_FELEN(pGFE);
+      cpGFpElementCopy(pTmpdata, pPdata, ECP_POINTLEN(pEC));
+      GFP_METHOD(pGFE)->neg(pTmpdata+elemLen, pPdata+elemLen, pGFE);
+      gfec_point_add(pRdata, pRdata, pTmpdata, pEC);
+   }
+   else
+      gfec_point_add(pRdata, pRdata, pPdata, pEC);
+}
+
+/*
+// interleaved (Straus) multi-multiplication with shared doublings.
+// With the GLV method (pGLV != NULL) the odd terms are the images phi(P)
+// of the points of the preceding terms and their tables are mapped from
+// the tables of those.
+*/
+static void cpMultiMulInterleaved(BNU_CHUNK_T* pRdata,
+                                  const cpMultiMulBuffer* pBuf, int scalarLen,
+                                  int nTerms, int bits, const cpGFpECGLV* pGLV,
+                                  IppsGFpECState* pEC)
+{
+   int pointLen = ECP_POINTLEN(pEC);
+   int nDigits = cpMultiMulDigits(bits, 0);
+   BNU_CHUNK_T* pTbl = pBuf->pTbl;
+   Ipp8s* pNaf = (Ipp8s*)pBuf->pDigits;
+   BNU_CHUNK_T* pTmpdata = cpEcGFpGetPool(1, pEC);
+   int top = -1;
+   int i, j;
+
+   for(j=0; j<nTerms; j++) {
+      BNU_CHUNK_T* pT = pTbl + j*WNAF_TBL_POINTS*pointLen;
+      int k;
+
+      if(pGLV && (j&1)) {
+         /* [k]*phi(P) = phi([k]*P) */
+         for(k=0; k<WNAF_TBL_POINTS; k++)
+            gfec_GLVMap(pT+k*pointLen, pT+(k-WNAF_TBL_POINTS)*pointLen, pGLV, pEC);
+      }
+      else {
+         /* [2k+1]*P = [2k-1]*P + [2]*P */
+         cpGFpElementCopy(pT, pBuf->ppPdata[j], pointLen);
+         gfec_point_double(pTmpdata, pT, pEC);
+         for(k=1; k<WNAF_TBL_POINTS; k++)
+            gfec_point_add(pT+k*pointLen, pT+(k-1)*pointLen, pTmpdata, pEC);
+      }
+
+      cpScalarToWNaf(pNaf+j*nDigits, nDigits, pBuf->pScalars+j*scalarLen, scalarLen);
+      if(pBuf->pNeg[j]) {
+         for(i=0; i<nDigits; i++)
+            pNaf[j*nDigits+i] = (Ipp8s)(-pNaf[j*nDigits+i]);
+      }
+      for(i=nDigits-1; i>top; i--) {
+         if(pNaf[j*nDigits+i]) {
+            top = i;
+            break;
+         }
+      }
+   }
+
+   /* R = point at infinity */
+   cpGFpElementPadd(pRdata, pointLen, 0);
+
+   for(i=top; i>=0; i--) {
+      if(i!=top)
+         gfec_point_double(pRdata, pRdata, pEC);
+      for(j=0; j<nTerms; j++) {
+         int d = pNaf[j*nDigits+i];
+         if(d) {
+            int negative = d<0;
+            const BNU_CHUNK_T* pT = pTbl + j*WNAF_TBL_POINTS*pointLen;
+            d = negative? -d : d;
+            cpAddSignedPoint(pRdata, pT+((d-1)/2)*pointLen, negative, pTmpdata, pEC);
+         }
+      }
+   }
+
+   cpEcGFpReleasePool(1, pEC);
+}
+
+/* bucket (Pippenger) multi-multiplication */
+static void cpMultiMulBucket(BNU_CHUNK_T* pRdata,
+                             const cpMultiMulBuffer* pBuf, int scalarLen,
+                             int nTerms, int bits, int window,
+                             IppsGFpECState* pEC)
+{
+   int pointLen = ECP_POINTLEN(pEC);
+   int nDigits = cpMultiMulDigits(bits, window);
+   int nBuckets = 1<<(window-1);
+   BNU_CHUNK_T* pBuckets = pBuf->pTbl;
+   Ipp16s* pDigits = (Ipp16s*)pBuf->pDigits;
+   BNU_CHUNK_T* pTmpdata = cpEcGFpGetPool(1, pEC);
+   BNU_CHUNK_T* pSumdata = cpEcGFpGetPool(1, pEC);
+   BNU_CHUNK_T* pAccdata = cpEcGFpGetPool(1, pEC);
+   int i, j, k;
+
+   for(j=0; j<nTerms; j++) {
+      cpScalarToSignedWindows(pDigits+j*nDigits, nDigits, pBuf->pScalars+j*scalarLen, window);
+      if(pBuf->pNeg[j]) {
+         for(k=0; k<nDigits; k++)
+            pDigits[j*nDigits+k] = (Ipp16s)(-pDigits[j*nDigits+k]);
+      }
+   }
+
+   /* R = point at infinity */
+   cpGFpElementPadd(pRdata, pointLen, 0);
+
+   for(k=nDigits-1; k>=0; k--) {
+      if(k!=nDigits-1) {
+         for(i=0; i<window; i++)
+            gfec_point_double(pRdata, pRdata, pEC);
+      }
+
+      /* bucket b collects the points whose digit is +-(b+1) */
+      cpGFpElementPadd(pBuckets, nBuckets*pointLen, 0);
+      for(j=0; j<nTerms; j++) {
+         int d = pDigits[j*nDigits+k];
+         if(d) {
+            int negative = d<0;
+            d = negative? -d : d;
+            cpAddSignedPoint(pBuckets+(d-1)*pointLen, pBuf->ppPdata[j], negative, pTmpdata, pEC);
+         }
+      }
+
+      /* sum of [b+1]*bucket_b as a running sum of running sums */
+      cpGFpElementPadd(pSumdata, pointLen, 0);
+      cpGFpElementPadd(pAccdata, pointLen, 0);
+      for(i=nBuckets-1; i>=0; i--) {
+         gfec_point_add(pSumdata, pSumdata, pBuckets+i*pointLen, pEC);
+         gfec_point_add(pAccdata, pAccdata, pSumdata, pEC);
+      }
+      gfec_point_add(pRdata, pRdata, pAccdata, pEC);
+   }
+
+   cpEcGFpReleasePool(3, pEC);
+}
+
+/* R = sum of the terms of the buffer */
+static void cpMultiMulPoint(IppsGFpECPoint* pR, const cpMultiMulBuffer* pBuf,
+                            int nTerms, int bits, const cpGFpECGLV* pGLV,
+                            IppsGFpECState* pEC)
+{
+   int scalarLen = MOD_LEN(ECP_MONT_R(pEC))+1;
+   int window = cpMultiMulWindow(nTerms, bits);
+   BNU_CHUNK_T* pRdata = cpEcGFpGetPool(1, pEC);
+
+   if(window)
+      cpMultiMulBucket(pRdata, pBuf, scalarLen, nTerms, bits, window, pEC);
+   else
+      cpMultiMulInterleaved(pRdata, pBuf, scalarLen, nTerms, bits, pGLV, pEC);
+
+   cpGFpElementCopy(ECP_POINT_X(pR), pRdata, ECP_POINTLEN(pEC));
+   ECP_POINT_FLAGS(pR) = gfec_IsPointAtInfinity(pR)? 0 : ECP_FINITE_POINT;
+
+   cpEcGFpReleasePool(1, pEC);
+}
+
+/*F*
+// Name: ippsGFpECMultiMulPointGetSize
+//
+// Purpose: Gets the size of the scratch buffer of ippsGFpECMultiMulPoint
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr               pEC == NULL
+//                                   pSize == NULL
+//
+//    ippStsContextMatchErr          invalid pEC->idCtx
+//                                   pEC->subgroup == NULL
+//
+//    ippStsBadArgErr                count < 1
+//                                   count > 2^16
+//
+//    ippStsNoErr                    no error
+//
+// Parameters:
+//    count           Number of points
+//    pEC             Pointer to the context of the elliptic curve
+//    pSize           Pointer to the size of the buffer in bytes
+//
+*F*/
+
+IPPFUN(IppStatus, ippsGFpECMultiMulPointGetSize,(int count, const IppsGFpECState* pEC, int* pSize))
+{
+   IPP_BAD_PTR2_RET(pEC, pSize);
+   pEC = (IppsGFpECState*)( IPP_ALIGNED_PTR(pEC, ECGFP_ALIGNMENT) );
+   IPP_BADARG_RET( !ECP_TEST_ID(pEC), ippStsContextMatchErr );
+   IPP_BADARG_RET(!ECP_SUBGROUP(pEC), ippStsContextMatchErr);
+   IPP_BADARG_RET( (1>count)||(count>MULTI_MUL_MAX_COUNT), ippStsBadArgErr);
+
+   *pSize = cpMultiMulBufferSize(count, 0, MOD_BITSIZE(ECP_MONT_R(pEC)), pEC);
+   return ippStsNoErr;
+}
+
+/*F*
+// Name: ippsGFpECMultiMulPoint
+//
+// Purpose: Computes [N_0]*P_0 + ... + [N_(count-1)]*P_(count-1)
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr               ppP == NULL
+//                                   ppN == NULL
+//                                   pR == NULL
+//                                   pEC == NULL
+//                                   pScratchBuffer == NULL
+//                                   any ppP[i] == NULL
+//                                   any ppN[i] == NULL
+//
+//    ippStsContextMatchErr          invalid pEC->idCtx
+//                                   pEC->subgroup == NULL
+//                                   invalid ppP[i]->idCtx
+//                                   invalid ppN[i]->idCtx
+//                                   invalid pR->idCtx
+//
+//    ippStsOutOfRangeErr            ECP_POINT_FELEN(ppP[i])!=GFP_FELEN()
+//                                   ECP_POINT_FELEN(pR)!=GFP_FELEN()
+//
+//    ippStsBadArgErr                count < 1
+//                                   count > 2^16
+//                                   ppN[i] is negative
+//                                   ppN[i] > MOD_MODULUS(ECP_MONT_R(pEC))
+//
+//    ippStsNoErr                    no error
+//
+// Parameters:
+//    ppP             Array of pointers to the points
+//    ppN             Array of pointers to the Big Number contexts of the scalars
+//    count           Number of points and scalars
+//    pR              Pointer to the context of the resulting elliptic curve point
+//    pEC             Pointer to the context of the elliptic curve
+//    pScratchBuffer  Pointer to a buffer of ippsGFpECMultiMulPointGetSize() bytes
+//
+//  Note:
+//    Few points are multiplied with interleaved width-5 NAF digits, so
+//    all points share one series of doublings. Many points are
+//    multiplied with the bucket method. The operations depend on the
+//    values of the scalars, so the function must not be used with
+//    secret scalars.
+//
+*F*/
+
+IPPFUN(IppStatus, ippsGFpECMultiMulPoint,(const IppsGFpECPoint* const ppP[],
+                                          const IppsBigNumState* const ppN[],
+                                          int count,
+                                          IppsGFpECPoint* pR,
+                                          IppsGFpECState* pEC,
+                                          Ipp8u* pScratchBuffer))
+{
+   IPP_BAD_PTR4_RET(ppP, ppN, pR, pEC);
+   IPP_BAD_PTR1_RET(pScratchBuffer);
+   pEC = (IppsGFpECState*)( IPP_ALIGNED_PTR(pEC, ECGFP_ALIGNMENT) );
+   IPP_BADARG_RET( !ECP_TEST_ID(pEC), ippStsContextMatchErr );
+   IPP_BADARG_RET(!ECP_SUBGROUP(pEC), ippStsContextMatchErr);
+   IPP_BADARG_RET( (1>count)||(count>MULTI_MUL_MAX_COUNT), ippStsBadArgErr);
+
+   IPP_BADARG_RET( !ECP_POINT_TEST_ID(pR), ippStsContextMatchErr );
+   IPP_BADARG_RET( ECP_POINT_FELEN(pR)!=GFP_FELEN(GFP_PMA(ECP_GFP(pEC))), ippStsOutOfRangeErr);
+
+   {
+      gsModEngine* pGForder = ECP_MONT_R(pEC);
+      int bits = MOD_BITSIZE(pGForder);
+      int orderLen = MOD_LEN(pGForder);
+      int scalarLen = orderLen+1;
+      cpMultiMulBuffer buf;
+      int i;
+
+      cpMultiMulSetBuffer(&buf, pScratchBuffer, count, 0, bits, pEC);
+
+      for(i=0; i<count; i++) {
+         const IppsGFpECPoint* pP = ppP[i];
+         const IppsBigNumState* pN = ppN[i];
+         BNU_CHUNK_T* pScalar;
+         int nsScalar;
+
+         IPP_BAD_PTR2_RET(pP, pN);
+         IPP_BADARG_RET( !ECP_POINT_TEST_ID(pP), ippStsContextMatchErr );
+         IPP_BADARG_RET( ECP_POINT_FELEN(pP)!=GFP_FELEN(GFP_PMA(ECP_GFP(pEC))), ippStsOutOfRangeErr);
+
+         pN = (IppsBigNumState*)( IPP_ALIGNED_PTR(pN, BN_ALIGNMENT) );
+         IPP_BADARG_RET(!BN_VALID_ID(pN), ippStsContextMatchErr );
+         IPP_BADARG_RET( BN_NEGATIVE(pN), ippStsBadArgErr );
+
+         pScalar = BN_NUMBER(pN);
+         nsScalar = BN_SIZE(pN);
+         IPP_BADARG_RET(0<cpCmp_BNU(pScalar, nsScalar, MOD_MODULUS(pGForder), orderLen), ippStsBadArgErr);
+         FIX_BNU(pScalar, nsScalar);
+         cpGFpElementCopyPadd(buf.pScalars+i*scalarLen, scalarLen, pScalar, nsScalar);
+         buf.ppPdata[i] = ECP_POINT_X(pP);
+         buf.pNeg[i] = 0;
+      }
+
+      cpMultiMulPoint(pR, &buf, count, bits, NULL, pEC);
+      return ippStsNoErr;
+   }
+}
+
+/*F*
+// Name: ippsGFpECMultiMulPointGLVGetSize
+//
+// Purpose: Gets the size of the scratch buffer of ippsGFpECMultiMulPointGLV
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr               pGLV == NULL
+//                                   pEC == NULL
+//                                   pSize == NULL
+//
+//    ippStsContextMatchErr          invalid pEC->idCtx
+//                                   pEC->subgroup == NULL
+//                                   pGLV is not set up for pEC
+//
+//    ippStsBadArgErr                count < 1
+//                                   count > 2^16
+//
+//    ippStsNoErr                    no error
+//
+// Parameters:
+//    count           Number of points
+//    pGLV            Pointer to the context of ippsGFpECGLVInit()
+//    pEC             Pointer to the context of the elliptic curve
+//    pSize           Pointer to the size of the buffer in bytes
+//
+*F*/
+
+IPPFUN(IppStatus, ippsGFpECMultiMulPointGLVGetSize,(int count, const Ipp8u* pGLVbuf, const IppsGFpECState* pEC, int* pSize))
+{
+   IPP_BAD_PTR3_RET(pGLVbuf, pEC, pSize);
+   pEC = (IppsGFpECState*)( IPP_ALIGNED_PTR(pEC, ECGFP_ALIGNMENT) );
+   IPP_BADARG_RET( !ECP_TEST_ID(pEC), ippStsContextMatchErr );
+   IPP_BADARG_RET(!ECP_SUBGROUP(pEC), ippStsContextMatchErr);
+   IPP_BADARG_RET( (1>count)||(count>MULTI_MUL_MAX_COUNT), ippStsBadArgErr);
+
+   {
+      const cpGFpECGLV* pGLV = GLV_CTX(pGLVbuf);
+      IPP_BADARG_RET( !gfec_GLVMatch(pGLV, (IppsGFpECState*)pEC), ippStsContextMatchErr );
+
+      *pSize = cpMultiMulBufferSize(count, 1, GLV_HALFBITS(pGLV), pEC);
+      return ippStsNoErr;
+   }
+}
+
+/*F*
+// Name: ippsGFpECMultiMulPointGLV
+//
+// Purpose: Computes [N_0]*P_0 + ... + [N_(count-1)]*P_(count-1)
+//          with the GLV endomorphism
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr               ppP == NULL
+//                                   ppN == NULL
+//                                   pGLV == NULL
+//                                   pR == NULL
+//                                   pEC == NULL
+//                                   pScratchBuffer == NULL
+//                                   any ppP[i] == NULL
+//                                   any ppN[i] == NULL
+//
+//    ippStsContextMatchErr          invalid pEC->idCtx
+//                                   pEC->subgroup == NULL
+//                                   invalid ppP[i]->idCtx
+//                                   invalid ppN[i]->idCtx
+//                                   invalid pR->idCtx
+//                                   pGLV is not set up for pEC
+//
+//    ippStsOutOfRangeErr            ECP_POINT_FELEN(ppP[i])!=GFP_FELEN()
+//                                   ECP_POINT_FELEN(pR)!=GFP_FELEN()
+//
+//    ippStsBadArgErr                count < 1
+//                                   count > 2^16
+//                                   ppN[i] is negative
+//                                   ppN[i] > MOD_MODULUS(ECP_MONT_R(pEC))
+//
+//    ippStsNoErr                    no error
+//
+// Parameters:
+//    ppP             Array of pointers to the points
+//    ppN             Array of pointers to the Big Number contexts of the scalars
+//    count           Number of points and scalars
+//    pGLV            Pointer to the context of ippsGFpECGLVInit()
+//    pR              Pointer to the context of the resulting elliptic curve point
+//    pEC             Pointer to the context of the elliptic curve
+//    pScratchBuffer  Pointer to a buffer of ippsGFpECMultiMulPointGLVGetSize() bytes
+//
+//  Note:
+//    every term [N]*P is split into [N1]*P + [N2]*phi(P) with halves of
+//    half the bitsize, which halves the doublings of the interleaved
+//    method and the windows of the bucket method. As ippsGFpECMultiMulPoint
+//    the function must not be used with secret scalars.
+//
+*F*/
+
+IPPFUN(IppStatus, ippsGFpECMultiMulPointGLV,(const IppsGFpECPoint* const ppP[],
+                                             const IppsBigNumState* const ppN[],
+                                             int count,
+                                             const Ipp8u* pGLVbuf,
+                                             IppsGFpECPoint* pR,
+                                             IppsGFpECState* pEC,
+                                             Ipp8u* pScratchBuffer))
+{
+   IPP_BAD_PTR4_RET(ppP, ppN, pR, pEC);
+   IPP_BAD_PTR2_RET(pGLVbuf, pScratchBuffer);
+   pEC = (IppsGFpECState*)( IPP_ALIGNED_PTR(pEC, ECGFP_ALIGNMENT) );
+   IPP_BADARG_RET( !ECP_TEST_ID(pEC), ippStsContextMatchErr );
+   IPP_BADARG_RET(!ECP_SUBGROUP(pEC), ippStsContextMatchErr);
+   IPP_BADARG_RET( (1>count)||(count>MULTI_MUL_MAX_COUNT), ippStsBadArgErr);
+
+   IPP_BADARG_RET( !ECP_POINT_TEST_ID(pR), ippStsContextMatchErr );
+   IPP_BADARG_RET( ECP_POINT_FELEN(pR)!=GFP_FELEN(GFP_PMA(ECP_GFP(pEC))), ippStsOutOfRangeErr);
+
+   {
+      const cpGFpECGLV* pGLV = GLV_CTX(pGLVbuf);
+      gsModEngine* pGForder = ECP_MONT_R(pEC);
+      int orderLen = MOD_LEN(pGForder);
+      int scalarLen = orderLen+1;
+      int pointLen = ECP_POINTLEN(pEC);
+      int bits;
+      cpMultiMulBuffer buf;
+      int i;
+
+      IPP_BADARG_RET( !gfec_GLVMatch(pGLV, pEC), ippStsContextMatchErr );
+      bits = GLV_HALFBITS(pGLV);
+      cpMultiMulSetBuffer(&buf, pScratchBuffer, count, 1, bits, pEC);
+
+      for(i=0; i<count; i++) {
+         const IppsGFpECPoint* pP = ppP[i];
+         const IppsBigNumState* pN = ppN[i];
+         BNU_CHUNK_T* pScalar;
+         int nsScalar;
+         BNU_CHUNK_T k[GLV_MAX_LEN];
+         BNU_CHUNK_T neg[2];
+
+         IPP_BAD_PTR2_RET(pP, pN);
+         IPP_BADARG_RET( !ECP_POINT_TEST_ID(pP), ippStsContextMatchErr );
+         IPP_BADARG_RET( ECP_POINT_FELEN(pP)!=GFP_FELEN(GFP_PMA(ECP_GFP(pEC))), ippStsOutOfRangeErr);
+
+         pN = (IppsBigNumState*)( IPP_ALIGNED_PTR(pN, BN_ALIGNMENT) );
+         IPP_BADARG_RET(!BN_VALID_ID(pN), ippStsContextMatchErr );
+         IPP_BADARG_RET( BN_NEGATIVE(pN), ippStsBadArgErr );
+
+         pScalar = BN_NUMBER(pN);
+         nsScalar = BN_SIZE(pN);
+         IPP_BADARG_RET(0<cpCmp_BNU(pScalar, nsScalar, MOD_MODULUS(pGForder), orderLen), ippStsBadArgErr);
+         FIX_BNU(pScalar, nsScalar);
+         cpGFpElementCopyPadd(k, orderLen, pScalar, nsScalar);
+
+         /* [N]*P = [N1]*P + [N2]*phi(P) */
+         gfec_GLVSplit(buf.pScalars+(2*i)*scalarLen, buf.pScalars+(2*i+1)*scalarLen, neg, k, pGLV);
+         buf.pNeg[2*i] = (Ipp8u)(neg[0] & 1);
+         buf.pNeg[2*i+1] = (Ipp8u)(neg[1] & 1);
+
+         gfec_GLVMap(buf.pPhi+i*pointLen, ECP_POINT_X(pP), pGLV, pEC);
+         buf.ppPdata[2*i] = ECP_POINT_X(pP);
+         buf.ppPdata[2*i+1] = buf.pPhi+i*pointLen;
+      }
+
+      cpMultiMulPoint(pR, &buf, 2*count, bits, pGLV, pEC);
+      return ippStsNoErr;
+   }
+}
@@ -137,7 +137,6 @@ typedef struct _cpGFpEC {
    const cpPrecompAP* pBaseTbl;  /* address of pre-computed [n]G tabble */
    gsModEngine*    pMontR; /* EC order montgomery engine */
 
-   BNU_CHUNK_T*    pPool;  /* pool of points   */
    #if defined(_LEGACY_ECCP_SUPPORT_)
    BNU_CHUNK_T*  pPublic;  /* regular   public key */
    BNU_CHUNK_T*  pPublicE; /* ephemeral public key */
@@ -150,7 +149,7 @@ typedef struct _cpGFpEC {
 #define ECGFP_ALIGNMENT   ((int)(sizeof(void*)))
 
 /* Local definitions */
-#define EC_POOL_SIZE       (10)  /* num of points into the pool */
+#define EC_POOL_SIZE       (10)  /* max num of points held from the thread pool */
 
 #define EC_MONT_POOL_SIZE   (4)  /* num of temp values for modular arithmetic */
 
@@ -167,7 +166,6 @@ typedef struct _cpGFpEC {
 #define ECP_G(pCtx)           ((pCtx)->pG)
 #define ECP_PREMULBP(pCtx)    ((pCtx)->pBaseTbl)
 #define ECP_MONT_R(pCtx)      ((pCtx)->pMontR)
-#define ECP_POOL(pCtx)        ((pCtx)->pPool)
 #if defined(_LEGACY_ECCP_SUPPORT_)
    #define ECP_PUBLIC(pCtx)   ((pCtx)->pPublic)
    #define ECP_PUBLIC_E(pCtx) ((pCtx)->pPublicE)
@@ -203,17 +201,15 @@ const cpPrecompAP* gfpec_precom_nistP521r1_fun(void);
 const cpPrecompAP* gfpec_precom_sm2_fun(void);
 
 /*
-// get/release n points from/to the pool
+// get/release n points from/to the thread pool
 */
 __INLINE BNU_CHUNK_T* cpEcGFpGetPool(int n, IppsGFpECState* pEC)
 {
-   BNU_CHUNK_T* pPool = ECP_POOL(pEC);
-   ECP_POOL(pEC) += n*GFP_FELEN(GFP_PMA(ECP_GFP(pEC)))*3;
-   return pPool;
+   return gsThreadPoolAlloc(n*GFP_FELEN(GFP_PMA(ECP_GFP(pEC)))*3);
 }
 __INLINE void cpEcGFpReleasePool(int n, IppsGFpECState* pEC)
 {
-   ECP_POOL(pEC) -= n*GFP_FELEN(GFP_PMA(ECP_GFP(pEC)))*3;
+   gsThreadPoolFree(n*GFP_FELEN(GFP_PMA(ECP_GFP(pEC)))*3);
 }
 
 __INLINE IppsGFpECPoint* cpEcGFpInitPoint(IppsGFpECPoint* pPoint, BNU_CHUNK_T* pData, int flags, const IppsGFpECState* pEC)
@@ -291,6 +287,117 @@ void    gfec_base_point_mul  (BNU_CHUNK_T* pRdata, const Ipp8u* pScalarB, int sc
 void    setupTable           (BNU_CHUNK_T* pTbl,
                         const BNU_CHUNK_T* pPdata, IppsGFpECState* pEC);
 
+/*
+// GLV endomorphism phi(x,y) = (beta*x,y) = [lambda]*(x,y) of a curve
+// y^2 = x^3 + b, and a short basis (a1,-b1), (a2,b2) of the lattice
+// {(x,y): x+y*lambda = 0 (mod order)} that splits scalars in halves
+*/
+typedef struct _cpGFpECGLV {
+   IppCtxId    idCtx;   /* GLV identifier                  */
+   int       elemLen;   /* length of beta                  */
+   int      orderLen;   /* length of a1, a2, b1, b2        */
+   int      halfBits;   /* bound of the bitsize of halves  */
+} cpGFpECGLV;
+
+/* data: beta, a1, a2, b1, b2 (orderLen), g1, g2 (orderLen+1) */
+#define GLV_CTX(ptr)       ((cpGFpECGLV*)( IPP_ALIGNED_PTR((ptr), CACHE_LINE_SIZE) ))
+#define GLV_ID(pCtx)       ((pCtx)->idCtx)
+#define GLV_ELEMLEN(pCtx)  ((pCtx)->elemLen)
+#define GLV_ORDERLEN(pCtx) ((pCtx)->orderLen)
+#define GLV_HALFBITS(pCtx) ((pCtx)->halfBits)
+#define GLV_BETA(pCtx)     ((BNU_CHUNK_T*)((pCtx)+1))
+#define GLV_A1(pCtx)       (GLV_BETA(pCtx)+GLV_ELEMLEN(pCtx))
+#define GLV_A2(pCtx)       (GLV_A1(pCtx)+GLV_ORDERLEN(pCtx))
+#define GLV_B1(pCtx)       (GLV_A2(pCtx)+GLV_ORDERLEN(pCtx))
+#define GLV_B2(pCtx)       (GLV_B1(pCtx)+GLV_ORDERLEN(pCtx))
+#define GLV_G1(pCtx)       (GLV_B2(pCtx)+GLV_ORDERLEN(pCtx))
+#define GLV_G2(pCtx)       (GLV_G1(pCtx)+GLV_ORDERLEN(pCtx)+1)
+#define GLV_TEST_ID(pCtx)  (GLV_ID((pCtx))==idCtxGFPECGLV)
+
+/* max length of the order and of the temporaries of the split */
+#define GLV_MAX_LEN        (BITS_BNU_CHUNK(GFP_MAX_BITSIZE)+2)
+
+/* the GLV context was set up for the curve */
+__INLINE int gfec_GLVMatch(const cpGFpECGLV* pGLV, IppsGFpECState* pEC)
+{
+   return GLV_TEST_ID(pGLV)
+       && GLV_ELEMLEN(pGLV)==GFP_FELEN(GFP_PMA(ECP_GFP(pEC)))
+       && GLV_ORDERLEN(pGLV)==MOD_LEN(ECP_MONT_R(pEC));
+}
+
+/* R = phi(P) */
+__INLINE void gfec_GLVMap(BNU_CHUNK_T* pRdata, const BNU_CHUNK_T* pPdata,
+                          const cpGFpECGLV* pGLV, IppsGFpECState* pEC)
+{
+   gsModEngine* pGFE = GFP_PMA(ECP_GFP(pEC));
+   int elemLen = GFP_FELEN(pGFE);
+   GFP_METHOD(pGFE)->mul(pRdata, pPdata, GLV_BETA(pGLV), pGFE);
+   cpGFpElementCopy(pRdata+elemLen, pPdata+elemLen, 2*elemLen);
+}
+
+/* K = (-1)^neg1*K1 + (-1)^neg2*K2*lambda (mod order), constant time */
+#define gfec_GLVSplit         OWNAPI(gfec_GLVSplit)
+void    gfec_GLVSplit        (BNU_CHUNK_T* pK1, BNU_CHUNK_T* pK2, BNU_CHUNK_T* pNeg,
+                        const BNU_CHUNK_T* pK, const cpGFpECGLV* pGLV);
+
+/*
+// GLS endomorphism psi(x,y) = (conj(x)*fx, conj(y)*fy) of the sextic twist
+// over GF(q^2) of a BN curve of parameter t. psi raises the points of the
+// prime order n to the power lambda = 6*t^2, and the lattice
+// {(x0,x1,x2,x3): x0+x1*lambda+x2*lambda^2+x3*lambda^3 = 0 (mod n)}
+// has a basis of entries of the size of t that splits scalars in quarters
+*/
+typedef struct _cpGFpECGLS {
+   IppCtxId    idCtx;   /* GLS identifier                          */
+   int       elemLen;   /* length of fx, fy                        */
+   int      orderLen;   /* length of n, |t| and the basis          */
+   int          tNeg;   /* t is negative                           */
+   int   quarterBits;   /* bound of the bitsize of quarters        */
+   int     bNeg[4*4];   /* signs of the entries of the basis       */
+   int       gNeg[4];   /* signs of the rounding factors           */
+} cpGFpECGLS;
+
+/* data: fx, fy (elemLen), n, |t|, basis (orderLen), g (orderLen+1) */
+#define GLS_CTX(ptr)       ((cpGFpECGLS*)( IPP_ALIGNED_PTR((ptr), CACHE_LINE_SIZE) ))
+#define GLS_ID(pCtx)       ((pCtx)->idCtx)
+#define GLS_ELEMLEN(pCtx)  ((pCtx)->elemLen)
+#define GLS_ORDERLEN(pCtx) ((pCtx)->orderLen)
+#define GLS_TNEG(pCtx)     ((pCtx)->tNeg)
+#define GLS_QUARTERBITS(pCtx) ((pCtx)->quarterBits)
+#define GLS_BNEG(pCtx,i,j) ((pCtx)->bNeg[4*(i)+(j)])
+#define GLS_GNEG(pCtx,j)   ((pCtx)->gNeg[(j)])
+#define GLS_FX(pCtx)       ((BNU_CHUNK_T*)((pCtx)+1))
+#define GLS_FY(pCtx)       (GLS_FX(pCtx)+GLS_ELEMLEN(pCtx))
+#define GLS_ORDER(pCtx)    (GLS_FY(pCtx)+GLS_ELEMLEN(pCtx))
+#define GLS_T(pCtx)        (GLS_ORDER(pCtx)+GLS_ORDERLEN(pCtx))
+#define GLS_B(pCtx,i,j)    (GLS_T(pCtx)+GLS_ORDERLEN(pCtx)*(1+4*(i)+(j)))
+#define GLS_G(pCtx,j)      (GLS_B(pCtx,4,0)+(GLS_ORDERLEN(pCtx)+1)*(j))
+#define GLS_TEST_ID(pCtx)  (GLS_ID((pCtx))==idCtxGFPECGLS)
+
+/* max length of the temporaries of the GLS context */
+#define GLS_MAX_LEN        (BITS_BNU_CHUNK(GFP_MAX_BITSIZE)+2)
+
+/* the GLS context was set up for the curve */
+__INLINE int gfec_GLSMatch(const cpGFpECGLS* pGLS, IppsGFpECState* pEC)
+{
+   return GLS_TEST_ID(pGLS)
+       && GLS_ELEMLEN(pGLS)==GFP_FELEN(GFP_PMA(ECP_GFP(pEC)));
+}
+
+/* R = psi(P), (X:Y:Z) -> (conj(X)*fx : conj(Y)*fy : conj(Z)) */
+__INLINE void gfec_GLSMap(BNU_CHUNK_T* pRdata, const BNU_CHUNK_T* pPdata,
+                          const cpGFpECGLS* pGLS, IppsGFpECState* pEC)
+{
+   gsModEngine* pGFE = GFP_PMA(ECP_GFP(pEC));
+   int elemLen = GFP_FELEN(pGFE);
+   mod_mul mulF = GFP_METHOD(pGFE)->mul;
+   cpGFpxConj(pRdata, pPdata, pGFE);
+   cpGFpxConj(pRdata+elemLen, pPdata+elemLen, pGFE);
+   cpGFpxConj(pRdata+2*elemLen, pPdata+2*elemLen, pGFE);
+   mulF(pRdata, pRdata, GLS_FX(pGLS), pGFE);
+   mulF(pRdata+elemLen, pRdata+elemLen, GLS_FY(pGLS), pGFE);
+}
+
 
 /* size of context */
 #define cpGFpECGetSize OWNAPI(cpGFpECGetSize)
@@ -96,9 +96,7 @@ typedef struct _cpGFp {
 #define GFP_MNT_RR(pCtx)      MOD_MNT_R2((pCtx))
 #define GFP_HMODULUS(pCtx)    MOD_HMODULUS((pCtx))
 #define GFP_QNR(pCtx)         MOD_QNR((pCtx))
-#define GFP_POOL(pCtx)        MOD_POOL_BUF((pCtx))
 #define GFP_MAXPOOL(pCtx)     MOD_MAXPOOL((pCtx))
-#define GFP_USEDPOOL(pCtx)    MOD_USEDPOOL((pCtx))
 
 #define GFP_IS_BASIC(pCtx)    (GFP_PARENT((pCtx))==NULL)
 #define GFP_TEST_ID(pCtx)     (GFP_ID((pCtx))==idCtxGFP)
@@ -209,7 +207,7 @@ __INLINE IppsGFpElement* cpGFpElementConstruct(IppsGFpElement* pR, BNU_CHUNK_T*
 
 /* size of GFp context, init and setup */
 #define cpGFpGetSize OWNAPI(cpGFpGetSize)
-int     cpGFpGetSize(int feBitSize, int peBitSize, int numpe);
+int     cpGFpGetSize(int feBitSize);
 
 #define   cpGFpInitGFp OWNAPI(cpGFpInitGFp)
 IppStatus cpGFpInitGFp(int primeBitSize, IppsGFpState* pGF);
@@ -85,9 +85,7 @@ void InitGFpxCtx(const IppsGFpState* pGroundGF, int extDeg, const IppsGFpMethod*
       GFP_PELEN(pGFEx)     = elemLen;
       GFP_METHOD(pGFEx)    = method->arith;
       GFP_MODULUS(pGFEx)   = (BNU_CHUNK_T*)(ptr);  ptr += elemLen * sizeof(BNU_CHUNK_T);  /* field polynomial */
-      GFP_POOL(pGFEx)      = (BNU_CHUNK_T*)(ptr);                                         /* pool */
       GFP_MAXPOOL(pGFEx)   = GFPX_POOL_SIZE;
-      GFP_USEDPOOL(pGFEx)  = 0;
 
       cpGFpElementPadd(GFP_MODULUS(pGFEx), elemLen, 0);
    }
@@ -0,0 +1,453 @@
+/*******************************************************************************
+* Copyright 2010-2018 Intel Corporation
+* All Rights Reserved.
+*
+* If this  software was obtained  under the  Intel Simplified  Software License,
+* the following terms apply:
+*
+* The source code,  information  and material  ("Material") contained  herein is
+* owned by Intel Corporation or its  suppliers or licensors,  and  title to such
+* Material remains with Intel  Corporation or its  suppliers or  licensors.  The
+* Material  contains  proprietary  information  of  Intel or  its suppliers  and
+* licensors.  The Material is protected by  worldwide copyright  laws and treaty
+* provisions.  No part  of  the  Material   may  be  used,  copied,  reproduced,
+* modified, published,  uploaded, posted, transmitted,  distributed or disclosed
+* in any way without Intel's prior express written permission.  No license under
+* any patent,  copyright or other  intellectual property rights  in the Material
+* is granted to  or  conferred  upon  you,  either   expressly,  by implication,
+* inducement,  estoppel  or  otherwise.  Any  license   under such  intellectual
+* property rights must be express and approved by Intel in writing.
+*
+* Unless otherwise agreed by Intel in writing,  you may not remove or alter this
+* notice or  any  other  notice   embedded  in  Materials  by  Intel  or Intel's
+* suppliers or licensors in any way.
+*
+*
+* If this  software  was obtained  under the  Apache License,  Version  2.0 (the
+* "License"), the following terms apply:
+*
+* You may  not use this  file except  in compliance  with  the License.  You may
+* obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+*
+*
+* Unless  required  by   applicable  law  or  agreed  to  in  writing,  software
+* distributed under the License  is distributed  on an  "AS IS"  BASIS,  WITHOUT
+* WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*
+* See the   License  for the   specific  language   governing   permissions  and
+* limitations under the License.
+*******************************************************************************/
+
+
+/*
+//
+//  Purpose:
+//     Intel(R) Integrated Performance Primitives. Cryptography Primitives.
+//     Operations over GF(p) extension.
+//
+//     Context:
+//        ippsGFpxCyclotomicCombTableGetSize()
+//        ippsGFpxCyclotomicCombTableInit()
+//        ippsGFpxCyclotomicMultiExpComb()
+//
+*/
+
+#include "owndefs.h"
+#include "owncp.h"
+#include "pcpbn.h"
+#include "pcpgfpstuff.h"
+#include "pcpgfpxstuff.h"
+#include "pcpgfpxmethod_com.h"
+#include "pcpgfpxmethod_binom_epid2.h"
+
+/* number of teeth of the comb */
+#define COMB_TEETH      (5)
+
+/* number of elements of the table: products of the non-empty subsets of the teeth */
+#define COMB_TBL_ELEMS  ((1<<COMB_TEETH)-1)
+
+/*
+// The table starts with the distance between the teeth of the comb in
+// bits, followed by the elements.
+*/
+#define COMB_TBL_HEADER (1)
+
+/* distance between the teeth of a comb for exponents of up to expBits bits */
+__INLINE int cpCombSpacing(int expBits)
+{
+   return (expBits+COMB_TEETH-1)/COMB_TEETH;
+}
+
+/* bit pos of the exponent, 0 past its end */
+__INLINE int cpCombExpBit(const BNU_CHUNK_T* pE, int len, int pos)
+{
+   int idx = pos/BNU_CHUNK_BITS;
+   return (idx<len)? (int)((pE[idx]>>(pos%BNU_CHUNK_BITS)) & 1) : 0;
+}
+
+/*
+// Tests that pGFE is GF(((p^2)^3)^2) of Intel(R) EPID 2.0, i.e. that its
+// arithmetic and the one of GF((p^2)^3) are the Intel(R) EPID 2.0 ones.
+*/
+static int cpIsEpid2Fq12(const gsModEngine* pGFE)
+{
+   const gsModEngine* pGFE6;
+   if(GFP_IS_BASIC(pGFE) || 12!=cpGFpBasicDegreeExtension(pGFE))
+      return 0;
+   pGFE6 = GFP_PARENT(pGFE);
+   return GFP_METHOD(pGFE)==ippsGFpxMethod_binom2_epid2()->arith
+       && GFP_METHOD(pGFE6)==ippsGFpxMethod_binom3_epid2()->arith;
+}
+
+/*
+// Squaring of an element of the cyclotomic subgroup of GF(p^12)
+// (Granger-Scott).
+//
+// GF(p^12) = GF(p^4)[w]/(w^3 -s), GF(p^4) = GF(p^2)[s]/(s^2 -xi), s = w^3,
+// so a = (g0 +h0*w) +(g1 +h1*w)*v +(g2 +h2*w)*v^2 is A +B*w +C*w^2 with
+// A = g0 +h1*s, B = h0 +g2*s and C = g1 +h2*s. If a^(p^4 -p^2 +1) = 1,
+//    a^2 = (3*A^2 -2*conj(A)) +(3*s*C^2 +2*conj(B))*w +(3*B^2 -2*conj(C))*w^2
+// where conj(x0 +x1*s) = x0 -x1*s. Needs 9 squarings over GF(p^2) instead
+// of the 2 multiplications over GF(p^6) of a general squaring.
+*/
+static BNU_CHUNK_T* cpFq12CyclotomicSqr_epid2(BNU_CHUNK_T* pR, const BNU_CHUNK_T* pA, gsModEngine* pGFE)
+{
+   gsModEngine* pGFE2 = GFP_PARENT(GFP_PARENT(pGFE));
+   mod_sqr sqrF = GFP_METHOD(pGFE2)->sqr;
+   mod_add addF = GFP_METHOD(pGFE2)->add;
+   mod_sub subF = GFP_METHOD(pGFE2)->sub;
+   int termLen = GFP_FELEN(pGFE2);
+
+   const BNU_CHUNK_T* g0 = pA;
+   const BNU_CHUNK_T* g1 = pA+termLen;
+   const BNU_CHUNK_T* g2 = pA+termLen*2;
+   const BNU_CHUNK_T* h0 = pA+termLen*3;
+   const BNU_CHUNK_T* h1 = pA+termLen*4;
+   const BNU_CHUNK_T* h2 = pA+termLen*5;
+
+   /* squares of A, B and C: x0 +x1*s => (x0^2 +xi*x1^2) +2*x0*x1*s */
+   BNU_CHUNK_T* t = cpGFpGetPool(9, pGFE2);
+   BNU_CHUNK_T* a0 = t;
+   BNU_CHUNK_T* a1 = t+termLen;
+   BNU_CHUNK_T* b0 = t+termLen*2;
+   BNU_CHUNK_T* b1 = t+termLen*3;
+   BNU_CHUNK_T* c0 = t+termLen*4;
+   BNU_CHUNK_T* c1 = t+termLen*5;
+   BNU_CHUNK_T* u0 = t+termLen*6;
+   BNU_CHUNK_T* u1 = t+termLen*7;
+   BNU_CHUNK_T* u2 = t+termLen*8;
+   const BNU_CHUNK_T* pX0[3];
+   const BNU_CHUNK_T* pX1[3];
+   BNU_CHUNK_T* pS0[3];
+   BNU_CHUNK_T* pS1[3];
+   int n;
+   //tbcd: temporary excluded: assert(NULL!=t);
+
+   pX0[0] = g0; pX1[0] = h1; pS0[0] = a0; pS1[0] = a1;
+   pX0[1] = h0; pX1[1] = g2; pS0[1] = b0; pS1[1] = b1;
+   pX0[2] = g1; pX1[2] = h2; pS0[2] = c0; pS1[2] = c1;
+   for(n=0; n<3; n++) {
+      sqrF(u0, pX0[n], pGFE2);            /* u0 = x0^2 */
+      sqrF(u1, pX1[n], pGFE2);            /* u1 = x1^2 */
+      addF(u2, pX0[n], pX1[n], pGFE2);
+      sqrF(u2, u2, pGFE2);                /* u2 = (x0+x1)^2 */
+      subF(u2, u2, u0, pGFE2);
+      subF(pS1[n], u2, u1, pGFE2);        /* s1 = 2*x0*x1 */
+      cpFq2Mul_xi(u1, u1, pGFE2);
+      addF(pS0[n], u0, u1, pGFE2);        /* s0 = x0^2 +xi*x1^2 */
+   }
+
+   /* the GF(p^2) terms of a^2 */
+   cpFq2Mul_xi(c1, c1, pGFE2);
+   {
+      BNU_CHUNK_T* r0 = pR;
+      BNU_CHUNK_T* r1 = pR+termLen;
+      BNU_CHUNK_T* r2 = pR+termLen*2;
+      BNU_CHUNK_T* r3 = pR+termLen*3;
+      BNU_CHUNK_T* r4 = pR+termLen*4;
+      BNU_CHUNK_T* r5 = pR+termLen*5;
+
+      /* 3*x -2*y or 3*x +2*y, computed before any term of R is written */
+      static const int isAdd[6] = {0, 1, 1, 0, 0, 1};
+      const BNU_CHUNK_T* pX[6];
+      const BNU_CHUNK_T* pY[6];
+      BNU_CHUNK_T* pZ[6];
+      pX[0] = a0; pY[0] = g0; pZ[0] = r0;   /* g0' = 3*a0 -2*g0 */
+      pX[1] = a1; pY[1] = h1; pZ[1] = r4;   /* h1' = 3*a1 +2*h1 */
+      pX[2] = c1; pY[2] = h0; pZ[2] = r3;   /* h0' = 3*xi*c1 +2*h0 */
+      pX[3] = c0; pY[3] = g2; pZ[3] = r2;   /* g2' = 3*c0 -2*g2 */
+      pX[4] = b0; pY[4] = g1; pZ[4] = r1;   /* g1' = 3*b0 -2*g1 */
+      pX[5] = b1; pY[5] = h2; pZ[5] = r5;   /* h2' = 3*b1 +2*h2 */
+      for(n=0; n<6; n++) {
+         BNU_CHUNK_T* x = (BNU_CHUNK_T*)pX[n];
+         if(isAdd[n]) addF(u0, x, pY[n], pGFE2);
+         else         subF(u0, x, pY[n], pGFE2);
+         addF(u0, u0, u0, pGFE2);
+         addF(x, u0, x, pGFE2);
+      }
+      for(n=0; n<6; n++)
+         cpGFpElementCopy(pZ[n], pX[n], termLen);
+   }
+
+   cpGFpReleasePool(9, pGFE2);
+   return pR;
+}
+
+/*
+// Fills entry v-1 of the table with the product of the teeth selected by
+// the bits of v, given the teeth in the entries 2^i-1.
+*/
+static void cpCombFillTable(BNU_CHUNK_T* pTbl, gsModEngine* pGFE)
+{
+   mod_mul mulF = GFP_METHOD(pGFE)->mul;
+   int elemLen = GFP_FELEN(pGFE);
+   int v;
+   for(v=1; v<=COMB_TBL_ELEMS; v++) {
+      int low = v & (-v);
+      if(v!=low)
+         mulF(pTbl+(v-1)*elemLen, pTbl+(v-low-1)*elemLen, pTbl+(low-1)*elemLen, pGFE);
+   }
+}
+
+/*F*
+// Name: ippsGFpxCyclotomicCombTableGetSize
+//
+// Purpose: Gets the size of the comb table of an element of the
+//          cyclotomic subgroup of GF(p^12)
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr               pGFp == NULL
+//                                   pSize == NULL
+//
+//    ippStsContextMatchErr          invalid pGFp->idCtx
+//
+//    ippStsBadArgErr                pGFp is not GF(((p^2)^3)^2) set up by
+//                                   ippsGFpxMethod_binom2_epid2() over
+//                                   ippsGFpxMethod_binom3_epid2()
+//
+//    ippStsNoErr                    no error
+//
+// Parameters:
+//    pGFp            Pointer to the context of the finite field
+//    pSize           Pointer to the size of the table in bytes
+//
+*F*/
+
+IPPFUN(IppStatus, ippsGFpxCyclotomicCombTableGetSize,(const IppsGFpState* pGFp, int* pSize))
+{
+   IPP_BAD_PTR2_RET(pGFp, pSize);
+   pGFp = (IppsGFpState*)( IPP_ALIGNED_PTR(pGFp, GFP_ALIGNMENT) );
+   IPP_BADARG_RET( !GFP_TEST_ID(pGFp), ippStsContextMatchErr );
+   IPP_BADARG_RET( !cpIsEpid2Fq12(GFP_PMA(pGFp)), ippStsBadArgErr );
+
+   {
+      int elemDataSize = GFP_FELEN(GFP_PMA(pGFp))*sizeof(BNU_CHUNK_T);
+
+      *pSize = COMB_TBL_HEADER*sizeof(BNU_CHUNK_T) + COMB_TBL_ELEMS*elemDataSize + CACHE_LINE_SIZE;
+      return ippStsNoErr;
+   }
+}
+
+/*F*
+// Name: ippsGFpxCyclotomicCombTableInit
+//
+// Purpose: Pre-computes the comb table of an element of the cyclotomic
+//          subgroup of GF(p^12) for ippsGFpxCyclotomicMultiExpComb
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr               pA == NULL
+//                                   pTable == NULL
+//                                   pGFp == NULL
+//
+//    ippStsContextMatchErr          invalid pGFp->idCtx
+//                                   invalid pA->idCtx
+//
+//    ippStsOutOfRangeErr            GFPE_ROOM(pA)!=GFP_FELEN()
+//
+//    ippStsBadArgErr                pGFp is not GF(((p^2)^3)^2) set up by
+//                                   ippsGFpxMethod_binom2_epid2() over
+//                                   ippsGFpxMethod_binom3_epid2()
+//                                   expBits < 1
+//
+//    ippStsNoErr                    no error
+//
+// Parameters:
+//    pA              Pointer to the context of the element
+//    expBits         Max bit size of the exponents the table is used with
+//    pTable          Pointer to the table of ippsGFpxCyclotomicCombTableGetSize() bytes
+//    pGFp            Pointer to the context of the finite field
+//
+//  Note:
+//    A must be in the cyclotomic subgroup, i.e. A^(p^4 -p^2 +1) = 1, as
+//    the outputs of the final exponentiation of a pairing are. The
+//    squarings of the table are done by the Granger-Scott formula, which
+//    gives wrong results for other elements. This is not checked.
+//    Tooth i of the comb is A^(2^(d*i)), i = 0,...,4, where d is expBits
+//    divided by 5 and rounded up. Entry v-1 of the table holds the
+//    product of the teeth selected by the bits of v, v = 1,...,31.
+//
+*F*/
+
+IPPFUN(IppStatus, ippsGFpxCyclotomicCombTableInit,(const IppsGFpElement* pA, int expBits, Ipp8u* pTable, IppsGFpState* pGFp))
+{
+   IPP_BAD_PTR3_RET(pA, pTable, pGFp);
+   pGFp = (IppsGFpState*)( IPP_ALIGNED_PTR(pGFp, GFP_ALIGNMENT) );
+   IPP_BADARG_RET( !GFP_TEST_ID(pGFp), ippStsContextMatchErr );
+   IPP_BADARG_RET( !cpIsEpid2Fq12(GFP_PMA(pGFp)), ippStsBadArgErr );
+   IPP_BADARG_RET( 1>expBits, ippStsBadArgErr);
+
+   IPP_BADARG_RET( !GFPE_TEST_ID(pA), ippStsContextMatchErr );
+   IPP_BADARG_RET( GFPE_ROOM(pA)!=GFP_FELEN(GFP_PMA(pGFp)), ippStsOutOfRangeErr);
+
+   {
+      gsModEngine* pGFE = GFP_PMA(pGFp);
+      int elemLen = GFP_FELEN(pGFE);
+      int spacing = cpCombSpacing(expBits);
+      BNU_CHUNK_T* pTbl = (BNU_CHUNK_T*)IPP_ALIGNED_PTR(pTable, CACHE_LINE_SIZE);
+      int i, n;
+
+      pTbl[0] = (BNU_CHUNK_T)spacing;
+      pTbl += COMB_TBL_HEADER;
+
+      /* tooth i = (tooth i-1)^(2^d) */
+      cpGFpElementCopy(pTbl, GFPE_DATA(pA), elemLen);
+      for(i=1; i<COMB_TEETH; i++) {
+         BNU_CHUNK_T* pTooth = pTbl+((1<<i)-1)*elemLen;
+         cpGFpElementCopy(pTooth, pTbl+((1<<(i-1))-1)*elemLen, elemLen);
+         for(n=0; n<spacing; n++)
+            cpFq12CyclotomicSqr_epid2(pTooth, pTooth, pGFE);
+      }
+      cpCombFillTable(pTbl, pGFE);
+
+      return ippStsNoErr;
+   }
+}
+
+/*F*
+// Name: ippsGFpxCyclotomicMultiExpComb
+//
+// Purpose: Computes A_0^E_0 * ... * A_(count-1)^E_(count-1) given the
+//          comb tables of the elements
+//
+// Returns:                   Reason:
+//    ippStsNullPtrErr               ppTable == NULL
+//                                   ppE == NULL
+//                                   pR == NULL
+//                                   pGFp == NULL
+//                                   any ppTable[i] == NULL
+//                                   any ppE[i] == NULL
+//
+//    ippStsContextMatchErr          invalid pGFp->idCtx
+//                                   invalid ppE[i]->idCtx
+//                                   invalid pR->idCtx
+//
+//    ippStsOutOfRangeErr            GFPE_ROOM(pR)!=GFP_FELEN()
+//
+//    ippStsBadArgErr                pGFp is not GF(((p^2)^3)^2) set up by
+//                                   ippsGFpxMethod_binom2_epid2() over
+//                                   ippsGFpxMethod_binom3_epid2()
+//                                   count < 1
+//                                   ppE[i] is negative
+//                                   ppE[i] has more bits than ppTable[i] is set up for
+//
+//    ippStsNoErr                    no error
+//
+// Parameters:
+//    ppTable         Array of pointers to the tables set up by ippsGFpxCyclotomicCombTableInit()
+//    ppE             Array of pointers to the Big Number contexts of the exponents
+//    count           Number of tables and exponents
+//    pR              Pointer to the context of the resulting element of the finite field
+//    pGFp            Pointer to the context of the finite field
+//
+//  Note:
+//    needs d-1 cyclotomic squarings shared by all elements and at most d
+//    multiplications per element, where d is the largest distance between
+//    the teeth. The table lookups depend on the values of the exponents,
+//    so the function must not be used with secret exponents.
+//
+*F*/
+
+IPPFUN(IppStatus, ippsGFpxCyclotomicMultiExpComb,(const Ipp8u* const ppTable[],
+                                                  const IppsBigNumState* const ppE[],
+                                                  int count,
+                                                  IppsGFpElement* pR,
+                                                  IppsGFpState* pGFp))
+{
+   IPP_BAD_PTR4_RET(ppTable, ppE, pR, pGFp);
+   pGFp = (IppsGFpState*)( IPP_ALIGNED_PTR(pGFp, GFP_ALIGNMENT) );
+   IPP_BADARG_RET( !GFP_TEST_ID(pGFp), ippStsContextMatchErr );
+   IPP_BADARG_RET( !cpIsEpid2Fq12(GFP_PMA(pGFp)), ippStsBadArgErr );
+   IPP_BADARG_RET( 1>count, ippStsBadArgErr);
+
+   IPP_BADARG_RET( !GFPE_TEST_ID(pR), ippStsContextMatchErr );
+   IPP_BADARG_RET( GFPE_ROOM(pR)!=GFP_FELEN(GFP_PMA(pGFp)), ippStsOutOfRangeErr);
+
+   {
+      gsModEngine* pGFE = GFP_PMA(pGFp);
+      mod_mul mulF = GFP_METHOD(pGFE)->mul;
+      int elemLen = GFP_FELEN(pGFE);
+      int spacing = 0;
+      int isOne = 1;
+      BNU_CHUNK_T* pRdata;
+      int i, j, k;
+
+      for(j=0; j<count; j++) {
+         const IppsBigNumState* pE = ppE[j];
+         BNU_CHUNK_T* pExp;
+         int nsExp;
+
+         IPP_BAD_PTR2_RET(ppTable[j], pE);
+         pE = (IppsBigNumState*)( IPP_ALIGNED_PTR(pE, BN_ALIGNMENT) );
+         IPP_BADARG_RET(!BN_VALID_ID(pE), ippStsContextMatchErr );
+         IPP_BADARG_RET( BN_NEGATIVE(pE), ippStsBadArgErr );
+
+         pExp = BN_NUMBER(pE);
+         nsExp = BN_SIZE(pE);
+         {
+            const BNU_CHUNK_T* pTbl = (const BNU_CHUNK_T*)IPP_ALIGNED_PTR(ppTable[j], CACHE_LINE_SIZE);
+            int tblSpacing = (int)pTbl[0];
+            FIX_BNU(pExp, nsExp);
+            IPP_BADARG_RET( BITSIZE_BNU(pExp, nsExp)>COMB_TEETH*tblSpacing, ippStsBadArgErr);
+            if(tblSpacing>spacing)
+               spacing = tblSpacing;
+         }
+      }
+
+      pRdata = cpGFpGetPool(1, pGFE);
+      //tbcd: temporary excluded: assert(NULL!=pRdata);
+
+      for(k=spacing-1; k>=0; k--) {
+         if(!isOne)
+            cpFq12CyclotomicSqr_epid2(pRdata, pRdata, pGFE);
+         for(j=0; j<count; j++) {
+            const IppsBigNumState* pE = (IppsBigNumState*)( IPP_ALIGNED_PTR(ppE[j], BN_ALIGNMENT) );
+            const BNU_CHUNK_T* pExp = BN_NUMBER(pE);
+            int nsExp = BN_SIZE(pE);
+            const BNU_CHUNK_T* pTbl = (const BNU_CHUNK_T*)IPP_ALIGNED_PTR(ppTable[j], CACHE_LINE_SIZE);
+            int tblSpacing = (int)pTbl[0];
+            int v = 0;
+            if(k<tblSpacing) {
+               for(i=0; i<COMB_TEETH; i++)
+                  v |= cpCombExpBit(pExp, nsExp, i*tblSpacing+k)<<i;
+            }
+            if(v) {
+               const BNU_CHUNK_T* pEntry = pTbl+COMB_TBL_HEADER+(v-1)*elemLen;
+               if(isOne)
+                  cpGFpElementCopy(pRdata, pEntry, elemLen);
+               else
+                  mulF(pRdata, pRdata, pEntry, pGFE);
+               isOne = 0;
+            }
+         }
+      }
+
+      /* R = 1 if all exponents are 0 */
+      if(isOne)
+         cpGFpElementCopyPadd(pRdata, elemLen, GFP_MNT_R(cpGFpBasic(pGFE)), GFP_FELEN(cpGFpBasic(pGFE)));
+
+      cpGFpElementCopy(GFPE_DATA(pR), pRdata, elemLen);
+
+      cpGFpReleasePool(1, pGFE);
+      return ippStsNoErr;
+   }
+}
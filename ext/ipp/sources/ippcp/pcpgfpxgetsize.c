@@ -54,14 +54,13 @@
 #include "pcptool.h"
 
 /* Get context size */
-static int cpGFExGetSize(int elemLen, int pelmLen, int numpe)
+static int cpGFExGetSize(int elemLen)
 {
    int ctxSize = 0;
 
-   /* size of GFp engine */
+   /* size of GFp engine (temporaries come from the thread pool) */
    ctxSize = sizeof(gsModEngine)
-            + elemLen*sizeof(BNU_CHUNK_T)    /* modulus  */
-            + pelmLen*sizeof(BNU_CHUNK_T)*numpe; /* pool */
+            + elemLen*sizeof(BNU_CHUNK_T);   /* modulus  */
 
    ctxSize = sizeof(IppsGFpState)   /* size of IppsGFPState*/
            + ctxSize;               /* GFpx engine */
@@ -101,7 +100,7 @@ IPPFUN(IppStatus, ippsGFpxGetSize, (const IppsGFpState* pGroundGF, int degree, i
       *pSize = 0;
       IPP_BADARG_RET(elmLen64> MAX_GFx_SIZE, ippStsBadArgErr);
 
-      *pSize = cpGFExGetSize(elemLen, elemLen, GFPX_POOL_SIZE)
+      *pSize = cpGFExGetSize(elemLen)
              + GFP_ALIGNMENT;
       return ippStsNoErr;
    }
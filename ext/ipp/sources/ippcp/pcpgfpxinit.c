@@ -78,6 +78,8 @@
 //                               cpID_Poly!=pGFpMethod->modulusID  -- method does not refferenced to polynomial one
 //                               pGFpMethod->modulusBitDeg!=extDeg -- fixed method does not match to degree extension
 //
+//    ippStsNoMemErr             temporaries of GF(p^d) exceed the thread pool
+//
 //    ippStsNoErr                no error
 //
 // Parameters:
@@ -110,6 +112,10 @@ IPPFUN(IppStatus, ippsGFpxInit,(const IppsGFpState* pGroundGF, int extDeg,
    /* test if method is fixed polynomial based */
    IPP_BADARG_RET(pGFpMethod->modulusBitDeg && (pGFpMethod->modulusBitDeg!=extDeg), ippStsBadArgErr);
 
+   /* test if nested temporaries of the extension fit the thread pool */
+   IPP_BADARG_RET(gsModPoolNeed(GFP_PMA(pGroundGF))
+                  +GFPX_POOL_SIZE*extDeg*GFP_FELEN(GFP_PMA(pGroundGF)) > GS_THREAD_POOL_LEN, ippStsNoMemErr);
+
    InitGFpxCtx(pGroundGF, extDeg, pGFpMethod, pGFpx);
 
    {
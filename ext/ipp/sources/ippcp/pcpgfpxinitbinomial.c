@@ -76,6 +76,8 @@
 //                               cpID_Poly!=pGFpMethod->modulusID  -- method does not refferenced to polynomial one
 //                               pGFpMethod->modulusBitDeg!=extDeg -- fixed method does not match to degree extension
 //
+//    ippStsNoMemErr             temporaries of GF(p^d) exceed the thread pool
+//
 //    ippStsNoErr                no error
 //
 // Parameters:
@@ -107,6 +109,10 @@ IPPFUN(IppStatus, ippsGFpxInitBinomial,(const IppsGFpState* pGroundGF, int extDe
    /* test if method assums fixed degree extension */
    IPP_BADARG_RET(pGFpMethod->modulusBitDeg && (extDeg!=pGFpMethod->modulusBitDeg), ippStsBadArgErr);
 
+   /* test if nested temporaries of the extension fit the thread pool */
+   IPP_BADARG_RET(gsModPoolNeed(GFP_PMA(pGroundGF))
+                  +GFPX_POOL_SIZE*extDeg*GFP_FELEN(GFP_PMA(pGroundGF)) > GS_THREAD_POOL_LEN, ippStsNoMemErr);
+
    /* init context */
    InitGFpxCtx(pGroundGF, extDeg, pGFpMethod, pGFpx);
 